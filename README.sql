@@ -1,5 +1,5 @@
-snmptrapd MySQL Logging
------------------------
+snmptrapd SQL Logging
+---------------------
 
 A trap handler for logging traps to a MySQL database was added
 in release 5.5.0.
@@ -25,5 +25,26 @@ periodic flush interval:
 A value of 0 for sqlSaveInterval will completely disable MySQL
 logging of traps.
 
+Queued traps are written by a separate thread, where available, so
+the database does not hold up the reception of traps.  Each flush
+inserts the traps, and their varbinds, with multi-row INSERTs and
+commits once per batch:
+
+	# traps per INSERT statement and transaction (default 100)
+	sqlBatchSize 100
+
+	# traps waiting for the database beyond which further traps
+	# are logged as text instead (default 10000)
+	sqlQueueLimit 10000
+
+Traps can also be logged to an SQLite database file, which is handy
+for testing and benchmarking without a MySQL server.  Build with
+--with-sqlite and add:
+
+	sqliteDatabase /var/net-snmp/traps.db
+
+The tables are created when the file is opened, using the same
+column names as the MySQL schema.
+
 The schema must be loaded into MySQL before running snmptrapd.
 The schema can be found in dist/schema-snmptrapd.sql
@@ -26,6 +26,7 @@
 #include <net-snmp/agent/net-snmp-agent-includes.h>
 
 #include <net-snmp/agent/bulk_to_next.h>
+#include <net-snmp/agent/agent_workers.h>
 
 netsnmp_feature_child_of(agent_handler, libnetsnmpagent);
 
@@ -628,6 +629,10 @@ netsnmp_call_handlers(netsnmp_handler_registration *reginfo,
         request->processed = 0;
     }
 
+    if ((reginfo->modes & HANDLER_CAN_THREADSAFE) &&
+        netsnmp_agent_workers_dispatch(reginfo, reqinfo, requests))
+        return SNMP_ERR_NOERROR;
+
     status = netsnmp_call_handler(reginfo->handler, reginfo, reqinfo, requests);
 
     return status;
@@ -109,6 +109,7 @@
 #include <net-snmp/agent/table_iterator.h>
 #include <net-snmp/agent/table_data.h>
 #include <net-snmp/agent/table_dataset.h>
+#include <net-snmp/agent/agent_workers.h>
 #include "agent_module_includes.h"
 #include "mib_module_includes.h"
 
@@ -283,6 +284,9 @@ init_agent_read_config(const char *app)
     netsnmp_ds_register_config(ASN_INTEGER, app, "avgBulkVarbindSize",
                                NETSNMP_DS_APPLICATION_ID,
                                NETSNMP_DS_AGENT_AVG_BULKVARBINDSIZE);
+    netsnmp_ds_register_config(ASN_INTEGER, app, "agentWorkerThreads",
+                               NETSNMP_DS_APPLICATION_ID,
+                               NETSNMP_DS_AGENT_WORKER_THREADS);
 #ifndef NETSNMP_NO_PDU_STATS
     netsnmp_ds_register_config(ASN_INTEGER, app, "pduStatsMax",
                                NETSNMP_DS_APPLICATION_ID,
@@ -306,6 +310,8 @@ update_config(void)
 {
     snmp_call_callbacks(SNMP_CALLBACK_APPLICATION,
                         SNMPD_CALLBACK_PRE_UPDATE_CONFIG, NULL);
+    /* worker jobs refer to the registrations free_config() removes */
+    netsnmp_agent_workers_drain();
     free_config();
     read_configs();
 }
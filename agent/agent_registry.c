@@ -281,6 +281,384 @@ clear_lookup_cache(void) {
 /**  @} */
 /* End of Lookup cache code */
 
+/** @defgroup agent_subtree_index Subtree index, for fast OID lookups.
+ *     Maintain a sorted per-context index of the top-level subtree list,
+ *     so that locating the subtree covering an OID takes a logarithmic
+ *     number of comparisons rather than a walk of every registration.
+ *   @ingroup agent_registry
+ *
+ * The index of a context is a skip list keyed on the start OID of each
+ * top-level subtree.  It is built from the list of subtrees the first time
+ * a context is searched, and from then on it is updated in place by the
+ * code that links subtrees into the list or removes them from it.
+ *
+ * @{
+ */
+
+#define SUBTREE_INDEX_MAX_LEVEL 16
+
+typedef struct subtree_index_node_s {
+   netsnmp_subtree *subtree;
+   struct subtree_index_node_s *forward[1];  /* level entries */
+} subtree_index_node;
+
+typedef struct subtree_index_context_s {
+   char *context;
+   struct subtree_index_context_s *next;
+   int level;
+   size_t count;
+   subtree_index_node *head;
+} subtree_index_context;
+
+static subtree_index_context *thecontextindex = NULL;
+
+/** @private
+ *  Allocates a skip list node of the given level.
+ */
+static subtree_index_node *
+subtree_index_node_new(netsnmp_subtree *s, int level) {
+    subtree_index_node *node;
+
+    node = calloc(1, sizeof(*node) + (level - 1) * sizeof(node->forward[0]));
+    if (node)
+        node->subtree = s;
+    return node;
+}
+
+/** @private
+ *  Picks the level of a new node: each level is a quarter as likely as
+ *  the one below it.
+ */
+static int
+subtree_index_random_level(void) {
+    static uint32_t seed = 2463534242U;
+    int level = 1;
+
+    for (;;) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        if ((seed & 3) != 0 || level >= SUBTREE_INDEX_MAX_LEVEL)
+            return level;
+        level++;
+    }
+}
+
+/** @private
+ *  Fills update[] with, for every level, the last node whose subtree
+ *  starts before the given OID.
+ *
+ *  @return the first node at the bottom level not starting before the OID.
+ */
+static subtree_index_node *
+subtree_index_search(subtree_index_context *idx, const oid *name,
+                     size_t name_len, subtree_index_node **update) {
+    subtree_index_node *x = idx->head, *n;
+    int i;
+
+    for (i = idx->level - 1; i >= 0; i--) {
+        while ((n = x->forward[i]) != NULL &&
+               snmp_oid_compare(n->subtree->start_a, n->subtree->start_len,
+                                name, name_len) < 0)
+            x = n;
+        if (update)
+            update[i] = x;
+    }
+    return x->forward[0];
+}
+
+/** @private
+ *  Adds a top-level subtree to an index, or replaces the entry that
+ *  starts at the same OID.
+ */
+static int
+subtree_index_add(subtree_index_context *idx, netsnmp_subtree *s) {
+    subtree_index_node *update[SUBTREE_INDEX_MAX_LEVEL], *node;
+    int level, i;
+
+    node = subtree_index_search(idx, s->start_a, s->start_len, update);
+    if (node && snmp_oid_compare(node->subtree->start_a,
+                                 node->subtree->start_len,
+                                 s->start_a, s->start_len) == 0) {
+        node->subtree = s;
+        return SNMPERR_SUCCESS;
+    }
+
+    level = subtree_index_random_level();
+    node = subtree_index_node_new(s, level);
+    if (!node)
+        return SNMPERR_MALLOC;
+    for (i = idx->level; i < level; i++)
+        update[i] = idx->head;
+    if (level > idx->level)
+        idx->level = level;
+    for (i = 0; i < level; i++) {
+        node->forward[i] = update[i]->forward[i];
+        update[i]->forward[i] = node;
+    }
+    idx->count++;
+    return SNMPERR_SUCCESS;
+}
+
+/** @private
+ *  Looks for the index entry of a subtree.
+ *
+ *  @return the node, or NULL if this subtree is not in the index.
+ */
+static subtree_index_node *
+subtree_index_lookup(subtree_index_context *idx, const netsnmp_subtree *s,
+                     subtree_index_node **update) {
+    subtree_index_node *node;
+
+    if (!s->start_a)
+        return NULL;
+    node = subtree_index_search(idx, s->start_a, s->start_len, update);
+    return (node && node->subtree == s) ? node : NULL;
+}
+
+/** @private
+ *  Removes a subtree from an index, if it is there.
+ */
+static void
+subtree_index_del(subtree_index_context *idx, const netsnmp_subtree *s) {
+    subtree_index_node *update[SUBTREE_INDEX_MAX_LEVEL], *node;
+    int i;
+
+    node = subtree_index_lookup(idx, s, update);
+    if (!node)
+        return;
+    for (i = 0; i < idx->level && update[i]->forward[i] == node; i++)
+        update[i]->forward[i] = node->forward[i];
+    while (idx->level > 1 && idx->head->forward[idx->level - 1] == NULL)
+        idx->level--;
+    idx->count--;
+    free(node);
+}
+
+/** @private
+ *  Frees every entry of an index.
+ */
+static void
+subtree_index_empty(subtree_index_context *idx) {
+    subtree_index_node *node, *next;
+
+    if (!idx->head)
+        return;
+    for (node = idx->head->forward[0]; node; node = next) {
+        next = node->forward[0];
+        free(node);
+    }
+    memset(idx->head->forward, 0,
+           SUBTREE_INDEX_MAX_LEVEL * sizeof(idx->head->forward[0]));
+    idx->level = 1;
+    idx->count = 0;
+}
+
+/** @private
+ *  Returns the subtree index of the given context, if it has been built.
+ */
+static subtree_index_context *
+find_context_subtree_index(const char *context) {
+    subtree_index_context *ptr;
+
+    if (!context)
+        context = "";
+
+    for (ptr = thecontextindex; ptr; ptr = ptr->next) {
+        if (strcmp(ptr->context, context) == 0)
+            return ptr;
+    }
+    return NULL;
+}
+
+/** @private
+ *  Returns the subtree index for the given context, building it from the
+ *  list of subtrees on first use.
+ *
+ *  @param context Name of the context. Name is case sensitive.
+ *
+ *  @return the subtree index, or NULL if the context has no subtrees or
+ *          the index could not be allocated.
+ */
+static subtree_index_context *
+get_context_subtree_index(const char *context) {
+    subtree_index_node *tail[SUBTREE_INDEX_MAX_LEVEL], *node;
+    subtree_index_context *ptr;
+    netsnmp_subtree *s;
+    int level, i;
+
+    if (!context)
+        context = "";
+
+    if ((ptr = find_context_subtree_index(context)) != NULL)
+        return ptr;
+
+    s = netsnmp_subtree_find_first(context);
+    if (!s)
+        return NULL;
+
+    ptr = SNMP_MALLOC_TYPEDEF(subtree_index_context);
+    if (!ptr)
+        return NULL;
+    ptr->context = strdup(context);
+    ptr->head = subtree_index_node_new(NULL, SUBTREE_INDEX_MAX_LEVEL);
+    ptr->level = 1;
+    if (!ptr->context || !ptr->head) {
+        SNMP_FREE(ptr->context);
+        SNMP_FREE(ptr->head);
+        free(ptr);
+        return NULL;
+    }
+
+    /* The list is already sorted, so simply append to every level. */
+    DEBUGMSGTL(("subtree:index", "building index for context: \"%s\"\n",
+                context));
+    for (i = 0; i < SUBTREE_INDEX_MAX_LEVEL; i++)
+        tail[i] = ptr->head;
+    for (; s; s = s->next) {
+        level = subtree_index_random_level();
+        node = subtree_index_node_new(s, level);
+        if (!node) {
+            subtree_index_empty(ptr);
+            free(ptr->head);
+            free(ptr->context);
+            free(ptr);
+            return NULL;
+        }
+        if (level > ptr->level)
+            ptr->level = level;
+        for (i = 0; i < level; i++) {
+            tail[i]->forward[i] = node;
+            tail[i] = node;
+        }
+        ptr->count++;
+    }
+
+    ptr->next = thecontextindex;
+    thecontextindex = ptr;
+    return ptr;
+}
+
+/** @private
+ *  Throws away the index of one context; it is rebuilt on next use.
+ */
+static void
+subtree_index_drop(subtree_index_context *idx) {
+    subtree_index_context **pp;
+
+    for (pp = &thecontextindex; *pp; pp = &(*pp)->next) {
+        if (*pp == idx) {
+            *pp = idx->next;
+            break;
+        }
+    }
+    subtree_index_empty(idx);
+    SNMP_FREE(idx->head);
+    SNMP_FREE(idx->context);
+    SNMP_FREE(idx);
+}
+
+/** @private
+ *  Records that a subtree has been linked into the top level of the
+ *  given context.
+ */
+static void
+subtree_index_insert(netsnmp_subtree *s, const char *context) {
+    subtree_index_context *idx = find_context_subtree_index(context);
+
+    if (idx && s && subtree_index_add(idx, s) != SNMPERR_SUCCESS) {
+        /* Drop the index rather than keep an incomplete one. */
+        subtree_index_drop(idx);
+    }
+}
+
+/** @private
+ *  Records that a subtree has taken the place of another one at the top
+ *  level of the given context.
+ */
+static void
+subtree_index_replace(netsnmp_subtree *old_sub, netsnmp_subtree *new_sub,
+                      const char *context) {
+    subtree_index_context *idx = find_context_subtree_index(context);
+    subtree_index_node *node;
+
+    if (!idx)
+        return;
+    if ((node = subtree_index_lookup(idx, old_sub, NULL)) != NULL &&
+        new_sub && snmp_oid_compare(old_sub->start_a, old_sub->start_len,
+                                    new_sub->start_a,
+                                    new_sub->start_len) == 0) {
+        node->subtree = new_sub;
+        return;
+    }
+    subtree_index_del(idx, old_sub);
+    subtree_index_insert(new_sub, context);
+}
+
+/** @private
+ *  Records that a subtree has been split, new_sub being linked in
+ *  right after current.  Only matters if current is at the top level.
+ */
+static void
+subtree_index_split(netsnmp_subtree *current, netsnmp_subtree *new_sub) {
+    subtree_index_context *idx;
+
+    for (idx = thecontextindex; idx; idx = idx->next) {
+        if (subtree_index_lookup(idx, current, NULL)) {
+            if (subtree_index_add(idx, new_sub) != SNMPERR_SUCCESS)
+                subtree_index_drop(idx);
+            return;
+        }
+    }
+}
+
+/** @private
+ *  Removes a subtree from whichever index it is in.
+ */
+static void
+subtree_index_remove(const netsnmp_subtree *s) {
+    subtree_index_context *idx;
+
+    for (idx = thecontextindex; idx; idx = idx->next)
+        subtree_index_del(idx, s);
+}
+
+/** @private
+ *  Finds the last top-level subtree starting at or before the given OID.
+ *
+ *  @param idx      Subtree index to search.
+ *
+ *  @param name     The OID we're searching for.
+ *
+ *  @param name_len Number of sub-ids (single integers) in the OID.
+ *
+ *  @return the subtree, or NULL if the OID precedes every registration.
+ */
+static netsnmp_subtree *
+subtree_index_find_prev(const subtree_index_context *idx,
+                        const oid *name, size_t name_len) {
+    const subtree_index_node *x = idx->head, *n;
+    int i;
+
+    for (i = idx->level - 1; i >= 0; i--) {
+        while ((n = x->forward[i]) != NULL &&
+               snmp_oid_compare(n->subtree->start_a, n->subtree->start_len,
+                                name, name_len) <= 0)
+            x = n;
+    }
+    return x->subtree;
+}
+
+static void
+clear_subtree_index(void) {
+
+    while (thecontextindex)
+	subtree_index_drop(thecontextindex);
+}
+
+/**  @} */
+/* End of Subtree index code */
+
 /** @defgroup agent_context_cache Context cache, storing the OIDs under their contexts.
  *     Maintain the cache used for locating sub-trees registered under different contexts.
  *   @ingroup agent_registry
@@ -379,6 +757,7 @@ netsnmp_remove_subtree(netsnmp_subtree *tree)
 
     if (tree->next)
         tree->next->prev = tree->prev;
+    subtree_index_remove(tree);
 }
 
 /** Replaces first subtree registered under given context name.
@@ -424,6 +803,7 @@ clear_context(void) {
 
     DEBUGMSGTL(("agent_registry", "clear context\n"));
 
+    clear_subtree_index();
     ptr = get_top_context_cache(); 
     while (ptr) {
 	next = ptr->next;
@@ -466,6 +846,7 @@ void
 netsnmp_subtree_free(netsnmp_subtree *a)
 {
   if (a != NULL) {
+    subtree_index_remove(a);
     if (a->variables != NULL && netsnmp_oid_equals(a->name_a, a->namelen, 
 					     a->start_a, a->start_len) == 0) {
       SNMP_FREE(a->variables);
@@ -742,6 +1123,7 @@ netsnmp_subtree_split(netsnmp_subtree *current, oid name[], int name_len)
     for (ptr = new_sub->next; ptr != NULL; ptr=ptr->children) {
         netsnmp_subtree_change_prev(ptr, new_sub);
     }
+    subtree_index_split(current, new_sub);
 
     return new_sub;
 }
@@ -826,6 +1208,7 @@ netsnmp_subtree_load(netsnmp_subtree *new_sub, const char *context_name)
 	    }
 
             netsnmp_subtree_change_next(new_sub, tree2);
+            subtree_index_insert(new_sub, context_name);
 
 #if 0
             /* The code below cannot be reached which is why it has been
@@ -930,6 +1313,8 @@ netsnmp_subtree_load(netsnmp_subtree *new_sub, const char *context_name)
 		for (prev = new_sub->prev; prev != NULL;prev = prev->children){
                     netsnmp_subtree_change_next(prev, new_sub);
 		}
+                subtree_index_replace(new_sub->children, new_sub,
+                                      context_name);
 	    }
 	    break;
 
@@ -978,6 +1363,7 @@ netsnmp_subtree_find_prev(const oid *name, size_t len, netsnmp_subtree *subtree,
 			  const char *context_name)
 {
     lookup_cache *lookup_cache = NULL;
+    subtree_index_context *idx;
     netsnmp_subtree *myptr = NULL, *previous = NULL;
     int cmp = 1;
     size_t ll_off = 0;
@@ -986,7 +1372,9 @@ netsnmp_subtree_find_prev(const oid *name, size_t len, netsnmp_subtree *subtree,
         myptr = subtree;
     } else {
 	/* look through everything */
-        if (lookup_cache_size) {
+        if ((idx = get_context_subtree_index(context_name)) != NULL) {
+            return subtree_index_find_prev(idx, name, len);
+        } else if (lookup_cache_size) {
             lookup_cache = lookup_cache_find(context_name, name, len, &cmp);
             if (lookup_cache) {
                 myptr = lookup_cache->next;
@@ -1637,6 +2025,7 @@ netsnmp_subtree_unload(netsnmp_subtree *sub, netsnmp_subtree *prev, const char *
 	if (sub->prev == NULL) {
 	    netsnmp_subtree_replace_first(sub->next, context);
 	}
+        subtree_index_replace(sub, NULL, context);
 
     } else {
         for (ptr = sub->prev; ptr; ptr = ptr->children)
@@ -1647,6 +2036,7 @@ netsnmp_subtree_unload(netsnmp_subtree *sub, netsnmp_subtree *prev, const char *
 	if (sub->prev == NULL) {
 	    netsnmp_subtree_replace_first(sub->children, context);
 	}
+        subtree_index_replace(sub, sub->children, context);
     }
     invalidate_lookup_cache(context);
 }
@@ -1705,8 +2095,7 @@ unregister_mib_context(oid * name, size_t len, int priority,
         DEBUGMSGOIDRANGE(("register_mib", name, len, range_subid, range_ubound));
         DEBUGMSG(("register_mib", "\n"));
 
-        list = netsnmp_subtree_find(name, len, netsnmp_subtree_find_first(context),
-                    context);
+        list = netsnmp_subtree_find(name, len, NULL, context);
         if (list == NULL) {
             return MIB_NO_SUCH_REGISTRATION;
         }
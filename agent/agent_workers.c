@@ -0,0 +1,569 @@
+/*
+ * agent_workers.c
+ *
+ * A pool of worker threads that handlers registered with
+ * HANDLER_CAN_THREADSAFE are called from, so that a slow handler no
+ * longer stalls every other request the agent is processing.
+ *
+ * The pool is disabled unless the library was built with
+ * --enable-reentrant and the "agentWorkerThreads" token is set to a
+ * positive value.  All other handlers keep being called on the main
+ * thread.
+ */
+/** @defgroup agent_workers Worker threads for thread-safe handlers
+ *     Call thread-safe handlers from a pool of worker threads.
+ *   @ingroup agent
+ *
+ * When a GET, GETNEXT or GETBULK request reaches a handler registration
+ * whose modes include HANDLER_CAN_THREADSAFE, netsnmp_call_handlers()
+ * hands the requests to netsnmp_agent_workers_dispatch().  The requests
+ * are marked as delegated and queued for a worker thread, which calls the
+ * handler chain with a private copy of the agent request info and of the
+ * request structures.  The copies are not delegated, so helpers such as
+ * the table, instance and scalar group helpers post-process the results
+ * exactly as they do on the main thread.  When the worker is done it
+ * queues the job for completion and wakes the main thread through a pipe
+ * registered with the fd event manager; the main thread then copies the
+ * results back into the original requests, clears the delegated flags,
+ * and the regular delegated request processing
+ * (netsnmp_check_outstanding_agent_requests()) finishes the PDU.
+ *
+ * The job queues are protected by the MT_LIB_AGENT_WORKERS lock of
+ * mt_support.  Idle workers block reading a pipe that gets one byte per
+ * queued job, so no condition variables are needed.
+ *
+ * The original requests are only ever changed on the main thread, so the
+ * main thread never looks at request data a worker is still writing.  A
+ * handler that declares itself thread-safe must not touch agent global
+ * state (other registrations, the session list, ...) without its own
+ * locking, and must not delegate its requests itself.
+ *
+ * @{
+ */
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-features.h>
+
+#include <errno.h>
+#if HAVE_STRING_H
+#include <string.h>
+#endif
+#if HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#if HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#if HAVE_SYS_SELECT_H
+#include <sys/select.h>
+#endif
+
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/agent/net-snmp-agent-includes.h>
+#include <net-snmp/agent/agent_workers.h>
+
+#if defined(NETSNMP_REENTRANT) && defined(HAVE_PTHREAD_H) && defined(HAVE_UNISTD_H)
+#define NETSNMP_AGENT_WORKERS 1
+#endif
+
+#ifdef NETSNMP_AGENT_WORKERS
+
+/** Upper limit for the agentWorkerThreads token. */
+#define AGENT_WORKERS_MAX 64
+
+typedef struct agent_worker_job_s {
+    netsnmp_handler_registration *reginfo;
+    netsnmp_agent_request_info reqinfo;   /* private copy for the worker */
+    netsnmp_request_info *requests;
+    netsnmp_request_info *shadow;         /* private copies of requests */
+    netsnmp_agent_session *asp;
+    struct agent_worker_job_s *next;
+} agent_worker_job;
+
+typedef struct agent_worker_queue_s {
+    agent_worker_job *head;
+    agent_worker_job *tail;
+} agent_worker_queue;
+
+static pthread_t      *workers;
+static int             workers_count;
+static int             workers_wanted;
+static int             workers_stopping;
+static int             workers_pipe[2] = { -1, -1 };   /* wakes the main thread */
+static int             pending_pipe[2] = { -1, -1 };   /* wakes a worker */
+
+static agent_worker_queue workers_pending;   /* waiting for a worker */
+static agent_worker_queue workers_running;   /* being processed */
+static agent_worker_queue workers_done;      /* waiting for the main thread */
+
+static void
+_queue_append(agent_worker_queue *q, agent_worker_job *job)
+{
+    job->next = NULL;
+    if (q->tail)
+        q->tail->next = job;
+    else
+        q->head = job;
+    q->tail = job;
+}
+
+static agent_worker_job *
+_queue_shift(agent_worker_queue *q)
+{
+    agent_worker_job *job = q->head;
+
+    if (job) {
+        q->head = job->next;
+        if (!q->head)
+            q->tail = NULL;
+        job->next = NULL;
+    }
+    return job;
+}
+
+static void
+_queue_remove(agent_worker_queue *q, agent_worker_job *job)
+{
+    agent_worker_job *j, *prev = NULL;
+
+    for (j = q->head; j; prev = j, j = j->next) {
+        if (j != job)
+            continue;
+        if (prev)
+            prev->next = j->next;
+        else
+            q->head = j->next;
+        if (q->tail == j)
+            q->tail = prev;
+        j->next = NULL;
+        return;
+    }
+}
+
+static int
+_queue_has_asp(const agent_worker_queue *q, const netsnmp_agent_session *asp)
+{
+    const agent_worker_job *j;
+
+    for (j = q->head; j; j = j->next)
+        if (j->asp == asp)
+            return 1;
+    return 0;
+}
+
+static void
+_pipe_close(int *fds)
+{
+    if (fds[0] >= 0)
+        close(fds[0]);
+    if (fds[1] >= 0)
+        close(fds[1]);
+    fds[0] = fds[1] = -1;
+}
+
+static void
+_pipe_poke(int fd)
+{
+    char            c = 0;
+
+    while (write(fd, &c, 1) < 0 && errno == EINTR)
+        ;
+}
+
+static void
+_job_free(agent_worker_job *job)
+{
+    netsnmp_free_all_list_data(job->reqinfo.agent_data);
+    free(job->shadow);
+    free(job);
+}
+
+/*
+ * Hands a finished job back to the main thread: what the handler chain
+ * did to the private copies is copied into the requests, which stop
+ * being delegated, and the private request info is released.
+ */
+static void
+_job_complete(agent_worker_job *job)
+{
+    netsnmp_request_info *request, *shadow, *next, *prev;
+    netsnmp_agent_request_info *agent_req_info;
+
+    for (request = job->requests, shadow = job->shadow; request;
+         request = next, shadow++) {
+        next = request->next;
+        prev = request->prev;
+        agent_req_info = request->agent_req_info;
+        *request = *shadow;
+        request->next = next;
+        request->prev = prev;
+        request->agent_req_info = agent_req_info;
+        request->delegated = REQUEST_IS_NOT_DELEGATED;
+    }
+    _job_free(job);
+}
+
+/*
+ * Waits on the main thread until no worker is running a job that
+ * matches asp (any job if asp is NULL).  The wakeup bytes read meanwhile
+ * are put back if completed jobs are left for _workers_wakeup().
+ * Called and returns with the workers lock held.
+ */
+static void
+_wait_running(const netsnmp_agent_session *asp)
+{
+    fd_set          readfds;
+    char            buf[64];
+    int             drained = 0;
+
+    while (asp ? _queue_has_asp(&workers_running, asp) :
+           workers_running.head != NULL || workers_pending.head != NULL) {
+        snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+        FD_ZERO(&readfds);
+        FD_SET(workers_pipe[0], &readfds);
+        if (select(workers_pipe[0] + 1, &readfds, NULL, NULL, NULL) > 0)
+            while (read(workers_pipe[0], buf, sizeof(buf)) > 0)
+                drained = 1;
+        snmp_res_lock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+    }
+    if (drained && workers_done.head)
+        _pipe_poke(workers_pipe[1]);
+}
+
+static void *
+_worker_main(void *arg)
+{
+    agent_worker_job *job;
+    char              c;
+    ssize_t           n;
+
+    for (;;) {
+        n = read(pending_pipe[0], &c, 1);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+
+        snmp_res_lock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+        if (workers_stopping) {
+            snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+            break;
+        }
+        /* the job this byte was written for may have been cancelled */
+        job = _queue_shift(&workers_pending);
+        if (job)
+            _queue_append(&workers_running, job);
+        snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+        if (!job)
+            continue;
+
+        DEBUGMSGTL(("agent_workers", "calling %s for asp %p\n",
+                    job->reginfo->handlerName, job->asp));
+        netsnmp_call_handler(job->reginfo->handler, job->reginfo,
+                             &job->reqinfo, job->shadow);
+
+        snmp_res_lock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+        _queue_remove(&workers_running, job);
+        _queue_append(&workers_done, job);
+        _pipe_poke(workers_pipe[1]);
+        snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+    }
+    return NULL;
+}
+
+/*
+ * fd event manager callback, run on the main thread whenever a worker
+ * has finished a job.
+ */
+static void
+_workers_wakeup(int fd, void *data)
+{
+    agent_worker_queue done;
+    agent_worker_job  *job;
+    char               buf[64];
+
+    while (read(fd, buf, sizeof(buf)) > 0)
+        ;
+
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+    done = workers_done;
+    workers_done.head = workers_done.tail = NULL;
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+
+    while ((job = _queue_shift(&done)) != NULL) {
+        DEBUGMSGTL(("agent_workers", "completed %s for asp %p\n",
+                    job->reginfo->handlerName, job->asp));
+        _job_complete(job);
+    }
+}
+
+/*
+ * Starts the threads on the first dispatch rather than in
+ * netsnmp_agent_workers_init(), which runs before snmpd forks into the
+ * background and would leave the daemon without its workers.
+ */
+static int
+_workers_start(void)
+{
+    int             i;
+
+    workers = calloc(workers_wanted, sizeof(*workers));
+    if (!workers) {
+        workers_wanted = 0;
+        return 0;
+    }
+
+    workers_stopping = 0;
+    for (i = 0; i < workers_wanted; i++) {
+        if (pthread_create(&workers[i], NULL, _worker_main, NULL) != 0) {
+            snmp_log(LOG_ERR, "agent workers: could not start thread %d\n", i);
+            break;
+        }
+        workers_count++;
+    }
+    if (workers_count == 0) {
+        /* handlers are called on the main thread from now on */
+        SNMP_FREE(workers);
+        workers_wanted = 0;
+        return 0;
+    }
+
+    DEBUGMSGTL(("agent_workers", "started %d worker threads\n",
+                workers_count));
+    return 1;
+}
+
+#endif /* NETSNMP_AGENT_WORKERS */
+
+/** Prepares the worker threads, if "agentWorkerThreads" asks for any.
+ *  The threads themselves are started when the first request is
+ *  dispatched.  Called from init_master_agent().
+ */
+void
+netsnmp_agent_workers_init(void)
+{
+#ifdef NETSNMP_AGENT_WORKERS
+    int             n;
+
+    if (workers_pipe[0] >= 0)
+        return;
+
+    n = netsnmp_ds_get_int(NETSNMP_DS_APPLICATION_ID,
+                           NETSNMP_DS_AGENT_WORKER_THREADS);
+    if (n <= 0)
+        return;
+    if (n > AGENT_WORKERS_MAX) {
+        snmp_log(LOG_WARNING, "agentWorkerThreads %d too large, using %d\n",
+                 n, AGENT_WORKERS_MAX);
+        n = AGENT_WORKERS_MAX;
+    }
+
+    if (pipe(workers_pipe) < 0 || pipe(pending_pipe) < 0) {
+        snmp_log_perror("agent workers: pipe");
+        goto err;
+    }
+    fcntl(workers_pipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(workers_pipe[1], F_SETFL, O_NONBLOCK);
+    if (register_readfd(workers_pipe[0], _workers_wakeup, NULL) != FD_REGISTERED_OK) {
+        snmp_log(LOG_ERR, "agent workers: could not register wakeup fd\n");
+        goto err;
+    }
+    workers_wanted = n;
+    return;
+
+  err:
+    _pipe_close(workers_pipe);
+    _pipe_close(pending_pipe);
+#endif /* NETSNMP_AGENT_WORKERS */
+}
+
+/** Stops the worker threads.  Jobs that have not been picked up yet are
+ *  completed without calling their handler; their requests are answered
+ *  with whatever the main thread already put in them.
+ */
+void
+netsnmp_agent_workers_shutdown(void)
+{
+#ifdef NETSNMP_AGENT_WORKERS
+    agent_worker_job *job;
+    int               i;
+
+    if (workers_pipe[0] < 0)
+        return;
+
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+    workers_stopping = 1;
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+    /* idle workers see end of file, busy ones the stopping flag */
+    close(pending_pipe[1]);
+    pending_pipe[1] = -1;
+
+    for (i = 0; i < workers_count; i++)
+        pthread_join(workers[i], NULL);
+    SNMP_FREE(workers);
+    workers_count = 0;
+    workers_wanted = 0;
+
+    while ((job = _queue_shift(&workers_pending)) != NULL)
+        _job_complete(job);
+    while ((job = _queue_shift(&workers_done)) != NULL)
+        _job_complete(job);
+
+    unregister_readfd(workers_pipe[0]);
+    _pipe_close(workers_pipe);
+    _pipe_close(pending_pipe);
+#endif /* NETSNMP_AGENT_WORKERS */
+}
+
+/** Returns non-zero if handlers may currently be dispatched to workers. */
+int
+netsnmp_agent_workers_active(void)
+{
+#ifdef NETSNMP_AGENT_WORKERS
+    return workers_wanted > 0;
+#else
+    return 0;
+#endif
+}
+
+/** Queues a handler call for a worker thread.
+ *
+ *  @param reginfo  The registration whose handler chain should be called.
+ *
+ *  @param reqinfo  The agent request info of the calling session.
+ *
+ *  @param requests The requests to pass to the handler chain.
+ *
+ *  @return 1 if the requests were delegated to a worker, 0 if the caller
+ *          has to call the handlers itself.
+ */
+int
+netsnmp_agent_workers_dispatch(netsnmp_handler_registration *reginfo,
+                               netsnmp_agent_request_info *reqinfo,
+                               netsnmp_request_info *requests)
+{
+#ifdef NETSNMP_AGENT_WORKERS
+    agent_worker_job     *job;
+    netsnmp_request_info *request;
+    int                   count, i;
+
+    if (!workers_wanted || !(reginfo->modes & HANDLER_CAN_THREADSAFE))
+        return 0;
+
+    switch (reqinfo->mode) {
+    case MODE_GET:
+    case MODE_GETNEXT:
+    case MODE_GETBULK:
+        break;
+    default:
+        /* SET processing relies on strict ordering across all handlers. */
+        return 0;
+    }
+
+    if (!workers_count && !_workers_start())
+        return 0;
+
+    for (request = requests, count = 0; request; request = request->next)
+        count++;
+
+    job = SNMP_MALLOC_TYPEDEF(agent_worker_job);
+    if (!job)
+        return 0;
+    job->shadow = calloc(count, sizeof(*job->shadow));
+    if (!job->shadow) {
+        free(job);
+        return 0;
+    }
+    job->reginfo = reginfo;
+    job->reqinfo.mode = reqinfo->mode;
+    job->reqinfo.asp = reqinfo->asp;
+    job->requests = requests;
+    job->asp = reqinfo->asp;
+
+    /*
+     * The worker runs the handler chain on copies of the requests that
+     * are not delegated, so that helpers finish their own processing;
+     * only the originals, which the main thread looks at, are delegated.
+     */
+    for (request = requests, i = 0; request; request = request->next, i++) {
+        job->shadow[i] = *request;
+        job->shadow[i].agent_req_info = &job->reqinfo;
+        job->shadow[i].prev = i ? &job->shadow[i - 1] : NULL;
+        job->shadow[i].next = i < count - 1 ? &job->shadow[i + 1] : NULL;
+        request->delegated = REQUEST_IS_DELEGATED;
+    }
+
+    DEBUGMSGTL(("agent_workers", "dispatching %s for asp %p\n",
+                reginfo->handlerName, job->asp));
+
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+    _queue_append(&workers_pending, job);
+    _pipe_poke(pending_pipe[1]);
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+    return 1;
+#else
+    return 0;
+#endif /* NETSNMP_AGENT_WORKERS */
+}
+
+/** Makes sure no worker still references an agent session that is about
+ *  to be freed.  Queued jobs for the session are dropped and jobs being
+ *  processed are waited for.
+ *
+ *  @param asp The agent session being released.
+ */
+void
+netsnmp_agent_workers_cancel(netsnmp_agent_session *asp)
+{
+#ifdef NETSNMP_AGENT_WORKERS
+    agent_worker_job *job, *next;
+
+    if (!workers_count || !asp)
+        return;
+
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+    for (job = workers_pending.head; job; job = next) {
+        next = job->next;
+        if (job->asp == asp) {
+            _queue_remove(&workers_pending, job);
+            _job_free(job);
+        }
+    }
+    _wait_running(asp);
+    for (job = workers_done.head; job; job = next) {
+        next = job->next;
+        if (job->asp == asp) {
+            /* copy back, so the data the handlers attached gets freed */
+            _queue_remove(&workers_done, job);
+            _job_complete(job);
+        }
+    }
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+#endif /* NETSNMP_AGENT_WORKERS */
+}
+
+/** Waits until the workers have finished every job queued so far, and
+ *  completes them.  Called before handler registrations are removed,
+ *  e.g. when the configuration is reloaded, since the jobs refer to them.
+ */
+void
+netsnmp_agent_workers_drain(void)
+{
+#ifdef NETSNMP_AGENT_WORKERS
+    agent_worker_job *job;
+
+    if (!workers_count)
+        return;
+
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+    _wait_running(NULL);
+    while ((job = _queue_shift(&workers_done)) != NULL)
+        _job_complete(job);
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_WORKERS);
+#endif /* NETSNMP_AGENT_WORKERS */
+}
+
+/**  @} */
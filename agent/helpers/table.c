@@ -55,6 +55,7 @@ static void     table_helper_cleanup(netsnmp_agent_request_info *reqinfo,
                                      netsnmp_request_info *request,
                                      int status);
 static void     table_data_free_func(void *data);
+static void     table_data_free_indexes(void *data);
 static int
 sparse_table_helper_handler(netsnmp_mib_handler *handler,
                             netsnmp_handler_registration *reginfo,
@@ -429,7 +430,15 @@ table_helper_handler(netsnmp_mib_handler *handler,
         incomplete = 0;
         tbl_req_info = netsnmp_extract_table_info(request);
         if (NULL == tbl_req_info) {
-            tbl_req_info = SNMP_MALLOC_TYPEDEF(netsnmp_table_request_info);
+            Netsnmp_Free_List_Data *free_func = table_data_free_indexes;
+
+            tbl_req_info = (netsnmp_table_request_info *)
+                netsnmp_arena_alloc(netsnmp_agent_arena(reqinfo),
+                                    sizeof(netsnmp_table_request_info));
+            if (tbl_req_info == NULL) {
+                tbl_req_info = SNMP_MALLOC_TYPEDEF(netsnmp_table_request_info);
+                free_func = table_data_free_func;
+            }
             if (tbl_req_info == NULL) {
                 table_helper_cleanup(reqinfo, request,
                                      SNMP_ERR_GENERR);
@@ -439,10 +448,10 @@ table_helper_handler(netsnmp_mib_handler *handler,
             tbl_req_info->indexes = snmp_clone_varbind(tbl_info->indexes);
             tbl_req_info->number_indexes = 0;       /* none yet */
             netsnmp_request_add_list_data(request,
-                                          netsnmp_create_data_list
-                                          (TABLE_HANDLER_NAME,
+                                          netsnmp_agent_create_list_data
+                                          (reqinfo, TABLE_HANDLER_NAME,
                                            (void *) tbl_req_info,
-                                           table_data_free_func));
+                                           free_func));
         } else {
             DEBUGMSGTL(("helper:table", "  using existing tbl_req_info\n "));
         }
@@ -1114,6 +1123,17 @@ table_data_free_func(void *data)
     free(info);
 }
 
+/** frees the indexes of table request info allocated from an arena */
+static void
+table_data_free_indexes(void *data)
+{
+    netsnmp_table_request_info *info = (netsnmp_table_request_info *) data;
+    if (!info)
+        return;
+    snmp_free_varbind(info->indexes);
+    info->indexes = NULL;
+}
+
 
 
 static void
@@ -0,0 +1,702 @@
+/*
+ * table_cursor.c
+ *
+ * Serve tables from pages of rows fetched on demand, rather than from a
+ * container holding all of them.
+ */
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-features.h>
+
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/agent/net-snmp-agent-includes.h>
+
+#include <net-snmp/agent/table_cursor.h>
+
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+
+#include <net-snmp/agent/table.h>
+#include <net-snmp/library/container.h>
+#include <net-snmp/library/snmp_assert.h>
+
+netsnmp_feature_provide(table_cursor);
+netsnmp_feature_child_of(table_cursor, mib_helpers);
+
+#ifndef NETSNMP_FEATURE_REMOVE_TABLE_CURSOR
+
+/** @defgroup table_cursor table_cursor
+ *  Helps you implement a large table by fetching pages of rows on demand.
+ *  @ingroup table
+ *
+ *  The table_cursor handler is used in conjunction with the
+ *  @link table table@endlink handler, in place of the table_container
+ *  handler, when loading every row of a table in a container on each
+ *  cache expiry is too expensive.
+ *
+ *  The module supplies a fetch function which, given a page, adds the
+ *  rows following the page start to it with
+ *  netsnmp_table_cursor_page_add().  The page only keeps the smallest
+ *  ones, up to its size, so the source needs no particular order and
+ *  memory stays bounded whatever the size of the table.  A source which
+ *  can compute the index of a row cheaply should ask
+ *  netsnmp_table_cursor_page_skip() before building it.  Modules whose
+ *  data access code loads a container can pass
+ *  netsnmp_table_cursor_page_sink() to it instead.
+ *
+ *  The last pages fetched are kept for a timeout, and a GETNEXT whose
+ *  index falls within one is answered from it.  When a walk reaches the
+ *  end of a page, the next one is fetched with twice as many rows, up to
+ *  max_page_rows, so walking the whole table takes few fetches while the
+ *  first GETBULK of a walk only pays for page_rows rows.
+ *
+ *  Found rows are added to the request's data list, where sub-handlers
+ *  find them with netsnmp_table_cursor_row_extract().  The table is read
+ *  only: SET requests are not looked up.
+ *
+ * @{
+ */
+
+/*
+ * A page holds the rows following start (or including it), in index
+ * order.  If more is not set, there are no rows after the last one.
+ */
+struct netsnmp_table_cursor_page_s {
+    netsnmp_table_cursor *cursor;
+
+    oid             start_oids[MAX_OID_LEN];
+    netsnmp_index   start;
+    char            from_first;
+    char            inclusive;
+    char            more;
+
+    void          **rows;
+    size_t          count;
+    size_t          max;
+    size_t          seen;
+
+    struct timeval  loaded;
+
+    struct netsnmp_table_cursor_page_s *next;
+};
+
+static int      _table_cursor_handler(netsnmp_mib_handler *handler,
+                                      netsnmp_handler_registration *reginfo,
+                                      netsnmp_agent_request_info *agtreq_info,
+                                      netsnmp_request_info *requests);
+
+/**********************************************************************
+ *
+ * pages
+ *
+ **********************************************************************/
+static netsnmp_table_cursor_page *
+_page_create(netsnmp_table_cursor *cursor, const netsnmp_index *start,
+             int inclusive, size_t max)
+{
+    netsnmp_table_cursor_page *page;
+
+    page = SNMP_MALLOC_TYPEDEF(netsnmp_table_cursor_page);
+    if (NULL == page)
+        return NULL;
+    page->rows = (void **) calloc(max, sizeof(void *));
+    if (NULL == page->rows) {
+        free(page);
+        return NULL;
+    }
+    page->cursor = cursor;
+    page->max = max;
+    page->start.oids = page->start_oids;
+    if (NULL == start)
+        page->from_first = 1;
+    else {
+        page->start.len = SNMP_MIN(start->len, MAX_OID_LEN);
+        memcpy(page->start_oids, start->oids, page->start.len * sizeof(oid));
+        page->inclusive = inclusive ? 1 : 0;
+    }
+    return page;
+}
+
+static void
+_page_free(netsnmp_table_cursor_page *page)
+{
+    netsnmp_table_cursor *cursor = page->cursor;
+    size_t          i;
+
+    for (i = 0; i < page->count; ++i)
+        cursor->free_row(page->rows[i], cursor->magic);
+    free(page->rows);
+    free(page);
+}
+
+/*
+ * index of the first row whose index is >= (or > if after) key
+ */
+static size_t
+_page_bsearch(netsnmp_table_cursor_page *page, const netsnmp_index *key,
+              int after)
+{
+    size_t          lo = 0, hi = page->count, mid;
+    int             rc;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        rc = netsnmp_compare_netsnmp_index(page->rows[mid], key);
+        if (rc < 0 || (after && 0 == rc))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+int
+netsnmp_table_cursor_page_add(netsnmp_table_cursor_page *page, void *row)
+{
+    netsnmp_table_cursor *cursor = page->cursor;
+    size_t          pos;
+    int             rc;
+
+    ++page->seen;
+
+    if (!page->from_first) {
+        rc = netsnmp_compare_netsnmp_index(row, &page->start);
+        if (rc < 0 || (0 == rc && !page->inclusive)) {
+            cursor->free_row(row, cursor->magic);
+            return 1;
+        }
+    }
+
+    if (page->count == page->max) {
+        page->more = 1;
+        if (netsnmp_compare_netsnmp_index(row,
+                                          page->rows[page->count - 1]) >= 0) {
+            cursor->free_row(row, cursor->magic);
+            return 1;
+        }
+        cursor->free_row(page->rows[--page->count], cursor->magic);
+    }
+
+    pos = _page_bsearch(page, (netsnmp_index *) row, 0);
+    if (pos < page->count &&
+        0 == netsnmp_compare_netsnmp_index(page->rows[pos], row)) {
+        DEBUGMSGTL(("table_cursor", "duplicate row dropped\n"));
+        cursor->free_row(row, cursor->magic);
+        return 1;
+    }
+    memmove(&page->rows[pos + 1], &page->rows[pos],
+            (page->count - pos) * sizeof(void *));
+    page->rows[pos] = row;
+    ++page->count;
+
+    return 0;
+}
+
+int
+netsnmp_table_cursor_page_done(netsnmp_table_cursor_page *page)
+{
+    return page->more;
+}
+
+int
+netsnmp_table_cursor_page_skip(netsnmp_table_cursor_page *page,
+                               const netsnmp_index *index)
+{
+    int             rc;
+
+    if (!page->from_first) {
+        rc = netsnmp_compare_netsnmp_index(index, &page->start);
+        if (rc < 0 || (0 == rc && !page->inclusive)) {
+            ++page->seen;
+            return 1;
+        }
+    }
+
+    if (page->count == page->max &&
+        netsnmp_compare_netsnmp_index(index,
+                                      page->rows[page->count - 1]) >= 0) {
+        ++page->seen;
+        page->more = 1;
+        return 1;
+    }
+
+    return 0;
+}
+
+/*
+ * Does page know about the row with index key (or, if next, the row
+ * following key)?
+ */
+static int
+_page_covers(netsnmp_table_cursor_page *page, const netsnmp_index *key,
+             int next)
+{
+    int             rc;
+
+    if (NULL == key)
+        return page->from_first;
+
+    if (!page->from_first) {
+        rc = netsnmp_compare_netsnmp_index(key, &page->start);
+        if (rc < 0 || (0 == rc && !next && !page->inclusive))
+            return 0;
+    }
+
+    if (!page->more)
+        return 1;
+    if (0 == page->count)
+        return 0;
+    rc = netsnmp_compare_netsnmp_index(key, page->rows[page->count - 1]);
+    return next ? rc < 0 : rc <= 0;
+}
+
+static int
+_page_expired(netsnmp_table_cursor_page *page)
+{
+    return netsnmp_ready_monotonic(&page->loaded,
+                                   1000 * page->cursor->timeout);
+}
+
+/*
+ * drop expired pages, then the least recently used ones, but never the
+ * most recent one, which the last row found comes from. Rows handed to
+ * sub-handlers must stay valid until they are done, so nothing is
+ * dropped while the cursor is pinned.
+ */
+static void
+_pages_trim(netsnmp_table_cursor *cursor)
+{
+    netsnmp_table_cursor_page **pp, *page;
+    int             n = 0;
+
+    if (cursor->pinned)
+        return;
+
+    for (pp = &cursor->pages; (page = *pp) != NULL; ) {
+        if (page != cursor->pages &&
+            (n >= cursor->max_pages || _page_expired(page))) {
+            *pp = page->next;
+            _page_free(page);
+            --cursor->npages;
+        } else {
+            ++n;
+            pp = &page->next;
+        }
+    }
+}
+
+/**********************************************************************
+ *
+ * cursor
+ *
+ **********************************************************************/
+netsnmp_table_cursor *
+netsnmp_table_cursor_create(Netsnmp_Table_Cursor_Fetch *fetch,
+                            Netsnmp_Table_Cursor_Free *free_row, void *magic)
+{
+    netsnmp_table_cursor *cursor;
+
+    if ((NULL == fetch) || (NULL == free_row)) {
+        snmp_log(LOG_ERR, "bad param in netsnmp_table_cursor_create\n");
+        return NULL;
+    }
+
+    cursor = SNMP_MALLOC_TYPEDEF(netsnmp_table_cursor);
+    if (NULL == cursor)
+        return NULL;
+
+    cursor->fetch = fetch;
+    cursor->free_row = free_row;
+    cursor->magic = magic;
+    cursor->page_rows = 32;
+    cursor->max_page_rows = 2048;
+    cursor->max_pages = 4;
+    cursor->timeout = 30;
+
+    return cursor;
+}
+
+void
+netsnmp_table_cursor_invalidate(netsnmp_table_cursor *cursor)
+{
+    netsnmp_table_cursor_page *page;
+
+    if (NULL == cursor)
+        return;
+
+    netsnmp_assert(0 == cursor->pinned);
+    while ((page = cursor->pages) != NULL) {
+        cursor->pages = page->next;
+        _page_free(page);
+    }
+    cursor->npages = 0;
+}
+
+void
+netsnmp_table_cursor_free(netsnmp_table_cursor *cursor)
+{
+    if (NULL == cursor)
+        return;
+
+    netsnmp_table_cursor_invalidate(cursor);
+    free(cursor);
+}
+
+/*
+ * The page to fetch when key is not covered. A GETNEXT continuing from
+ * the last row of a page is walking the table, so read further ahead.
+ */
+static netsnmp_table_cursor_page *
+_page_fetch(netsnmp_table_cursor *cursor, const netsnmp_index *key, int next)
+{
+    netsnmp_table_cursor_page *page;
+    size_t          max = cursor->page_rows;
+    int             rc;
+
+    if (next && key) {
+        for (page = cursor->pages; page; page = page->next) {
+            if (page->more && page->count && !_page_expired(page) &&
+                0 == netsnmp_compare_netsnmp_index(page->rows[page->count - 1],
+                                                   key)) {
+                max = SNMP_MIN(2 * page->max, cursor->max_page_rows);
+                break;
+            }
+        }
+    }
+    if (max < 1)
+        max = 1;
+
+    page = _page_create(cursor, key, !next, max);
+    if (NULL == page)
+        return NULL;
+
+    ++cursor->fetches;
+    rc = cursor->fetch(cursor, page);
+    if (rc) {
+        DEBUGMSGTL(("table_cursor", "fetch failed (%d)\n", rc));
+        _page_free(page);
+        return NULL;
+    }
+    netsnmp_get_monotonic_clock(&page->loaded);
+    cursor->size = page->seen;
+    DEBUGMSGTL(("table_cursor", "fetched %" NETSNMP_PRIz "u of %"
+                NETSNMP_PRIz "u rows%s\n", page->count, page->seen,
+                page->more ? "" : " (end of table)"));
+
+    page->next = cursor->pages;
+    cursor->pages = page;
+    ++cursor->npages;
+
+    return page;
+}
+
+void *
+netsnmp_table_cursor_find(netsnmp_table_cursor *cursor,
+                          const netsnmp_index *key, int next)
+{
+    netsnmp_table_cursor_page **pp, *page;
+    size_t          pos;
+
+    if (NULL == cursor || (NULL == key && !next))
+        return NULL;
+
+    for (pp = &cursor->pages; (page = *pp) != NULL; pp = &page->next) {
+        if (_page_covers(page, key, next) && !_page_expired(page)) {
+            /** move it to the front */
+            *pp = page->next;
+            page->next = cursor->pages;
+            cursor->pages = page;
+            break;
+        }
+    }
+    if (NULL == page) {
+        page = _page_fetch(cursor, key, next);
+        _pages_trim(cursor);
+        if (NULL == page)
+            return NULL;
+    }
+
+    if (NULL == key)
+        return page->count ? page->rows[0] : NULL;
+    pos = _page_bsearch(page, key, next);
+    if (pos == page->count)
+        return NULL;
+    if (!next && netsnmp_compare_netsnmp_index(page->rows[pos], key))
+        return NULL;
+    return page->rows[pos];
+}
+
+/**********************************************************************
+ *
+ * page sink
+ *
+ **********************************************************************/
+typedef struct table_cursor_sink_s {
+    netsnmp_table_cursor_page *page;
+    Netsnmp_Table_Cursor_Convert *convert;
+    void           *magic;
+    size_t          count;
+} table_cursor_sink;
+
+static int
+_sink_insert(netsnmp_container *container, const void *data)
+{
+    table_cursor_sink *sink = (table_cursor_sink *) container->container_data;
+    void           *row;
+
+    ++sink->count;
+    row = sink->convert(NETSNMP_REMOVE_CONST(void *, data), sink->magic);
+    if (row)
+        netsnmp_table_cursor_page_add(sink->page, row);
+    return 0;
+}
+
+static size_t
+_sink_size(netsnmp_container *container)
+{
+    return ((table_cursor_sink *) container->container_data)->count;
+}
+
+static int
+_sink_remove(netsnmp_container *container, const void *data)
+{
+    return -1;
+}
+
+static void *
+_sink_find(netsnmp_container *container, const void *data)
+{
+    return NULL;
+}
+
+static void
+_sink_for_each(netsnmp_container *container, netsnmp_container_obj_func *f,
+               void *context)
+{
+}
+
+static void
+_sink_clear(netsnmp_container *container, netsnmp_container_obj_func *f,
+            void *context)
+{
+    /** the entries are in the page, which is not ours to clear */
+}
+
+static int
+_sink_free(netsnmp_container *container)
+{
+    free(container->container_data);
+    free(container);
+    return 0;
+}
+
+netsnmp_container *
+netsnmp_table_cursor_page_sink(netsnmp_table_cursor_page *page,
+                               Netsnmp_Table_Cursor_Convert *convert,
+                               void *magic)
+{
+    netsnmp_container *c;
+    table_cursor_sink *sink;
+
+    if ((NULL == page) || (NULL == convert))
+        return NULL;
+
+    c = SNMP_MALLOC_TYPEDEF(netsnmp_container);
+    sink = SNMP_MALLOC_TYPEDEF(table_cursor_sink);
+    if ((NULL == c) || (NULL == sink)) {
+        free(c);
+        free(sink);
+        return NULL;
+    }
+    sink->page = page;
+    sink->convert = convert;
+    sink->magic = magic;
+
+    c->container_data = sink;
+    c->get_size = _sink_size;
+    c->cfree = _sink_free;
+    c->insert = _sink_insert;
+    c->remove = _sink_remove;
+    c->find = _sink_find;
+    c->find_next = _sink_find;
+    c->for_each = _sink_for_each;
+    c->clear = _sink_clear;
+    c->compare = netsnmp_compare_netsnmp_index;
+
+    return c;
+}
+
+/**********************************************************************
+ *
+ * handler
+ *
+ **********************************************************************/
+/** returns a netsnmp_mib_handler object for the table_cursor helper */
+netsnmp_mib_handler *
+netsnmp_table_cursor_handler_get(netsnmp_table_registration_info *tabreq,
+                                 netsnmp_table_cursor *cursor)
+{
+    netsnmp_mib_handler *handler;
+
+    if ((NULL == tabreq) || (NULL == cursor)) {
+        snmp_log(LOG_ERR, "bad param in netsnmp_table_cursor_handler_get\n");
+        return NULL;
+    }
+
+    handler = netsnmp_create_handler("table_cursor", _table_cursor_handler);
+    if (NULL == handler) {
+        snmp_log(LOG_ERR,
+                 "malloc failure in netsnmp_table_cursor_handler_get\n");
+        return NULL;
+    }
+    handler->myvoid = cursor;
+
+    return handler;
+}
+
+int
+netsnmp_table_cursor_register(netsnmp_handler_registration *reginfo,
+                              netsnmp_table_registration_info *tabreq,
+                              netsnmp_table_cursor *cursor)
+{
+    netsnmp_mib_handler *handler;
+
+    if ((NULL == reginfo) || (NULL == reginfo->handler) || (NULL == tabreq)) {
+        snmp_log(LOG_ERR, "bad param in netsnmp_table_cursor_register\n");
+        netsnmp_handler_registration_free(reginfo);
+        return SNMPERR_GENERR;
+    }
+
+    handler = netsnmp_table_cursor_handler_get(tabreq, cursor);
+    if (!handler ||
+        (netsnmp_inject_handler(reginfo, handler) != SNMPERR_SUCCESS)) {
+        snmp_log(LOG_ERR, "could not create table cursor handler\n");
+        netsnmp_handler_free(handler);
+        netsnmp_handler_registration_free(reginfo);
+        return MIB_REGISTRATION_FAILED;
+    }
+
+    return netsnmp_register_table(reginfo, tabreq);
+}
+
+void *
+netsnmp_table_cursor_row_extract(netsnmp_request_info *request)
+{
+    return netsnmp_request_get_list_data(request, TABLE_CURSOR_ROW);
+}
+
+/** @cond */
+static void
+_data_lookup(netsnmp_handler_registration *reginfo,
+             netsnmp_agent_request_info *agtreq_info,
+             netsnmp_request_info *request, netsnmp_table_cursor *cursor)
+{
+    netsnmp_table_request_info *tblreq_info;
+    netsnmp_index   index;
+    netsnmp_index  *row = NULL;
+    oid             next_col;
+
+    tblreq_info = netsnmp_extract_table_info(request);
+    netsnmp_assert(NULL != tblreq_info);
+
+    index.oids = tblreq_info->index_oid;
+    index.len = tblreq_info->index_oid_len;
+
+    if ((agtreq_info->mode == MODE_GETNEXT) ||
+        (agtreq_info->mode == MODE_GETBULK)) {
+        row = (netsnmp_index *)
+            netsnmp_table_cursor_find(cursor, tblreq_info->number_indexes ?
+                                      &index : NULL, 1);
+        if (NULL == row && tblreq_info->number_indexes) {
+            /*
+             * end of the column: try the first row of the next one
+             */
+            next_col = netsnmp_table_next_column(tblreq_info);
+            if (0 != next_col) {
+                tblreq_info->colnum = next_col;
+                row = (netsnmp_index *)
+                    netsnmp_table_cursor_find(cursor, NULL, 1);
+            }
+        }
+        if (NULL == row) {
+            netsnmp_set_request_error(agtreq_info, request,
+                                      SNMP_ENDOFMIBVIEW);
+            DEBUGMSGTL(("table_cursor", "no row found\n"));
+            return;
+        }
+        tblreq_info->index_oid_len = row->len;
+        memcpy(tblreq_info->index_oid, row->oids, row->len * sizeof(oid));
+        netsnmp_update_variable_list_from_index(tblreq_info);
+        netsnmp_table_build_oid_from_index(reginfo, request, tblreq_info);
+    } else {
+        row = (netsnmp_index *) netsnmp_table_cursor_find(cursor, &index, 0);
+        if (NULL == row) {
+            netsnmp_set_request_error(agtreq_info, request,
+                                      SNMP_NOSUCHINSTANCE);
+            DEBUGMSGTL(("table_cursor", "no row found\n"));
+            return;
+        }
+    }
+
+    netsnmp_request_add_list_data(request,
+                                  netsnmp_create_data_list(TABLE_CURSOR_ROW,
+                                                           row, NULL));
+}
+
+static int
+_table_cursor_handler(netsnmp_mib_handler *handler,
+                      netsnmp_handler_registration *reginfo,
+                      netsnmp_agent_request_info *agtreq_info,
+                      netsnmp_request_info *requests)
+{
+    netsnmp_table_cursor *cursor;
+    netsnmp_request_info *request;
+    int             rc = SNMP_ERR_NOERROR, oldmode, need_processing = 0;
+
+    netsnmp_assert((NULL != handler) && (NULL != handler->myvoid));
+    cursor = (netsnmp_table_cursor *) handler->myvoid;
+
+    DEBUGMSGTL(("table_cursor", "Mode %s, Got request:\n",
+                se_find_label_in_slist("agent_mode", agtreq_info->mode)));
+
+    oldmode = agtreq_info->mode;
+    if (!MODE_IS_GET(oldmode))
+        return netsnmp_call_next_handler(handler, reginfo, agtreq_info,
+                                         requests);
+
+    /*
+     * keep every page the rows come from until the sub-handlers are done
+     */
+    ++cursor->pinned;
+    for (request = requests; request; request = request->next) {
+        if (request->processed)
+            continue;
+        _data_lookup(reginfo, agtreq_info, request, cursor);
+        if (!request->processed)
+            ++need_processing;
+    }
+
+    if (need_processing && handler->next) {
+        /*
+         * sub-handlers see a GET for the row we found
+         */
+        if (MODE_GETNEXT == oldmode)
+            agtreq_info->mode = MODE_GET;
+        rc = netsnmp_call_next_handler(handler, reginfo, agtreq_info,
+                                       requests);
+        agtreq_info->mode = oldmode;
+    }
+    --cursor->pinned;
+    _pages_trim(cursor);
+
+    return rc;
+}
+/** @endcond */
+
+#else /* NETSNMP_FEATURE_REMOVE_TABLE_CURSOR */
+netsnmp_feature_unused(table_cursor);
+#endif /* NETSNMP_FEATURE_REMOVE_TABLE_CURSOR */
+/** @} */
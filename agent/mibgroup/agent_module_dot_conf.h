@@ -0,0 +1 @@
+/* This file is automatically generated by configure.  Do not modify by hand. */
@@ -0,0 +1,11 @@
+/* This file is automatically generated by configure.  Do not modify by hand. */
+#include "mibgroup/snmpv3/usmConf.h"
+/*#include "mibgroup/agentx/master.h"*/
+/*#include "mibgroup/agentx/subagent.h"*/
+/*#include "mibgroup/utilities/execute.h"*/
+#include "mibgroup/utilities/iquery.h"
+#include "mibgroup/mibII/vacm_conf.h"
+/*#include "mibgroup/agentx/protocol.h"*/
+/*#include "mibgroup/agentx/master_admin.h"*/
+/*#include "mibgroup/agentx/agentx_config.h"*/
+/*#include "mibgroup/agentx/client.h"*/
@@ -27,20 +27,38 @@ netsnmp_feature_child_of(swrun_max_processes, software_running);
 netsnmp_feature_child_of(swrun_count_processes_by_name, software_running);
 netsnmp_feature_child_of(swrun_count_processes_by_regex, software_running);
 
+#define SWRUN_CACHE_TIMEOUT 30
+
+/*
+ * number of processes running each program, by hrSWRunName
+ */
+typedef struct swrun_name_s {
+    char            name[64+1];
+    int             count;
+} swrun_name;
+
 /**---------------------------------------------------------------------*/
 /*
  * local static vars
  */
 static int _swrun_init = 0;
        int _swrun_max  = 0;
+       void (*_swrun_refresh)(netsnmp_swrun_entry *entry, u_char what) = NULL;
+static int _swrun_events = 0;
+static int _swrun_loaded = 0;
 static netsnmp_cache     *swrun_cache     = NULL;
 static netsnmp_container *swrun_container = NULL;
+static netsnmp_container *swrun_names     = NULL;
 
 /*
  * local static prototypes
  */
 static void _swrun_entry_release(netsnmp_swrun_entry * entry,
                                             void *unused);
+static int  _swrun_name_compare(const void *lhs, const void *rhs);
+static void _swrun_name_add(const char *name);
+static void _swrun_name_del(const char *name);
+static void _swrun_names_load(void);
 
 /**
  * initialization
@@ -56,6 +74,11 @@ init_swrun(void)
     _swrun_init = 1;
 
     (void)netsnmp_swrun_container();
+    swrun_names = netsnmp_container_find("swrun_names:binary_array");
+    if (swrun_names) {
+        swrun_names->compare = _swrun_name_compare;
+        swrun_names->container_name = strdup("swrun names");
+    }
     netsnmp_arch_swrun_init();
     (void) netsnmp_swrun_cache();
 }
@@ -83,6 +106,7 @@ swrun_count_processes(int include_kthreads)
 
     it = CONTAINER_ITERATOR( swrun_container );
     while ((entry = (netsnmp_swrun_entry*)ITERATOR_NEXT( it )) != NULL) {
+        netsnmp_swrun_entry_refresh(entry, NETSNMP_SWRUN_STALE_CMDLINE);
         if (4 == entry->hrSWRunType)
             i++;
     }
@@ -117,6 +141,7 @@ swrun_count_processes_by_regex( char *name, netsnmp_regex_ptr regexp )
 
     it = CONTAINER_ITERATOR( swrun_container );
     while ((entry = (netsnmp_swrun_entry*)ITERATOR_NEXT( it )) != NULL) {
+        netsnmp_swrun_entry_refresh(entry, NETSNMP_SWRUN_STALE_CMDLINE);
         /* need to assemble full command back so regexps can get full picture */
         sprintf(fullCommand, "%s %s", entry->hrSWRunPath, entry->hrSWRunParameters);
         found = pcre_exec(regexp.regex_ptr, NULL, fullCommand, strlen(fullCommand), 0, 0, found_ndx, 30);
@@ -135,22 +160,15 @@ swrun_count_processes_by_regex( char *name, netsnmp_regex_ptr regexp )
 int
 swrun_count_processes_by_name( char *name )
 {
-    netsnmp_swrun_entry *entry;
-    netsnmp_iterator  *it;
-    int i = 0;
+    swrun_name *found;
 
     netsnmp_cache_check_and_reload(swrun_cache);
-    if ( !swrun_container || !name )
+    if ( !swrun_names || !name )
         return 0;    /* or -1 */
 
-    it = CONTAINER_ITERATOR( swrun_container );
-    while ((entry = (netsnmp_swrun_entry*)ITERATOR_NEXT( it )) != NULL) {
-        if (0 == strcmp( entry->hrSWRunName, name ))
-            i++;
-    }
-    ITERATOR_RELEASE( it );
+    found = (swrun_name *) CONTAINER_FIND(swrun_names, name);
 
-    return i;
+    return found ? found->count : 0;
 }
 #endif /* NETSNMP_FEATURE_REMOVE_SWRUN_COUNT_PROCESSES_BY_NAME */
 
@@ -162,14 +180,29 @@ swrun_count_processes_by_name( char *name )
 static int
 _cache_load( netsnmp_cache *cache,  void *magic )
 {
+    if (_swrun_events) {
+        /*
+         * once loaded, process events keep the container current
+         */
+        if (_swrun_loaded)
+            return 0;
+        netsnmp_swrun_container_free_items( swrun_container );
+    }
     netsnmp_swrun_container_load( swrun_container, 0 );
+    _swrun_names_load();
+    _swrun_loaded = 1;
     return 0;
 }
 
 static void
 _cache_free( netsnmp_cache *cache,  void *magic )
 {
+    if (_swrun_events)
+        return;     /* rows are removed as processes exit */
     netsnmp_swrun_container_free_items( swrun_container );
+    if (swrun_names)
+        CONTAINER_CLEAR(swrun_names, netsnmp_container_simple_free, NULL);
+    _swrun_loaded = 0;
     return;
 }
 
@@ -183,7 +216,7 @@ netsnmp_swrun_cache(void)
     size_t hrSWRunTable_oid_len = OID_LENGTH(hrSWRunTable_oid);
 
     if ( !swrun_cache ) {
-        swrun_cache = netsnmp_cache_create(30,   /* timeout in seconds */
+        swrun_cache = netsnmp_cache_create(SWRUN_CACHE_TIMEOUT,
                            _cache_load,  _cache_free,
                            hrSWRunTable_oid, hrSWRunTable_oid_len);
         if (swrun_cache)
@@ -343,6 +376,32 @@ netsnmp_swrun_entry_create(int32_t index)
     return entry;
 }
 
+/**
+ * read the attributes of entry that the architecture code only reads
+ * when they are needed.
+ *
+ * @param what NETSNMP_SWRUN_STALE_CMDLINE for hrSWRunPath,
+ *             hrSWRunParameters and hrSWRunType, NETSNMP_SWRUN_STALE_STAT
+ *             for hrSWRunStatus and the perf values, or both.
+ */
+void
+netsnmp_swrun_entry_refresh(netsnmp_swrun_entry *entry, u_char what)
+{
+    if (NULL == entry || NULL == _swrun_refresh)
+        return;
+
+    /*
+     * the perf values were reread with the whole table each time the
+     * cache expired, and now are when they are this old.
+     */
+    if ((what & NETSNMP_SWRUN_STALE_STAT) &&
+        netsnmp_ready_monotonic(&entry->refreshed, SWRUN_CACHE_TIMEOUT * 1000))
+        entry->stale |= NETSNMP_SWRUN_STALE_STAT;
+
+    if (entry->stale & what)
+        (*_swrun_refresh)(entry, entry->stale & what);
+}
+
 /**
  */
 NETSNMP_INLINE void
@@ -358,6 +417,159 @@ netsnmp_swrun_entry_free(netsnmp_swrun_entry * entry)
     free(entry);
 }
 
+/**---------------------------------------------------------------------*/
+/*
+ * process events
+ *
+ * Architectures which learn about process creation and exit from the
+ * kernel keep swrun_container current with these, instead of having it
+ * reloaded each time the cache expires.
+ */
+
+/**
+ * the container is kept current from now on. Once it has been loaded,
+ * expiring the cache no longer reloads it.
+ */
+void
+netsnmp_swrun_events_start(void)
+{
+    DEBUGMSGTL(("swrun:events", "started\n"));
+    _swrun_events = 1;
+}
+
+/**
+ * events were lost: load the whole table again when it is next used
+ */
+void
+netsnmp_swrun_events_lost(void)
+{
+    DEBUGMSGTL(("swrun:events", "lost, reloading\n"));
+    _swrun_loaded = 0;
+    if (swrun_cache)
+        swrun_cache->valid = 0;
+}
+
+/**
+ * 1 if events must be applied, i.e. the container has been loaded
+ */
+int
+netsnmp_swrun_events_active(void)
+{
+    return _swrun_events && _swrun_loaded;
+}
+
+/**
+ * add entry, for a new process, to the container
+ */
+int
+netsnmp_swrun_entry_insert(netsnmp_swrun_entry *entry)
+{
+    if (CONTAINER_INSERT(swrun_container, entry) != 0) {
+        netsnmp_swrun_entry_free(entry);
+        return -1;
+    }
+    _swrun_name_add(entry->hrSWRunName);
+    return 0;
+}
+
+/**
+ * remove the entry of a process which exited
+ */
+void
+netsnmp_swrun_entry_remove(netsnmp_swrun_entry *entry)
+{
+    _swrun_name_del(entry->hrSWRunName);
+    CONTAINER_REMOVE(swrun_container, entry);
+    netsnmp_swrun_entry_free(entry);
+}
+
+/**
+ * change the hrSWRunName of entry, e.g. after an exec
+ */
+void
+netsnmp_swrun_entry_set_name(netsnmp_swrun_entry *entry,
+                             const char *name, size_t len)
+{
+    if (len >= sizeof(entry->hrSWRunName))
+        len = sizeof(entry->hrSWRunName) - 1;
+    if (len == entry->hrSWRunName_len &&
+        0 == memcmp(entry->hrSWRunName, name, len))
+        return;
+
+    _swrun_name_del(entry->hrSWRunName);
+    memcpy(entry->hrSWRunName, name, len);
+    entry->hrSWRunName[len] = '\0';
+    entry->hrSWRunName_len = len;
+    _swrun_name_add(entry->hrSWRunName);
+}
+
+/**---------------------------------------------------------------------*/
+/*
+ * name index
+ */
+/*
+ * names are looked up by the name itself, which swrun_name starts with
+ */
+static int
+_swrun_name_compare(const void *lhs, const void *rhs)
+{
+    return strcmp((const char *) lhs, (const char *) rhs);
+}
+
+static void
+_swrun_name_add(const char *name)
+{
+    swrun_name *found;
+
+    if (NULL == swrun_names)
+        return;
+
+    found = (swrun_name *) CONTAINER_FIND(swrun_names, name);
+    if (found) {
+        found->count++;
+        return;
+    }
+
+    found = SNMP_MALLOC_TYPEDEF(swrun_name);
+    if (NULL == found)
+        return;
+    strlcpy(found->name, name, sizeof(found->name));
+    found->count = 1;
+    if (CONTAINER_INSERT(swrun_names, found) != 0)
+        free(found);
+}
+
+static void
+_swrun_name_del(const char *name)
+{
+    swrun_name *found;
+
+    if (NULL == swrun_names)
+        return;
+
+    found = (swrun_name *) CONTAINER_FIND(swrun_names, name);
+    if (found && --found->count <= 0) {
+        CONTAINER_REMOVE(swrun_names, found);
+        free(found);
+    }
+}
+
+static void
+_swrun_names_load(void)
+{
+    netsnmp_swrun_entry *entry;
+    netsnmp_iterator  *it;
+
+    if (NULL == swrun_names)
+        return;
+
+    CONTAINER_CLEAR(swrun_names, netsnmp_container_simple_free, NULL);
+    it = CONTAINER_ITERATOR( swrun_container );
+    while ((entry = (netsnmp_swrun_entry*)ITERATOR_NEXT( it )) != NULL)
+        _swrun_name_add(entry->hrSWRunName);
+    ITERATOR_RELEASE( it );
+}
+
 /**---------------------------------------------------------------------*/
 /*
  * Utility routines
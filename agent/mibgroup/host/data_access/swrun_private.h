@@ -1,3 +1,23 @@
 extern void netsnmp_arch_swrun_init(void);
 extern int netsnmp_arch_swrun_container_load(netsnmp_container* container,
                                              u_int load_flags);
+
+/*
+ * set by architectures which leave some attributes stale when loading,
+ * to read them on demand
+ */
+extern void (*_swrun_refresh)(netsnmp_swrun_entry *entry, u_char what);
+
+/*
+ * for architectures which keep the container current from process events
+ */
+extern void netsnmp_swrun_events_start(void);
+extern void netsnmp_swrun_events_lost(void);
+extern int  netsnmp_swrun_events_active(void);
+extern netsnmp_swrun_entry *
+            netsnmp_swrun_entry_get_by_index(netsnmp_container *container,
+                                             oid index);
+extern int  netsnmp_swrun_entry_insert(netsnmp_swrun_entry *entry);
+extern void netsnmp_swrun_entry_remove(netsnmp_swrun_entry *entry);
+extern void netsnmp_swrun_entry_set_name(netsnmp_swrun_entry *entry,
+                                         const char *name, size_t len);
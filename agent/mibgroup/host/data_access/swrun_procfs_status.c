@@ -23,17 +23,32 @@
 #ifdef HAVE_LINUX_TASKS_H
 #include <linux/tasks.h>
 #endif
+#if defined(HAVE_LINUX_NETLINK_H) && defined(HAVE_LINUX_CONNECTOR_H) && \
+    defined(HAVE_LINUX_CN_PROC_H)
+#define SWRUN_PROC_EVENTS 1
+#include <errno.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/connector.h>
+#include <linux/cn_proc.h>
+#endif
 
 #include <net-snmp/net-snmp-includes.h>
 #include <net-snmp/agent/net-snmp-agent-includes.h>
 #include <net-snmp/library/container.h>
 #include <net-snmp/library/snmp_debug.h>
 #include <net-snmp/data_access/swrun.h>
+#include "swrun.h"
 #include "swrun_private.h"
 
 static long pagesize;
 static long sc_clk_tck;
 
+static void _swrun_entry_refresh(netsnmp_swrun_entry *entry, u_char what);
+#ifdef SWRUN_PROC_EVENTS
+static void _swrun_events_init(void);
+#endif
+
 /* ---------------------------------------------------------------------
  */
 void
@@ -45,9 +60,202 @@ netsnmp_arch_swrun_init(void)
     
     pagesize = getpagesize();
     sc_clk_tck = sysconf(_SC_CLK_TCK);
+
+    /*
+     * loading only reads hrSWRunName, the other columns are read when
+     * they are asked for
+     */
+    _swrun_refresh = _swrun_entry_refresh;
+#ifdef SWRUN_PROC_EVENTS
+    _swrun_events_init();
+#endif
     return;
 }
 
+/* ---------------------------------------------------------------------
+ */
+
+/*
+ * read the process name into name, which holds size bytes.
+ * Returns its length, or -1 if the process went away.
+ */
+static int
+_swrun_read_name(int pid, char *name, size_t size)
+{
+    FILE                *fp;
+    char                 buf[BUFSIZ], *cp = buf;
+    int                  len;
+
+    snprintf( buf, BUFSIZ, "/proc/%d/comm", pid );
+    fp = fopen( buf, "r" );
+    if (!fp) {
+        /*
+         *   Name:  process name
+         */
+        snprintf( buf, BUFSIZ, "/proc/%d/status", pid );
+        fp = fopen( buf, "r" );
+        if (!fp)
+            return -1; /* file (process) probably went away */
+        memset(buf, 0, sizeof(buf));
+        if (fgets( buf, BUFSIZ-1, fp ) == NULL) {
+            fclose(fp);
+            return -1;
+        }
+        for ( cp = buf; *cp && *cp != ':'; cp++ )
+            ;
+        while (*cp && isspace(*(++cp)))	/* Skip ':' and following spaces */
+            ;
+    } else {
+        memset(buf, 0, sizeof(buf));
+        if (fgets( buf, BUFSIZ-1, fp ) == NULL) {
+            fclose(fp);
+            return -1;
+        }
+    }
+    fclose(fp);
+
+    len = snprintf(name, size, "%s", cp);
+    if (len >= (int)size)
+        len = size - 1;
+    if ( len > 0 && '\n' == name[ len-1 ]) {
+        name[ len-1 ] = '\0';
+        len--;                          /* Stamp on trailing newline */
+    }
+    return len;
+}
+
+static void
+_swrun_read_cmdline(netsnmp_swrun_entry *entry)
+{
+    FILE                *fp;
+    char                 buf[BUFSIZ], *cp;
+    int                  ret;
+
+    entry->hrSWRunPath_len = 0;
+    entry->hrSWRunParameters_len = 0;
+
+    /*
+     *  Command Line:
+     *     argv[0] '\0' argv[1] '\0' ....
+     */
+    snprintf( buf, BUFSIZ, "/proc/%d/cmdline", (int)entry->hrSWRunIndex );
+    fp = fopen( buf, "r" );
+    if (!fp)
+        return; /* file (process) probably went away */
+    entry->hrSWRunType = HRSWRUNTYPE_APPLICATION;
+    memset(buf, 0, sizeof(buf));
+    cp = fgets( buf, BUFSIZ-1, fp );
+    fclose(fp);
+    if (cp != NULL) {
+        /*
+         *     argv[0]   is hrSWRunPath
+         */
+        ret = snprintf(entry->hrSWRunPath, sizeof(entry->hrSWRunPath),
+                       "%s", buf);
+
+        if (ret < sizeof(entry->hrSWRunPath))
+            entry->hrSWRunPath_len = ret;
+        else
+            entry->hrSWRunPath_len = sizeof(entry->hrSWRunPath) - 1;
+
+        /*
+         * Stitch together argv[1..] to construct hrSWRunParameters
+         */
+        for (cp = buf + ret; ! (*cp == '\0' && *(cp + 1) == '\0'); cp++)
+                if (*cp == '\0')
+                        *cp = ' ';
+
+        entry->hrSWRunParameters_len
+            = sprintf(entry->hrSWRunParameters, "%.*s",
+                      (int)sizeof(entry->hrSWRunParameters) - 1,
+                      buf + ret + 1);
+    } else {
+        /* empty /proc/PID/cmdline, it's probably a kernel thread */
+        entry->hrSWRunType = HRSWRUNTYPE_OPERATINGSYSTEM;
+    }
+}
+
+static void
+_swrun_read_stat(netsnmp_swrun_entry *entry)
+{
+    FILE                *fp;
+    int                  i;
+    unsigned long long   cpu;
+    char                 buf[BUFSIZ], *cp, *cp1;
+
+    netsnmp_get_monotonic_clock(&entry->refreshed);
+
+    /*
+     *   {xxx} {xxx} STATUS  {xxx}*10  UTIME STIME  {xxx}*8 RSS
+     */
+    snprintf( buf, BUFSIZ, "/proc/%d/stat", (int)entry->hrSWRunIndex );
+    fp = fopen( buf, "r" );
+    if (!fp) {
+        entry->hrSWRunStatus = HRSWRUNSTATUS_INVALID;
+        return; /* file (process) probably went away */
+    }
+    if (fgets( buf, BUFSIZ-1, fp ) == NULL) {
+        fclose(fp);
+        entry->hrSWRunStatus = HRSWRUNSTATUS_INVALID;
+        return;
+    }
+    fclose(fp);
+
+    cp = buf;
+    while ( ' ' != *(cp++))    /* Skip first field */
+        ;
+    cp1 = cp;                  /* Skip second field */
+    while (*cp1) {
+        if (*cp1 == ')') cp = cp1;
+        cp1++;
+    }
+    cp += 2;
+    
+    switch (*cp) {
+    case 'R':  entry->hrSWRunStatus = HRSWRUNSTATUS_RUNNING;
+               break;
+    case 'S':  entry->hrSWRunStatus = HRSWRUNSTATUS_RUNNABLE;
+               break;
+    case 'D':
+    case 'T':  entry->hrSWRunStatus = HRSWRUNSTATUS_NOTRUNNABLE;
+               break;
+    case 'Z':
+    default:   entry->hrSWRunStatus = HRSWRUNSTATUS_INVALID;
+               break;
+    }
+    for (i=11; i; i--) {   /* Skip STATUS + 10 fields */
+        while (' ' != *(++cp))
+            ;
+        cp++;
+    }
+    cpu  = atol( cp );                     /*  utime */
+    while ( ' ' != *(++cp))
+        ;
+    cpu += atol( cp );                     /* +stime */
+    entry->hrSWRunPerfCPU  = cpu * 100 / sc_clk_tck;
+
+    for (i=9; i; i--) {   /* Skip stime + 8 fields */
+        while (' ' != *(++cp))
+            ;
+        cp++;
+    }
+    entry->hrSWRunPerfMem  = atol( cp );       /* rss   */
+    entry->hrSWRunPerfMem *= (pagesize/1024);  /* in kB */
+}
+
+static void
+_swrun_entry_refresh(netsnmp_swrun_entry *entry, u_char what)
+{
+    DEBUGMSGTL(("swrun:load:arch", "refresh %d (%x)\n",
+                (int)entry->hrSWRunIndex, what));
+
+    if (what & NETSNMP_SWRUN_STALE_CMDLINE)
+        _swrun_read_cmdline(entry);
+    if (what & NETSNMP_SWRUN_STALE_STAT)
+        _swrun_read_stat(entry);
+    entry->stale &= ~what;
+}
+
 /* ---------------------------------------------------------------------
  */
 int
@@ -55,10 +263,7 @@ netsnmp_arch_swrun_container_load( netsnmp_container *container, u_int flags)
 {
     DIR                 *procdir = NULL;
     struct dirent       *procentry_p;
-    FILE                *fp;
-    int                  pid, i, ret;
-    unsigned long long   cpu;
-    char                 buf[BUFSIZ], buf2[BUFSIZ], *cp, *cp1;
+    int                  pid, len;
     netsnmp_swrun_entry *entry;
     
     procdir = opendir("/proc");
@@ -80,144 +285,305 @@ netsnmp_arch_swrun_container_load( netsnmp_container *container, u_int flags)
             continue;   /* error already logged by function */
 
         /*
-         * Now extract the interesting information
-         *   from the various /proc{PID}/ interface files
-         */
-
-        /*
-         *   Name:  process name
+         * Only the name is read now, for swrun_count_processes_by_name().
+         * The other /proc/{PID}/ interface files are read by
+         * _swrun_entry_refresh() when their columns are needed.
          */
-        snprintf( buf2, BUFSIZ, "/proc/%d/status", pid );
-        fp = fopen( buf2, "r" );
-        if (!fp) {
+        len = _swrun_read_name(pid, entry->hrSWRunName,
+                               sizeof(entry->hrSWRunName));
+        if (len < 0) {
             netsnmp_swrun_entry_free(entry);
             continue; /* file (process) probably went away */
-	}
-        memset(buf, 0, sizeof(buf));
-        if (fgets( buf, BUFSIZ-1, fp ) == NULL) {
-            fclose(fp);
-            netsnmp_swrun_entry_free(entry);
-            continue;
         }
-        fclose(fp);
+        entry->hrSWRunName_len = len;
+        entry->stale = NETSNMP_SWRUN_STALE_CMDLINE | NETSNMP_SWRUN_STALE_STAT;
+        CONTAINER_INSERT(container, entry);
+    }
+    closedir( procdir );
 
-        for ( cp = buf; *cp != ':'; cp++ )
-            ;
-        while (isspace(*(++cp)))	/* Skip ':' and following spaces */
-            ;
-        entry->hrSWRunName_len = snprintf(entry->hrSWRunName,
-                                   sizeof(entry->hrSWRunName)-1, "%s", cp);
-        if ( '\n' == entry->hrSWRunName[ entry->hrSWRunName_len-1 ]) {
-            entry->hrSWRunName[ entry->hrSWRunName_len-1 ] = '\0';
-            entry->hrSWRunName_len--;           /* Stamp on trailing newline */
-        }
+    DEBUGMSGTL(("swrun:load:arch"," loaded %" NETSNMP_PRIz "d entries\n",
+                CONTAINER_SIZE(container)));
 
-        /*
-         *  Command Line:
-         *     argv[0] '\0' argv[1] '\0' ....
-         */
-        snprintf( buf2, BUFSIZ, "/proc/%d/cmdline", pid );
-        fp = fopen( buf2, "r" );
-        if (!fp) {
-            netsnmp_swrun_entry_free(entry);
-            continue; /* file (process) probably went away */
-        }
-        entry->hrSWRunType = HRSWRUNTYPE_APPLICATION;
-        memset(buf, 0, sizeof(buf));
-        cp = fgets( buf, BUFSIZ-1, fp );
-        fclose(fp);
-        if (cp != NULL) {
-            /*
-             *     argv[0]   is hrSWRunPath
-             */
-            ret = snprintf(entry->hrSWRunPath, sizeof(entry->hrSWRunPath),
-                           "%s", buf);
+    return 0;
+}
 
-            if (ret < sizeof(entry->hrSWRunPath))
-                entry->hrSWRunPath_len = ret;
-            else
-                entry->hrSWRunPath_len = sizeof(entry->hrSWRunPath) - 1;
+#ifdef SWRUN_PROC_EVENTS
+/* ---------------------------------------------------------------------
+ * process events
+ *
+ * The proc connector reports every fork, exec and exit, so once loaded
+ * the container is updated one process at a time instead of being
+ * reloaded from /proc whenever the cache expires.  It needs
+ * CAP_NET_ADMIN and reports pids of the initial pid namespace; without
+ * either, the container is reloaded as before.
+ */
+#define SWRUN_EVENTS_RCVBUF     (4 * 1024 * 1024)
+#define SWRUN_EVENTS_BUF_SIZE   8192
 
-            /*
-             * Stitch together argv[1..] to construct hrSWRunParameters
-             */
-            for (cp = buf + ret; ! (*cp == '\0' && *(cp + 1) == '\0'); cp++)
-                    if (*cp == '\0')
-                            *cp = ' ';
-
-            entry->hrSWRunParameters_len
-                = sprintf(entry->hrSWRunParameters, "%.*s",
-                          (int)sizeof(entry->hrSWRunParameters) - 1,
-                          buf + ret + 1);
-        } else {
-            /* empty /proc/PID/cmdline, it's probably a kernel thread */
-            entry->hrSWRunPath_len = 0;
-            entry->hrSWRunParameters_len = 0;
-            entry->hrSWRunType = HRSWRUNTYPE_OPERATINGSYSTEM;
+/*
+ * 1 if this process runs in a child pid namespace, where the pids of the
+ * proc connector are not those of /proc
+ */
+static int
+_swrun_child_pid_ns(void)
+{
+    FILE                *fp;
+    char                 buf[BUFSIZ], *cp;
+    int                  pids = 0;
+
+    fp = fopen("/proc/self/status", "r");
+    if (!fp)
+        return 0;
+    while (fgets(buf, sizeof(buf), fp) != NULL) {
+        if (strncmp(buf, "NSpid:", 6) != 0)
+            continue;
+        for (cp = buf + 6; *cp; ) {
+            while (isspace(*cp))
+                cp++;
+            if (!isdigit(*cp))
+                break;
+            pids++;
+            while (isdigit(*cp))
+                cp++;
         }
+        break;
+    }
+    fclose(fp);
+    return pids > 1;
+}
+
+static void
+_swrun_event(struct proc_event *ev)
+{
+    netsnmp_container   *container = netsnmp_swrun_container();
+    netsnmp_swrun_entry *entry, *parent;
+    char                 name[sizeof(entry->hrSWRunName)];
+    int                  len, pid;
+
+    switch (ev->what) {
+    case PROC_EVENT_FORK:
+        if (ev->event_data.fork.child_pid != ev->event_data.fork.child_tgid)
+            break;  /* a new thread */
+        pid = ev->event_data.fork.child_tgid;
+        if (netsnmp_swrun_entry_get_by_index(container, pid))
+            break;  /* already found by the load */
+        entry = netsnmp_swrun_entry_create(pid);
+        if (NULL == entry)
+            break;
+        entry->stale = NETSNMP_SWRUN_STALE_CMDLINE | NETSNMP_SWRUN_STALE_STAT;
 
         /*
-         *   {xxx} {xxx} STATUS  {xxx}*10  UTIME STIME  {xxx}*8 RSS
+         * the child runs the parent's program until it execs
          */
-        snprintf( buf, BUFSIZ, "/proc/%d/stat", pid );
-        fp = fopen( buf, "r" );
-        if (!fp) {
-            netsnmp_swrun_entry_free(entry);
-            continue; /* file (process) probably went away */
-	}
-        if (fgets( buf, BUFSIZ-1, fp ) == NULL) {
-            fclose(fp);
-            netsnmp_swrun_entry_free(entry);
-            continue;
+        parent = netsnmp_swrun_entry_get_by_index(container,
+                                        ev->event_data.fork.parent_tgid);
+        if (parent) {
+            memcpy(entry->hrSWRunName, parent->hrSWRunName,
+                   sizeof(entry->hrSWRunName));
+            entry->hrSWRunName_len = parent->hrSWRunName_len;
+            if (!(parent->stale & NETSNMP_SWRUN_STALE_CMDLINE)) {
+                memcpy(entry->hrSWRunPath, parent->hrSWRunPath,
+                       sizeof(entry->hrSWRunPath));
+                entry->hrSWRunPath_len = parent->hrSWRunPath_len;
+                memcpy(entry->hrSWRunParameters, parent->hrSWRunParameters,
+                       sizeof(entry->hrSWRunParameters));
+                entry->hrSWRunParameters_len = parent->hrSWRunParameters_len;
+                entry->hrSWRunType = parent->hrSWRunType;
+                entry->stale &= ~NETSNMP_SWRUN_STALE_CMDLINE;
+            }
+        } else {
+            len = _swrun_read_name(pid, entry->hrSWRunName,
+                                   sizeof(entry->hrSWRunName));
+            if (len < 0) {
+                netsnmp_swrun_entry_free(entry);
+                break;  /* already gone */
+            }
+            entry->hrSWRunName_len = len;
         }
-        fclose(fp);
+        DEBUGMSGTL(("swrun:events", "fork %d: %s\n", pid,
+                    entry->hrSWRunName));
+        netsnmp_swrun_entry_insert(entry);
+        break;
 
-        cp = buf;
-        while ( ' ' != *(cp++))    /* Skip first field */
-            ;
-        cp1 = cp;                  /* Skip second field */
-        while (*cp1) {
-            if (*cp1 == ')') cp = cp1;
-            cp1++;
-        }
-        cp += 2;
-        
-        switch (*cp) {
-        case 'R':  entry->hrSWRunStatus = HRSWRUNSTATUS_RUNNING;
-                   break;
-        case 'S':  entry->hrSWRunStatus = HRSWRUNSTATUS_RUNNABLE;
-                   break;
-        case 'D':
-        case 'T':  entry->hrSWRunStatus = HRSWRUNSTATUS_NOTRUNNABLE;
-                   break;
-        case 'Z':
-        default:   entry->hrSWRunStatus = HRSWRUNSTATUS_INVALID;
-                   break;
+    case PROC_EVENT_EXEC:
+        pid = ev->event_data.exec.process_tgid;
+        len = _swrun_read_name(pid, name, sizeof(name));
+        if (len < 0)
+            break;  /* already gone, its exit follows */
+        DEBUGMSGTL(("swrun:events", "exec %d: %s\n", pid, name));
+        entry = netsnmp_swrun_entry_get_by_index(container, pid);
+        if (NULL == entry) {
+            entry = netsnmp_swrun_entry_create(pid);
+            if (NULL == entry)
+                break;
+            memcpy(entry->hrSWRunName, name, len + 1);
+            entry->hrSWRunName_len = len;
+            entry->stale = NETSNMP_SWRUN_STALE_CMDLINE |
+                NETSNMP_SWRUN_STALE_STAT;
+            netsnmp_swrun_entry_insert(entry);
+            break;
         }
-        for (i=11; i; i--) {   /* Skip STATUS + 10 fields */
-            while (' ' != *(++cp))
-                ;
-            cp++;
+        netsnmp_swrun_entry_set_name(entry, name, len);
+        entry->stale |= NETSNMP_SWRUN_STALE_CMDLINE | NETSNMP_SWRUN_STALE_STAT;
+        break;
+
+    case PROC_EVENT_COMM:
+        if (ev->event_data.comm.process_pid != ev->event_data.comm.process_tgid)
+            break;  /* a thread renamed itself */
+        entry = netsnmp_swrun_entry_get_by_index(container,
+                                        ev->event_data.comm.process_tgid);
+        if (entry)
+            netsnmp_swrun_entry_set_name(entry, ev->event_data.comm.comm,
+                               strnlen(ev->event_data.comm.comm,
+                                       sizeof(ev->event_data.comm.comm)));
+        break;
+
+    case PROC_EVENT_EXIT:
+        if (ev->event_data.exit.process_pid != ev->event_data.exit.process_tgid)
+            break;  /* a thread exited */
+        pid = ev->event_data.exit.process_tgid;
+        DEBUGMSGTL(("swrun:events", "exit %d\n", pid));
+        entry = netsnmp_swrun_entry_get_by_index(container, pid);
+        if (entry)
+            netsnmp_swrun_entry_remove(entry);
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void
+_swrun_events_read(int fd, void *data)
+{
+    char                 buf[SWRUN_EVENTS_BUF_SIZE];
+    struct nlmsghdr     *nlh;
+    struct cn_msg       *msg;
+    int                  len;
+
+    for (;;) {
+        len = recv(fd, buf, sizeof(buf), MSG_DONTWAIT);
+        if (len < 0) {
+            if (ENOBUFS == errno) {
+                /* the kernel dropped events, start over */
+                netsnmp_swrun_events_lost();
+                continue;
+            }
+            if (EINTR == errno)
+                continue;
+            break;
         }
-        cpu  = atol( cp );                     /*  utime */
-        while ( ' ' != *(++cp))
-            ;
-        cpu += atol( cp );                     /* +stime */
-        entry->hrSWRunPerfCPU  = cpu * 100 / sc_clk_tck;
+        if (0 == len)
+            break;
 
-        for (i=9; i; i--) {   /* Skip stime + 8 fields */
-            while (' ' != *(++cp))
-                ;
-            cp++;
+        for (nlh = (struct nlmsghdr *) buf; NLMSG_OK(nlh, len);
+             nlh = NLMSG_NEXT(nlh, len)) {
+            if (NLMSG_NOOP == nlh->nlmsg_type ||
+                NLMSG_ERROR == nlh->nlmsg_type)
+                continue;
+            msg = (struct cn_msg *) NLMSG_DATA(nlh);
+            if (CN_IDX_PROC != msg->id.idx || CN_VAL_PROC != msg->id.val)
+                continue;
+            /*
+             * events from before the first load are part of it
+             */
+            if (netsnmp_swrun_events_active())
+                _swrun_event((struct proc_event *) msg->data);
         }
-        entry->hrSWRunPerfMem  = atol( cp );       /* rss   */
-        entry->hrSWRunPerfMem *= (pagesize/1024);  /* in kB */
-        CONTAINER_INSERT(container, entry);
     }
-    closedir( procdir );
+}
 
-    DEBUGMSGTL(("swrun:load:arch"," loaded %" NETSNMP_PRIz "d entries\n",
-                CONTAINER_SIZE(container)));
+static void
+_swrun_events_init(void)
+{
+    struct sockaddr_nl   sa;
+    char                 buf[SWRUN_EVENTS_BUF_SIZE];
+    struct nlmsghdr     *nlh;
+    struct cn_msg       *msg;
+    struct proc_event   *ev;
+    struct timeval       tv;
+    fd_set               readfds;
+    int                  fd, len, rcvbuf = SWRUN_EVENTS_RCVBUF, err = -1;
+    unsigned int         seq = (unsigned int) getpid();
 
-    return 0;
+    if (_swrun_child_pid_ns()) {
+        DEBUGMSGTL(("swrun:events", "not in the initial pid namespace\n"));
+        return;
+    }
+
+    fd = socket(PF_NETLINK, SOCK_DGRAM, NETLINK_CONNECTOR);
+    if (fd < 0) {
+        DEBUGMSGTL(("swrun:events", "no proc connector: %s\n",
+                    strerror(errno)));
+        return;
+    }
+    if (setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf)) < 0)
+        DEBUGMSGTL(("swrun:events", "SO_RCVBUF: %s\n", strerror(errno)));
+
+    memset(&sa, 0, sizeof(sa));
+    sa.nl_family = AF_NETLINK;
+    sa.nl_groups = CN_IDX_PROC;
+    if (bind(fd, (struct sockaddr *) &sa, sizeof(sa)) < 0) {
+        DEBUGMSGTL(("swrun:events", "bind: %s\n", strerror(errno)));
+        close(fd);
+        return;
+    }
+
+    memset(buf, 0, sizeof(buf));
+    nlh = (struct nlmsghdr *) buf;
+    nlh->nlmsg_len = NLMSG_LENGTH(sizeof(*msg) + sizeof(int));
+    nlh->nlmsg_type = NLMSG_DONE;
+    msg = (struct cn_msg *) NLMSG_DATA(nlh);
+    msg->id.idx = CN_IDX_PROC;
+    msg->id.val = CN_VAL_PROC;
+    msg->seq = seq;
+    msg->ack = seq;
+    msg->len = sizeof(int);
+    *(int *) msg->data = PROC_CN_MCAST_LISTEN;
+    if (send(fd, buf, nlh->nlmsg_len, 0) < 0) {
+        DEBUGMSGTL(("swrun:events", "listen: %s\n", strerror(errno)));
+        close(fd);
+        return;
+    }
+
+    /*
+     * The kernel acknowledges the request with ack + 1, and EPERM
+     * without CAP_NET_ADMIN.  Events may come first; they are older than
+     * the first load anyway.
+     */
+    while (err < 0) {
+        FD_ZERO(&readfds);
+        FD_SET(fd, &readfds);
+        tv.tv_sec = 1;
+        tv.tv_usec = 0;
+        if (select(fd + 1, &readfds, NULL, NULL, &tv) <= 0)
+            break;
+        len = recv(fd, buf, sizeof(buf), 0);
+        if (len < 0 && ENOBUFS == errno)
+            continue;
+        if (len <= 0)
+            break;
+        for (nlh = (struct nlmsghdr *) buf; NLMSG_OK(nlh, len);
+             nlh = NLMSG_NEXT(nlh, len)) {
+            msg = (struct cn_msg *) NLMSG_DATA(nlh);
+            ev = (struct proc_event *) msg->data;
+            if (CN_IDX_PROC == msg->id.idx && CN_VAL_PROC == msg->id.val &&
+                seq + 1 == msg->ack && PROC_EVENT_NONE == ev->what) {
+                err = ev->event_data.ack.err;
+                break;
+            }
+        }
+    }
+    if (err != 0) {
+        DEBUGMSGTL(("swrun:events", "not subscribed (%d)\n", err));
+        close(fd);
+        return;
+    }
+
+    if (register_readfd(fd, _swrun_events_read, NULL) != 0) {
+        close(fd);
+        return;
+    }
+    netsnmp_swrun_events_start();
 }
+#endif /* SWRUN_PROC_EVENTS */
@@ -174,6 +174,7 @@ hrSWRunPerfTable_handler(netsnmp_mib_handler *handler,
                 continue;
             }
 
+            netsnmp_swrun_entry_refresh(table_entry, NETSNMP_SWRUN_STALE_STAT);
             switch (table_info->colnum) {
             case COLUMN_HRSWRUNPERFCPU:
                 snmp_set_var_typed_integer(request->requestvb, ASN_INTEGER,
@@ -201,12 +201,16 @@ hrSWRunTable_handler(netsnmp_mib_handler *handler,
                     );
                 break;
             case COLUMN_HRSWRUNPATH:
+                netsnmp_swrun_entry_refresh(table_entry,
+                                            NETSNMP_SWRUN_STALE_CMDLINE);
                 snmp_set_var_typed_value(request->requestvb, ASN_OCTET_STR,
                                          (u_char *) table_entry->
                                          hrSWRunPath,
                                          table_entry->hrSWRunPath_len);
                 break;
             case COLUMN_HRSWRUNPARAMETERS:
+                netsnmp_swrun_entry_refresh(table_entry,
+                                            NETSNMP_SWRUN_STALE_CMDLINE);
                 snmp_set_var_typed_value(request->requestvb, ASN_OCTET_STR,
                                          (u_char *) table_entry->
                                          hrSWRunParameters,
@@ -214,10 +218,14 @@ hrSWRunTable_handler(netsnmp_mib_handler *handler,
                                          hrSWRunParameters_len);
                 break;
             case COLUMN_HRSWRUNTYPE:
+                netsnmp_swrun_entry_refresh(table_entry,
+                                            NETSNMP_SWRUN_STALE_CMDLINE);
                 snmp_set_var_typed_integer(request->requestvb, ASN_INTEGER,
                                            table_entry->hrSWRunType);
                 break;
             case COLUMN_HRSWRUNSTATUS:
+                netsnmp_swrun_entry_refresh(table_entry,
+                                            NETSNMP_SWRUN_STALE_STAT);
                 snmp_set_var_typed_integer(request->requestvb, ASN_INTEGER,
                                            table_entry->hrSWRunStatus);
                 break;
@@ -188,6 +188,90 @@ netsnmp_access_interface_container_load(netsnmp_container* container, u_int load
     return container;
 }
 
+/**
+ * load a single interface
+ *
+ * @param if_index   ifIndex of the interface
+ * @param load_flags flags to modify behaviour, as for container_load
+ *
+ * @retval NULL  interface not found, excluded, or not supported
+ * @retval !NULL new entry, to be freed by the caller
+ */
+netsnmp_interface_entry *
+netsnmp_access_interface_entry_load(oid if_index, u_int load_flags)
+{
+    DEBUGMSGTL(("access:interface:entry", "load %" NETSNMP_PRIo "u\n",
+                if_index));
+    netsnmp_assert(1 == _access_interface_init);
+
+#ifdef linux
+    return netsnmp_arch_interface_entry_load(if_index, load_flags);
+#else
+    return NULL;
+#endif
+}
+
+/**
+ * refresh the statistics of an entry, without reloading anything else
+ *
+ * @retval  0 : success
+ * @retval -1 : error, or not supported
+ */
+int
+netsnmp_access_interface_entry_stats_refresh(netsnmp_interface_entry *entry)
+{
+#ifdef linux
+    netsnmp_interface_entry tmp;
+
+    DEBUGMSGTL(("access:interface:entry", "stats_refresh\n"));
+
+    if ((NULL == entry) || (NULL == entry->name))
+        return -1;
+
+    memset(&tmp, 0, sizeof(tmp));
+    tmp.name = entry->name;
+    tmp.index = entry->index;
+    if (0 != netsnmp_arch_interface_entry_stats_load(&tmp))
+        return -1;
+
+    netsnmp_access_interface_entry_update_stats(entry, &tmp);
+    netsnmp_access_interface_entry_calculate_stats(entry);
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * ask to be told about interfaces being added, changed or removed.
+ * There is only one subscriber at a time.
+ *
+ * @retval  0 : success
+ * @retval -1 : events not supported, or already registered
+ */
+int
+netsnmp_access_interface_events_register(netsnmp_access_interface_event_cb *cb,
+                                         void *ctx)
+{
+    DEBUGMSGTL(("access:interface:events", "register\n"));
+
+#ifdef linux
+    return netsnmp_arch_interface_events_register(cb, ctx);
+#else
+    return -1;
+#endif
+}
+
+void
+netsnmp_access_interface_events_unregister(void)
+{
+    DEBUGMSGTL(("access:interface:events", "unregister\n"));
+
+#ifdef linux
+    netsnmp_arch_interface_events_unregister();
+#endif
+}
+
 void
 netsnmp_access_interface_container_free(netsnmp_container *container, u_int free_flags)
 {
@@ -18,6 +18,9 @@ extern          "C" {
 /**---------------------------------------------------------------------*/
 /**/
 
+int
+netsnmp_access_interface_arphrd_to_type(int hwtype);
+
 int
 netsnmp_access_interface_ioctl_physaddr_get(int fd,
                                             netsnmp_interface_entry *ifentry);
@@ -109,6 +109,9 @@ typedef __u8 u8;           /* ditto */
 #endif  /* RTMGRP_IPV6_PREFIX */
 #endif  /* HAVE_LINUX_RTNETLINK_H */
 #endif  /* NETSNMP_ENABLE_IPV6 */
+#ifdef HAVE_LINUX_RTNETLINK_H
+#include <linux/rtnetlink.h>
+#endif
 unsigned long long
 netsnmp_linux_interface_get_if_speed(int fd, const char *name,
         unsigned long long defaultspeed);
@@ -596,339 +599,1411 @@ _parse_stats(netsnmp_interface_entry *entry, char *stats, int expected)
     return 0;
 }
 
+typedef struct _nl_link_info _nl_link_info;
+
+#ifdef HAVE_LINUX_RTNETLINK_H
 /*
+ * netlink interface attributes
  *
- * @retval  0 success
- * @retval -1 no container specified
- * @retval -2 could not open /proc/net/dev
- * @retval -3 could not create entry (probably malloc)
+ * A single RTM_GETLINK dump returns the flags, mtu, operational state,
+ * hardware address and 64 bit counters of every interface, which saves
+ * parsing /proc/net/dev and several ioctls per interface on every reload.
  */
-int
-netsnmp_arch_interface_container_load(netsnmp_container* container,
-                                      u_int load_flags)
-{
-    FILE           *devin;
-    char            line[256];
-    netsnmp_interface_entry *entry = NULL;
-    static char     scan_expected = 0;
-    int             fd;
-    int             interfaces = 0;
-    struct ifconf   ifc;
-#ifdef NETSNMP_ENABLE_IPV6
-    netsnmp_container *addr_container;
-#endif
+#define NL_LINK_BUFSIZE 32768
+#define NL_LINK_ADDRLEN 32      /* MAX_ADDR_LEN in linux/netdevice.h */
+#define NL_DEVCONF_FORWARDING 0 /* DEVCONF_FORWARDING in linux/ipv6.h */
 
-    DEBUGMSGTL(("access:interface:container:arch", "load (flags %x)\n",
-                load_flags));
+/*
+ * _nl_link_info.has bits
+ */
+#define NL_LINK_HAS_CARRIER_CHANGES 0x01
+#define NL_LINK_HAS_SPEED           0x02
+#define NL_LINK_HAS_V4_RETRANSMIT   0x04
+#define NL_LINK_HAS_V6_RETRANSMIT   0x08
+#define NL_LINK_HAS_V6_REACHABLE    0x10
+#define NL_LINK_HAS_V6_FORWARDING   0x20
+#define NL_LINK_HAS_ADDR_FLAGS      0x40
+#define NL_LINK_HAS_V6_FLAGS        (NL_LINK_HAS_V6_RETRANSMIT | \
+                                     NL_LINK_HAS_V6_REACHABLE | \
+                                     NL_LINK_HAS_V6_FORWARDING)
+
+struct _nl_link_info {
+    oid             index;      /* first, see _nl_link_index_compare() */
+    char            name[IF_NAMESIZE];
+    u_int           os_flags;
+    u_int           mtu;
+    u_int           carrier_changes;
+    u_short         hwtype;
+    u_char          operstate;
+    u_char          has_stats;
+    u_char          has;
+    char            forwarding_v6;
+    u_char          paddr_len;
+    u_char          paddr[NL_LINK_ADDRLEN];
+    u_int           addr_flags;     /* NETSNMP_INTERFACE_FLAGS_HAS_IPVx */
+    u_int           retransmit_v4;  /* milliseconds */
+    u_int           retransmit_v6;  /* milliseconds */
+    u_int           reachable_time; /* milliseconds */
+    unsigned long long speed;
+    struct rtnl_link_stats64 stats;
+};
+
+typedef int     (_nl_msg_handler) (struct nlmsghdr *nlp, void *ctx);
 
-    if (NULL == container) {
-        snmp_log(LOG_ERR, "no container specified/found for interface\n");
-        return -1;
-    }
+/*
+ * the last RTM_GETLINK dump, sorted by index. It remembers the ethtool
+ * speed of each interface, so that only links which changed are asked
+ * again.
+ */
+static _nl_link_info *_nl_link_cache;
+static int      _nl_link_cache_count;
 
-    if (!(devin = fopen("/proc/net/dev", "r"))) {
-        DEBUGMSGTL(("access:interface",
-                    "Failed to load Interface Table (linux1)\n"));
-        snmp_log_perror("interface_linux: cannot open /proc/net/dev");
-        return -2;
-    }
+/*
+ * socket and receive buffer for requests. They are kept open, as ifTable
+ * refreshes the counters of single rows when it follows link events.
+ * Interfaces are only loaded from the main thread.
+ */
+static int      _nl_request_fd = -1;
+static char    *_nl_request_buf;
 
-    /*
-     * create socket for ioctls
-     */
-    fd = socket(AF_INET, SOCK_DGRAM, 0);
-    if(fd < 0) {
-        snmp_log_perror("interface_linux: could not create socket");
-        fclose(devin);
-        return -2;
-    }
+/*
+ * kernel IF_OPER_xxx (RFC 2863 operational states) to ifOperStatus.
+ * IF_OPER_UNKNOWN (0) is left to the interface flags.
+ */
+static const u_char _nl_oper_status[] = {
+    0,
+    IFOPERSTATUS_NOTPRESENT,
+    IFOPERSTATUS_DOWN,
+    IFOPERSTATUS_LOWERLAYERDOWN,
+    IFOPERSTATUS_TESTING,
+    IFOPERSTATUS_DORMANT,
+    IFOPERSTATUS_UP,
+};
 
-#ifdef NETSNMP_ENABLE_IPV6
-    /*
-     * get ipv6 addresses
-     */
-    addr_container = netsnmp_access_ipaddress_container_load(NULL, 0);
-#endif
+/**
+ * @internal
+ * compare the indexes of two links, or of a link and an oid, for qsort()
+ * and bsearch()
+ */
+static int
+_nl_link_index_compare(const void *lhs, const void *rhs)
+{
+    oid             l = *(const oid *) lhs, r = *(const oid *) rhs;
 
-    /*
-     * Read the first two lines of the file, containing the header
-     * This indicates which version of the kernel we're working with,
-     * and hence which statistics are actually available.
-     *
-     * Wes originally suggested parsing the field names in this header
-     * to detect the position of individual fields directly,
-     * but I suspect this is probably more trouble than it's worth.
-     */
-    NETSNMP_IGNORE_RESULT(fgets(line, sizeof(line), devin));
-    NETSNMP_IGNORE_RESULT(fgets(line, sizeof(line), devin));
+    return l < r ? -1 : l > r;
+}
 
-    if( 0 == scan_expected ) {
-        if (strstr(line, "compressed")) {
-            scan_expected = 10;
-            DEBUGMSGTL(("access:interface",
-                        "using linux 2.2 kernel /proc/net/dev\n"));
-        } else {
-            scan_expected = 5;
-            DEBUGMSGTL(("access:interface",
-                        "using linux 2.0 kernel /proc/net/dev\n"));
-        }
-    }
+static _nl_link_info *
+_nl_link_cache_find(oid if_index)
+{
+    if (NULL == _nl_link_cache)
+        return NULL;
+    return (_nl_link_info *) bsearch(&if_index, _nl_link_cache,
+                                     _nl_link_cache_count,
+                                     sizeof(*_nl_link_cache),
+                                     _nl_link_index_compare);
+}
 
-    interfaces = netsnmp_access_ipaddress_ioctl_get_interface_count(fd, &ifc);
-    if (interfaces < 0) {
-        snmp_log(LOG_ERR,"get interface count failed\n");
-        fclose(devin);
-        close(fd);
-        return -2;
-    }
-    netsnmp_assert(NULL != ifc.ifc_buf);
+/**
+ * @internal
+ * parse the ipv6 forwarding setting from IFLA_AF_SPEC
+ */
+static void
+_nl_link_parse_af_spec(struct rtattr *spec, _nl_link_info *link)
+{
+    struct rtattr  *af, *rta;
+    int             len = RTA_PAYLOAD(spec), af_len;
+    int32_t         forwarding;
 
+    for (af = (struct rtattr *) RTA_DATA(spec); RTA_OK(af, len);
+         af = RTA_NEXT(af, len)) {
+        if (AF_INET6 != af->rta_type)
+            continue;
+        af_len = RTA_PAYLOAD(af);
+        for (rta = (struct rtattr *) RTA_DATA(af); RTA_OK(rta, af_len);
+             rta = RTA_NEXT(rta, af_len)) {
+            if (IFLA_INET6_CONF != rta->rta_type ||
+                RTA_PAYLOAD(rta) < (NL_DEVCONF_FORWARDING + 1) *
+                sizeof(int32_t))
+                continue;
+            memcpy(&forwarding, (int32_t *) RTA_DATA(rta) +
+                   NL_DEVCONF_FORWARDING, sizeof(forwarding));
+            link->forwarding_v6 = forwarding;
+            link->has |= NL_LINK_HAS_V6_FORWARDING;
+        }
+    }
+}
 
-    /*
-     * The rest of the file provides the statistics for each interface.
-     * Read in each line in turn, isolate the interface name
-     *   and retrieve (or create) the corresponding data structure.
-     */
-    while (fgets(line, sizeof(line), devin)) {
-        char           *stats, *ifstart = line;
-        u_int           flags;
-        oid             if_index;
+/**
+ * @internal
+ * parse one RTM_NEWLINK message
+ *
+ * @retval  0 success
+ * @retval -1 malformed or nameless interface
+ */
+static int
+_nl_link_parse(struct nlmsghdr *nlp, _nl_link_info *link)
+{
+    struct ifinfomsg *ifi = (struct ifinfomsg *) NLMSG_DATA(nlp);
+    struct rtattr  *rta;
+    size_t          plen;
+    int             len;
 
-        flags = 0;
-        if (line[strlen(line) - 1] == '\n')
-            line[strlen(line) - 1] = '\0';
+    len = nlp->nlmsg_len - NLMSG_LENGTH(sizeof(*ifi));
+    if (len < 0)
+        return -1;
 
-        while (*ifstart && *ifstart == ' ')
-            ifstart++;
+    memset(link, 0, sizeof(*link));
+    link->index = ifi->ifi_index;
+    link->hwtype = ifi->ifi_type;
+    link->os_flags = ifi->ifi_flags;
+
+    for (rta = IFLA_RTA(ifi); RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+        plen = RTA_PAYLOAD(rta);
+        switch (rta->rta_type) {
+        case IFLA_IFNAME:
+            if (plen >= sizeof(link->name))
+                plen = sizeof(link->name) - 1;
+            memcpy(link->name, RTA_DATA(rta), plen);
+            link->name[plen] = 0;
+            break;
 
-        if ((!*ifstart) || ((stats = strrchr(ifstart, ':')) == NULL)) {
-            snmp_log(LOG_ERR,
-                     "interface data format error 1, line ==|%s|\n", line);
-            continue;
-        }
-        if ((scan_expected == 10) && ((stats - line) < 6)) {
-            snmp_log(LOG_ERR,
-                     "interface data format error 2 (%d < 6), line ==|%s|\n",
-                     (int)(stats - line), line);
-        }
+        case IFLA_MTU:
+            if (plen >= sizeof(link->mtu))
+                memcpy(&link->mtu, RTA_DATA(rta), sizeof(link->mtu));
+            break;
 
-        DEBUGMSGTL(("9:access:ifcontainer", "processing '%s'\n", ifstart));
+        case IFLA_OPERSTATE:
+            if (plen >= 1)
+                link->operstate = *(u_char *) RTA_DATA(rta);
+            break;
 
-        /*
-         * get index via ioctl.
-         * If we've met this interface before, use the same index.
-         * Otherwise find an unused index value and use that.
-         */
-        *stats++ = 0; /* null terminate name */
+        case IFLA_ADDRESS:
+            if (plen > sizeof(link->paddr))
+                plen = sizeof(link->paddr);
+            memcpy(link->paddr, RTA_DATA(rta), plen);
+            link->paddr_len = plen;
+            break;
 
-	if (!netsnmp_access_interface_include(ifstart))
-		continue;
+        case IFLA_CARRIER_CHANGES:
+            if (plen >= sizeof(link->carrier_changes)) {
+                memcpy(&link->carrier_changes, RTA_DATA(rta),
+                       sizeof(link->carrier_changes));
+                link->has |= NL_LINK_HAS_CARRIER_CHANGES;
+            }
+            break;
 
-	if (netsnmp_access_interface_max_reached(ifstart))
-		/* we may need to stop tracking ifaces if a max was set */
-		continue;
-        /*
-         * set address type flags.
-         * the only way I know of to check an interface for
-         * ip version is to look for ip addresses. If anyone
-         * knows a better way, put it here!
-         */
-#ifdef NETSNMP_ENABLE_IPV6
-        if_index = netsnmp_arch_interface_index_find(ifstart);
-        _arch_interface_has_ipv6(if_index, &flags, addr_container);
-#endif
-        netsnmp_access_interface_ioctl_has_ipv4(fd, ifstart, 0, &flags, &ifc);
+        case IFLA_AF_SPEC:
+            _nl_link_parse_af_spec(rta, link);
+            break;
 
-        /*
-         * do we only want one address type?
-         */
-        if (((load_flags & NETSNMP_ACCESS_INTERFACE_LOAD_IP4_ONLY) &&
-             ((flags & NETSNMP_INTERFACE_FLAGS_HAS_IPV4) == 0)) ||
-            ((load_flags & NETSNMP_ACCESS_INTERFACE_LOAD_IP6_ONLY) &&
-             ((flags & NETSNMP_INTERFACE_FLAGS_HAS_IPV6) == 0))) {
-            DEBUGMSGTL(("9:access:ifcontainer",
-                        "interface '%s' excluded by ip version\n",
-                        ifstart));
-            continue;
-        }
+        case IFLA_STATS64:
+            if (plen > sizeof(link->stats))
+                plen = sizeof(link->stats);
+            memset(&link->stats, 0, sizeof(link->stats));
+            memcpy(&link->stats, RTA_DATA(rta), plen);
+            link->has_stats = 64;
+            break;
 
-        entry = netsnmp_access_interface_entry_create(ifstart, 0);
-        if(NULL == entry) {
-#ifdef NETSNMP_ENABLE_IPV6
-            netsnmp_access_ipaddress_container_free(addr_container, 0);
-#endif
-            fclose(devin);
-            close(fd);
-            free(ifc.ifc_buf);
-            return -3;
+        case IFLA_STATS:
+            /*
+             * kernels before 2.6.35 only have 32 bit counters
+             */
+            if (64 != link->has_stats &&
+                plen >= sizeof(struct rtnl_link_stats)) {
+                struct rtnl_link_stats st;
+
+                memcpy(&st, RTA_DATA(rta), sizeof(st));
+                link->stats.rx_packets = st.rx_packets;
+                link->stats.tx_packets = st.tx_packets;
+                link->stats.rx_bytes = st.rx_bytes;
+                link->stats.tx_bytes = st.tx_bytes;
+                link->stats.rx_errors = st.rx_errors;
+                link->stats.tx_errors = st.tx_errors;
+                link->stats.rx_dropped = st.rx_dropped;
+                link->stats.tx_dropped = st.tx_dropped;
+                link->stats.multicast = st.multicast;
+                link->stats.collisions = st.collisions;
+                link->has_stats = 32;
+            }
+            break;
         }
-        entry->ns_flags = flags; /* initial flags; we'll set more later */
+    }
 
-#ifdef HAVE_PCI_LOOKUP_NAME
-	_arch_interface_description_get(entry);
-#endif
+    return link->name[0] ? 0 : -1;
+}
 
+/**
+ * @internal
+ * send a rtnetlink request and pass every message of the reply to handler
+ *
+ * @retval  0 success, or the single object asked for is gone
+ * @retval -1 netlink not available, the request or the handler failed
+ */
+static int
+_nl_request(struct nlmsghdr *req, _nl_msg_handler *handler, void *ctx)
+{
+    static u_int    seq;
+    struct sockaddr_nl sa;
+    struct nlmsghdr *nlp;
+    int             done = 0;
+    ssize_t         len;
+
+    if (NULL == _nl_request_buf) {
+        _nl_request_buf = (char *) malloc(NL_LINK_BUFSIZE);
+        if (NULL == _nl_request_buf)
+            return -1;
+    }
 
-        /*
-         * use ioctls for some stuff
-         *  (ignore rc, so we get as much info as possible)
-         */
-        netsnmp_access_interface_ioctl_physaddr_get(fd, entry);
+    if (_nl_request_fd < 0) {
+#if defined(SOL_NETLINK) && defined(NETLINK_GET_STRICT_CHK)
+        int             one = 1;
+#endif
 
-        /*
-         * physaddr should have set type. make some guesses (based
-         * on name) if not.
-         */
-        if(0 == entry->type) {
-            typedef struct _match_if {
-               int             mi_type;
-               const char     *mi_name;
-            }              *pmatch_if, match_if;
-            
-            static match_if lmatch_if[] = {
-                {IANAIFTYPE_SOFTWARELOOPBACK, "lo"},
-                {IANAIFTYPE_ETHERNETCSMACD, "eth"},
-                {IANAIFTYPE_ETHERNETCSMACD, "vmnet"},
-                {IANAIFTYPE_ISO88025TOKENRING, "tr"},
-                {IANAIFTYPE_FASTETHER, "feth"},
-                {IANAIFTYPE_GIGABITETHERNET,"gig"},
-                {IANAIFTYPE_INFINIBAND,"ib"},
-                {IANAIFTYPE_PPP, "ppp"},
-                {IANAIFTYPE_SLIP, "sl"},
-                {IANAIFTYPE_TUNNEL, "sit"},
-                {IANAIFTYPE_BASICISDN, "ippp"},
-                {IANAIFTYPE_PROPVIRTUAL, "bond"}, /* Bonding driver find fastest slave */
-                {IANAIFTYPE_PROPVIRTUAL, "vad"},  /* ANS driver - ?speed? */
-                {0, NULL}                  /* end of list */
-            };
-
-            int             len;
-            register pmatch_if pm;
-            
-            for (pm = lmatch_if; pm->mi_name; pm++) {
-                len = strlen(pm->mi_name);
-                if (0 == strncmp(entry->name, pm->mi_name, len)) {
-                    entry->type = pm->mi_type;
-                    break;
-                }
-            }
-            if(NULL == pm->mi_name)
-                entry->type = IANAIFTYPE_OTHER;
+        _nl_request_fd = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+        if (_nl_request_fd < 0) {
+            DEBUGMSGTL(("access:interface:netlink", "socket failed: %s\n",
+                        strerror(errno)));
+            return -1;
         }
-
+#if defined(SOL_NETLINK) && defined(NETLINK_GET_STRICT_CHK)
         /*
-         * interface identifier is specified based on physaddr and type
+         * lets the kernel filter address dumps by interface (4.20 and
+         * later); replies are checked either way.
          */
-        switch (entry->type) {
-        case IANAIFTYPE_ETHERNETCSMACD:
-        case IANAIFTYPE_ETHERNET3MBIT:
-        case IANAIFTYPE_FASTETHER:
-        case IANAIFTYPE_FASTETHERFX:
-        case IANAIFTYPE_GIGABITETHERNET:
-        case IANAIFTYPE_FDDI:
-        case IANAIFTYPE_ISO88025TOKENRING:
-            if (NULL != entry->paddr && ETH_ALEN != entry->paddr_len)
-                break;
+        (void) setsockopt(_nl_request_fd, SOL_NETLINK, NETLINK_GET_STRICT_CHK,
+                          &one, sizeof(one));
+#endif
+    }
 
-            entry->v6_if_id_len = entry->paddr_len + 2;
-            memcpy(entry->v6_if_id, entry->paddr, 3);
-            memcpy(entry->v6_if_id + 5, entry->paddr + 3, 3);
-            entry->v6_if_id[0] ^= 2;
-            entry->v6_if_id[3] = 0xFF;
-            entry->v6_if_id[4] = 0xFE;
+    memset(&sa, 0, sizeof(sa));
+    sa.nl_family = AF_NETLINK;
 
-            entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_V6_IFID;
-            break;
+    req->nlmsg_flags |= NLM_F_REQUEST;
+    req->nlmsg_seq = ++seq;
 
-        case IANAIFTYPE_SOFTWARELOOPBACK:
-            entry->v6_if_id_len = 0;
-            entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_V6_IFID;
-            break;
+    if (sendto(_nl_request_fd, req, req->nlmsg_len, 0,
+               (struct sockaddr *) &sa, sizeof(sa)) < 0) {
+        DEBUGMSGTL(("access:interface:netlink", "send failed: %s\n",
+                    strerror(errno)));
+        return -1;
+    }
+
+    /*
+     * replies to an earlier request that failed half way are skipped by
+     * their sequence number
+     */
+    while (!done) {
+        len = recv(_nl_request_fd, _nl_request_buf, NL_LINK_BUFSIZE,
+                   MSG_TRUNC);
+        if (len < 0 && EINTR == errno)
+            continue;
+        if (len <= 0 || len > NL_LINK_BUFSIZE) {
+            DEBUGMSGTL(("access:interface:netlink",
+                        "recv failed (%d): %s\n", (int) len,
+                        strerror(errno)));
+            return -1;
         }
 
-        if (IANAIFTYPE_ETHERNETCSMACD == entry->type) {
-            unsigned long long speed;
-            unsigned long long defaultspeed = NOMINAL_LINK_SPEED;
-            if (!(entry->os_flags & IFF_RUNNING)) {
+        for (nlp = (struct nlmsghdr *) _nl_request_buf; NLMSG_OK(nlp, len);
+             nlp = NLMSG_NEXT(nlp, len)) {
+            if (nlp->nlmsg_seq != req->nlmsg_seq)
+                continue;
+            if (NLMSG_DONE == nlp->nlmsg_type) {
+                done = 1;
+                break;
+            }
+            if (NLMSG_ERROR == nlp->nlmsg_type) {
+                struct nlmsgerr *err = (struct nlmsgerr *) NLMSG_DATA(nlp);
+
                 /*
-                 * use speed 0 if the if speed cannot be determined *and* the
-                 * interface is down
+                 * asking for a single interface that is gone is no error
                  */
-                defaultspeed = 0;
+                if (!(req->nlmsg_flags & NLM_F_DUMP) &&
+                    -ENODEV == err->error) {
+                    done = 1;
+                    break;
+                }
+                DEBUGMSGTL(("access:interface:netlink",
+                            "request %d returned error %d\n",
+                            req->nlmsg_type, err->error));
+                return -1;
+            }
+            if ((*handler)(nlp, ctx) < 0)
+                return -1;
+            if (!(req->nlmsg_flags & NLM_F_DUMP)) {
+                done = 1;
+                break;
             }
-            speed = netsnmp_linux_interface_get_if_speed(fd,
-                    entry->name, defaultspeed);
-            if (speed > 0xffffffffL) {
-                entry->speed = 0xffffffff;
-            } else
-                entry->speed = speed;
-            entry->speed_high = speed / 1000000LL;
         }
-#ifdef APPLIED_PATCH_836390   /* xxx-rks ifspeed fixes */
-        else if (IANAIFTYPE_PROPVIRTUAL == entry->type)
-            entry->speed = _get_bonded_if_speed(entry);
-#endif
-        else
-            netsnmp_access_interface_entry_guess_speed(entry);
-        
-        netsnmp_access_interface_ioctl_flags_get(fd, entry);
+    }
 
-        netsnmp_access_interface_ioctl_mtu_get(fd, entry);
+    return 0;
+}
 
-        /*
-         * Zero speed means link problem.
-         * - i'm not sure this is always true...
-         */
-        if((entry->speed == 0) && (entry->os_flags & IFF_UP)) {
-            entry->os_flags &= ~IFF_RUNNING;
-        }
+struct _nl_link_list {
+    _nl_link_info  *info;
+    int             count;
+    int             alloced;
+};
 
-        /*
-         * check for promiscuous mode.
-         *  NOTE: there are 2 ways to set promiscuous mode in Linux
-         *  (kernels later than 2.2.something) - using ioctls and
-         *  using setsockopt. The ioctl method tested here does not
-         *  detect if an interface was set using setsockopt. google
-         *  on IFF_PROMISC and linux to see lots of arguments about it.
-         */
-        if(entry->os_flags & IFF_PROMISC) {
-            entry->promiscuous = 1; /* boolean */
-        }
+static int
+_nl_link_add(struct nlmsghdr *nlp, void *ctx)
+{
+    struct _nl_link_list *list = (struct _nl_link_list *) ctx;
+    _nl_link_info  *tmp;
+
+    if (RTM_NEWLINK != nlp->nlmsg_type)
+        return 0;
+
+    if (list->count == list->alloced) {
+        list->alloced = list->alloced ? list->alloced * 2 : 32;
+        tmp = (_nl_link_info *)
+            realloc(list->info, list->alloced * sizeof(*tmp));
+        if (NULL == tmp)
+            return -1;
+        list->info = tmp;
+    }
+    if (0 == _nl_link_parse(nlp, &list->info[list->count]))
+        ++list->count;
+    return 0;
+}
 
-        /*
-         * hardcoded max packet size
-         * (see ip_frag_reasm: if(len > 65535) goto out_oversize;)
-         */
-        entry->reasm_max_v4 = entry->reasm_max_v6 = 65535;
-        entry->ns_flags |= 
-            NETSNMP_INTERFACE_FLAGS_HAS_V4_REASMMAX |
-            NETSNMP_INTERFACE_FLAGS_HAS_V6_REASMMAX;
+/**
+ * @internal
+ * fetch interfaces with a RTM_GETLINK request
+ *
+ * @param if_index : interface to fetch, or 0 to dump all interfaces
+ * @param links    : set to an array of interfaces, sorted by index, to be
+ *                   freed by the caller
+ *
+ * @retval >=0 number of interfaces in links
+ * @retval  -1 netlink not available or the request failed
+ */
+static int
+_nl_link_request(oid if_index, _nl_link_info **links)
+{
+    struct {
+        struct nlmsghdr  n;
+        struct ifinfomsg i;
+    }               req;
+    struct _nl_link_list list;
 
-        netsnmp_access_interface_entry_overrides(entry);
+    *links = NULL;
+    memset(&list, 0, sizeof(list));
 
-        if (! (load_flags & NETSNMP_ACCESS_INTERFACE_LOAD_NO_STATS))
-            _parse_stats(entry, stats, scan_expected);
+    memset(&req, 0, sizeof(req));
+    req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifinfomsg));
+    req.n.nlmsg_type = RTM_GETLINK;
+    if (0 == if_index)
+        req.n.nlmsg_flags |= NLM_F_DUMP;
+    req.i.ifi_family = AF_UNSPEC;
+    req.i.ifi_index = if_index;
 
-        if (flags & NETSNMP_INTERFACE_FLAGS_HAS_IPV4)
-            _arch_interface_flags_v4_get(entry);
+    if (_nl_request(&req.n, _nl_link_add, &list) < 0) {
+        free(list.info);
+        return -1;
+    }
 
-#ifdef NETSNMP_ENABLE_IPV6
-        if (flags & NETSNMP_INTERFACE_FLAGS_HAS_IPV6)
-            _arch_interface_flags_v6_get(entry);
-#endif /* NETSNMP_ENABLE_IPV6 */
+    DEBUGMSGTL(("access:interface:netlink", "got %d interfaces\n",
+                list.count));
+    if (list.count > 1)
+        qsort(list.info, list.count, sizeof(*list.info),
+              _nl_link_index_compare);
+    *links = list.info;
+    return list.count;
+}
 
-        /*
-         * add to container
-         */
-        CONTAINER_INSERT(container, entry);
+struct _nl_neightbl_ctx {
+    _nl_link_info  *links;
+    int             count;
+};
+
+static int
+_nl_neightbl_parse(struct nlmsghdr *nlp, void *ctx)
+{
+    struct _nl_neightbl_ctx *nt = (struct _nl_neightbl_ctx *) ctx;
+    struct ndtmsg  *ndtm = (struct ndtmsg *) NLMSG_DATA(nlp);
+    struct rtattr  *rta, *parm;
+    _nl_link_info  *link;
+    uint32_t        if_index = 0;
+    oid             key;
+    uint64_t        retrans = 0, reachable = 0;
+    u_char          has = 0;
+    int             len, plen;
+
+    if (RTM_NEWNEIGHTBL != nlp->nlmsg_type)
+        return 0;
+    len = nlp->nlmsg_len - NLMSG_LENGTH(sizeof(*ndtm));
+    if (len < 0 ||
+        (AF_INET != ndtm->ndtm_family && AF_INET6 != ndtm->ndtm_family))
+        return 0;
+
+    for (rta = (struct rtattr *) ((char *) ndtm +
+                                  NLMSG_ALIGN(sizeof(*ndtm)));
+         RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+        if (NDTA_PARMS != rta->rta_type)
+            continue;
+        plen = RTA_PAYLOAD(rta);
+        for (parm = (struct rtattr *) RTA_DATA(rta); RTA_OK(parm, plen);
+             parm = RTA_NEXT(parm, plen)) {
+            switch (parm->rta_type) {
+            case NDTPA_IFINDEX:
+                if (RTA_PAYLOAD(parm) >= sizeof(if_index))
+                    memcpy(&if_index, RTA_DATA(parm), sizeof(if_index));
+                break;
+            case NDTPA_RETRANS_TIME:
+                if (RTA_PAYLOAD(parm) >= sizeof(retrans)) {
+                    memcpy(&retrans, RTA_DATA(parm), sizeof(retrans));
+                    has |= AF_INET == ndtm->ndtm_family ?
+                        NL_LINK_HAS_V4_RETRANSMIT : NL_LINK_HAS_V6_RETRANSMIT;
+                }
+                break;
+            case NDTPA_BASE_REACHABLE_TIME:
+                if (RTA_PAYLOAD(parm) >= sizeof(reachable)) {
+                    memcpy(&reachable, RTA_DATA(parm), sizeof(reachable));
+                    if (AF_INET6 == ndtm->ndtm_family)
+                        has |= NL_LINK_HAS_V6_REACHABLE;
+                }
+                break;
+            }
+        }
     }
-#ifdef NETSNMP_ENABLE_IPV6
-    netsnmp_access_ipaddress_container_free(addr_container, 0);
+
+    /*
+     * the table defaults have no ifindex
+     */
+    if (0 == if_index)
+        return 0;
+    key = if_index;
+    link = (_nl_link_info *) bsearch(&key, nt->links, nt->count,
+                                     sizeof(*link), _nl_link_index_compare);
+    if (NULL == link)
+        return 0;
+
+    if (has & NL_LINK_HAS_V4_RETRANSMIT)
+        link->retransmit_v4 = retrans;
+    if (has & NL_LINK_HAS_V6_RETRANSMIT)
+        link->retransmit_v6 = retrans;
+    if (has & NL_LINK_HAS_V6_REACHABLE)
+        link->reachable_time = reachable;
+    link->has |= has;
+    return 0;
+}
+
+/**
+ * @internal
+ * fill in the per interface neighbour retransmit and reachable times of
+ * links (sorted by index) with one RTM_GETNEIGHTBL dump, instead of
+ * reading them from /proc/sys for every interface.
+ */
+static void
+_nl_neightbl_request(_nl_link_info *links, int count)
+{
+    struct {
+        struct nlmsghdr  n;
+        struct ndtmsg    t;
+    }               req;
+    struct _nl_neightbl_ctx nt;
+
+    memset(&req, 0, sizeof(req));
+    req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct ndtmsg));
+    req.n.nlmsg_type = RTM_GETNEIGHTBL;
+    req.n.nlmsg_flags = NLM_F_DUMP;
+    req.t.ndtm_family = AF_UNSPEC;
+
+    nt.links = links;
+    nt.count = count;
+    if (_nl_request(&req.n, _nl_neightbl_parse, &nt) < 0)
+        DEBUGMSGTL(("access:interface:netlink",
+                    "no neighbour tables, using /proc/sys\n"));
+}
+
+static int
+_nl_addr_parse(struct nlmsghdr *nlp, void *ctx)
+{
+    _nl_link_info  *link = (_nl_link_info *) ctx;
+    struct ifaddrmsg *ifa = (struct ifaddrmsg *) NLMSG_DATA(nlp);
+
+    if (RTM_NEWADDR != nlp->nlmsg_type ||
+        nlp->nlmsg_len < NLMSG_LENGTH(sizeof(*ifa)) ||
+        ifa->ifa_index != link->index)
+        return 0;
+
+    if (AF_INET == ifa->ifa_family)
+        link->addr_flags |= NETSNMP_INTERFACE_FLAGS_HAS_IPV4;
+#ifdef NETSNMP_ENABLE_IPV6
+    else if (AF_INET6 == ifa->ifa_family)
+        link->addr_flags |= NETSNMP_INTERFACE_FLAGS_HAS_IPV6;
 #endif
+    return 0;
+}
+
+/**
+ * @internal
+ * find the ip versions a single link has addresses for with a RTM_GETADDR
+ * dump, instead of loading the addresses of every interface.
+ *
+ * @retval  0 success, link->addr_flags set
+ * @retval -1 request failed
+ */
+static int
+_nl_addr_request(_nl_link_info *link)
+{
+    struct {
+        struct nlmsghdr  n;
+        struct ifaddrmsg a;
+    }               req;
+
+    memset(&req, 0, sizeof(req));
+    req.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifaddrmsg));
+    req.n.nlmsg_type = RTM_GETADDR;
+    req.n.nlmsg_flags = NLM_F_DUMP;
+    req.a.ifa_family = AF_UNSPEC;
+    req.a.ifa_index = link->index;
+
+    link->addr_flags = 0;
+    if (_nl_request(&req.n, _nl_addr_parse, link) < 0)
+        return -1;
+    link->has |= NL_LINK_HAS_ADDR_FLAGS;
+    return 0;
+}
+
+/**
+ * @internal
+ * set flags, mtu and status from netlink attributes. This mirrors
+ * netsnmp_access_interface_ioctl_flags_get(), but uses the kernel's
+ * operational state where it is known.
+ */
+static void
+_nl_link_flags_set(netsnmp_interface_entry *entry, const _nl_link_info *link)
+{
+    entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_IF_FLAGS;
+    entry->os_flags = link->os_flags;
+    entry->mtu = link->mtu;
+
+    if (entry->os_flags & IFF_UP) {
+        entry->admin_status = IFADMINSTATUS_UP;
+        if (link->operstate > 0 &&
+            link->operstate < sizeof(_nl_oper_status))
+            entry->oper_status = _nl_oper_status[link->operstate];
+        else if (entry->os_flags & IFF_RUNNING)
+            entry->oper_status = IFOPERSTATUS_UP;
+        else
+            entry->oper_status = IFOPERSTATUS_DOWN;
+    }
+    else {
+        entry->admin_status = IFADMINSTATUS_DOWN;
+        entry->oper_status = IFOPERSTATUS_DOWN;
+    }
+
+    entry->connector_present = (entry->os_flags & IFF_LOOPBACK) ? 0 : 1;
+}
+
+/**
+ * @internal
+ * set counters from netlink attributes, as _parse_stats() does for a
+ * /proc/net/dev line.
+ */
+static void
+_nl_link_stats_set(netsnmp_interface_entry *entry, const _nl_link_info *link)
+{
+    const struct rtnl_link_stats64 *st = &link->stats;
+    uint64_t        snd_pkt = st->tx_packets;
+
+    entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_BYTES;
+    entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_DROPS;
+    entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_MCAST_PKTS;
+    entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_HIGH_SPEED;
+    if (64 == link->has_stats) {
+        entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_HIGH_BYTES;
+        entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_HIGH_PACKETS;
+    }
+    entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_ACTIVE;
+
+    if (!strcmp(entry->name, "lo") && st->rx_packets > 0 && !snd_pkt)
+        snd_pkt = st->rx_packets;
+
+    entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_CALCULATE_UCAST;
+    entry->stats.ibytes.low = st->rx_bytes & 0xffffffff;
+    entry->stats.iall.low = st->rx_packets & 0xffffffff;
+    entry->stats.imcast.low = st->multicast & 0xffffffff;
+    entry->stats.obytes.low = st->tx_bytes & 0xffffffff;
+    entry->stats.oucast.low = snd_pkt & 0xffffffff;
+    entry->stats.ibytes.high = st->rx_bytes >> 32;
+    entry->stats.iall.high = st->rx_packets >> 32;
+    entry->stats.imcast.high = st->multicast >> 32;
+    entry->stats.obytes.high = st->tx_bytes >> 32;
+    entry->stats.oucast.high = snd_pkt >> 32;
+    entry->stats.ierrors   = st->rx_errors;
+    entry->stats.idiscards = st->rx_dropped;
+    entry->stats.oerrors   = st->tx_errors;
+    entry->stats.odiscards = st->tx_dropped;
+    entry->stats.collisions = st->collisions;
+
+    entry->stats.inucast = entry->stats.imcast.low +
+        entry->stats.ibcast.low;
+    entry->stats.onucast = entry->stats.omcast.low +
+        entry->stats.obcast.low;
+}
+
+/**
+ * @internal
+ * set the neighbour times and ipv6 forwarding from netlink, as
+ * _arch_interface_flags_v4_get() and _arch_interface_flags_v6_get() do
+ * from /proc/sys.
+ *
+ * @retval the NETSNMP_INTERFACE_FLAGS_HAS_IPVx bits of flags that still
+ *         have to be read from /proc/sys
+ */
+static u_int
+_nl_link_ip_flags_set(netsnmp_interface_entry *entry,
+                      const _nl_link_info *link, u_int flags)
+{
+    if ((flags & NETSNMP_INTERFACE_FLAGS_HAS_IPV4) &&
+        (link->has & NL_LINK_HAS_V4_RETRANSMIT)) {
+        entry->retransmit_v4 = link->retransmit_v4;
+        entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_V4_RETRANSMIT;
+        flags &= ~NETSNMP_INTERFACE_FLAGS_HAS_IPV4;
+    }
+
+    if ((flags & NETSNMP_INTERFACE_FLAGS_HAS_IPV6) &&
+        (link->has & NL_LINK_HAS_V6_FLAGS) == NL_LINK_HAS_V6_FLAGS) {
+        entry->retransmit_v6 = link->retransmit_v6;
+        entry->reachable_time = link->reachable_time;
+        entry->forwarding_v6 = link->forwarding_v6;
+        entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_V6_RETRANSMIT |
+            NETSNMP_INTERFACE_FLAGS_HAS_V6_REACHABLE |
+            NETSNMP_INTERFACE_FLAGS_HAS_V6_FORWARDING;
+        flags &= ~NETSNMP_INTERFACE_FLAGS_HAS_IPV6;
+    }
+
+    return flags;
+}
+
+/**
+ * @internal
+ * get the speed of an ethernet link. The ethtool ioctl is only repeated
+ * when the link could have renegotiated since the last dump: it has a new
+ * name or state, or the carrier went away in between.
+ */
+static unsigned long long
+_nl_link_speed_get(int fd, _nl_link_info *link,
+                   unsigned long long defaultspeed)
+{
+    const _nl_link_info *cached = _nl_link_cache_find(link->index);
+
+    if (NULL != cached && (cached->has & NL_LINK_HAS_SPEED) &&
+        (cached->has & link->has & NL_LINK_HAS_CARRIER_CHANGES) &&
+        cached->carrier_changes == link->carrier_changes &&
+        cached->operstate == link->operstate &&
+        0 == ((cached->os_flags ^ link->os_flags) & (IFF_UP | IFF_RUNNING)) &&
+        0 == strcmp(cached->name, link->name))
+        link->speed = cached->speed;
+    else
+        link->speed = netsnmp_linux_interface_get_if_speed(fd, link->name,
+                                                           defaultspeed);
+    link->has |= NL_LINK_HAS_SPEED;
+    return link->speed;
+}
+#endif /* HAVE_LINUX_RTNETLINK_H */
+
+/**
+ * @internal
+ * create an entry for an interface and fill in everything but the
+ * statistics. The flags, mtu and physaddr are taken from link when it
+ * is set (netlink), or queried with ioctls otherwise.
+ *
+ * @retval  0 success
+ * @retval  1 interface skipped
+ * @retval -3 could not create entry (probably malloc)
+ */
+static int
+_arch_interface_entry_load(netsnmp_interface_entry **entryp,
+                           const char *name, oid if_index,
+                           _nl_link_info *link, u_int load_flags,
+                           int fd, const struct ifconf *ifc,
+                           netsnmp_container *addr_container)
+{
+    netsnmp_interface_entry *entry;
+    u_int           flags = 0;
+
+    *entryp = NULL;
+
+    if (!netsnmp_access_interface_include(name))
+        return 1;
+
+    if (netsnmp_access_interface_max_reached(name))
+        /* we may need to stop tracking ifaces if a max was set */
+        return 1;
+
+    /*
+     * set address type flags.
+     * the only way I know of to check an interface for
+     * ip version is to look for ip addresses. If anyone
+     * knows a better way, put it here!
+     */
+#ifdef HAVE_LINUX_RTNETLINK_H
+    if (NULL != link && (link->has & NL_LINK_HAS_ADDR_FLAGS))
+        flags = link->addr_flags;
+    else
+#endif
+    {
+#ifdef NETSNMP_ENABLE_IPV6
+        if (0 == if_index)
+            if_index = netsnmp_arch_interface_index_find(name);
+        _arch_interface_has_ipv6(if_index, &flags, addr_container);
+#endif
+        netsnmp_access_interface_ioctl_has_ipv4(fd, name, 0, &flags, ifc);
+    }
+
+    /*
+     * do we only want one address type?
+     */
+    if (((load_flags & NETSNMP_ACCESS_INTERFACE_LOAD_IP4_ONLY) &&
+         ((flags & NETSNMP_INTERFACE_FLAGS_HAS_IPV4) == 0)) ||
+        ((load_flags & NETSNMP_ACCESS_INTERFACE_LOAD_IP6_ONLY) &&
+         ((flags & NETSNMP_INTERFACE_FLAGS_HAS_IPV6) == 0))) {
+        DEBUGMSGTL(("9:access:ifcontainer",
+                    "interface '%s' excluded by ip version\n",
+                    name));
+        return 1;
+    }
+
+    entry = netsnmp_access_interface_entry_create(name, if_index);
+    if(NULL == entry)
+        return -3;
+    entry->ns_flags = flags; /* initial flags; we'll set more later */
+
+#ifdef HAVE_PCI_LOOKUP_NAME
+    _arch_interface_description_get(entry);
+#endif
+
+#ifdef HAVE_LINUX_RTNETLINK_H
+    if (NULL != link) {
+        int             type;
+
+        if (link->paddr_len > 0) {
+            entry->paddr = (char*)malloc(link->paddr_len);
+            if (NULL != entry->paddr) {
+                memcpy(entry->paddr, link->paddr, link->paddr_len);
+                entry->paddr_len = link->paddr_len;
+            }
+        }
+        type = netsnmp_access_interface_arphrd_to_type(link->hwtype);
+        if (0 != type)
+            entry->type = type;
+    }
+    else
+#endif
+    /*
+     * use ioctls for some stuff
+     *  (ignore rc, so we get as much info as possible)
+     */
+    netsnmp_access_interface_ioctl_physaddr_get(fd, entry);
+
+    /*
+     * physaddr should have set type. make some guesses (based
+     * on name) if not.
+     */
+    if(0 == entry->type) {
+        typedef struct _match_if {
+           int             mi_type;
+           const char     *mi_name;
+        }              *pmatch_if, match_if;
+
+        static match_if lmatch_if[] = {
+            {IANAIFTYPE_SOFTWARELOOPBACK, "lo"},
+            {IANAIFTYPE_ETHERNETCSMACD, "eth"},
+            {IANAIFTYPE_ETHERNETCSMACD, "vmnet"},
+            {IANAIFTYPE_ISO88025TOKENRING, "tr"},
+            {IANAIFTYPE_FASTETHER, "feth"},
+            {IANAIFTYPE_GIGABITETHERNET,"gig"},
+            {IANAIFTYPE_INFINIBAND,"ib"},
+            {IANAIFTYPE_PPP, "ppp"},
+            {IANAIFTYPE_SLIP, "sl"},
+            {IANAIFTYPE_TUNNEL, "sit"},
+            {IANAIFTYPE_BASICISDN, "ippp"},
+            {IANAIFTYPE_PROPVIRTUAL, "bond"}, /* Bonding driver find fastest slave */
+            {IANAIFTYPE_PROPVIRTUAL, "vad"},  /* ANS driver - ?speed? */
+            {0, NULL}                  /* end of list */
+        };
+
+        int             len;
+        register pmatch_if pm;
+
+        for (pm = lmatch_if; pm->mi_name; pm++) {
+            len = strlen(pm->mi_name);
+            if (0 == strncmp(entry->name, pm->mi_name, len)) {
+                entry->type = pm->mi_type;
+                break;
+            }
+        }
+        if(NULL == pm->mi_name)
+            entry->type = IANAIFTYPE_OTHER;
+    }
+
+    /*
+     * interface identifier is specified based on physaddr and type
+     */
+    switch (entry->type) {
+    case IANAIFTYPE_ETHERNETCSMACD:
+    case IANAIFTYPE_ETHERNET3MBIT:
+    case IANAIFTYPE_FASTETHER:
+    case IANAIFTYPE_FASTETHERFX:
+    case IANAIFTYPE_GIGABITETHERNET:
+    case IANAIFTYPE_FDDI:
+    case IANAIFTYPE_ISO88025TOKENRING:
+        if (NULL != entry->paddr && ETH_ALEN != entry->paddr_len)
+            break;
+
+        entry->v6_if_id_len = entry->paddr_len + 2;
+        memcpy(entry->v6_if_id, entry->paddr, 3);
+        memcpy(entry->v6_if_id + 5, entry->paddr + 3, 3);
+        entry->v6_if_id[0] ^= 2;
+        entry->v6_if_id[3] = 0xFF;
+        entry->v6_if_id[4] = 0xFE;
+
+        entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_V6_IFID;
+        break;
+
+    case IANAIFTYPE_SOFTWARELOOPBACK:
+        entry->v6_if_id_len = 0;
+        entry->ns_flags |= NETSNMP_INTERFACE_FLAGS_HAS_V6_IFID;
+        break;
+    }
+
+    if (IANAIFTYPE_ETHERNETCSMACD == entry->type) {
+        unsigned long long speed;
+        unsigned long long defaultspeed = NOMINAL_LINK_SPEED;
+        if (!(entry->os_flags & IFF_RUNNING)) {
+            /*
+             * use speed 0 if the if speed cannot be determined *and* the
+             * interface is down
+             */
+            defaultspeed = 0;
+        }
+#ifdef HAVE_LINUX_RTNETLINK_H
+        if (NULL != link)
+            speed = _nl_link_speed_get(fd, link, defaultspeed);
+        else
+#endif
+        speed = netsnmp_linux_interface_get_if_speed(fd,
+                entry->name, defaultspeed);
+        if (speed > 0xffffffffL) {
+            entry->speed = 0xffffffff;
+        } else
+            entry->speed = speed;
+        entry->speed_high = speed / 1000000LL;
+    }
+#ifdef APPLIED_PATCH_836390   /* xxx-rks ifspeed fixes */
+    else if (IANAIFTYPE_PROPVIRTUAL == entry->type)
+        entry->speed = _get_bonded_if_speed(entry);
+#endif
+    else
+        netsnmp_access_interface_entry_guess_speed(entry);
+
+#ifdef HAVE_LINUX_RTNETLINK_H
+    if (NULL != link)
+        _nl_link_flags_set(entry, link);
+    else
+#endif
+    {
+        netsnmp_access_interface_ioctl_flags_get(fd, entry);
+
+        netsnmp_access_interface_ioctl_mtu_get(fd, entry);
+    }
+
+    /*
+     * Zero speed means link problem.
+     * - i'm not sure this is always true...
+     */
+    if((entry->speed == 0) && (entry->os_flags & IFF_UP)) {
+        entry->os_flags &= ~IFF_RUNNING;
+    }
+
+    /*
+     * check for promiscuous mode.
+     *  NOTE: there are 2 ways to set promiscuous mode in Linux
+     *  (kernels later than 2.2.something) - using ioctls and
+     *  using setsockopt. The ioctl method tested here does not
+     *  detect if an interface was set using setsockopt. google
+     *  on IFF_PROMISC and linux to see lots of arguments about it.
+     */
+    if(entry->os_flags & IFF_PROMISC) {
+        entry->promiscuous = 1; /* boolean */
+    }
+
+    /*
+     * hardcoded max packet size
+     * (see ip_frag_reasm: if(len > 65535) goto out_oversize;)
+     */
+    entry->reasm_max_v4 = entry->reasm_max_v6 = 65535;
+    entry->ns_flags |=
+        NETSNMP_INTERFACE_FLAGS_HAS_V4_REASMMAX |
+        NETSNMP_INTERFACE_FLAGS_HAS_V6_REASMMAX;
+
+    netsnmp_access_interface_entry_overrides(entry);
+
+#ifdef HAVE_LINUX_RTNETLINK_H
+    if (NULL != link)
+        flags = _nl_link_ip_flags_set(entry, link, flags);
+#endif
+
+    if (flags & NETSNMP_INTERFACE_FLAGS_HAS_IPV4)
+        _arch_interface_flags_v4_get(entry);
+
+#ifdef NETSNMP_ENABLE_IPV6
+    if (flags & NETSNMP_INTERFACE_FLAGS_HAS_IPV6)
+        _arch_interface_flags_v6_get(entry);
+#endif /* NETSNMP_ENABLE_IPV6 */
+
+    *entryp = entry;
+    return 0;
+}
+
+#ifdef HAVE_LINUX_RTNETLINK_H
+/**
+ * @internal
+ * load the interfaces from a netlink RTM_GETLINK dump
+ *
+ * @retval  0 success
+ * @retval -2 netlink dump failed (use /proc/net/dev instead)
+ * @retval -3 could not create entry (probably malloc)
+ */
+static int
+_arch_interface_netlink_load(netsnmp_container *container, u_int load_flags,
+                             int fd, const struct ifconf *ifc,
+                             netsnmp_container *addr_container)
+{
+    netsnmp_interface_entry *entry;
+    _nl_link_info  *links;
+    int             count, i, rc = 0;
+
+    count = _nl_link_request(0, &links);
+    if (count < 0)
+        return -2;
+    _nl_neightbl_request(links, count);
+
+    for (i = 0; i < count; ++i) {
+        DEBUGMSGTL(("9:access:ifcontainer", "processing '%s' (netlink)\n",
+                    links[i].name));
+
+        rc = _arch_interface_entry_load(&entry, links[i].name, links[i].index,
+                                        &links[i], load_flags, fd, ifc,
+                                        addr_container);
+        if (rc < 0)
+            break;
+        if (rc > 0) {
+            rc = 0;
+            continue;
+        }
+
+        if (! (load_flags & NETSNMP_ACCESS_INTERFACE_LOAD_NO_STATS) &&
+            links[i].has_stats)
+            _nl_link_stats_set(entry, &links[i]);
+
+        /*
+         * add to container
+         */
+        CONTAINER_INSERT(container, entry);
+    }
+
+    free(_nl_link_cache);
+    _nl_link_cache = links;
+    _nl_link_cache_count = count;
+    return rc;
+}
+#endif /* HAVE_LINUX_RTNETLINK_H */
+
+/**
+ * @internal
+ * load the interfaces from /proc/net/dev, using ioctls for the rest
+ *
+ * @retval  0 success
+ * @retval -2 could not open /proc/net/dev
+ * @retval -3 could not create entry (probably malloc)
+ */
+static int
+_arch_interface_proc_load(netsnmp_container *container, u_int load_flags,
+                          int fd, const struct ifconf *ifc,
+                          netsnmp_container *addr_container)
+{
+    FILE           *devin;
+    char            line[256];
+    netsnmp_interface_entry *entry = NULL;
+    static char     scan_expected = 0;
+    int             rc;
+
+    if (!(devin = fopen("/proc/net/dev", "r"))) {
+        DEBUGMSGTL(("access:interface",
+                    "Failed to load Interface Table (linux1)\n"));
+        snmp_log_perror("interface_linux: cannot open /proc/net/dev");
+        return -2;
+    }
+
+    /*
+     * Read the first two lines of the file, containing the header
+     * This indicates which version of the kernel we're working with,
+     * and hence which statistics are actually available.
+     *
+     * Wes originally suggested parsing the field names in this header
+     * to detect the position of individual fields directly,
+     * but I suspect this is probably more trouble than it's worth.
+     */
+    NETSNMP_IGNORE_RESULT(fgets(line, sizeof(line), devin));
+    NETSNMP_IGNORE_RESULT(fgets(line, sizeof(line), devin));
+
+    if( 0 == scan_expected ) {
+        if (strstr(line, "compressed")) {
+            scan_expected = 10;
+            DEBUGMSGTL(("access:interface",
+                        "using linux 2.2 kernel /proc/net/dev\n"));
+        } else {
+            scan_expected = 5;
+            DEBUGMSGTL(("access:interface",
+                        "using linux 2.0 kernel /proc/net/dev\n"));
+        }
+    }
+
+    /*
+     * The rest of the file provides the statistics for each interface.
+     * Read in each line in turn, isolate the interface name
+     *   and retrieve (or create) the corresponding data structure.
+     */
+    while (fgets(line, sizeof(line), devin)) {
+        char           *stats, *ifstart = line;
+
+        if (line[strlen(line) - 1] == '\n')
+            line[strlen(line) - 1] = '\0';
+
+        while (*ifstart && *ifstart == ' ')
+            ifstart++;
+
+        if ((!*ifstart) || ((stats = strrchr(ifstart, ':')) == NULL)) {
+            snmp_log(LOG_ERR,
+                     "interface data format error 1, line ==|%s|\n", line);
+            continue;
+        }
+        if ((scan_expected == 10) && ((stats - line) < 6)) {
+            snmp_log(LOG_ERR,
+                     "interface data format error 2 (%d < 6), line ==|%s|\n",
+                     (int)(stats - line), line);
+        }
+
+        DEBUGMSGTL(("9:access:ifcontainer", "processing '%s'\n", ifstart));
+
+        /*
+         * get index via ioctl.
+         * If we've met this interface before, use the same index.
+         * Otherwise find an unused index value and use that.
+         */
+        *stats++ = 0; /* null terminate name */
+
+        rc = _arch_interface_entry_load(&entry, ifstart, 0, NULL, load_flags,
+                                        fd, ifc, addr_container);
+        if (rc < 0) {
+            fclose(devin);
+            return rc;
+        }
+        if (rc > 0)
+            continue;
+
+        if (! (load_flags & NETSNMP_ACCESS_INTERFACE_LOAD_NO_STATS))
+            _parse_stats(entry, stats, scan_expected);
+
+        /*
+         * add to container
+         */
+        CONTAINER_INSERT(container, entry);
+    }
     fclose(devin);
+    return 0;
+}
+
+/*
+ *
+ * @retval  0 success
+ * @retval -1 no container specified
+ * @retval -2 could not open /proc/net/dev
+ * @retval -3 could not create entry (probably malloc)
+ */
+int
+netsnmp_arch_interface_container_load(netsnmp_container* container,
+                                      u_int load_flags)
+{
+    int             fd;
+    int             interfaces = 0;
+    int             rc = -2;
+    struct ifconf   ifc;
+    netsnmp_container *addr_container = NULL;
+
+    DEBUGMSGTL(("access:interface:container:arch", "load (flags %x)\n",
+                load_flags));
+
+    if (NULL == container) {
+        snmp_log(LOG_ERR, "no container specified/found for interface\n");
+        return -1;
+    }
+
+    /*
+     * create socket for ioctls
+     */
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if(fd < 0) {
+        snmp_log_perror("interface_linux: could not create socket");
+        return -2;
+    }
+
+    interfaces = netsnmp_access_ipaddress_ioctl_get_interface_count(fd, &ifc);
+    if (interfaces < 0) {
+        snmp_log(LOG_ERR,"get interface count failed\n");
+        close(fd);
+        return -2;
+    }
+    netsnmp_assert(NULL != ifc.ifc_buf);
+
+#ifdef NETSNMP_ENABLE_IPV6
+    /*
+     * get ipv6 addresses
+     */
+    addr_container = netsnmp_access_ipaddress_container_load(NULL, 0);
+#endif
+
+#ifdef HAVE_LINUX_RTNETLINK_H
+    rc = _arch_interface_netlink_load(container, load_flags, fd, &ifc,
+                                      addr_container);
+    if (-2 == rc)
+        DEBUGMSGTL(("access:interface",
+                    "netlink unavailable, using /proc/net/dev\n"));
+#endif
+    if (-2 == rc)
+        rc = _arch_interface_proc_load(container, load_flags, fd, &ifc,
+                                       addr_container);
+
+#ifdef NETSNMP_ENABLE_IPV6
+    netsnmp_access_ipaddress_container_free(addr_container, 0);
+#endif
     close(fd);
     free(ifc.ifc_buf);
+    return rc;
+}
+
+/**
+ * load a single interface with a RTM_GETLINK request. Its addresses
+ * are asked for with a RTM_GETADDR request for that interface, instead
+ * of loading the addresses of every interface.
+ *
+ * @retval NULL  interface not found, excluded or error
+ * @retval !NULL new entry
+ */
+netsnmp_interface_entry *
+netsnmp_arch_interface_entry_load(oid if_index, u_int load_flags)
+{
+#ifdef HAVE_LINUX_RTNETLINK_H
+    netsnmp_interface_entry *entry = NULL;
+    _nl_link_info  *links, *cached;
+    struct ifconf   ifc, *ifcp = NULL;
+    int             fd, rc;
+
+    if (_nl_link_request(if_index, &links) <= 0) {
+        free(links);
+        return NULL;
+    }
+
+    /*
+     * for the ethtool speed, or the ioctls if netlink has no addresses
+     */
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) {
+        snmp_log_perror("interface_linux: could not create socket");
+        free(links);
+        return NULL;
+    }
+
+    if (0 != _nl_addr_request(links)) {
+        if (netsnmp_access_ipaddress_ioctl_get_interface_count(fd, &ifc) < 0) {
+            close(fd);
+            free(links);
+            return NULL;
+        }
+        ifcp = &ifc;
+    }
+
+    /*
+     * without an address container, _arch_interface_has_ipv6() only
+     * loads the ipv6 addresses
+     */
+    rc = _arch_interface_entry_load(&entry, links->name, links->index, links,
+                                    load_flags, fd, ifcp, NULL);
+    if ((0 == rc) && ! (load_flags & NETSNMP_ACCESS_INTERFACE_LOAD_NO_STATS) &&
+        links->has_stats)
+        _nl_link_stats_set(entry, links);
+    if ((NULL != entry) && (links->has & NL_LINK_HAS_SPEED) &&
+        (NULL != (cached = _nl_link_cache_find(if_index))))
+        *cached = *links;
+
+    if (NULL != ifcp)
+        free(ifc.ifc_buf);
+    close(fd);
+    free(links);
+    return entry;
+#else
+    return NULL;
+#endif /* HAVE_LINUX_RTNETLINK_H */
+}
+
+/**
+ * update the statistics of an entry with a RTM_GETLINK request
+ *
+ * @retval  0 success
+ * @retval -1 interface not found or error
+ */
+int
+netsnmp_arch_interface_entry_stats_load(netsnmp_interface_entry *entry)
+{
+#ifdef HAVE_LINUX_RTNETLINK_H
+    _nl_link_info  *links;
+    int             rc = -1;
+
+    if ((_nl_link_request(entry->index, &links) > 0) &&
+        links->has_stats && (0 == strcmp(links->name, entry->name))) {
+        _nl_link_stats_set(entry, links);
+        rc = 0;
+    }
+    free(links);
+    return rc;
+#else
+    return -1;
+#endif /* HAVE_LINUX_RTNETLINK_H */
+}
+
+#ifdef HAVE_LINUX_RTNETLINK_H
+static int      _nl_event_fd = -1;
+static void     (*_nl_event_cb)(oid, int, void *);
+static void    *_nl_event_ctx;
+
+/*
+ * read RTMGRP_LINK notifications and pass them on
+ */
+static void
+_nl_link_event_read(int fd, void *data)
+{
+    char            buf[16384];
+    struct nlmsghdr *nlp;
+    struct ifinfomsg *ifi;
+    ssize_t         len;
+
+    for (;;) {
+        len = recv(fd, buf, sizeof(buf), MSG_DONTWAIT | MSG_TRUNC);
+        if (len < 0) {
+            if (EINTR == errno)
+                continue;
+            if (EAGAIN == errno)
+                break;
+            if (ENOBUFS == errno) {
+                /*
+                 * the socket overflowed and we lost track
+                 */
+                DEBUGMSGTL(("access:interface:events", "overflow\n"));
+                (*_nl_event_cb)(0, NETSNMP_ACCESS_INTERFACE_EVENT_OVERFLOW,
+                                _nl_event_ctx);
+                continue;
+            }
+            snmp_log_perror("interface_linux: netlink event recv");
+            break;
+        }
+        if (0 == len)
+            break;
+        if (len > (ssize_t) sizeof(buf)) {
+            (*_nl_event_cb)(0, NETSNMP_ACCESS_INTERFACE_EVENT_OVERFLOW,
+                            _nl_event_ctx);
+            continue;
+        }
+
+        for (nlp = (struct nlmsghdr *) buf; NLMSG_OK(nlp, len);
+             nlp = NLMSG_NEXT(nlp, len)) {
+            if (RTM_NEWLINK != nlp->nlmsg_type &&
+                RTM_DELLINK != nlp->nlmsg_type)
+                continue;
+            if (nlp->nlmsg_len < NLMSG_LENGTH(sizeof(*ifi)))
+                continue;
+            ifi = (struct ifinfomsg *) NLMSG_DATA(nlp);
+
+            DEBUGMSGTL(("access:interface:events", "%s ifIndex %d\n",
+                        RTM_NEWLINK == nlp->nlmsg_type ? "new" : "del",
+                        ifi->ifi_index));
+            (*_nl_event_cb)(ifi->ifi_index,
+                            RTM_NEWLINK == nlp->nlmsg_type ?
+                            NETSNMP_ACCESS_INTERFACE_EVENT_CHANGED :
+                            NETSNMP_ACCESS_INTERFACE_EVENT_REMOVED,
+                            _nl_event_ctx);
+        }
+    }
+}
+#endif /* HAVE_LINUX_RTNETLINK_H */
+
+/**
+ * subscribe to RTMGRP_LINK notifications
+ *
+ * @retval  0 success
+ * @retval -1 error, or already subscribed
+ */
+int
+netsnmp_arch_interface_events_register(void (*cb)(oid, int, void *),
+                                       void *ctx)
+{
+#ifdef HAVE_LINUX_RTNETLINK_H
+    struct sockaddr_nl sa;
+    int             fd;
+
+    if (_nl_event_fd >= 0 || NULL == cb)
+        return -1;
+
+    fd = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+    if (fd < 0) {
+        snmp_log_perror("interface_linux: netlink event socket");
+        return -1;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.nl_family = AF_NETLINK;
+    sa.nl_groups = RTMGRP_LINK;
+    if (bind(fd, (struct sockaddr *) &sa, sizeof(sa)) < 0) {
+        snmp_log_perror("interface_linux: netlink event bind");
+        close(fd);
+        return -1;
+    }
+
+    if (register_readfd(fd, _nl_link_event_read, NULL) != 0) {
+        snmp_log(LOG_ERR, "interface_linux: error registering netlink "
+                 "event socket\n");
+        close(fd);
+        return -1;
+    }
+
+    _nl_event_fd = fd;
+    _nl_event_cb = cb;
+    _nl_event_ctx = ctx;
     return 0;
+#else
+    return -1;
+#endif /* HAVE_LINUX_RTNETLINK_H */
+}
+
+void
+netsnmp_arch_interface_events_unregister(void)
+{
+#ifdef HAVE_LINUX_RTNETLINK_H
+    if (_nl_event_fd < 0)
+        return;
+
+    unregister_readfd(_nl_event_fd);
+    close(_nl_event_fd);
+    _nl_event_fd = -1;
+    _nl_event_cb = NULL;
+    _nl_event_ctx = NULL;
+#endif /* HAVE_LINUX_RTNETLINK_H */
 }
 
 #ifndef NETSNMP_FEATURE_REMOVE_INTERFACE_ARCH_SET_ADMIN_STATUS
@@ -10,3 +10,12 @@ int netsnmp_arch_interface_container_load(struct netsnmp_container_s* container,
 oid netsnmp_arch_interface_index_find(const char *name);
 int netsnmp_arch_set_admin_status(struct netsnmp_interface_entry_s * entry,
                                   int ifAdminStatus_val);
+#ifdef linux
+struct netsnmp_interface_entry_s *
+netsnmp_arch_interface_entry_load(oid if_index, u_int load_flags);
+int netsnmp_arch_interface_entry_stats_load(struct netsnmp_interface_entry_s
+                                            *entry);
+int netsnmp_arch_interface_events_register(void (*cb)(oid, int, void *),
+                                           void *ctx);
+void netsnmp_arch_interface_events_unregister(void);
+#endif
@@ -111,6 +111,11 @@ init_ifTable(void)
     snmp_register_callback(SNMP_CALLBACK_LIBRARY,
                            SNMP_CALLBACK_POST_READ_CONFIG,
                            _init_ifTable, NULL);
+    /*
+     * after _init_ifTable, so that its post config callback finds
+     * the table set up.
+     */
+    ifTable_register_config();
 }
 
 /**
@@ -326,6 +326,7 @@ config_exclude(mibII/interfaces)
          * TODO:131:o: |   |-> Add useful data to ifTable rowreq context.
          */
         char            known_missing;
+        u_long          stats_refreshed;        /* agent uptime */
 	u_char          undo_ref_count;
 
         /*
@@ -49,10 +49,20 @@ static int fadeout = IFTABLE_REMOVE_MISSING_AFTER;
  * Value of interface_replace_old config option
  */
 static int replace_old = 0;
+/*
+ * Value of interface_events config option, and whether the container
+ * is currently kept up to date by interface events.
+ */
+static int use_events = 0;
+static int _events_active = 0;
+static netsnmp_cache *_ifTable_cache = NULL;
 
 static void
 _delete_missing_interface(ifTable_rowreq_ctx *rowreq_ctx,
                           netsnmp_container *container);
+static int
+_ifTable_events_config(int majorID, int minorID, void *serverargs,
+                       void *clientarg);
 
 /** @ingroup interface 
  * @defgroup data_access data_access: Routines to access data
@@ -100,6 +110,14 @@ parse_interface_replace_old(const char *token, char *line)
     snmp_log(LOG_ERR, "Invalid value of interface_replace_old parameter: '%s'\n",
             line);
 }
+static void
+parse_interface_events(const char *token, char *line)
+{
+    int             val = netsnmp_ds_parse_boolean(line);
+
+    if (val >= 0)
+        use_events = val;
+}
 
 /**
  * initialization for ifTable data access
@@ -121,13 +139,29 @@ ifTable_init_data(ifTable_registration * ifTable_reg)
     /*
      * TODO:303:o: Initialize ifTable data.
      */
+
+    return MFD_SUCCESS;
+}                               /* ifTable_init_data */
+
+/**
+ * register the ifTable configuration tokens
+ *
+ * The table itself is only initialized once the configuration has been
+ * read, so this has to be done earlier, from init_ifTable().
+ */
+void
+ifTable_register_config(void)
+{
     snmpd_register_config_handler("interface_fadeout", parse_interface_fadeout, NULL,
             "interface_fadeout seconds");
     snmpd_register_config_handler("interface_replace_old",
             parse_interface_replace_old, NULL, "interface_replace_old yes|no");
-
-    return MFD_SUCCESS;
-}                               /* ifTable_init_data */
+    snmpd_register_config_handler("interface_events",
+            parse_interface_events, NULL, "interface_events yes|no");
+    snmp_register_callback(SNMP_CALLBACK_LIBRARY,
+                           SNMP_CALLBACK_POST_READ_CONFIG,
+                           _ifTable_events_config, NULL);
+}
 
 /**
  * container overview
@@ -197,6 +231,7 @@ ifTable_container_init(netsnmp_container **container_ptr_ptr,
      * At 100 Mbps it is ~5 minutes, and at 1 Gbps, ~34 seconds.
      */
     cache->timeout = IFTABLE_CACHE_TIMEOUT;     /* seconds */
+    _ifTable_cache = cache;
 
     /*
      * don't release resources
@@ -408,6 +443,7 @@ _check_interface_entry_for_updates(ifTable_rowreq_ctx * rowreq_ctx,
             oper_changed = 1;
         netsnmp_access_interface_entry_copy(rowreq_ctx->data.ifentry,
                                             ifentry);
+        rowreq_ctx->stats_refreshed = netsnmp_get_agent_uptime();
 
         /*
          * remove entry from temporary ifcontainer
@@ -499,6 +535,7 @@ _add_new_interface(netsnmp_interface_entry *ifentry,
         if (replace_old)
                 _check_and_replace_old(ifentry, container);
 
+        rowreq_ctx->stats_refreshed = netsnmp_get_agent_uptime();
         CONTAINER_INSERT(container, rowreq_ctx);
         if (0 == _first_load) {
             rowreq_ctx->data.ifLastChange = netsnmp_get_agent_uptime();
@@ -570,8 +607,173 @@ ifTable_container_shutdown(netsnmp_container *container_ptr)
         return;
     }
 
+    if (_events_active) {
+        netsnmp_access_interface_events_unregister();
+        _events_active = 0;
+    }
 }                               /* ifTable_container_shutdown */
 
+/**
+ * apply a fresh copy of interface data to the container.
+ *
+ * @param container  the ifTable container
+ * @param cdc        current holds the fresh interface entries
+ * @param rowreq_ctx the only row to check (may be NULL), if all is 0
+ * @param all        check every row of the container
+ */
+static void
+_ifTable_container_update(netsnmp_container *container, cd_container *cdc,
+                          ifTable_rowreq_ctx *rowreq_ctx, int all)
+{
+    /*
+     * compare it to what we've already got, and make any adjustements...
+     */
+    if (all)
+        CONTAINER_FOR_EACH(container, (netsnmp_container_obj_func *)
+                           _check_interface_entry_for_updates, cdc);
+    else if (NULL != rowreq_ctx)
+        _check_interface_entry_for_updates(rowreq_ctx, cdc);
+
+    /*
+     * now remove any missing interfaces
+     */
+    if (NULL != cdc->deleted) {
+       CONTAINER_FOR_EACH(cdc->deleted,
+                          (netsnmp_container_obj_func *) _delete_missing_interface,
+                          container);
+       CONTAINER_FREE(cdc->deleted);
+    }
+
+    /*
+     * now add any new interfaces
+     */
+    CONTAINER_FOR_EACH(cdc->current,
+                       (netsnmp_container_obj_func *) _add_new_interface,
+                       container);
+
+    /*
+     * free the container. we've either claimed each ifentry, or released it,
+     * so the dal function doesn't need to clear the container.
+     */
+    netsnmp_access_interface_container_free(cdc->current,
+                                            NETSNMP_ACCESS_INTERFACE_FREE_DONT_CLEAR);
+}
+
+static void     _ifTable_fadeout_check(unsigned int clientreg, void *clientarg);
+
+/**
+ * interface event callback: reload just the interface that changed.
+ */
+static void
+_ifTable_interface_event(oid if_index, int event, void *ctx)
+{
+    netsnmp_cache  *cache = (netsnmp_cache *) ctx;
+    netsnmp_container *container = (netsnmp_container *) cache->magic;
+    netsnmp_interface_entry *ifentry;
+    ifTable_rowreq_ctx *rowreq_ctx;
+    netsnmp_index   tmp;
+    cd_container    cdc;
+    char            was_missing;
+
+    DEBUGMSGTL(("ifTable:access", "interface event %d for %" NETSNMP_PRIo
+                "u\n", event, if_index));
+
+    if ((NETSNMP_ACCESS_INTERFACE_EVENT_OVERFLOW == event) ||
+        (NULL == container) || !cache->valid) {
+        /*
+         * we lost track; reload everything
+         */
+        cache->expired = 1;
+        netsnmp_cache_check_and_reload(cache);
+        return;
+    }
+
+    cdc.current =
+        netsnmp_access_interface_container_init(NETSNMP_ACCESS_INTERFACE_INIT_NOFLAGS);
+    if (NULL == cdc.current)
+        return;
+    cdc.deleted = NULL;
+
+    if (NETSNMP_ACCESS_INTERFACE_EVENT_CHANGED == event) {
+        ifentry = netsnmp_access_interface_entry_load(if_index,
+                                                      NETSNMP_ACCESS_INTERFACE_LOAD_NOFLAGS);
+        if (NULL != ifentry)
+            CONTAINER_INSERT(cdc.current, ifentry);
+    }
+
+    tmp.len = 1;
+    tmp.oids = &if_index;
+    rowreq_ctx = (ifTable_rowreq_ctx *) CONTAINER_FIND(container, &tmp);
+    if ((NULL == rowreq_ctx) && (0 == CONTAINER_SIZE(cdc.current))) {
+        netsnmp_access_interface_container_free(cdc.current,
+                                                NETSNMP_ACCESS_INTERFACE_FREE_NOFLAGS);
+        return;
+    }
+    was_missing = rowreq_ctx ? rowreq_ctx->known_missing : 0;
+
+    _ifTable_container_update(container, &cdc, rowreq_ctx, 0);
+
+    /*
+     * nothing reloads the container every few seconds, so come back to
+     * remove the row once it has been missing for long enough.
+     */
+    if ((NULL != rowreq_ctx) && !was_missing &&
+        (rowreq_ctx == CONTAINER_FIND(container, &tmp)) &&
+        rowreq_ctx->known_missing)
+        snmp_alarm_register(fadeout + 1, 0, _ifTable_fadeout_check,
+                            (void *) (uintptr_t) if_index);
+}
+
+static void
+_ifTable_fadeout_check(unsigned int clientreg, void *clientarg)
+{
+    if (_events_active)
+        _ifTable_interface_event((oid) (uintptr_t) clientarg,
+                                 NETSNMP_ACCESS_INTERFACE_EVENT_CHANGED,
+                                 _ifTable_cache);
+}
+
+/**
+ * start or stop following interface events after the configuration
+ * has been read.
+ */
+static int
+_ifTable_events_config(int majorID, int minorID, void *serverargs,
+                       void *clientarg)
+{
+    int             timeout;
+
+    if ((NULL == _ifTable_cache) || (use_events == _events_active))
+        return 0;
+
+    if (use_events) {
+        if (0 != netsnmp_access_interface_events_register(
+                _ifTable_interface_event, _ifTable_cache)) {
+            snmp_log(LOG_WARNING, "interface_events: interface events not "
+                     "available, reloading ifTable periodically\n");
+            return 0;
+        }
+        _events_active = 1;
+        timeout = IFTABLE_EVENTS_RESYNC;
+    } else {
+        netsnmp_access_interface_events_unregister();
+        _events_active = 0;
+        timeout = IFTABLE_CACHE_TIMEOUT;
+    }
+    DEBUGMSGTL(("ifTable:access", "interface events %s\n",
+                _events_active ? "on" : "off"));
+
+    /*
+     * the periodic reload is now only a safety net against missed events
+     */
+    _ifTable_cache->timeout = timeout;
+    if (0 != _ifTable_cache->timer_id) {
+        netsnmp_cache_timer_stop(_ifTable_cache);
+        netsnmp_cache_timer_start(_ifTable_cache);
+    }
+    return 0;
+}
+
 /**
  * load initial data
  *
@@ -630,35 +832,9 @@ ifTable_container_load(netsnmp_container *container)
     cdc.deleted = NULL; /* created as needed */
 
     /*
-     * we just got a fresh copy of interface data. compare it to
-     * what we've already got, and make any adjustements...
+     * we just got a fresh copy of interface data. apply it.
      */
-    CONTAINER_FOR_EACH(container, (netsnmp_container_obj_func *)
-                       _check_interface_entry_for_updates, &cdc);
-
-    /*
-     * now remove any missing interfaces
-     */
-    if (NULL != cdc.deleted) {
-       CONTAINER_FOR_EACH(cdc.deleted,
-                          (netsnmp_container_obj_func *) _delete_missing_interface,
-                          container);
-       CONTAINER_FREE(cdc.deleted);
-    }
-
-    /*
-     * now add any new interfaces
-     */
-    CONTAINER_FOR_EACH(cdc.current,
-                       (netsnmp_container_obj_func *) _add_new_interface,
-                       container);
-
-    /*
-     * free the container. we've either claimed each ifentry, or released it,
-     * so the dal function doesn't need to clear the container.
-     */
-    netsnmp_access_interface_container_free(cdc.current,
-                                            NETSNMP_ACCESS_INTERFACE_FREE_DONT_CLEAR);
+    _ifTable_container_update(container, &cdc, NULL, 1);
 
     DEBUGMSGT(("verbose:ifTable:ifTable_cache_load",
                "%lu records\n", (unsigned long)CONTAINER_SIZE(container)));
@@ -717,6 +893,20 @@ ifTable_row_prep(ifTable_rowreq_ctx * rowreq_ctx)
      * If populating row data was delayed, this is the place to
      * fill in the row for this request.
      */
+    /*
+     * when following interface events the container is not reloaded
+     * every few seconds, so refresh the counters of this row once they
+     * are older than that.
+     */
+    if (_events_active) {
+        u_long          now = netsnmp_get_agent_uptime();
+
+        if (now - rowreq_ctx->stats_refreshed >= IFTABLE_CACHE_TIMEOUT * 100) {
+            netsnmp_access_interface_entry_stats_refresh(rowreq_ctx->data.
+                                                         ifentry);
+            rowreq_ctx->stats_refreshed = now;
+        }
+    }
 
     return MFD_SUCCESS;
 }                               /* ifTable_row_prep */
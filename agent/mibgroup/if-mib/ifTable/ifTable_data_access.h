@@ -36,6 +36,7 @@ extern          "C" {
 
 
     int             ifTable_init_data(ifTable_registration * ifTable_reg);
+    void            ifTable_register_config(void);
 
 
     /*
@@ -50,6 +51,12 @@ extern          "C" {
 
 #define IFTABLE_REMOVE_MISSING_AFTER     (5 * 60) /* seconds */
 
+    /*
+     * with interface_events, the container is only reloaded this often,
+     * in case events were missed.
+     */
+#define IFTABLE_EVENTS_RESYNC            (5 * 60) /* seconds */
+
     void            ifTable_container_init(netsnmp_container
                                            **container_ptr_ptr,
                                            netsnmp_cache * cache);
@@ -97,8 +97,11 @@ ifXTable_row_prep(ifXTable_rowreq_ctx * rowreq_ctx)
      * If populating row data was delayed, this is the place to
      * fill in the row for this request.
      */
-
-    return MFD_SUCCESS;
+    /*
+     * the rows are shared with ifTable, which knows when the
+     * counters need a refresh.
+     */
+    return ifTable_row_prep(rowreq_ctx);
 }                               /* ifXTable_row_prep */
 
 /** @} */
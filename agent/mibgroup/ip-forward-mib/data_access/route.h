@@ -22,6 +22,9 @@ config_require(ip-forward-mib/data_access/route_common)
 #if defined( linux )
 config_require(ip-forward-mib/data_access/route_linux)
 config_require(ip-forward-mib/data_access/route_ioctl)
+#if defined( HAVE_LINUX_RTNETLINK_H )
+config_require(ip-forward-mib/data_access/route_netlink)
+#endif
 #elif defined( freebsd7 ) || defined( netbsd5 ) || defined( openbsd4 ) || defined( dragonfly ) || defined( darwin )
 config_require(ip-forward-mib/data_access/route_sysctl)
 #elif defined(solaris2)
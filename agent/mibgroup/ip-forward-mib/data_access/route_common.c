@@ -82,6 +82,77 @@ netsnmp_access_route_container_free(netsnmp_container *container, u_int free_fla
         CONTAINER_FREE(container);
 }
 
+#ifndef HAVE_LINUX_RTNETLINK_H
+/**---------------------------------------------------------------------*/
+/*
+ * access functions, for when the kernel can't tell us about route
+ * changes: every load reads all routes again.
+ */
+netsnmp_route_access *
+netsnmp_access_route_create(u_int load_flags,
+                            NetsnmpAccessRouteUpdate *update_hook,
+                            NetsnmpAccessRouteGC *gc_hook,
+                            int *cache_timeout, int *cache_flags,
+                            char *cache_expired)
+{
+    netsnmp_route_access *access;
+
+    access = SNMP_MALLOC_TYPEDEF(netsnmp_route_access);
+    if (NULL == access) {
+        snmp_log(LOG_ERR,"malloc error in netsnmp_access_route_create\n");
+        return NULL;
+    }
+
+    access->load_flags = load_flags;
+    access->update_hook = update_hook;
+    access->gc_hook = gc_hook;
+    access->cache_expired = cache_expired;
+
+    return access;
+}
+
+int
+netsnmp_access_route_delete(netsnmp_route_access *access)
+{
+    free(access);
+    return 0;
+}
+
+static void
+_access_route_entry_update(netsnmp_route_entry *entry,
+                           netsnmp_route_access *access)
+{
+    entry->generation = access->generation;
+    access->update_hook(access, entry);
+}
+
+int
+netsnmp_access_route_load(netsnmp_route_access *access)
+{
+    netsnmp_container *container;
+
+    container = netsnmp_access_route_container_load(NULL, access->load_flags);
+    if (NULL == container)
+        return -1;
+
+    access->generation++;
+    CONTAINER_FOR_EACH(container,
+                       (netsnmp_container_obj_func *) _access_route_entry_update,
+                       access);
+    netsnmp_access_route_container_free(container,
+                                        NETSNMP_ACCESS_ROUTE_FREE_DONT_CLEAR);
+    access->gc_hook(access);
+
+    return 0;
+}
+
+int
+netsnmp_access_route_unload(netsnmp_route_access *access)
+{
+    return 0;
+}
+#endif /* HAVE_LINUX_RTNETLINK_H */
+
 /**---------------------------------------------------------------------*/
 /*
  * ifentry functions
@@ -223,8 +294,9 @@ netsnmp_access_route_entry_copy(netsnmp_route_entry *lhs,
             lhs->rt_policy = rhs->rt_policy;
         }
         else {
+            /* rt_policy_len is in bytes, not oids */
             snmp_clone_mem((void **) &lhs->rt_policy, rhs->rt_policy,
-                           rhs->rt_policy_len * sizeof(oid));
+                           rhs->rt_policy_len);
         }
     }
     lhs->rt_policy_len = rhs->rt_policy_len;
@@ -259,6 +331,31 @@ netsnmp_access_route_entry_copy(netsnmp_route_entry *lhs,
     return 0;
 }
 
+/**
+ * update the columns of a route entry that are not part of its index,
+ * from another entry for the same route
+ *
+ * Unlike netsnmp_access_route_entry_copy(), this leaves the addresses
+ * and policy (and their storage) alone, as they must be the same anyway.
+ */
+void
+netsnmp_access_route_entry_update(netsnmp_route_entry *lhs,
+                                  const netsnmp_route_entry *rhs)
+{
+    lhs->if_index = rhs->if_index;
+    lhs->rt_type = rhs->rt_type;
+    lhs->rt_proto = rhs->rt_proto;
+
+    lhs->rt_age = rhs->rt_age;
+    lhs->rt_nexthop_as = rhs->rt_nexthop_as;
+
+    lhs->rt_metric1 = rhs->rt_metric1;
+    lhs->rt_metric2 = rhs->rt_metric2;
+    lhs->rt_metric3 = rhs->rt_metric3;
+    lhs->rt_metric4 = rhs->rt_metric4;
+    lhs->rt_metric5 = rhs->rt_metric5;
+}
+
 
 /**---------------------------------------------------------------------*/
 /*
@@ -13,6 +13,9 @@
 #include <net-snmp/data_access/ipaddress.h>
 
 #include "ip-forward-mib/data_access/route_ioctl.h"
+#ifdef HAVE_LINUX_RTNETLINK_H
+#include "ip-forward-mib/data_access/route_netlink.h"
+#endif
 #include "ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_constants.h"
 #include "if-mib/data_access/interface_ioctl.h"
 #include "route.h"
@@ -343,7 +346,7 @@ _load_ipv6(netsnmp_container* container, u_long *index )
  *
  * @retval  0 success
  * @retval -1 no container specified
- * @retval -2 could not open data file
+ * @retval -2 could not open data file (or netlink dump failed)
  */
 int
 netsnmp_access_route_container_arch_load(netsnmp_container* container,
@@ -360,6 +363,16 @@ netsnmp_access_route_container_arch_load(netsnmp_container* container,
         return -1;
     }
 
+#ifdef HAVE_LINUX_RTNETLINK_H
+    /*
+     * a netlink dump is much cheaper than parsing /proc with a lot of
+     * routes; fall back to /proc if netlink can't be used.
+     */
+    rc = _netsnmp_netlink_route_load(container, load_flags, &count);
+    if (-1 != rc)
+        return rc;
+#endif
+
     rc = _load_ipv4(container, &count);
     
 #ifdef NETSNMP_ENABLE_IPV6
@@ -0,0 +1,706 @@
+/*
+ *  Interface MIB architecture support
+ *
+ * Routes are read with an RTM_GETROUTE dump.  A table that keeps its
+ * container between requests can also subscribe to the route change
+ * notifications and apply each one as it arrives, instead of reading the
+ * whole route table again, which takes a while with a full BGP table.
+ */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include "mibII/mibII_common.h"
+
+#include <net-snmp/agent/net-snmp-agent-includes.h>
+#include <net-snmp/data_access/route.h>
+
+#include "ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_constants.h"
+#include "route.h"
+#include "route_private.h"
+#include "route_netlink.h"
+
+#include <errno.h>
+#include <stdint.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <net/if.h>
+#include <linux/types.h>
+#include <linux/rtnetlink.h>
+
+/*
+ * the kernel fills dump messages up to 32k
+ */
+#define ROUTE_NETLINK_BUF_SIZE      65536
+/*
+ * room for a burst of notifications, e.g. when a BGP session goes down
+ */
+#define ROUTE_NETLINK_RCVBUF        (4 * 1024 * 1024)
+/*
+ * the container is kept up to date while it is in use, and dropped after
+ * this many seconds without requests.  Long enough for the usual polling
+ * intervals, so that a poll does not have to read the route table again.
+ */
+#define ROUTE_NETLINK_IDLE_TIMEOUT  600
+/*
+ * how often to retry a dump that lost notifications
+ */
+#define ROUTE_NETLINK_DUMP_RETRIES  3
+
+typedef struct {
+    int             fd;
+    int             lost;   /* notifications lost since the last dump */
+    int            *up_links;   /* sorted if indexes of the links up */
+    int             up_count;
+    int             up_size;
+} _route_netlink;
+
+typedef void (_route_entry_fn)(netsnmp_route_entry *entry, void *ctx);
+
+typedef struct {
+    netsnmp_container *container;
+    u_long         *index;
+} _load_ctx;
+
+static void _access_route_read_netlink(int fd, void *data);
+
+static u_char
+_type_from_rtm(unsigned char rtm_type, int has_gateway)
+{
+    switch (rtm_type) {
+    case RTN_UNICAST:
+        return has_gateway ? INETCIDRROUTETYPE_REMOTE :
+            INETCIDRROUTETYPE_LOCAL;
+    case RTN_LOCAL:
+    case RTN_BROADCAST:
+    case RTN_ANYCAST:
+    case RTN_MULTICAST:
+        return INETCIDRROUTETYPE_LOCAL;
+    case RTN_UNREACHABLE:
+    case RTN_PROHIBIT:
+    case RTN_THROW:
+        return INETCIDRROUTETYPE_REJECT;
+    case RTN_BLACKHOLE:
+        return INETCIDRROUTETYPE_BLACKHOLE;
+    default:
+        return 0; /* not a route we forward (or reject) with */
+    }
+}
+
+static u_char
+_proto_from_rtm(unsigned char rtm_protocol)
+{
+    switch (rtm_protocol) {
+    case RTPROT_REDIRECT:
+        return IANAIPROUTEPROTOCOL_ICMP;
+    case RTPROT_STATIC:
+        return IANAIPROUTEPROTOCOL_NETMGMT;
+#ifdef RTPROT_BGP
+    case RTPROT_BGP:
+        return IANAIPROUTEPROTOCOL_BGP;
+    case RTPROT_ISIS:
+        return IANAIPROUTEPROTOCOL_ISIS;
+    case RTPROT_OSPF:
+        return IANAIPROUTEPROTOCOL_OSPF;
+    case RTPROT_RIP:
+        return IANAIPROUTEPROTOCOL_RIP;
+#endif
+    default:
+        return IANAIPROUTEPROTOCOL_LOCAL;
+    }
+}
+
+/*
+ * pass a route entry for each next hop of the route in an RTM_NEWROUTE or
+ * RTM_DELROUTE message to fn, which then owns it.
+ *
+ * @retval  0 not a route we report
+ * @retval >0 number of entries passed to fn
+ * @retval -1 error
+ */
+static int
+_route_entries(struct nlmsghdr *nlh, u_int load_flags,
+               _route_entry_fn *fn, void *ctx)
+{
+    struct rtmsg   *rtm;
+    struct rtattr  *tb[RTA_MAX + 1], *rta;
+    struct rtnexthop *rtnh = NULL;
+    netsnmp_route_entry *entry;
+    int             length, nh_length = 0, count = 0;
+    u_char          addr_type, addr_len;
+    uint32_t        table;
+
+    if (RTM_NEWROUTE != nlh->nlmsg_type && RTM_DELROUTE != nlh->nlmsg_type)
+        return 0;
+
+    rtm = (struct rtmsg *) NLMSG_DATA(nlh);
+    length = nlh->nlmsg_len - NLMSG_LENGTH(sizeof(*rtm));
+    if (length < 0)
+        return -1;
+
+    switch (rtm->rtm_family) {
+    case AF_INET:
+        addr_type = INETADDRESSTYPE_IPV4;
+        addr_len = 4;
+        break;
+#ifdef NETSNMP_ENABLE_IPV6
+    case AF_INET6:
+        if (load_flags & NETSNMP_ACCESS_ROUTE_LOAD_IPV4_ONLY)
+            return 0;
+        addr_type = INETADDRESSTYPE_IPV6;
+        addr_len = 16;
+        break;
+#endif
+    default:
+        return 0;
+    }
+
+    /** cached clones (e.g. pmtu exceptions) are not routes */
+    if (rtm->rtm_flags & RTM_F_CLONED)
+        return 0;
+
+    memset(tb, 0, sizeof(tb));
+    for (rta = RTM_RTA(rtm); RTA_OK(rta, length);
+         rta = RTA_NEXT(rta, length))
+        if (rta->rta_type <= RTA_MAX)
+            tb[rta->rta_type] = rta;
+
+    table = rtm->rtm_table;
+    if (tb[RTA_TABLE])
+        table = *(uint32_t *) RTA_DATA(tb[RTA_TABLE]);
+    /** like /proc/net/route, only show the main ipv4 table */
+    if (AF_INET == rtm->rtm_family && RT_TABLE_MAIN != table)
+        return 0;
+
+    if (tb[RTA_MULTIPATH]) {
+        rtnh = (struct rtnexthop *) RTA_DATA(tb[RTA_MULTIPATH]);
+        nh_length = RTA_PAYLOAD(tb[RTA_MULTIPATH]);
+    }
+
+    for (;;) {
+        struct rtattr  *gateway = tb[RTA_GATEWAY];
+        int             if_index = 0, has_gateway = 0;
+
+        if (tb[RTA_OIF])
+            if_index = *(int *) RTA_DATA(tb[RTA_OIF]);
+
+        if (NULL != rtnh) {
+            /** one entry per next hop of a multipath route */
+            if (nh_length < (int) sizeof(*rtnh) || !RTNH_OK(rtnh, nh_length))
+                break;
+            if_index = rtnh->rtnh_ifindex;
+            gateway = NULL;
+            length = rtnh->rtnh_len - RTNH_LENGTH(0);
+            for (rta = RTNH_DATA(rtnh); RTA_OK(rta, length);
+                 rta = RTA_NEXT(rta, length))
+                if (RTA_GATEWAY == rta->rta_type)
+                    gateway = rta;
+        }
+
+        entry = netsnmp_access_route_entry_create();
+        if (NULL == entry)
+            return -1;
+
+        if (RTM_DELROUTE == nlh->nlmsg_type)
+            entry->flags |= NETSNMP_ACCESS_ROUTE_ENTRY_FLAG_DELETE;
+        else if ((nlh->nlmsg_flags & NLM_F_REPLACE) && 0 == count)
+            entry->flags |= NETSNMP_ACCESS_ROUTE_ENTRY_FLAG_REPLACE;
+
+        entry->if_index = if_index;
+
+        entry->rt_dest_type = addr_type;
+        entry->rt_dest_len = addr_len;
+        if (tb[RTA_DST] && RTA_PAYLOAD(tb[RTA_DST]) >= addr_len)
+            memcpy(entry->rt_dest, RTA_DATA(tb[RTA_DST]), addr_len);
+        entry->rt_pfx_len = rtm->rtm_dst_len;
+
+        entry->rt_nexthop_type = addr_type;
+        entry->rt_nexthop_len = addr_len;
+        if (gateway && RTA_PAYLOAD(gateway) >= addr_len) {
+            memcpy(entry->rt_nexthop, RTA_DATA(gateway), addr_len);
+            has_gateway = 1;
+        }
+
+        entry->rt_metric1 = tb[RTA_PRIORITY] ?
+            *(int32_t *) RTA_DATA(tb[RTA_PRIORITY]) : 0;
+
+#ifdef USING_IP_FORWARD_MIB_IPCIDRROUTETABLE_IPCIDRROUTETABLE_MODULE
+        if (AF_INET == rtm->rtm_family) {
+            entry->rt_mask = rtm->rtm_dst_len ?
+                htonl(0xffffffffU << (32 - rtm->rtm_dst_len)) : 0;
+            entry->rt_tos = rtm->rtm_tos;
+        }
+#endif
+
+#ifdef USING_IP_FORWARD_MIB_INETCIDRROUTETABLE_INETCIDRROUTETABLE_MODULE
+        /*
+         * as in route_linux.c, the if index in the policy tells apart
+         * routes that would otherwise have the same index, e.g. default
+         * routes. For ipv6 that is also needed for gateway routes (the
+         * same link-local next hop can be on several interfaces), and the
+         * table too, for routes in the local table that shadow the main
+         * one. Unlike an arbitrary index, this gives a notification the
+         * same index as the dump.
+         */
+        if (AF_INET != rtm->rtm_family || !has_gateway) {
+            entry->rt_policy = calloc(3, sizeof(oid));
+            if (NULL != entry->rt_policy) {
+                entry->rt_policy[1] = (RT_TABLE_MAIN == table) ? 0 : table;
+                entry->rt_policy[2] = entry->if_index;
+                entry->rt_policy_len = sizeof(oid)*3;
+            }
+        }
+#endif
+
+        entry->rt_type = _type_from_rtm(rtm->rtm_type, has_gateway);
+        entry->rt_proto = _proto_from_rtm(rtm->rtm_protocol);
+
+        fn(entry, ctx);
+        ++count;
+
+        if (NULL == rtnh)
+            break;
+        nh_length -= RTNH_ALIGN(rtnh->rtnh_len);
+        rtnh = RTNH_NEXT(rtnh);
+    }
+
+    return count;
+}
+
+static int
+_netlink_open(unsigned int groups)
+{
+    struct sockaddr_nl sa;
+    int             fd, rcvbuf = ROUTE_NETLINK_RCVBUF;
+
+    fd = socket(PF_NETLINK, SOCK_DGRAM, NETLINK_ROUTE);
+    if (fd < 0) {
+        DEBUGMSGTL(("access:netlink:route", "socket: %s\n", strerror(errno)));
+        return -1;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.nl_family = AF_NETLINK;
+    sa.nl_groups = groups;
+    if (bind(fd, (struct sockaddr *) &sa, sizeof(sa)) < 0) {
+        DEBUGMSGTL(("access:netlink:route", "bind: %s\n", strerror(errno)));
+        close(fd);
+        return -1;
+    }
+
+    /** capped by net.core.rmem_max, which is fine */
+    if (groups)
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+
+    return fd;
+}
+
+static int
+_netlink_link_dump_request(int fd)
+{
+    struct {
+        struct nlmsghdr  n;
+        struct ifinfomsg i;
+    } req;
+
+    memset(&req, 0, sizeof(req));
+    req.n.nlmsg_len = sizeof(req);
+    req.n.nlmsg_type = RTM_GETLINK;
+    req.n.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    req.i.ifi_family = AF_UNSPEC;
+
+    return send(fd, &req, req.n.nlmsg_len, 0) < 0 ? -1 : 0;
+}
+
+static int
+_netlink_dump_request(int fd, u_int load_flags, unsigned int seq)
+{
+    struct {
+        struct nlmsghdr n;
+        struct rtmsg    r;
+    } req;
+
+    memset(&req, 0, sizeof(req));
+    req.n.nlmsg_len = sizeof(req);
+    req.n.nlmsg_type = RTM_GETROUTE;
+    req.n.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    req.n.nlmsg_seq = seq;
+    req.r.rtm_family = (load_flags & NETSNMP_ACCESS_ROUTE_LOAD_IPV4_ONLY) ?
+        AF_INET : AF_UNSPEC;
+
+    return send(fd, &req, req.n.nlmsg_len, 0) < 0 ? -1 : 0;
+}
+
+/**---------------------------------------------------------------------*/
+/*
+ * container load
+ */
+static void
+_insert_entry(netsnmp_route_entry *entry, void *ctx)
+{
+    _load_ctx      *lctx = (_load_ctx *) ctx;
+
+    /*
+     * arbitrary index
+     */
+    entry->ns_rt_index = ++(*lctx->index);
+
+    if (CONTAINER_INSERT(lctx->container, entry) < 0) {
+        DEBUGMSGTL(("access:route:container", "error with route_entry: insert into container failed.\n"));
+        netsnmp_access_route_entry_free(entry);
+    }
+}
+
+/** load routes with a netlink dump
+ * @internal
+ *
+ * @retval  0 success
+ * @retval -1 netlink is not available
+ * @retval -2 the dump failed
+ */
+int
+_netsnmp_netlink_route_load(netsnmp_container *container, u_int load_flags,
+                            u_long *index)
+{
+    static unsigned int seq;
+    struct nlmsghdr *h;
+    _load_ctx       lctx;
+    char           *buf;
+    int             fd, len, rc = -2, done = 0;
+
+    DEBUGMSGTL(("access:route:container",
+                "route_container_arch_load netlink\n"));
+
+    fd = _netlink_open(0);
+    if (fd < 0)
+        return -1;
+    if (_netlink_dump_request(fd, load_flags, ++seq) < 0) {
+        DEBUGMSGTL(("access:netlink:route", "send: %s\n", strerror(errno)));
+        close(fd);
+        return -1;
+    }
+
+    buf = malloc(ROUTE_NETLINK_BUF_SIZE);
+    if (NULL == buf) {
+        close(fd);
+        return -2;
+    }
+
+    lctx.container = container;
+    lctx.index = index;
+    while (!done) {
+        len = recv(fd, buf, ROUTE_NETLINK_BUF_SIZE, 0);
+        if (len < 0 && EINTR == errno)
+            continue;
+        if (len <= 0) {
+            snmp_log(LOG_ERR, "netlink route dump: %s\n",
+                     len ? strerror(errno) : "end of file");
+            break;
+        }
+        for (h = (struct nlmsghdr *) buf; NLMSG_OK(h, len);
+             h = NLMSG_NEXT(h, len)) {
+            if (h->nlmsg_seq != seq)
+                continue;
+            if (NLMSG_DONE == h->nlmsg_type) {
+                rc = 0;
+                done = 1;
+                break;
+            }
+            if (NLMSG_ERROR == h->nlmsg_type) {
+                snmp_log(LOG_ERR, "netlink route dump failed\n");
+                done = 1;
+                break;
+            }
+            if (_route_entries(h, load_flags, _insert_entry, &lctx) < 0)
+                NETSNMP_LOGONCE((LOG_ERR, "bad netlink route message\n"));
+        }
+    }
+
+    free(buf);
+    close(fd);
+    return rc;
+}
+
+/**---------------------------------------------------------------------*/
+/*
+ * keeping a container up to date
+ */
+netsnmp_route_access *
+netsnmp_access_route_create(u_int load_flags,
+                            NetsnmpAccessRouteUpdate *update_hook,
+                            NetsnmpAccessRouteGC *gc_hook,
+                            int *cache_timeout, int *cache_flags,
+                            char *cache_expired)
+{
+    netsnmp_route_access *access;
+    _route_netlink *nl;
+
+    access = SNMP_MALLOC_TYPEDEF(netsnmp_route_access);
+    nl = SNMP_MALLOC_TYPEDEF(_route_netlink);
+    if (NULL == access || NULL == nl) {
+        snmp_log(LOG_ERR,"malloc error in netsnmp_access_route_create\n");
+        free(access);
+        free(nl);
+        return NULL;
+    }
+
+    nl->fd = -1;
+    access->arch_magic = nl;
+    access->magic = NULL;
+    access->load_flags = load_flags;
+    access->update_hook = update_hook;
+    access->gc_hook = gc_hook;
+    access->synchronized = 0;
+
+    if (cache_timeout != NULL)
+        *cache_timeout = ROUTE_NETLINK_IDLE_TIMEOUT;
+    if (cache_flags != NULL)
+        *cache_flags |= NETSNMP_CACHE_RESET_TIMER_ON_USE | NETSNMP_CACHE_DONT_FREE_BEFORE_LOAD;
+    access->cache_expired = cache_expired;
+
+    DEBUGMSGTL(("access:netlink:route", "create route cache\n"));
+
+    return access;
+}
+
+int
+netsnmp_access_route_delete(netsnmp_route_access *access)
+{
+    if (NULL == access)
+        return 0;
+
+    netsnmp_access_route_unload(access);
+    free(((_route_netlink *) access->arch_magic)->up_links);
+    free(access->arch_magic);
+    free(access);
+
+    return 0;
+}
+
+static void
+_update_entry(netsnmp_route_entry *entry, void *ctx)
+{
+    netsnmp_route_access *access = (netsnmp_route_access *) ctx;
+
+    entry->generation = access->generation;
+    access->update_hook(access, entry);
+}
+
+/*
+ * note whether link if_index is up
+ *
+ * @retval 1 it was up before
+ * @retval 0 it was not
+ */
+static int
+_link_set_up(_route_netlink *nl, int if_index, int up)
+{
+    int             lo = 0, hi = nl->up_count, mid;
+
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (nl->up_links[mid] < if_index)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo < nl->up_count && nl->up_links[lo] == if_index) {
+        if (!up) {
+            memmove(&nl->up_links[lo], &nl->up_links[lo + 1],
+                    (nl->up_count - lo - 1) * sizeof(int));
+            nl->up_count--;
+        }
+        return 1;
+    }
+    if (up) {
+        if (nl->up_count == nl->up_size) {
+            int             size = nl->up_size ? 2 * nl->up_size : 16;
+            int            *links;
+
+            links = realloc(nl->up_links, size * sizeof(int));
+            if (NULL == links)
+                return 0;
+            nl->up_links = links;
+            nl->up_size = size;
+        }
+        memmove(&nl->up_links[lo + 1], &nl->up_links[lo],
+                (nl->up_count - lo) * sizeof(int));
+        nl->up_links[lo] = if_index;
+        nl->up_count++;
+    }
+    return 0;
+}
+
+static void
+_lost_sync(netsnmp_route_access *access, const char *why)
+{
+    _route_netlink *nl = (_route_netlink *) access->arch_magic;
+
+    DEBUGMSGTL(("access:netlink:route", "lost sync: %s\n", why));
+    nl->lost = 1;
+    access->synchronized = 0;
+    if (access->cache_expired != NULL)
+        *access->cache_expired = 1;
+}
+
+/*
+ * process the messages in one read from the socket
+ *
+ * @retval  1 end of a dump
+ * @retval  0 nothing more (yet)
+ * @retval -1 error
+ */
+static int
+_access_route_read(netsnmp_route_access *access, int flags)
+{
+    _route_netlink *nl = (_route_netlink *) access->arch_magic;
+    struct nlmsghdr *h;
+    struct ifinfomsg *ifi;
+    char           *buf;
+    int             len, up, rc = 0;
+
+    buf = malloc(ROUTE_NETLINK_BUF_SIZE);
+    if (NULL == buf)
+        return -1;
+
+    do {
+        len = recv(nl->fd, buf, ROUTE_NETLINK_BUF_SIZE, flags);
+    } while (len < 0 && EINTR == errno);
+    if (len < 0) {
+        if (EAGAIN == errno)
+            rc = 0;
+        else if (ENOBUFS == errno) {
+            snmp_log(LOG_WARNING, "netlink buffer overrun\n");
+            _lost_sync(access, "overrun");
+        } else {
+            snmp_log(LOG_ERR, "netlink route read: %s\n", strerror(errno));
+            rc = -1;
+        }
+        free(buf);
+        return rc;
+    }
+
+    for (h = (struct nlmsghdr *) buf; NLMSG_OK(h, len); h = NLMSG_NEXT(h, len)) {
+        switch (h->nlmsg_type) {
+        case NLMSG_DONE:
+            rc = 1;
+            continue;
+        case NLMSG_ERROR:
+            snmp_log(LOG_ERR, "netlink route dump failed\n");
+            rc = -1;
+            continue;
+        case RTM_NEWLINK:
+        case RTM_DELLINK:
+            /*
+             * routes through an interface that goes down are removed
+             * without a notification (for ipv4 at least).  Links are
+             * also notified for all kinds of other changes, and links
+             * that were not up have no routes to lose.
+             */
+            if (h->nlmsg_len < NLMSG_LENGTH(sizeof(*ifi)))
+                continue;
+            ifi = (struct ifinfomsg *) NLMSG_DATA(h);
+            up = RTM_NEWLINK == h->nlmsg_type && (ifi->ifi_flags & IFF_UP);
+            if (_link_set_up(nl, ifi->ifi_index, up) && !up)
+                _lost_sync(access, "interface down");
+            continue;
+        }
+
+        DEBUGMSGTL(("9:access:netlink:route", "route netlink message %d\n",
+                    h->nlmsg_type));
+        if (_route_entries(h, access->load_flags, _update_entry, access) < 0)
+            NETSNMP_LOGONCE((LOG_ERR, "bad netlink route message\n"));
+    }
+
+    free(buf);
+    return rc;
+}
+
+static void
+_access_route_read_netlink(int fd, void *data)
+{
+    _access_route_read((netsnmp_route_access *) data, MSG_DONTWAIT);
+}
+
+int
+netsnmp_access_route_load(netsnmp_route_access *access)
+{
+    _route_netlink *nl = (_route_netlink *) access->arch_magic;
+    int             rc, tries;
+
+    if (access->synchronized)
+        return 0;
+
+    if (nl->fd < 0) {
+        unsigned int groups = RTMGRP_IPV4_ROUTE | RTMGRP_LINK;
+
+        if (!(access->load_flags & NETSNMP_ACCESS_ROUTE_LOAD_IPV4_ONLY))
+            groups |= RTMGRP_IPV6_ROUTE;
+        nl->fd = _netlink_open(groups);
+        if (nl->fd < 0) {
+            snmp_log_perror("netsnmp_access_route_load: netlink socket");
+            return -1;
+        }
+        if (register_readfd(nl->fd, _access_route_read_netlink, access) != 0) {
+            snmp_log(LOG_ERR,"netsnmp_access_route_load: error registering netlink socket\n");
+            close(nl->fd);
+            nl->fd = -1;
+            return -1;
+        }
+    }
+
+    for (tries = 0; tries < ROUTE_NETLINK_DUMP_RETRIES; tries++) {
+        DEBUGMSGTL(("access:netlink:route", "synchronizing route table\n"));
+
+        access->generation++;
+        nl->lost = 0;
+
+        /*
+         * which links are up, so that only those going down make us
+         * read the routes again
+         */
+        nl->up_count = 0;
+        if (_netlink_link_dump_request(nl->fd) < 0) {
+            snmp_log_perror("netsnmp_access_route_load: send failed");
+            netsnmp_access_route_unload(access);
+            return -1;
+        }
+        while (0 == (rc = _access_route_read(access, 0)))
+            ;
+        if (rc > 0) {
+            if (_netlink_dump_request(nl->fd, access->load_flags, 0) < 0) {
+                snmp_log_perror("netsnmp_access_route_load: send failed");
+                netsnmp_access_route_unload(access);
+                return -1;
+            }
+            while (0 == (rc = _access_route_read(access, 0)))
+                ;
+        }
+        if (rc < 0) {
+            /** start over with a new socket next time */
+            netsnmp_access_route_unload(access);
+            return -1;
+        }
+        access->gc_hook(access);
+        if (!nl->lost)
+            break;
+    }
+    access->synchronized = !nl->lost;
+
+    return 0;
+}
+
+int
+netsnmp_access_route_unload(netsnmp_route_access *access)
+{
+    _route_netlink *nl = (_route_netlink *) access->arch_magic;
+
+    DEBUGMSGTL(("access:netlink:route", "unload route cache\n"));
+
+    if (nl->fd >= 0) {
+        unregister_readfd(nl->fd);
+        close(nl->fd);
+        nl->fd = -1;
+    }
+    access->synchronized = 0;
+    return 0;
+}
@@ -0,0 +1,6 @@
+/*
+ * internal header, not for distribution
+ */
+
+int _netsnmp_netlink_route_load(netsnmp_container *container,
+                                u_int load_flags, u_long *index);
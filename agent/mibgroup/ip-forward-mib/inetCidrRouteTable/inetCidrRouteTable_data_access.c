@@ -8,6 +8,7 @@
  * standard Net-SNMP includes 
  */
 #include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-features.h>
 #include <net-snmp/net-snmp-includes.h>
 #include <net-snmp/agent/net-snmp-agent-includes.h>
 
@@ -19,6 +20,13 @@
 
 #include "inetCidrRouteTable_data_access.h"
 
+netsnmp_feature_require(container_lifo);
+static netsnmp_route_access *route_access = NULL;
+
+static void     _route_hook_update(netsnmp_route_access *access,
+                                   netsnmp_route_entry *entry);
+static void     _route_hook_gc(netsnmp_route_access *access);
+
 /** @ingroup interface 
  * @addtogroup data_access data_access: Routines to access data
  *
@@ -130,36 +138,91 @@ inetCidrRouteTable_container_init(netsnmp_container **container_ptr_ptr,
      * cache->enabled to 0.
      */
     cache->timeout = INETCIDRROUTETABLE_CACHE_TIMEOUT;  /* seconds */
+
+    /*
+     * where the kernel tells us about route changes, the route access
+     * keeps the container up to date and changes the cache settings.
+     */
+    route_access = netsnmp_access_route_create(
+                           NETSNMP_ACCESS_ROUTE_LOAD_NOFLAGS,
+                           _route_hook_update,
+                           _route_hook_gc,
+                           &cache->timeout,
+                           &cache->flags,
+                           &cache->expired);
+    if (route_access == NULL) {
+        snmp_log(LOG_ERR,
+                 "unable to create route access in inetCidrRouteTable_container_init\n");
+        return;
+    }
 }                               /* inetCidrRouteTable_container_init */
 
 /**
- * check entry for update
+ * the table part of the policy, 0 for the main table
+ */
+static oid
+_policy_table(netsnmp_route_entry *route_entry)
+{
+    if (NULL == route_entry->rt_policy ||
+        route_entry->rt_policy_len < 2 * sizeof(oid))
+        return 0;
+    return route_entry->rt_policy[1];
+}
+
+/**
+ * remove the routes a replaced route had; the kernel does not send a
+ * notification for each of its old next hops.
  */
 static void
-_snarf_route_entry(netsnmp_route_entry *route_entry,
-                   netsnmp_container *container)
+_remove_replaced_routes(inetCidrRouteTable_rowreq_ctx *rowreq_ctx,
+                        netsnmp_container *container)
 {
-    inetCidrRouteTable_rowreq_ctx *rowreq_ctx;
+    netsnmp_route_entry *route_entry = rowreq_ctx->data;
+    inetCidrRouteTable_rowreq_ctx *old;
+    netsnmp_void_array *replaced;
+    netsnmp_index   prefix;
+    size_t          i;
 
-    netsnmp_assert(NULL != route_entry);
-    netsnmp_assert(NULL != container);
+    if (NULL == container->get_subset)
+        return;
 
     /*
-     * per  inetCidrRouteType:
-     *
-     * Routes which do not result in traffic forwarding or 
-     * rejection should not be displayed even if the  
-     * implementation keeps them stored internally.
+     * the rows with the same inetCidrRouteDestType, inetCidrRouteDest
+     * (length and octets) and inetCidrRoutePfxLen
      */
-    if (route_entry->rt_type == 0) {    /* set when route not up */
-        DEBUGMSGT(("verbose:inetCidrRouteTable:inetCidrRouteTable_cache_load", "skipping route\n"));
-        netsnmp_access_route_entry_free(route_entry);
+    prefix.oids = rowreq_ctx->oid_idx.oids;
+    prefix.len = 3 + route_entry->rt_dest_len;
+    replaced = CONTAINER_GET_SUBSET(container, &prefix);
+    if (NULL == replaced)
         return;
+
+    for (i = 0; i < replaced->size; i++) {
+        old = (inetCidrRouteTable_rowreq_ctx *) replaced->array[i];
+        if (old->data->rt_metric1 != route_entry->rt_metric1 ||
+            _policy_table(old->data) != _policy_table(route_entry))
+            continue;
+        CONTAINER_REMOVE(container, old);
+        inetCidrRouteTable_release_rowreq_ctx(old);
     }
+    free(replaced->array);
+    free(replaced);
+}
+
+/**
+ * check entry for update
+ */
+static void
+_add_or_update_route_entry(netsnmp_route_entry *route_entry,
+                           netsnmp_container *container)
+{
+    inetCidrRouteTable_rowreq_ctx *rowreq_ctx, *old;
+
+    netsnmp_assert(NULL != route_entry);
+    netsnmp_assert(NULL != container);
 
     /*
-     * allocate an row context and set the index(es), then add it to
-     * the container
+     * allocate an row context and set the index(es), then try to find it in
+     * the cache.
      */
     rowreq_ctx = inetCidrRouteTable_allocate_rowreq_ctx(route_entry, NULL);
     if ((NULL != rowreq_ctx) &&
@@ -170,8 +233,40 @@ _snarf_route_entry(netsnmp_route_entry *route_entry,
           route_entry->rt_policy, route_entry->rt_policy_len,
           route_entry->rt_nexthop_type,
           (char *) route_entry->rt_nexthop, route_entry->rt_nexthop_len))) {
-        CONTAINER_INSERT(container, rowreq_ctx);
-        rowreq_ctx->row_status = ROWSTATUS_ACTIVE;
+
+        if (route_entry->flags & NETSNMP_ACCESS_ROUTE_ENTRY_FLAG_REPLACE) {
+            _remove_replaced_routes(rowreq_ctx, container);
+            route_entry->flags &= ~NETSNMP_ACCESS_ROUTE_ENTRY_FLAG_REPLACE;
+        }
+
+        /* try to find old entry */
+        old = (inetCidrRouteTable_rowreq_ctx*)CONTAINER_FIND(container, rowreq_ctx);
+
+        /*
+         * per  inetCidrRouteType:
+         *
+         * Routes which do not result in traffic forwarding or 
+         * rejection should not be displayed even if the  
+         * implementation keeps them stored internally.
+         */
+        if ((route_entry->flags & NETSNMP_ACCESS_ROUTE_ENTRY_FLAG_DELETE) ||
+            route_entry->rt_type == 0) {    /* set when route not up */
+            DEBUGMSGT(("verbose:inetCidrRouteTable:inetCidrRouteTable_cache_load", "skipping route\n"));
+            if (old != NULL) {
+                CONTAINER_REMOVE(container, old);
+                inetCidrRouteTable_release_rowreq_ctx(old);
+            }
+            inetCidrRouteTable_release_rowreq_ctx(rowreq_ctx);
+        } else if (old != NULL) {
+            /* the entry is already there, update it */
+            netsnmp_access_route_entry_update(old->data, route_entry);
+            old->data->generation = route_entry->generation;
+            /* this also frees route_entry */
+            inetCidrRouteTable_release_rowreq_ctx(rowreq_ctx);
+        } else {
+            CONTAINER_INSERT(container, rowreq_ctx);
+            rowreq_ctx->row_status = ROWSTATUS_ACTIVE;
+        }
     } else {
         if (rowreq_ctx) {
             snmp_log(LOG_ERR, "error setting index while loading "
@@ -182,6 +277,52 @@ _snarf_route_entry(netsnmp_route_entry *route_entry,
     }
 }
 
+static void
+_route_hook_update(netsnmp_route_access *access, netsnmp_route_entry *entry)
+{
+    _add_or_update_route_entry(entry, (netsnmp_container *) access->magic);
+}
+
+typedef struct {
+    unsigned generation;
+    netsnmp_container *to_delete;
+} _collect_ctx;
+
+/**
+ * Put all entries with outdated generation to deletion list.
+ */
+static void
+_collect_invalid_route_ctx(inetCidrRouteTable_rowreq_ctx *ctx,
+                           _collect_ctx *cctx)
+{
+    if (ctx->data->generation != cctx->generation)
+        CONTAINER_INSERT(cctx->to_delete, ctx);
+}
+
+static void
+_route_hook_gc(netsnmp_route_access *access)
+{
+    netsnmp_container *container = (netsnmp_container *) access->magic;
+    _collect_ctx cctx;
+
+    cctx.to_delete = netsnmp_container_find("lifo");
+    if (NULL == cctx.to_delete)
+        return;
+    cctx.generation = access->generation;
+
+    CONTAINER_FOR_EACH(container,
+                       (netsnmp_container_obj_func *) _collect_invalid_route_ctx,
+                       &cctx);
+
+    while (CONTAINER_SIZE(cctx.to_delete)) {
+        inetCidrRouteTable_rowreq_ctx *ctx = (inetCidrRouteTable_rowreq_ctx*)CONTAINER_FIRST(cctx.to_delete);
+        CONTAINER_REMOVE(container, ctx);
+        inetCidrRouteTable_release_rowreq_ctx(ctx);
+        CONTAINER_REMOVE(cctx.to_delete, NULL);
+    }
+    CONTAINER_FREE(cctx.to_delete);
+}
+
 /**
  * container shutdown
  *
@@ -203,6 +344,11 @@ inetCidrRouteTable_container_shutdown(netsnmp_container *container_ptr)
 {
     DEBUGMSGTL(("verbose:inetCidrRouteTable:inetCidrRouteTable_container_shutdown", "called\n"));
 
+    if (NULL != route_access) {
+        netsnmp_access_route_delete(route_access);
+        route_access = NULL;
+    }
+
     if (NULL == container_ptr) {
         snmp_log(LOG_ERR,
                  "bad params to inetCidrRouteTable_container_shutdown\n");
@@ -247,8 +393,6 @@ inetCidrRouteTable_container_shutdown(netsnmp_container *container_ptr)
 int
 inetCidrRouteTable_container_load(netsnmp_container *container)
 {
-    netsnmp_container *route_container;
-
     DEBUGMSGTL(("verbose:inetCidrRouteTable:inetCidrRouteTable_container_load", "called\n"));
 
     /*
@@ -257,32 +401,16 @@ inetCidrRouteTable_container_load(netsnmp_container *container)
      * set the index(es) [and data, optionally] and insert into
      * the container.
      *
-     * we use the netsnmp data access api to get the data
+     * we use the netsnmp data access api to get the data, which updates
+     * the rows already in the container.
      */
-    route_container =
-        netsnmp_access_route_container_load(NULL,
-                                            NETSNMP_ACCESS_ROUTE_LOAD_NOFLAGS);
+    if (NULL == route_access)
+        return MFD_RESOURCE_UNAVAILABLE;
 
-    if (NULL == route_container)
+    route_access->magic = container;
+    if (netsnmp_access_route_load(route_access) < 0)
         return MFD_RESOURCE_UNAVAILABLE;        /* msg already logged */
 
-    DEBUGMSGT(("verbose:inetCidrRouteTable:inetCidrRouteTable_cache_load",
-               "%d records\n", (int)CONTAINER_SIZE(route_container)));
-
-    /*
-     * we just got a fresh copy of route data. snarf data
-     */
-    CONTAINER_FOR_EACH(route_container,
-                       (netsnmp_container_obj_func *) _snarf_route_entry,
-                       container);
-
-    /*
-     * free the container. we've either claimed each ifentry, or released it,
-     * so the dal function doesn't need to clear the container.
-     */
-    netsnmp_access_route_container_free(route_container,
-                                        NETSNMP_ACCESS_ROUTE_FREE_DONT_CLEAR);
-
     DEBUGMSGT(("verbose:inetCidrRouteTable:inetCidrRouteTable_cache_load",
                "%d records\n", (int)CONTAINER_SIZE(container)));
 
@@ -307,6 +435,11 @@ inetCidrRouteTable_container_free(netsnmp_container *container)
 {
     DEBUGMSGTL(("verbose:inetCidrRouteTable:inetCidrRouteTable_container_free", "called\n"));
 
+    if (NULL != route_access) {
+        netsnmp_access_route_unload(route_access);
+        route_access->magic = NULL;
+    }
+
     /*
      * TODO:380:M: Free inetCidrRouteTable container data.
      */
@@ -8,6 +8,7 @@
  * standard Net-SNMP includes 
  */
 #include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-features.h>
 #include <net-snmp/net-snmp-includes.h>
 #include <net-snmp/agent/net-snmp-agent-includes.h>
 
@@ -19,6 +20,12 @@
 
 #include "ipCidrRouteTable_data_access.h"
 
+netsnmp_feature_require(container_lifo);
+static netsnmp_route_access *route_access = NULL;
+
+static void     _route_hook_update(netsnmp_route_access *access,
+                                   netsnmp_route_entry *entry);
+static void     _route_hook_gc(netsnmp_route_access *access);
 
 /** @ingroup interface 
  * @addtogroup data_access data_access: Routines to access data
@@ -132,17 +139,71 @@ ipCidrRouteTable_container_init(netsnmp_container **container_ptr_ptr,
      * cache->enabled to 0.
      */
     cache->timeout = IPCIDRROUTETABLE_CACHE_TIMEOUT;    /* seconds */
+
+    /*
+     * where the kernel tells us about route changes, the route access
+     * keeps the container up to date and changes the cache settings.
+     */
+    route_access = netsnmp_access_route_create(
+                           NETSNMP_ACCESS_ROUTE_LOAD_IPV4_ONLY,
+                           _route_hook_update,
+                           _route_hook_gc,
+                           &cache->timeout,
+                           &cache->flags,
+                           &cache->expired);
+    if (route_access == NULL) {
+        snmp_log(LOG_ERR,
+                 "unable to create route access in ipCidrRouteTable_container_init\n");
+        return;
+    }
 }                               /* ipCidrRouteTable_container_init */
 
+/**
+ * remove the routes a replaced route had; the kernel does not send a
+ * notification for each of its old next hops.
+ */
+static void
+_remove_replaced_routes(ipCidrRouteTable_rowreq_ctx *rowreq_ctx,
+                        netsnmp_container *container)
+{
+    ipCidrRouteTable_rowreq_ctx *old;
+    netsnmp_void_array *replaced;
+    netsnmp_index   prefix;
+    size_t          i;
+
+    if (NULL == container->get_subset)
+        return;
+
+    /*
+     * the rows with the same ipCidrRouteDest, ipCidrRouteMask and
+     * ipCidrRouteTos
+     */
+    prefix.oids = rowreq_ctx->oid_idx.oids;
+    prefix.len = 9;
+    replaced = CONTAINER_GET_SUBSET(container, &prefix);
+    if (NULL == replaced)
+        return;
+
+    for (i = 0; i < replaced->size; i++) {
+        old = (ipCidrRouteTable_rowreq_ctx *) replaced->array[i];
+        if (old->data->rt_metric1 != rowreq_ctx->data->rt_metric1)
+            continue;
+        CONTAINER_REMOVE(container, old);
+        ipCidrRouteTable_release_rowreq_ctx(old);
+    }
+    free(replaced->array);
+    free(replaced);
+}
+
 /**
  * check entry for update
  *
  */
 static void
-_snarf_route_entry(netsnmp_route_entry *route_entry,
-                   netsnmp_container *container)
+_add_or_update_route_entry(netsnmp_route_entry *route_entry,
+                           netsnmp_container *container)
 {
-    ipCidrRouteTable_rowreq_ctx *rowreq_ctx;
+    ipCidrRouteTable_rowreq_ctx *rowreq_ctx, *old;
 
     DEBUGTRACE;
 
@@ -150,8 +211,8 @@ _snarf_route_entry(netsnmp_route_entry *route_entry,
     netsnmp_assert(NULL != container);
 
     /*
-     * allocate an row context and set the index(es), then add it to
-     * the container
+     * allocate an row context and set the index(es), then try to find it in
+     * the cache.
      */
     rowreq_ctx = ipCidrRouteTable_allocate_rowreq_ctx(route_entry, NULL);
     if ((NULL != rowreq_ctx) &&
@@ -159,9 +220,31 @@ _snarf_route_entry(netsnmp_route_entry *route_entry,
          (rowreq_ctx, *((in_addr_t *) route_entry->rt_dest),
           route_entry->rt_mask, route_entry->rt_tos,
           *((in_addr_t *) route_entry->rt_nexthop)))) {
-        
-        CONTAINER_INSERT(container, rowreq_ctx);
-        rowreq_ctx->ipCidrRouteStatus = ROWSTATUS_ACTIVE;
+
+        if (route_entry->flags & NETSNMP_ACCESS_ROUTE_ENTRY_FLAG_REPLACE) {
+            _remove_replaced_routes(rowreq_ctx, container);
+            route_entry->flags &= ~NETSNMP_ACCESS_ROUTE_ENTRY_FLAG_REPLACE;
+        }
+
+        /* try to find old entry */
+        old = (ipCidrRouteTable_rowreq_ctx*)CONTAINER_FIND(container, rowreq_ctx);
+        if (route_entry->flags & NETSNMP_ACCESS_ROUTE_ENTRY_FLAG_DELETE) {
+            /* delete existing entry */
+            if (old != NULL) {
+                CONTAINER_REMOVE(container, old);
+                ipCidrRouteTable_release_rowreq_ctx(old);
+            }
+            ipCidrRouteTable_release_rowreq_ctx(rowreq_ctx);
+        } else if (old != NULL) {
+            /* the entry is already there, update it */
+            netsnmp_access_route_entry_update(old->data, route_entry);
+            old->data->generation = route_entry->generation;
+            /* this also frees route_entry */
+            ipCidrRouteTable_release_rowreq_ctx(rowreq_ctx);
+        } else {
+            CONTAINER_INSERT(container, rowreq_ctx);
+            rowreq_ctx->ipCidrRouteStatus = ROWSTATUS_ACTIVE;
+        }
     } else {
         if (rowreq_ctx) {
             snmp_log(LOG_ERR, "error setting index while loading "
@@ -172,6 +255,52 @@ _snarf_route_entry(netsnmp_route_entry *route_entry,
     }
 }
 
+static void
+_route_hook_update(netsnmp_route_access *access, netsnmp_route_entry *entry)
+{
+    _add_or_update_route_entry(entry, (netsnmp_container *) access->magic);
+}
+
+typedef struct {
+    unsigned generation;
+    netsnmp_container *to_delete;
+} _collect_ctx;
+
+/**
+ * Put all entries with outdated generation to deletion list.
+ */
+static void
+_collect_invalid_route_ctx(ipCidrRouteTable_rowreq_ctx *ctx,
+                           _collect_ctx *cctx)
+{
+    if (ctx->data->generation != cctx->generation)
+        CONTAINER_INSERT(cctx->to_delete, ctx);
+}
+
+static void
+_route_hook_gc(netsnmp_route_access *access)
+{
+    netsnmp_container *container = (netsnmp_container *) access->magic;
+    _collect_ctx cctx;
+
+    cctx.to_delete = netsnmp_container_find("lifo");
+    if (NULL == cctx.to_delete)
+        return;
+    cctx.generation = access->generation;
+
+    CONTAINER_FOR_EACH(container,
+                       (netsnmp_container_obj_func *) _collect_invalid_route_ctx,
+                       &cctx);
+
+    while (CONTAINER_SIZE(cctx.to_delete)) {
+        ipCidrRouteTable_rowreq_ctx *ctx = (ipCidrRouteTable_rowreq_ctx*)CONTAINER_FIRST(cctx.to_delete);
+        CONTAINER_REMOVE(container, ctx);
+        ipCidrRouteTable_release_rowreq_ctx(ctx);
+        CONTAINER_REMOVE(cctx.to_delete, NULL);
+    }
+    CONTAINER_FREE(cctx.to_delete);
+}
+
 /**
  * container shutdown
  *
@@ -193,6 +322,11 @@ ipCidrRouteTable_container_shutdown(netsnmp_container *container_ptr)
 {
     DEBUGMSGTL(("verbose:ipCidrRouteTable:ipCidrRouteTable_container_shutdown", "called\n"));
 
+    if (NULL != route_access) {
+        netsnmp_access_route_delete(route_access);
+        route_access = NULL;
+    }
+
     if (NULL == container_ptr) {
         snmp_log(LOG_ERR,
                  "bad params to ipCidrRouteTable_container_shutdown\n");
@@ -237,8 +371,6 @@ ipCidrRouteTable_container_shutdown(netsnmp_container *container_ptr)
 int
 ipCidrRouteTable_container_load(netsnmp_container *container)
 {
-    netsnmp_container *route_container;
-
     DEBUGMSGTL(("verbose:ipCidrRouteTable:ipCidrRouteTable_cache_load",
                 "called\n"));
 
@@ -247,28 +379,16 @@ ipCidrRouteTable_container_load(netsnmp_container *container)
      * loop over your ipCidrRouteTable data, allocate a rowreq context,
      * set the index(es) [and data, optionally] and insert into
      * the container.
+     *
+     * the route access updates the rows already in the container.
      */
-    route_container =
-        netsnmp_access_route_container_load(NULL,
-                                            NETSNMP_ACCESS_ROUTE_LOAD_IPV4_ONLY);
+    if (NULL == route_access)
+        return MFD_RESOURCE_UNAVAILABLE;
 
-    if (NULL == route_container)
+    route_access->magic = container;
+    if (netsnmp_access_route_load(route_access) < 0)
         return MFD_RESOURCE_UNAVAILABLE;        /* msg already logged */
 
-    /*
-     * we just got a fresh copy of route data. snarf data
-     */
-    CONTAINER_FOR_EACH(route_container,
-                       (netsnmp_container_obj_func *) _snarf_route_entry,
-                       container);
-
-    /*
-     * free the container. we've either claimed each ifentry, or released it,
-     * so the dal function doesn't need to clear the container.
-     */
-    netsnmp_access_route_container_free(route_container,
-                                        NETSNMP_ACCESS_ROUTE_FREE_DONT_CLEAR);
-
     DEBUGMSGT(("verbose:ipCidrRouteTable:ipCidrRouteTable_cache_load",
                "%d records\n", (int)CONTAINER_SIZE(container)));
 
@@ -294,6 +414,11 @@ ipCidrRouteTable_container_free(netsnmp_container *container)
     DEBUGMSGTL(("verbose:ipCidrRouteTable:ipCidrRouteTable_container_free",
                 "called\n"));
 
+    if (NULL != route_access) {
+        netsnmp_access_route_unload(route_access);
+        route_access->magic = NULL;
+    }
+
     /*
      * TODO:380:M: Free ipCidrRouteTable container data.
      */
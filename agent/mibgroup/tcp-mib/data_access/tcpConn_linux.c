@@ -12,9 +12,17 @@
 #include "tcp-mib/tcpConnectionTable/tcpConnectionTable_constants.h"
 #include "tcp-mib/data_access/tcpConn_private.h"
 #include "mibgroup/util_funcs/get_pid_from_inode.h"
+#include "mibgroup/util_funcs/sock_diag.h"
+
+#include <netinet/tcp.h>
+
 static int
 linux_states[12] = { 1, 5, 3, 4, 6, 7, 11, 1, 8, 9, 2, 10 };
 
+#ifdef HAVE_LINUX_SOCK_DIAG_H
+static int _load_sock_diag(netsnmp_container *container, int family,
+                           u_int flags);
+#endif
 static int _load4(netsnmp_container *container, u_int flags);
 #if defined (NETSNMP_ENABLE_IPV6)
 static int _load6(netsnmp_container *container, u_int flags);
@@ -92,17 +100,32 @@ netsnmp_arch_tcpconn_container_load(netsnmp_container *container,
         return -1;
     }
 
-    rc = _load4(container, load_flags);
+    /*
+     * prefer sock_diag, and read /proc if the kernel doesn't support it
+     */
+    rc = -1;
+#ifdef HAVE_LINUX_SOCK_DIAG_H
+    if (!(load_flags & NETSNMP_ACCESS_TCPCONN_LOAD_NO_SOCK_DIAG))
+        rc = _load_sock_diag(container, AF_INET, load_flags);
+#endif
+    if (-1 == rc)
+        rc = _load4(container, load_flags);
 
 #if defined (NETSNMP_ENABLE_IPV6)
     if((0 != rc) || (load_flags & NETSNMP_ACCESS_TCPCONN_LOAD_IPV4_ONLY))
         return rc;
 
+    rc = -1;
+#ifdef HAVE_LINUX_SOCK_DIAG_H
+    if (!(load_flags & NETSNMP_ACCESS_TCPCONN_LOAD_NO_SOCK_DIAG))
+        rc = _load_sock_diag(container, AF_INET6, load_flags);
+#endif
     /*
      * load ipv6. ipv6 module might not be loaded,
      * so ignore -2 err (file not found)
      */
-    rc = _load6(container, load_flags);
+    if (-1 == rc)
+        rc = _load6(container, load_flags);
     if (-2 == rc)
         rc = 0;
 #endif
@@ -110,6 +133,64 @@ netsnmp_arch_tcpconn_container_load(netsnmp_container *container,
     return rc;
 }
 
+#ifdef HAVE_LINUX_SOCK_DIAG_H
+static int
+_add_sock_diag(const struct inet_diag_msg *r, void *ctx)
+{
+    netsnmp_container     *container = (netsnmp_container *) ctx;
+    netsnmp_tcpconn_entry *entry;
+    int                    addr_len = AF_INET == r->idiag_family ? 4 : 16;
+
+    entry = netsnmp_access_tcpconn_entry_create();
+    if(NULL == entry)
+        return -1;
+
+    entry->loc_port = ntohs(r->id.idiag_sport);
+    entry->rmt_port = ntohs(r->id.idiag_dport);
+    entry->tcpConnState = (r->idiag_state & 0xf) < 12 ?
+        linux_states[r->idiag_state & 0xf] : 2;
+    entry->pid = netsnmp_get_pid_from_inode(r->idiag_inode);
+
+    /** already in network order */
+    memcpy(entry->loc_addr, r->id.idiag_src, addr_len);
+    entry->loc_addr_len = addr_len;
+    memcpy(entry->rmt_addr, r->id.idiag_dst, addr_len);
+    entry->rmt_addr_len = addr_len;
+
+    entry->arbitrary_index = CONTAINER_SIZE(container) + 1;
+    CONTAINER_INSERT(container, entry);
+    return 0;
+}
+
+/**
+ * load the connections of one address family through sock_diag, letting
+ * the kernel skip the states we don't care about
+ *
+ * @retval  0 no errors
+ * @retval -1 sock_diag not available
+ * @retval -3 errors
+ */
+static int
+_load_sock_diag(netsnmp_container *container, int family, u_int load_flags)
+{
+    unsigned int states = ((1 << (TCP_CLOSING + 1)) - 1) & ~1;
+    int          rc;
+
+    if (load_flags & NETSNMP_ACCESS_TCPCONN_LOAD_NOLISTEN)
+        states &= ~(1 << TCP_LISTEN);
+    else if (load_flags & NETSNMP_ACCESS_TCPCONN_LOAD_ONLYLISTEN)
+        states = 1 << TCP_LISTEN;
+
+    rc = netsnmp_sock_diag_dump(family, IPPROTO_TCP, states,
+                                _add_sock_diag, container);
+    DEBUGMSGTL(("access:tcpconn:container", "sock_diag family %d: %d\n",
+                family, rc));
+    if (-2 == rc)
+        rc = -3;
+    return rc;
+}
+#endif /* HAVE_LINUX_SOCK_DIAG_H */
+
 /**
  *
  * @retval  0 no errors
@@ -54,6 +54,69 @@ struct variable2 extensible_passthru_variables[] = {
      var_extensible_pass, 0, {MIBINDEX}},
 };
 
+/*
+ * The pass entries, and the buffers var_extensible_pass() returns, are
+ * shared by all the pass registrations, so their scripts run one at a
+ * time.  The registrations are thread-safe otherwise: with
+ * agentWorkerThreads, a slow script only holds up other pass requests.
+ */
+static int
+pass_lock_handler(netsnmp_mib_handler *handler,
+                  netsnmp_handler_registration *reginfo,
+                  netsnmp_agent_request_info *reqinfo,
+                  netsnmp_request_info *requests)
+{
+    int             rc;
+
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_AGENT_PASS);
+    rc = netsnmp_call_next_handler(handler, reginfo, reqinfo, requests);
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_PASS);
+    return rc;
+}
+
+/*
+ * registers a pass entry like register_mib_priority() does, with the
+ * lock handler in front of the old api handler
+ */
+static int
+pass_register(struct extensible *passthru)
+{
+    netsnmp_handler_registration *reginfo;
+    netsnmp_mib_handler *handler;
+    struct variable *vp;
+
+    handler = netsnmp_create_handler("old_api", netsnmp_old_api_helper);
+    vp = netsnmp_duplicate_variable((struct variable *)
+                                    extensible_passthru_variables);
+    if (handler == NULL || vp == NULL) {
+        netsnmp_handler_free(handler);
+        free(vp);
+        return MIB_REGISTRATION_FAILED;
+    }
+    handler->myvoid = vp;
+    handler->data_clone = (void *(*)(void *)) netsnmp_duplicate_variable;
+    handler->data_free = free;
+
+    reginfo = netsnmp_handler_registration_create("pass", handler,
+                                                  passthru->miboid,
+                                                  passthru->miblen,
+                                                  HANDLER_CAN_RWRITE |
+                                                  HANDLER_CAN_THREADSAFE);
+    if (reginfo == NULL) {
+        netsnmp_handler_free(handler);
+        return MIB_REGISTRATION_FAILED;
+    }
+    reginfo->priority = passthru->mibpriority;
+    if (netsnmp_inject_handler(reginfo,
+                               netsnmp_create_handler("pass_lock",
+                                                      pass_lock_handler))
+        != SNMPERR_SUCCESS) {
+        netsnmp_handler_registration_free(reginfo);
+        return MIB_REGISTRATION_FAILED;
+    }
+    return netsnmp_register_handler(reginfo);
+}
+
 
 
 void
@@ -142,10 +205,7 @@ pass_parse_config(const char *token, char *cptr)
     strlcpy((*ppass)->name, (*ppass)->command, sizeof((*ppass)->name));
     (*ppass)->next = NULL;
 
-    register_mib_priority("pass",
-                 (struct variable *) extensible_passthru_variables,
-                 sizeof(struct variable2), 1, (*ppass)->miboid,
-                 (*ppass)->miblen, (*ppass)->mibpriority);
+    pass_register(*ppass);
 
     /*
      * argggg -- passthrus must be sorted 
@@ -200,6 +260,7 @@ var_extensible_pass(struct variable *vp,
     int             i, rtest, fd, newlen;
     char            buf[SNMP_MAXBUF];
     static char     buf2[SNMP_MAXBUF];
+    static struct netsnmp_internal_pass_value value;
     struct extensible *passthru;
     FILE           *file;
 
@@ -264,7 +325,8 @@ var_extensible_pass(struct variable *vp,
                 fclose(file);
                 wait_on_exec(passthru);
 
-                return netsnmp_internal_pass_parse(buf, buf2, var_len, vp);
+                return netsnmp_internal_pass_parse(buf, buf2, var_len, vp,
+                                                   &value);
             }
             *var_len = 0;
             return (NULL);
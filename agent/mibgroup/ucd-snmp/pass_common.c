@@ -110,12 +110,10 @@ unsigned char *
 netsnmp_internal_pass_parse(char * buf,
                             char * buf2,
                             size_t * var_len,
-                            struct variable *vp)
+                            struct variable *vp,
+                            struct netsnmp_internal_pass_value *ret)
 {
-    static long     long_ret;
-    static in_addr_t addr_ret;
     int             newlen;
-    static oid      objid[MAX_OID_LEN];
 
     /*
      * buf contains the return type, and buf2 contains the data
@@ -130,40 +128,38 @@ netsnmp_internal_pass_parse(char * buf,
     }
 #ifdef NETSNMP_WITH_OPAQUE_SPECIAL_TYPES
     else if (!strncasecmp(buf, "integer64", 9)) {
-        static struct counter64 c64;
         uint64_t v64 = strtoull(buf2, NULL, 10);
-        c64.high = (unsigned long)(v64 >> 32);
-        c64.low  = (unsigned long)(v64 & 0xffffffff);
-        *var_len = sizeof(c64);
+        ret->c64.high = (unsigned long)(v64 >> 32);
+        ret->c64.low  = (unsigned long)(v64 & 0xffffffff);
+        *var_len = sizeof(ret->c64);
         vp->type = ASN_OPAQUE_I64;
-        return ((unsigned char *) &c64);
+        return ((unsigned char *) &ret->c64);
     }
 #endif
     else if (!strncasecmp(buf, "integer", 7)) {
-        *var_len = sizeof(long_ret);
-        long_ret = strtol(buf2, NULL, 10);
+        *var_len = sizeof(ret->long_ret);
+        ret->long_ret = strtol(buf2, NULL, 10);
         vp->type = ASN_INTEGER;
-        return ((unsigned char *) &long_ret);
+        return ((unsigned char *) &ret->long_ret);
     } else if (!strncasecmp(buf, "unsigned", 8)) {
-        *var_len = sizeof(long_ret);
-        long_ret = strtoul(buf2, NULL, 10);
+        *var_len = sizeof(ret->long_ret);
+        ret->long_ret = strtoul(buf2, NULL, 10);
         vp->type = ASN_UNSIGNED;
-        return ((unsigned char *) &long_ret);
+        return ((unsigned char *) &ret->long_ret);
     }
     else if (!strncasecmp(buf, "counter64", 9)) {
-        static struct counter64 c64;
         uint64_t v64 = strtoull(buf2, NULL, 10);
-        c64.high = (unsigned long)(v64 >> 32);
-        c64.low  = (unsigned long)(v64 & 0xffffffff);
-        *var_len = sizeof(c64);
+        ret->c64.high = (unsigned long)(v64 >> 32);
+        ret->c64.low  = (unsigned long)(v64 & 0xffffffff);
+        *var_len = sizeof(ret->c64);
         vp->type = ASN_COUNTER64;
-        return ((unsigned char *) &c64);
+        return ((unsigned char *) &ret->c64);
     }
     else if (!strncasecmp(buf, "counter", 7)) {
-        *var_len = sizeof(long_ret);
-        long_ret = strtoul(buf2, NULL, 10);
+        *var_len = sizeof(ret->long_ret);
+        ret->long_ret = strtoul(buf2, NULL, 10);
         vp->type = ASN_COUNTER;
-        return ((unsigned char *) &long_ret);
+        return ((unsigned char *) &ret->long_ret);
     } else if (!strncasecmp(buf, "octet", 5)) {
         *var_len = netsnmp_internal_asc2bin(buf2);
         vp->type = ASN_OCTET_STR;
@@ -173,34 +169,34 @@ netsnmp_internal_pass_parse(char * buf,
         vp->type = ASN_OPAQUE;
         return ((unsigned char *) buf2);
     } else if (!strncasecmp(buf, "gauge", 5)) {
-        *var_len = sizeof(long_ret);
-        long_ret = strtoul(buf2, NULL, 10);
+        *var_len = sizeof(ret->long_ret);
+        ret->long_ret = strtoul(buf2, NULL, 10);
         vp->type = ASN_GAUGE;
-        return ((unsigned char *) &long_ret);
+        return ((unsigned char *) &ret->long_ret);
     } else if (!strncasecmp(buf, "objectid", 8)) {
-        newlen = parse_miboid(buf2, objid);
+        newlen = parse_miboid(buf2, ret->objid);
         *var_len = newlen * sizeof(oid);
         vp->type = ASN_OBJECT_ID;
-        return ((unsigned char *) objid);
+        return ((unsigned char *) ret->objid);
     } else if (!strncasecmp(buf, "timetick", 8)) {
-        *var_len = sizeof(long_ret);
-        long_ret = strtoul(buf2, NULL, 10);
+        *var_len = sizeof(ret->long_ret);
+        ret->long_ret = strtoul(buf2, NULL, 10);
         vp->type = ASN_TIMETICKS;
-        return ((unsigned char *) &long_ret);
+        return ((unsigned char *) &ret->long_ret);
     } else if (!strncasecmp(buf, "ipaddress", 9)) {
-        newlen = parse_miboid(buf2, objid);
+        newlen = parse_miboid(buf2, ret->objid);
         if (newlen != 4) {
             snmp_log(LOG_ERR, "invalid ipaddress returned:  %s\n", buf2);
             *var_len = 0;
             return (NULL);
         }
-        addr_ret =
-            (objid[0] << (8 * 3)) + (objid[1] << (8 * 2)) +
-            (objid[2] << 8) + objid[3];
-        addr_ret = htonl(addr_ret);
-        *var_len = sizeof(addr_ret);
+        ret->addr_ret =
+            (ret->objid[0] << (8 * 3)) + (ret->objid[1] << (8 * 2)) +
+            (ret->objid[2] << 8) + ret->objid[3];
+        ret->addr_ret = htonl(ret->addr_ret);
+        *var_len = sizeof(ret->addr_ret);
         vp->type = ASN_IPADDRESS;
-        return ((unsigned char *) &addr_ret);
+        return ((unsigned char *) &ret->addr_ret);
     }
     *var_len = 0;
     return (NULL);
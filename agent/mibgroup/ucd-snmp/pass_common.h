@@ -9,9 +9,21 @@
 int
 netsnmp_internal_pass_str_to_errno(const char *buf);
 
+/*
+ * where netsnmp_internal_pass_parse() stores the values it does not
+ * return in buf2
+ */
+struct netsnmp_internal_pass_value {
+    long            long_ret;
+    in_addr_t       addr_ret;
+    oid             objid[MAX_OID_LEN];
+    struct counter64 c64;
+};
+
 unsigned char *
 netsnmp_internal_pass_parse(char *buf, char *buf2, size_t *var_len,
-                            struct variable *vp);
+                            struct variable *vp,
+                            struct netsnmp_internal_pass_value *ret);
 
 void
 netsnmp_internal_pass_set_format(char *buf, const u_char *var_val,
@@ -23,6 +23,9 @@
 #if HAVE_SYS_WAIT_H
 # include <sys/wait.h>
 #endif
+#if HAVE_SYS_SELECT_H
+#include <sys/select.h>
+#endif
 #ifdef HAVE_LIMITS_H
 #include <limits.h>
 #endif
@@ -45,20 +48,72 @@
 netsnmp_feature_require(get_exten_instance);
 netsnmp_feature_require(parse_miboid);
 
+/*
+ * Protocol version 2 (pass_persist -v 2) numbers its requests, so that
+ * several may be outstanding at once and answered in any order, and
+ * sends all the varbinds of a handler call in a single request.  The
+ * agent does not wait for the answer: the varbinds are delegated and
+ * completed when the reply is read from the pipe.  For GETBULK, the
+ * helper is asked for up to max-repetitions successors of each OID and
+ * the later repetitions are answered from those.
+ */
+#define PASS_PERSIST_TIMEOUT    30      /* seconds before a helper is hung */
+#define PASS_PERSIST_MAX_REPLY  (1024 * 1024)
+
+struct persist_request {
+    struct persist_request *next;
+    u_int           id;
+    int             mode;
+    int             repeat;             /* getbulk max-repetitions, or 0 */
+    long            transid;
+    int             count;
+    netsnmp_request_info **requests;
+    netsnmp_delegated_cache *cache;
+    struct timeval  sent;
+    char           *cmd;                /* not written until PONG 2 */
+};
+
+/*
+ * a varbind returned by a getbulk beyond the first repetition, indexed
+ * by the OID it follows.  A NULL name means nothing follows.
+ */
+struct persist_prefetch {
+    netsnmp_index   index;
+    oid            *name;
+    size_t          name_len;
+    u_char          type;
+    u_char         *val;
+    size_t          val_len;
+};
+
 struct extensible *persistpassthrus = NULL;
 int             numpersistpassthrus = 0;
 struct persist_pipe_type {
     FILE           *fIn;
     int             fdOut;
     netsnmp_pid_t   pid;
+    /*
+     * protocol version 2
+     */
+    int             version;
+    int             awaiting_pong;      /* requests are queued until then */
+    char           *rbuf;               /* reply data not parsed yet */
+    size_t          rlen;
+    size_t          rsize;
+    u_int           next_id;
+    struct persist_request *pending;    /* oldest first */
+    netsnmp_container *prefetch;
+    long            prefetch_transid;
 }              *persist_pipes = (struct persist_pipe_type *) NULL;
 static unsigned pipe_check_alarm_id;
 static int      init_persist_pipes(void);
 static void     close_persist_pipe(int iindex);
 static int      open_persist_pipe(int iindex, char *command);
+static int      open_persist_pipe_v2(int iindex, char *command);
 static void     check_persist_pipes(unsigned clientreg, void *clientarg);
 static void     destruct_persist_pipes(void);
 static int      write_persist_pipe(int iindex, const char *data);
+static Netsnmp_Node_Handler pass_persist_handler;
 
 /*
  * the relocatable extensible commands variables 
@@ -77,7 +132,7 @@ init_pass_persist(void)
     snmpd_register_config_handler("pass_persist",
                                   pass_persist_parse_config,
                                   pass_persist_free_config,
-                                  "miboid program");
+                                  "[-p priority] [-v version] miboid program");
     pipe_check_alarm_id = snmp_alarm_register(10, SA_REPEAT, check_persist_pipes, NULL);
 }
 
@@ -134,12 +189,13 @@ pass_persist_parse_config(const char *token, char *cptr)
     struct extensible **ppass = &persistpassthrus, **etmp, *ptmp;
     char           *tcptr, *endopt;
     int             i;
-    long int        priority;
+    long int        priority, version;
 
     /*
      * options
      */
     priority = DEFAULT_MIB_PRIORITY;
+    version = 1;
     while (*cptr == '-') {
       cptr++;
       switch (*cptr) {
@@ -159,6 +215,17 @@ pass_persist_parse_config(const char *token, char *cptr)
 	cptr = endopt;
 	cptr = skip_white(cptr);
 	break;
+      case 'v':
+	/* protocol version */
+	cptr++;
+	cptr = skip_white(cptr);
+	version = strtol(cptr, &endopt, 10);
+	if (endopt == cptr || (version != 1 && version != 2)) {
+	  config_perror("pass_persist protocol version must be 1 or 2");
+	  return;
+	}
+	cptr = skip_white(endopt);
+	break;
       default:
 	config_perror("unknown option for pass directive");
 	return;
@@ -183,6 +250,7 @@ pass_persist_parse_config(const char *token, char *cptr)
         return;
     (*ppass)->type = PASSTHRU_PERSIST;
     (*ppass)->mibpriority = priority;
+    (*ppass)->version = version;
 
     (*ppass)->miblen = parse_miboid(cptr, (*ppass)->miboid);
     while (isdigit((unsigned char)(*cptr)) || *cptr == '.')
@@ -207,7 +275,22 @@ pass_persist_parse_config(const char *token, char *cptr)
     strlcpy((*ppass)->name, (*ppass)->command, sizeof((*ppass)->name));
     (*ppass)->next = NULL;
 
-    register_mib_priority("pass_persist",
+    if (version == 2) {
+        netsnmp_handler_registration *reginfo;
+
+        reginfo = netsnmp_create_handler_registration("pass_persist",
+                                                      pass_persist_handler,
+                                                      (*ppass)->miboid,
+                                                      (*ppass)->miblen,
+                                                      HANDLER_CAN_RWRITE);
+        if (reginfo) {
+            reginfo->priority = (*ppass)->mibpriority;
+            reginfo->handler->myvoid = *ppass;
+            if (netsnmp_register_handler(reginfo) != MIB_REGISTERED_OK)
+                config_perror("registering pass_persist failed");
+        }
+    } else
+        register_mib_priority("pass_persist",
                  (struct variable *) extensible_persist_passthru_variables,
                  sizeof(struct variable2), 1, (*ppass)->miboid,
                  (*ppass)->miblen, (*ppass)->mibpriority);
@@ -295,6 +378,7 @@ var_extensible_pass_persist(struct variable *vp,
     int             i, rtest, newlen;
     char            buf[SNMP_MAXBUF];
     static char     buf2[SNMP_MAXBUF];
+    static struct netsnmp_internal_pass_value value;
     struct extensible *persistpassthru;
     FILE           *file;
     int             pipe_idx;
@@ -394,7 +478,8 @@ var_extensible_pass_persist(struct variable *vp,
                     close_persist_pipe(pipe_idx);
                     return (NULL);
                 }
-                return netsnmp_internal_pass_parse(buf, buf2, var_len, vp);
+                return netsnmp_internal_pass_parse(buf, buf2, var_len, vp,
+                                                   &value);
             }
             *var_len = 0;
             return (NULL);
@@ -486,6 +571,584 @@ setPassPersist(int action,
     return SNMP_ERR_NOSUCHNAME;
 }
 
+/*
+ * the pipe of a pass_persist entry.  persistpassthru becomes the entry
+ * owning the pipe, when several entries share the same command.
+ */
+static int
+persist_pipe_index(struct extensible **persistpassthru)
+{
+    struct extensible *ptmp;
+    int             i;
+
+    for (i = 1, ptmp = persistpassthrus; ptmp != NULL;
+         ptmp = ptmp->next, i++)
+        if (ptmp == *persistpassthru)
+            break;
+    if (ptmp == NULL)
+        return -1;
+#ifdef USING_SINGLE_COMMON_PASSPERSIST_INSTANCE
+    if (ptmp->passpersist_inst != NULL) {
+        i = get_exten_group_id(ptmp->passpersist_inst, i);
+        *persistpassthru = ptmp->passpersist_inst;
+    }
+#endif /* USING_SINGLE_COMMON_PASSPERSIST_INSTANCE */
+    return i;
+}
+
+static void
+persist_request_free(struct persist_request *preq)
+{
+    if (preq == NULL)
+        return;
+    netsnmp_free_delegated_cache(preq->cache);
+    free(preq->requests);
+    free(preq->cmd);
+    free(preq);
+}
+
+static void
+persist_prefetch_free(void *data, void *context)
+{
+    struct persist_prefetch *pf = (struct persist_prefetch *) data;
+
+    free(pf->index.oids);
+    free(pf->name);
+    free(pf->val);
+    free(pf);
+}
+
+static void
+persist_prefetch_clear(struct persist_pipe_type *pp)
+{
+    if (pp->prefetch == NULL)
+        return;
+    CONTAINER_CLEAR(pp->prefetch, persist_prefetch_free, NULL);
+    CONTAINER_FREE(pp->prefetch);
+    pp->prefetch = NULL;
+}
+
+/*
+ * remembers that name follows after during transaction transid
+ */
+static void
+persist_prefetch_add(struct persist_pipe_type *pp, long transid,
+                     const oid *after, size_t after_len,
+                     const oid *name, size_t name_len,
+                     u_char type, const u_char *val, size_t val_len)
+{
+    struct persist_prefetch *pf;
+
+    if (pp->prefetch != NULL && pp->prefetch_transid != transid)
+        persist_prefetch_clear(pp);
+    if (pp->prefetch == NULL) {
+        pp->prefetch = netsnmp_container_find("pass_persist:binary_array");
+        if (pp->prefetch == NULL)
+            return;
+        pp->prefetch->compare = netsnmp_compare_netsnmp_index;
+        pp->prefetch_transid = transid;
+    }
+
+    pf = SNMP_MALLOC_TYPEDEF(struct persist_prefetch);
+    if (pf == NULL)
+        return;
+    pf->index.len = after_len;
+    pf->index.oids = netsnmp_memdup(after, after_len * sizeof(oid));
+    if (name != NULL) {
+        pf->name = netsnmp_memdup(name, name_len * sizeof(oid));
+        pf->name_len = name_len;
+        pf->type = type;
+        pf->val = netsnmp_memdup(val, val_len);
+        pf->val_len = val_len;
+    }
+    if (pf->index.oids == NULL || (name != NULL && pf->name == NULL) ||
+        CONTAINER_INSERT(pp->prefetch, pf) != 0)
+        persist_prefetch_free(pf, NULL);
+}
+
+/*
+ * answers a GETBULK repetition from an earlier reply.  Returns 1 if the
+ * request has been answered.
+ */
+static int
+persist_prefetch_answer(struct persist_pipe_type *pp, long transid,
+                        netsnmp_request_info *request)
+{
+    struct persist_prefetch *pf, key;
+
+    if (pp->prefetch == NULL || pp->prefetch_transid != transid)
+        return 0;
+    key.index.oids = request->requestvb->name;
+    key.index.len = request->requestvb->name_length;
+    pf = (struct persist_prefetch *) CONTAINER_FIND(pp->prefetch, &key);
+    if (pf == NULL)
+        return 0;
+    /*
+     * without a name, the helper has nothing more: leave the varbind to
+     * the next subtree
+     */
+    if (pf->name != NULL) {
+        snmp_set_var_objid(request->requestvb, pf->name, pf->name_len);
+        snmp_set_var_typed_value(request->requestvb, pf->type, pf->val,
+                                 pf->val_len);
+    }
+    return 1;
+}
+
+static void
+persist_set_result(int mode, netsnmp_request_info *request,
+                   const oid *name, size_t name_len,
+                   u_char type, const u_char *val, size_t val_len)
+{
+    netsnmp_variable_list *var = request->requestvb;
+
+    if (val == NULL) {
+        if (mode == MODE_GET)
+            snmp_set_var_typed_value(var, SNMP_NOSUCHINSTANCE, NULL, 0);
+        return;
+    }
+    if (mode == MODE_GETNEXT) {
+        /*
+         * a helper going backwards would have the agent loop forever
+         */
+        if (snmp_oid_compare(name, name_len, var->name,
+                             var->name_length) <= 0) {
+            DEBUGMSGTL(("ucd-snmp/pass_persist",
+                        "ignoring a getnext answer not after the request\n"));
+            return;
+        }
+        snmp_set_var_objid(var, name, name_len);
+    }
+    snmp_set_var_typed_value(var, type, val, val_len);
+}
+
+/*
+ * copies the next line of the reply data at *pos into buf, with its
+ * newline as fgets() does.  NULL if it has not all been read yet.
+ */
+static char *
+persist_reply_line(struct persist_pipe_type *pp, size_t *pos,
+                   char *buf, size_t len)
+{
+    char           *start = pp->rbuf + *pos, *nl;
+    size_t          n;
+
+    nl = memchr(start, '\n', pp->rlen - *pos);
+    if (nl == NULL)
+        return NULL;
+    n = nl - start + 1;
+    *pos += n;
+    if (n >= len)
+        n = len - 1;
+    memcpy(buf, start, n);
+    buf[n] = '\0';
+    return buf;
+}
+
+/*
+ * Walks through the items of the reply to preq at *pos, and stores them
+ * in the requests unless cache is NULL.  Returns 1 at the end of the
+ * reply, 0 if it has not all been read yet and -1 if it is malformed.
+ */
+static int
+persist_reply_items(struct persist_pipe_type *pp,
+                    struct persist_request *preq, size_t *pos,
+                    netsnmp_delegated_cache *cache)
+{
+    char            buf[SNMP_MAXBUF], type[SNMP_MAXBUF], value[SNMP_MAXBUF];
+    oid             name[MAX_OID_LEN], prev[MAX_OID_LEN];
+    size_t          name_len, prev_len = 0, val_len;
+    struct variable vp;
+    struct netsnmp_internal_pass_value pass_value;
+    u_char         *val;
+    int             i, n, err;
+
+    for (i = 0; i < preq->count; i++) {
+        netsnmp_request_info *request = preq->requests[i];
+
+        if (preq->mode != MODE_GET && preq->mode != MODE_GETNEXT) {
+            /*
+             * set: one status line per varbind
+             */
+            if (!persist_reply_line(pp, pos, buf, sizeof(buf)))
+                return 0;
+            if (cache != NULL &&
+                (err = netsnmp_internal_pass_str_to_errno(buf)) !=
+                SNMP_ERR_NOERROR)
+                netsnmp_set_request_error(cache->reqinfo, request, err);
+            continue;
+        }
+
+        /*
+         * get and getnext: "NONE" or one varbind.  getbulk: up to
+         * max-repetitions varbinds, then "END".
+         */
+        for (n = 0; preq->repeat || n < 1; n++) {
+            if (!persist_reply_line(pp, pos, buf, sizeof(buf)))
+                return 0;
+            if (preq->repeat ? !strncmp(buf, "END", 3) :
+                !strncmp(buf, "NONE", 4))
+                break;
+            if (preq->repeat && n == preq->repeat)
+                return -1;
+            if (!persist_reply_line(pp, pos, type, sizeof(type)) ||
+                !persist_reply_line(pp, pos, value, sizeof(value)))
+                return 0;
+            name_len = parse_miboid(buf, name);
+            if (name_len == 0)
+                return -1;
+            if (cache == NULL)
+                continue;
+
+            memset(&vp, 0, sizeof(vp));
+            val = netsnmp_internal_pass_parse(type, value, &val_len, &vp,
+                                              &pass_value);
+            if (n == 0)
+                persist_set_result(preq->mode, request, name, name_len,
+                                   vp.type, val, val_len);
+            else if (val != NULL)
+                persist_prefetch_add(pp, preq->transid, prev, prev_len,
+                                     name, name_len, vp.type, val, val_len);
+            memcpy(prev, name, name_len * sizeof(oid));
+            prev_len = name_len;
+        }
+        if (cache == NULL)
+            continue;
+        if (n == 0 && preq->mode == MODE_GET)
+            snmp_set_var_typed_value(request->requestvb,
+                                     SNMP_NOSUCHINSTANCE, NULL, 0);
+        else if (n > 0 && n < preq->repeat)
+            persist_prefetch_add(pp, preq->transid, prev, prev_len,
+                                 NULL, 0, 0, NULL, 0);
+    }
+    return 1;
+}
+
+/*
+ * Handles the reply at the start of the reply data.  Returns 1 once it
+ * is done, 0 if it has not all been read yet and -1 if it is malformed.
+ */
+static int
+persist_reply(int iindex)
+{
+    struct persist_pipe_type *pp = &persist_pipes[iindex];
+    struct persist_request *preq, **prev;
+    netsnmp_delegated_cache *cache;
+    char            buf[SNMP_MAXBUF];
+    size_t          pos = 0, start;
+    u_int           id;
+    int             i, rc;
+
+    if (!persist_reply_line(pp, &pos, buf, sizeof(buf)))
+        return 0;
+    if (sscanf(buf, "%u", &id) != 1)
+        return -1;
+    for (prev = &pp->pending; (preq = *prev) != NULL; prev = &preq->next)
+        if (preq->id == id)
+            break;
+    if (preq == NULL)
+        return -1;
+
+    /*
+     * don't touch the requests before the whole reply is there
+     */
+    start = pos;
+    rc = persist_reply_items(pp, preq, &pos, NULL);
+    if (rc <= 0)
+        return rc;
+    *prev = preq->next;
+
+    cache = netsnmp_handler_check_cache(preq->cache);
+    if (cache != NULL) {
+        for (i = 0; i < preq->count; i++)
+            preq->requests[i]->delegated = 0;
+        pos = start;
+        persist_reply_items(pp, preq, &pos, cache);
+        if (cache->reqinfo->mode == MODE_GETBULK)
+            netsnmp_bulk_to_next_fix_requests(cache->requests);
+    } else
+        DEBUGMSGTL(("ucd-snmp/pass_persist",
+                    "request %u is gone, dropping its reply\n", id));
+    persist_request_free(preq);
+
+    memmove(pp->rbuf, pp->rbuf + pos, pp->rlen - pos);
+    pp->rlen -= pos;
+    return 1;
+}
+
+/*
+ * fails the requests still waiting for a reply from a pipe
+ */
+static void
+persist_fail_pending(int iindex)
+{
+    struct persist_pipe_type *pp = &persist_pipes[iindex];
+    struct persist_request *preq;
+    netsnmp_delegated_cache *cache;
+    int             i;
+
+    while ((preq = pp->pending) != NULL) {
+        pp->pending = preq->next;
+        cache = netsnmp_handler_check_cache(preq->cache);
+        for (i = 0; cache != NULL && i < preq->count; i++) {
+            preq->requests[i]->delegated = 0;
+            netsnmp_set_request_error(cache->reqinfo, preq->requests[i],
+                                      preq->mode == MODE_GET ||
+                                      preq->mode == MODE_GETNEXT ?
+                                      SNMP_ERR_GENERR :
+                                      SNMP_ERR_NOTWRITABLE);
+        }
+        persist_request_free(preq);
+    }
+}
+
+/*
+ * makes room for more reply data.  Returns 0 if the reply is too long.
+ */
+static int
+persist_reserve(struct persist_pipe_type *pp)
+{
+    char           *rbuf;
+    size_t          rsize;
+
+    if (pp->rlen < pp->rsize)
+        return 1;
+    rsize = pp->rsize ? 2 * pp->rsize : SNMP_MAXBUF;
+    if (rsize > PASS_PERSIST_MAX_REPLY)
+        return 0;
+    rbuf = (char *) realloc(pp->rbuf, rsize);
+    if (rbuf == NULL)
+        return 0;
+    pp->rbuf = rbuf;
+    pp->rsize = rsize;
+    return 1;
+}
+
+/*
+ * Checks the helper's answer to "PING 2" and writes the requests queued
+ * while waiting for it.  Returns 1 once that is done, 0 if the answer has
+ * not all been read yet or the pipe had to be closed.
+ */
+static int
+persist_pong(int iindex)
+{
+    struct persist_pipe_type *pp = &persist_pipes[iindex];
+    struct persist_request *preq;
+    char           *nl;
+
+    nl = memchr(pp->rbuf, '\n', pp->rlen);
+    if (nl == NULL)
+        return 0;
+    if (strncmp(pp->rbuf, "PONG 2", 6) != 0) {
+        snmp_log(LOG_ERR, "pass_persist[%d]: helper does not answer PING 2 with PONG 2 - closing pipe\n",
+                 iindex);
+        close_persist_pipe(iindex);
+        return 0;
+    }
+    pp->rlen -= nl + 1 - pp->rbuf;
+    memmove(pp->rbuf, nl + 1, pp->rlen);
+    pp->awaiting_pong = 0;
+
+    for (preq = pp->pending; preq != NULL; preq = preq->next) {
+        if (preq->cmd == NULL)
+            continue;
+        if (!write_persist_pipe(iindex, preq->cmd)) {
+            close_persist_pipe(iindex);
+            return 0;
+        }
+        SNMP_FREE(preq->cmd);
+    }
+    return 1;
+}
+
+static void
+persist_pipe_readable(int fd, void *clientarg)
+{
+    struct persist_pipe_type *pp = (struct persist_pipe_type *) clientarg;
+    int             iindex = pp - persist_pipes;
+    ssize_t         n;
+    int             rc;
+
+    if (!persist_reserve(pp)) {
+        snmp_log(LOG_ERR, "pass_persist[%d]: reply too long - closing pipe\n",
+                 iindex);
+        close_persist_pipe(iindex);
+        return;
+    }
+    n = read(fd, pp->rbuf + pp->rlen, pp->rsize - pp->rlen);
+    if (n < 0 && (errno == EINTR || errno == EAGAIN))
+        return;
+    if (n <= 0) {
+        snmp_log(LOG_INFO, "pass_persist[%d]: child process closed its output - closing pipe\n",
+                 iindex);
+        close_persist_pipe(iindex);
+        return;
+    }
+    pp->rlen += n;
+
+    if (pp->awaiting_pong && !persist_pong(iindex))
+        return;
+    while ((rc = persist_reply(iindex)) > 0)
+        ;
+    if (rc < 0) {
+        snmp_log(LOG_ERR, "pass_persist[%d]: malformed reply - closing pipe\n",
+                 iindex);
+        close_persist_pipe(iindex);
+    }
+}
+
+/*
+ * MIB handler for protocol version 2: sends all the varbinds in a single
+ * request and delegates them until the reply arrives.
+ */
+static int
+pass_persist_handler(netsnmp_mib_handler *handler,
+                     netsnmp_handler_registration *reginfo,
+                     netsnmp_agent_request_info *reqinfo,
+                     netsnmp_request_info *requests)
+{
+    struct extensible *persistpassthru, *owner;
+    struct persist_pipe_type *pp;
+    struct persist_request *preq, **tail;
+    netsnmp_request_info *request;
+    netsnmp_variable_list *var;
+    netsnmp_pdu    *pdu = reqinfo->asp->pdu;
+    const char     *command;
+    char            buf[SNMP_MAXBUF], buf2[SNMP_MAXBUF];
+    u_char         *data = NULL;
+    size_t          data_len = 0, out_len = 0;
+    char           *cmd = NULL;
+    int             pipe_idx, count, rtest, bulk;
+
+    switch (reqinfo->mode) {
+    case MODE_GET:
+        command = "get";
+        break;
+    case MODE_GETNEXT:
+        command = "getnext";
+        break;
+#ifndef NETSNMP_NO_WRITE_SUPPORT
+    case MODE_SET_ACTION:
+        command = "set";
+        break;
+#endif /* NETSNMP_NO_WRITE_SUPPORT */
+    default:
+        return SNMP_ERR_NOERROR;
+    }
+    bulk = reqinfo->mode == MODE_GETNEXT && pdu->command == SNMP_MSG_GETBULK;
+
+    if (!init_persist_pipes())
+        return SNMP_ERR_GENERR;
+    persistpassthru = owner = (struct extensible *) handler->myvoid;
+    pipe_idx = persist_pipe_index(&owner);
+    if (pipe_idx < 0)
+        return SNMP_ERR_GENERR;
+    pp = &persist_pipes[pipe_idx];
+
+    for (count = 0, request = requests; request; request = request->next)
+        count++;
+    preq = SNMP_MALLOC_TYPEDEF(struct persist_request);
+    if (preq == NULL ||
+        (preq->requests = calloc(count, sizeof(*preq->requests))) == NULL) {
+        persist_request_free(preq);
+        return SNMP_ERR_GENERR;
+    }
+    preq->mode = reqinfo->mode;
+    preq->transid = pdu->transid;
+
+    for (request = requests; request; request = request->next) {
+        var = request->requestvb;
+        if (bulk && persist_prefetch_answer(pp, pdu->transid, request))
+            continue;
+        rtest = snmp_oidtree_compare(var->name, var->name_length,
+                                     persistpassthru->miboid,
+                                     persistpassthru->miblen);
+        if (persistpassthru->miblen >= var->name_length || rtest < 0)
+            sprint_mib_oid(buf, persistpassthru->miboid,
+                           persistpassthru->miblen);
+        else
+            sprint_mib_oid(buf, var->name, var->name_length);
+        snmp_cstrcat(&data, &data_len, &out_len, 1, buf);
+        snmp_cstrcat(&data, &data_len, &out_len, 1, "\n");
+        if (preq->mode != MODE_GET && preq->mode != MODE_GETNEXT) {
+            netsnmp_internal_pass_set_format(buf2, var->val.string,
+                                             var->type, var->val_len);
+            snmp_cstrcat(&data, &data_len, &out_len, 1, buf2);
+        }
+        /*
+         * request->repeat more varbinds follow this one
+         */
+        if (bulk && request->repeat + 1 > preq->repeat)
+            preq->repeat = request->repeat + 1;
+        preq->requests[preq->count++] = request;
+    }
+    if (preq->count == 0 || data == NULL) {
+        free(data);
+        persist_request_free(preq);
+        return SNMP_ERR_NOERROR;
+    }
+    if (preq->repeat > 1)
+        command = "getbulk";
+    else
+        preq->repeat = 0;
+
+    preq->cache = netsnmp_create_delegated_cache(handler, reginfo, reqinfo,
+                                                 requests, NULL);
+    if (preq->cache == NULL) {
+        free(data);
+        persist_request_free(preq);
+        return SNMP_ERR_GENERR;
+    }
+
+    if (!open_persist_pipe_v2(pipe_idx, owner->name))
+        goto fail;
+    preq->id = pp->next_id++;
+    if (preq->repeat)
+        snprintf(buf, sizeof(buf), "%s %u %d %d\n", command, preq->id,
+                 preq->count, preq->repeat);
+    else
+        snprintf(buf, sizeof(buf), "%s %u %d\n", command, preq->id,
+                 preq->count);
+    if (asprintf(&cmd, "%s%s", buf, data) < 0) {
+        cmd = NULL;
+        goto fail;
+    }
+    if (pp->awaiting_pong) {
+        DEBUGMSGTL(("ucd-snmp/pass_persist", "persistpass-queueing:\n%s",
+                    cmd));
+        preq->cmd = cmd;
+        cmd = NULL;
+    } else {
+        DEBUGMSGTL(("ucd-snmp/pass_persist", "persistpass-sending:\n%s",
+                    cmd));
+        if (!write_persist_pipe(pipe_idx, cmd)) {
+            close_persist_pipe(pipe_idx);
+            goto fail;
+        }
+    }
+    free(cmd);
+    free(data);
+
+    netsnmp_get_monotonic_clock(&preq->sent);
+    for (count = 0; count < preq->count; count++)
+        preq->requests[count]->delegated = 1;
+    for (tail = &pp->pending; *tail != NULL; tail = &(*tail)->next)
+        ;
+    *tail = preq;
+    return SNMP_ERR_NOERROR;
+
+  fail:
+    /*
+     * as with protocol version 1, unanswered gets are left empty
+     */
+    if (preq->mode != MODE_GET && preq->mode != MODE_GETNEXT)
+        netsnmp_request_set_error_all(requests, SNMP_ERR_NOTWRITABLE);
+    free(cmd);
+    free(data);
+    persist_request_free(preq);
+    return SNMP_ERR_NOERROR;
+}
+
 int
 pass_persist_compare(const void *a, const void *b)
 {
@@ -515,8 +1178,7 @@ init_persist_pipes(void)
     /*
      * Otherwise malloc and initialize 
      */
-    persist_pipes = malloc(sizeof(persist_pipes[0]) *
-                           (numpersistpassthrus + 1));
+    persist_pipes = calloc(numpersistpassthrus + 1, sizeof(persist_pipes[0]));
     if (!persist_pipes)
         return 0;
     for (i = 0; i <= numpersistpassthrus; i++) {
@@ -560,6 +1222,12 @@ static void check_persist_pipes(unsigned clientreg, void *clientarg)
         if (process_stopped(i)) {
             snmp_log(LOG_INFO, "pass_persist[%d]: child process stopped - closing pipe\n", i);
             close_persist_pipe(i);
+        } else if (persist_pipes[i].pending &&
+                   netsnmp_ready_monotonic(&persist_pipes[i].pending->sent,
+                                           PASS_PERSIST_TIMEOUT * 1000)) {
+            snmp_log(LOG_ERR, "pass_persist[%d]: no reply for %d seconds - closing pipe\n",
+                     i, PASS_PERSIST_TIMEOUT);
+            close_persist_pipe(i);
         }
     }
 }
@@ -671,6 +1339,48 @@ open_persist_pipe(int iindex, char *command)
     return 1;
 }
 
+/*
+ * Starts a protocol version 2 helper unless it is running already.  The
+ * helper must answer "PING 2" with "PONG 2"; that answer and the replies
+ * are read as they arrive, and requests are queued until the answer is in.
+ * returns 0 on failure, 1 on success
+ */
+static int
+open_persist_pipe_v2(int iindex, char *command)
+{
+    struct persist_pipe_type *pp = &persist_pipes[iindex];
+    int             fdIn, fdOut;
+    netsnmp_pid_t   pid;
+
+    if (pp->pid != NETSNMP_NO_SUCH_PROCESS)
+        return 1;
+
+    DEBUGMSGTL(("ucd-snmp/pass_persist", "open_persist_pipe_v2(%d,'%s')\n",
+                iindex, command));
+    if ((0 == get_exec_pipes(command, &fdIn, &fdOut, &pid)) ||
+        (pid == NETSNMP_NO_SUCH_PROCESS)) {
+        DEBUGMSGTL(("ucd-snmp/pass_persist",
+                    "open_persist_pipe_v2: pid == -1\n"));
+        return 0;
+    }
+    pp->pid = pid;
+    pp->fdOut = fdOut;
+    pp->fIn = fdopen(fdIn, "r");
+    pp->rlen = 0;
+    if (pp->fIn == NULL || !write_persist_pipe(iindex, "PING 2\n")) {
+        close_persist_pipe(iindex);
+        return 0;
+    }
+
+    if (register_readfd(fdIn, persist_pipe_readable, pp) != FD_REGISTERED_OK) {
+        close_persist_pipe(iindex);
+        return 0;
+    }
+    pp->version = 2;
+    pp->awaiting_pong = 1;
+    return 1;
+}
+
 static int
 write_persist_pipe(int iindex, const char *data)
 {
@@ -712,6 +1422,18 @@ write_persist_pipe(int iindex, const char *data)
 static void
 close_persist_pipe(int iindex)
 {
+    struct persist_pipe_type *pp = &persist_pipes[iindex];
+
+    if (pp->version == 2) {
+        unregister_readfd(fileno(pp->fIn));
+        pp->version = 0;
+        pp->awaiting_pong = 0;
+    }
+    persist_fail_pending(iindex);
+    persist_prefetch_clear(pp);
+    SNMP_FREE(pp->rbuf);
+    pp->rlen = pp->rsize = 0;
+
     /*
      * Check and nix every item 
      */
@@ -159,3 +159,18 @@ netsnmp_access_udp_endpoint_entry_free(netsnmp_udp_endpoint_entry * entry)
 
     free(entry);
 }
+
+/**
+ * find the pid of the process owning an endpoint loaded with
+ * NETSNMP_ACCESS_UDP_ENDPOINT_LOAD_NO_PID
+ *
+ * @param instance the instance of the endpoint
+ * @param refresh  scan the processes again first
+ *
+ * @retval 0 unknown
+ */
+u_int
+netsnmp_access_udp_endpoint_pid(u_int instance, int refresh)
+{
+    return netsnmp_arch_udp_endpoint_pid(instance, refresh);
+}
@@ -15,6 +15,7 @@
 
 #include "udp-mib/udpEndpointTable/udpEndpointTable_constants.h"
 #include "mibgroup/util_funcs/get_pid_from_inode.h"
+#include "mibgroup/util_funcs/sock_diag.h"
 #include "udp_endpoint_private.h"
 
 #include <fcntl.h>
@@ -24,11 +25,20 @@ netsnmp_feature_require(text_utils);
 netsnmp_feature_child_of(udp_endpoint_all, libnetsnmpmibs);
 netsnmp_feature_child_of(udp_endpoint_writable, udp_endpoint_all);
 
+#ifdef HAVE_LINUX_SOCK_DIAG_H
+static int _load_sock_diag(netsnmp_container *container, int family);
+#endif
 static int _load4(netsnmp_container *container, u_int flags);
 #if defined (NETSNMP_ENABLE_IPV6)
 static int _load6(netsnmp_container *container, u_int flags);
 #endif
 
+/*
+ * whether the current load looks up the pid of each endpoint, which
+ * needs the processes to be scanned first
+ */
+static int _lookup_pids;
+
 /*
  * initialize arch specific storage
  *
@@ -92,9 +102,20 @@ netsnmp_arch_udp_endpoint_container_load(netsnmp_container *container,
     int rc = 0;
 
     /* Setup the pid_from_inode table, and fill it.*/
-    netsnmp_get_pid_from_inode_init();
+    _lookup_pids = !(load_flags & NETSNMP_ACCESS_UDP_ENDPOINT_LOAD_NO_PID);
+    if (_lookup_pids)
+        netsnmp_get_pid_from_inode_init();
 
-    rc = _load4(container, load_flags);
+    /*
+     * prefer sock_diag, and read /proc if the kernel doesn't support it
+     */
+    rc = -1;
+#ifdef HAVE_LINUX_SOCK_DIAG_H
+    if (!(load_flags & NETSNMP_ACCESS_UDP_ENDPOINT_LOAD_NO_SOCK_DIAG))
+        rc = _load_sock_diag(container, AF_INET);
+#endif
+    if (-1 == rc)
+        rc = _load4(container, load_flags);
     if(rc < 0) {
         u_int flags = NETSNMP_ACCESS_UDP_ENDPOINT_FREE_KEEP_CONTAINER;
         netsnmp_access_udp_endpoint_container_free(container, flags);
@@ -102,7 +123,13 @@ netsnmp_arch_udp_endpoint_container_load(netsnmp_container *container,
     }
 
 #if defined (NETSNMP_ENABLE_IPV6)
-    rc = _load6(container, load_flags);
+    rc = -1;
+#ifdef HAVE_LINUX_SOCK_DIAG_H
+    if (!(load_flags & NETSNMP_ACCESS_UDP_ENDPOINT_LOAD_NO_SOCK_DIAG))
+        rc = _load_sock_diag(container, AF_INET6);
+#endif
+    if (-1 == rc)
+        rc = _load6(container, load_flags);
     if(rc < 0) {
         u_int flags = NETSNMP_ACCESS_UDP_ENDPOINT_FREE_KEEP_CONTAINER;
         netsnmp_access_udp_endpoint_container_free(container, flags);
@@ -113,6 +140,78 @@ netsnmp_arch_udp_endpoint_container_load(netsnmp_container *container,
     return 0;
 }
 
+/*
+ * find the pid of an endpoint loaded without it
+ */
+u_int
+netsnmp_arch_udp_endpoint_pid(u_int instance, int refresh)
+{
+    if (refresh)
+        netsnmp_get_pid_from_inode_init();
+    return netsnmp_get_pid_from_inode(instance);
+}
+
+#ifdef HAVE_LINUX_SOCK_DIAG_H
+static int
+_add_sock_diag(const struct inet_diag_msg *r, void *ctx)
+{
+    netsnmp_container          *container = (netsnmp_container *) ctx;
+    netsnmp_udp_endpoint_entry *ep;
+    int                         addr_len = AF_INET == r->idiag_family ? 4 : 16;
+
+    ep = SNMP_MALLOC_TYPEDEF(netsnmp_udp_endpoint_entry);
+    if (NULL == ep)
+        return -1;
+
+    /** already in network order */
+    memcpy(ep->loc_addr, r->id.idiag_src, addr_len);
+    ep->loc_addr_len = addr_len;
+    ep->loc_port = ntohs(r->id.idiag_sport);
+    memcpy(ep->rmt_addr, r->id.idiag_dst, addr_len);
+    ep->rmt_addr_len = addr_len;
+    ep->rmt_port = ntohs(r->id.idiag_dport);
+    ep->state = r->idiag_state;
+
+    /*
+     * Use inode as instance value.
+     */
+    ep->instance = (u_int)r->idiag_inode;
+    if (_lookup_pids)
+        ep->pid = netsnmp_get_pid_from_inode(r->idiag_inode);
+
+    ep->index = CONTAINER_SIZE(container);
+    ep->oid_index.oids = &ep->index;
+    ep->oid_index.len = 1;
+
+    CONTAINER_INSERT(container, ep);
+    return 0;
+}
+
+/**
+ * load the endpoints of one address family through sock_diag
+ *
+ * @retval  0 no errors
+ * @retval -1 sock_diag not available
+ * @retval -3 errors
+ */
+static int
+_load_sock_diag(netsnmp_container *container, int family)
+{
+    int rc;
+
+    if (NULL == container)
+        return -3;
+
+    rc = netsnmp_sock_diag_dump(family, IPPROTO_UDP, ~0U,
+                                _add_sock_diag, container);
+    DEBUGMSGTL(("access:udp_endpoint", "sock_diag family %d: %d\n",
+                family, rc));
+    if (-2 == rc)
+        rc = -3;
+    return rc;
+}
+#endif /* HAVE_LINUX_SOCK_DIAG_H */
+
 /**
  * @internal
  * process token value index line
@@ -235,7 +334,8 @@ _process_line_udp_ep(netsnmp_line_info *line_info, void *mem,
     /*
      * get the pid also
      */
-    ep->pid = netsnmp_get_pid_from_inode(inode);
+    if (_lookup_pids)
+        ep->pid = netsnmp_get_pid_from_inode(inode);
 
     ep->index = (uintptr_t)(lpi->user_context);
     lpi->user_context = (void*)((char*)(lpi->user_context) + 1);
@@ -118,6 +118,15 @@ netsnmp_arch_udp_endpoint_container_load(netsnmp_container *container,
     return rc;
 }
 
+/*
+ * the load fills in the pid, when it is known
+ */
+u_int
+netsnmp_arch_udp_endpoint_pid(u_int instance, int refresh)
+{
+    return 0;
+}
+
 #ifdef HAVE_KVM_GETFILES
 /**
  *
@@ -77,6 +77,15 @@ netsnmp_arch_udp_endpoint_container_load(netsnmp_container * container,
     return (0);
 }
 
+/*
+ * the load fills in the pid, when it is known
+ */
+u_int
+netsnmp_arch_udp_endpoint_pid(u_int instance, int refresh)
+{
+    return 0;
+}
+
 static int 
 _load_udp_endpoint_table_v4(netsnmp_container *container, int flag) 
 {
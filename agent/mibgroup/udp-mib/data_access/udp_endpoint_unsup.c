@@ -63,3 +63,12 @@ netsnmp_arch_udp_endpoint_container_load(netsnmp_container *container,
 {
     return -1;
 }
+
+/*
+ * the load fills in the pid, when it is known
+ */
+u_int
+netsnmp_arch_udp_endpoint_pid(u_int instance, int refresh)
+{
+    return 0;
+}
@@ -71,8 +71,20 @@ udpEndpointTable_init_data(udpEndpointTable_registration *
 /**
  * container overview
  *
+ *  There is a row for every UDP socket of the system, so rather than
+ *  loading all of them in a container of row contexts, the table is
+ *  served by a table_cursor, which fetches pages of the rows following
+ *  an index.  The pages are built from a snapshot of the endpoints,
+ *  which the cache helper loads in the container when it expires, so
+ *  the GETNEXTs of a walk do not read the kernel tables again.
  */
 
+/*
+ * the pids of the endpoints are only looked up when a row is prepared,
+ * rescanning the processes once after each load of the snapshot
+ */
+static int      _pids_stale = 1;
+
 /**
  * container initialization
  *
@@ -88,16 +100,8 @@ udpEndpointTable_init_data(udpEndpointTable_registration *
  *  users. The default code should suffice for most cases. If no custom
  *  container is allocated, the MFD code will create one for your.
  *
- *  This is also the place to set up cache behavior. The default, to
- *  simply set the cache timeout, will work well with the default
- *  container. If you are using a custom container, you may want to
- *  look at the cache helper documentation to see if there are any
- *  flags you want to set.
- *
- * @remark
- *  This would also be a good place to do any initialization needed
- *  for you data source. For example, opening a connection to another
- *  process that will supply the data, opening a database, etc.
+ *  The container holds the snapshot of netsnmp_udp_endpoint_entry
+ *  structures, not row contexts.
  */
 void
 udpEndpointTable_container_init(netsnmp_container **container_ptr_ptr,
@@ -124,14 +128,6 @@ udpEndpointTable_container_init(netsnmp_container **container_ptr_ptr,
         return;
     }
 
-    /*
-     * TODO:345:A: Set up udpEndpointTable cache properties.
-     *
-     * Also for advanced users, you can set parameters for the
-     * cache. Do not change the magic pointer, as it is used
-     * by the MFD helper. To completely disable caching, set
-     * cache->enabled to 0.
-     */
     cache->timeout = UDPENDPOINTTABLE_CACHE_TIMEOUT;    /* seconds */
 }                               /* udpEndpointTable_container_init */
 
@@ -145,11 +141,6 @@ udpEndpointTable_container_init(netsnmp_container **container_ptr_ptr,
  *  users. The default code should suffice for most cases.
  *
  *  This function is called before udpEndpointTable_container_free().
- *
- * @remark
- *  This would also be a good place to do any cleanup needed
- *  for you data source. For example, closing a connection to another
- *  process that supplied the data, closing a database, etc.
  */
 void
 udpEndpointTable_container_shutdown(netsnmp_container *container_ptr)
@@ -164,39 +155,105 @@ udpEndpointTable_container_shutdown(netsnmp_container *container_ptr)
 
 }                               /* udpEndpointTable_container_shutdown */
 
+static void
+_snapshot_insert(void *data, void *context)
+{
+    netsnmp_container *container = (netsnmp_container *) context;
+
+    if (CONTAINER_INSERT(container, data))
+        netsnmp_access_udp_endpoint_entry_free((netsnmp_udp_endpoint_entry *)
+                                               data);
+}
+
 /**
- * load initial data
+ * load the snapshot of the endpoints
  *
- * TODO:350:M: Implement udpEndpointTable data load
- * This function will also be called by the cache helper to load
- * the container again (after the container free function has been
- * called to free the previous contents).
+ * This function is called by the cache helper to load the container
+ * again (after the container free function has been called to free the
+ * previous contents).
  *
- * @param container container to which items should be inserted
+ * @param container container to which endpoints should be inserted
  *
  * @retval MFD_SUCCESS              : success.
  * @retval MFD_RESOURCE_UNAVAILABLE : Can't access data source
- * @retval MFD_ERROR                : other error.
  *
- *  This function is called to load the index(es) (and data, optionally)
- *  for the every row in the data set.
+ *  Only the endpoints are read here: finding the process owning each of
+ *  them means scanning every process, which is left to
+ *  udpEndpointTable_row_prep().
+ */
+int
+udpEndpointTable_container_load(netsnmp_container *container)
+{
+    netsnmp_container *ep_c;
+
+    DEBUGMSGTL(("verbose:udpEndpointTable:udpEndpointTable_container_load",
+                "called\n"));
+
+    ep_c = netsnmp_access_udp_endpoint_container_load(NULL,
+               NETSNMP_ACCESS_UDP_ENDPOINT_LOAD_NO_PID);
+    if (NULL == ep_c)
+        return MFD_RESOURCE_UNAVAILABLE;
+
+    CONTAINER_FOR_EACH(ep_c, _snapshot_insert, container);
+    netsnmp_access_udp_endpoint_container_free(ep_c,
+                                    NETSNMP_ACCESS_UDP_ENDPOINT_FREE_DONT_CLEAR);
+    _pids_stale = 1;
+
+    DEBUGMSGT(("verbose:udpEndpointTable:udpEndpointTable_container_load",
+               "inserted %d records\n", (int)CONTAINER_SIZE(container)));
+
+    return MFD_SUCCESS;
+}                               /* udpEndpointTable_container_load */
+
+static void
+_snapshot_free(void *data, void *context)
+{
+    netsnmp_access_udp_endpoint_entry_free((netsnmp_udp_endpoint_entry *)
+                                           data);
+}
+
+/**
+ * container clean up
  *
- * @remark
- *  While loading the data, the only important thing is the indexes.
- *  If access to your data is cheap/fast (e.g. you have a pointer to a
- *  structure in memory), it would make sense to update the data here.
- *  If, however, the accessing the data invovles more work (e.g. parsing
- *  some other existing data, or peforming calculations to derive the data),
- *  then you can limit yourself to setting the indexes and saving any
- *  information you will need later. Then use the saved information in
- *  udpEndpointTable_row_prep() for populating data.
+ * @param container container with all current items
  *
- * @note
- *  If you need consistency between rows (like you want statistics
- *  for each row to be from the same time frame), you should set all
- *  data here.
+ *  This callback is called to empty the container, whose items are
+ *  endpoints rather than row contexts.
+ */
+void
+udpEndpointTable_container_free(netsnmp_container *container)
+{
+    DEBUGMSGTL(("verbose:udpEndpointTable:udpEndpointTable_container_free",
+                "called\n"));
+
+    CONTAINER_CLEAR(container, _snapshot_free, NULL);
+}                               /* udpEndpointTable_container_free */
+
+/**
+ * cursor initialization
+ *
+ * @param cursor The table_cursor serving the table. You can set the
+ *        page timeout and sizes using this pointer.
  *
+ *  This function is called at startup to allow you to customize certain
+ *  aspects of the access method. For the most part, it is for advanced
+ *  users. The default code should suffice for most cases.
  */
+void
+udpEndpointTable_cursor_init(netsnmp_table_cursor *cursor)
+{
+    DEBUGMSGTL(("verbose:udpEndpointTable:udpEndpointTable_cursor_init",
+                "called\n"));
+
+    if (NULL == cursor) {
+        snmp_log(LOG_ERR,
+                 "bad cursor param to udpEndpointTable_cursor_init\n");
+        return;
+    }
+
+    cursor->timeout = UDPENDPOINTTABLE_CACHE_TIMEOUT;   /* seconds */
+}                               /* udpEndpointTable_cursor_init */
+
 static u_long
 _address_type_from_len(int addrlen) {
 	switch (addrlen) {
@@ -212,118 +269,80 @@ _address_type_from_len(int addrlen) {
 	}
 }
 
-int
-udpEndpointTable_container_load(netsnmp_container *container)
+/*
+ * add the row of an endpoint to a page, if it belongs there
+ */
+static void
+_page_add_endpoint(void *data, void *context)
 {
+    netsnmp_udp_endpoint_entry *ep = (netsnmp_udp_endpoint_entry *) data;
+    netsnmp_table_cursor_page *page = (netsnmp_table_cursor_page *) context;
     udpEndpointTable_rowreq_ctx *rowreq_ctx;
-    netsnmp_container *ep_c;
-    netsnmp_iterator *ep_it;
-    netsnmp_udp_endpoint_entry *ep;
+    udpEndpointTable_mib_index tbl_idx;
+    oid             oid_tmp[MAX_udpEndpointTable_IDX_LEN];
+    netsnmp_index   oid_idx;
+
+    if (MFD_SUCCESS !=
+        udpEndpointTable_indexes_set_tbl_idx(&tbl_idx,
+                                    _address_type_from_len(ep->loc_addr_len),
+                                    (char *) ep->loc_addr,
+                                    ep->loc_addr_len,
+                                    ep->loc_port,
+                                    _address_type_from_len(ep->rmt_addr_len),
+                                    (char *) ep->rmt_addr,
+                                    ep->rmt_addr_len,
+                                    ep->rmt_port,
+                                    ep->instance,
+                                    ep->pid)) {
+        snmp_log(LOG_ERR,
+                 "error setting index while loading "
+                 "udpEndpointTable data.\n");
+        return;
+    }
 
     /*
-     * temporary storage for index values
+     * only build the rows the page keeps
      */
-    u_long	udpEndpointLocalAddressType;
-    u_long	udpEndpointRemoteAddressType;
-
-    DEBUGMSGTL(("verbose:udpEndpointTable:udpEndpointTable_container_load",
-                "called\n"));
+    oid_idx.oids = oid_tmp;
+    oid_idx.len = OID_LENGTH(oid_tmp);
+    if (0 != udpEndpointTable_index_to_oid(&oid_idx, &tbl_idx) ||
+        netsnmp_table_cursor_page_skip(page, &oid_idx))
+        return;
 
-    /*
-     * TODO:351:M: |-> Load/update data in the udpEndpointTable container.
-     * loop over your udpEndpointTable data, allocate a rowreq context,
-     * set the index(es) [and data, optionally] and insert into
-     * the container.
-     */
-    ep_c = netsnmp_access_udp_endpoint_container_load(NULL, 0);
-    if (NULL == ep_c)
-        return MFD_RESOURCE_UNAVAILABLE;
-    ep_it = CONTAINER_ITERATOR(ep_c);
-    if (NULL == ep_it) {
-        netsnmp_access_udp_endpoint_container_free(ep_c, 0);
-        return MFD_RESOURCE_UNAVAILABLE;
-    }
-    for (ep = (netsnmp_udp_endpoint_entry*)ITERATOR_FIRST(ep_it); ep;
-         ep = (netsnmp_udp_endpoint_entry*)ITERATOR_NEXT (ep_it)) {
-
-        /*
-         * TODO:352:M: |   |-> set indexes in new udpEndpointTable rowreq context.
-         */
-        rowreq_ctx = udpEndpointTable_allocate_rowreq_ctx();
-        if (NULL == rowreq_ctx) {
-            snmp_log(LOG_ERR, "memory allocation failed\n");
-            return MFD_RESOURCE_UNAVAILABLE;
-        }
-        udpEndpointLocalAddressType = _address_type_from_len(ep->loc_addr_len);
-	udpEndpointRemoteAddressType = _address_type_from_len(ep->rmt_addr_len);
-        if (MFD_SUCCESS !=
-            udpEndpointTable_indexes_set(rowreq_ctx,
-                                         udpEndpointLocalAddressType,
-                                         (char *) ep->loc_addr,
-                                         ep->loc_addr_len,
-                                         ep->loc_port,
-                                         udpEndpointRemoteAddressType,
-                                         (char *) ep->rmt_addr,
-                                         ep->rmt_addr_len,
-                                         ep->rmt_port,
-                                         ep->instance,
-                                         ep->pid)) {
-            snmp_log(LOG_ERR,
-                     "error setting index while loading "
-                     "udpEndpointTable data.\n");
-            udpEndpointTable_release_rowreq_ctx(rowreq_ctx);
-            continue;
-        }
-
-        /*
-         * TODO:352:r: |   |-> populate udpEndpointTable data context.
-         * Populate data context here. (optionally, delay until row prep)
-         */
-        /*
-         * non-TRANSIENT data: no need to copy. set pointer to data 
-         */
-
-        /*
-         * insert into table container
-         */
-        if (CONTAINER_INSERT(container, rowreq_ctx))
-	    udpEndpointTable_release_rowreq_ctx(rowreq_ctx);
+    rowreq_ctx = udpEndpointTable_allocate_rowreq_ctx();
+    if (NULL == rowreq_ctx) {
+        snmp_log(LOG_ERR, "memory allocation failed\n");
+        return;
     }
+    rowreq_ctx->tbl_idx = tbl_idx;
+    rowreq_ctx->oid_idx.len = oid_idx.len;
+    memcpy(rowreq_ctx->oid_idx.oids, oid_tmp, oid_idx.len * sizeof(oid));
 
-    ITERATOR_RELEASE(ep_it);
-
-    netsnmp_access_udp_endpoint_container_free(ep_c, 0);
-
-
-    DEBUGMSGT(("verbose:udpEndpointTable:udpEndpointTable_container_load",
-               "inserted %d records\n", (int)CONTAINER_SIZE(container)));
-
-    return MFD_SUCCESS;
-}                               /* udpEndpointTable_container_load */
+    netsnmp_table_cursor_page_add(page, rowreq_ctx);
+}
 
 /**
- * container clean up
+ * fetch a page of rows
  *
- * @param container container with all current items
+ * @param container the snapshot of the endpoints
+ * @param page page to which rows should be added
  *
- *  This optional callback is called prior to all
- *  item's being removed from the container. If you
- *  need to do any processing before that, do it here.
- *
- * @note
- *  The MFD helper will take care of releasing all the row contexts.
+ * @retval MFD_SUCCESS              : success.
  *
+ *  Only the endpoints of the page are turned into rows, so the memory
+ *  used by row contexts does not depend on the number of sockets.
  */
-void
-udpEndpointTable_container_free(netsnmp_container *container)
+int
+udpEndpointTable_cursor_fetch(netsnmp_container *container,
+                              netsnmp_table_cursor_page *page)
 {
-    DEBUGMSGTL(("verbose:udpEndpointTable:udpEndpointTable_container_free",
+    DEBUGMSGTL(("verbose:udpEndpointTable:udpEndpointTable_cursor_fetch",
                 "called\n"));
 
-    /*
-     * TODO:380:M: Free udpEndpointTable container data.
-     */
-}                               /* udpEndpointTable_container_free */
+    CONTAINER_FOR_EACH(container, _page_add_endpoint, page);
+
+    return MFD_SUCCESS;
+}                               /* udpEndpointTable_cursor_fetch */
 
 /**
  * prepare row for processing.
@@ -347,10 +366,15 @@ udpEndpointTable_row_prep(udpEndpointTable_rowreq_ctx * rowreq_ctx)
     netsnmp_assert(NULL != rowreq_ctx);
 
     /*
-     * TODO:390:o: Prepare row for request.
-     * If populating row data was delayed, this is the place to
-     * fill in the row for this request.
+     * the snapshot was loaded without the pids
      */
+    if (0 == rowreq_ctx->tbl_idx.udpEndpointProcess) {
+        rowreq_ctx->tbl_idx.udpEndpointProcess =
+            netsnmp_access_udp_endpoint_pid(rowreq_ctx->tbl_idx.
+                                            udpEndpointInstance,
+                                            _pids_stale);
+        _pids_stale = 0;
+    }
 
     return MFD_SUCCESS;
 }                               /* udpEndpointTable_row_prep */
@@ -57,10 +57,12 @@ extern          "C" {
     void            udpEndpointTable_container_free(netsnmp_container
                                                     *container);
 
-    int             udpEndpointTable_cache_load(netsnmp_container
-                                                *container);
-    void            udpEndpointTable_cache_free(netsnmp_container
-                                                *container);
+    void            udpEndpointTable_cursor_init(netsnmp_table_cursor *
+                                                 cursor);
+    int             udpEndpointTable_cursor_fetch(netsnmp_container
+                                                  *container,
+                                                  netsnmp_table_cursor_page
+                                                  *page);
 
     int             udpEndpointTable_row_prep(udpEndpointTable_rowreq_ctx *
                                               rowreq_ctx);
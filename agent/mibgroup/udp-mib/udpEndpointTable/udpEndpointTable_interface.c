@@ -40,7 +40,7 @@
 #include "udpEndpointTable.h"
 
 
-#include <net-snmp/agent/table_container.h>
+#include <net-snmp/agent/table_cursor.h>
 #include <net-snmp/library/container.h>
 
 #include "udpEndpointTable_interface.h"
@@ -57,7 +57,7 @@ netsnmp_feature_require(check_all_requests_error);
 netsnmp_feature_child_of(udpEndpointTable_container_size, udpEndpointTable_external_access);
 netsnmp_feature_child_of(udpEndpointTable_registration_set, udpEndpointTable_external_access);
 netsnmp_feature_child_of(udpEndpointTable_registration_get, udpEndpointTable_external_access);
-netsnmp_feature_child_of(udpEndpointTable_container_get, udpEndpointTable_external_access);
+netsnmp_feature_child_of(udpEndpointTable_cursor_get, udpEndpointTable_external_access);
 
 /**********************************************************************
  **********************************************************************
@@ -75,6 +75,7 @@ typedef struct udpEndpointTable_interface_ctx_s {
 
     netsnmp_container *container;
     netsnmp_cache  *cache;
+    netsnmp_table_cursor *cursor;
 
     udpEndpointTable_registration *user_ctx;
 
@@ -87,18 +88,18 @@ typedef struct udpEndpointTable_interface_ctx_s {
 static udpEndpointTable_interface_ctx udpEndpointTable_if_ctx;
 
 static void
-                _udpEndpointTable_container_init(udpEndpointTable_interface_ctx * if_ctx);
+                _udpEndpointTable_cursor_init(udpEndpointTable_interface_ctx * if_ctx);
 static void
-                _udpEndpointTable_container_shutdown(udpEndpointTable_interface_ctx *
-                                                     if_ctx);
+                _udpEndpointTable_cursor_shutdown(udpEndpointTable_interface_ctx *
+                                                  if_ctx);
 
-#ifndef NETSNMP_FEATURE_REMOVE_UDPENDPOINTTABLE_CONTAINER_GET
-netsnmp_container *
-udpEndpointTable_container_get(void)
+#ifndef NETSNMP_FEATURE_REMOVE_UDPENDPOINTTABLE_CURSOR_GET
+netsnmp_table_cursor *
+udpEndpointTable_cursor_get(void)
 {
-    return udpEndpointTable_if_ctx.container;
+    return udpEndpointTable_if_ctx.cursor;
 }
-#endif /* NETSNMP_FEATURE_REMOVE_UDPENDPOINTTABLE_CONTAINER_GET */
+#endif /* NETSNMP_FEATURE_REMOVE_UDPENDPOINTTABLE_CURSOR_GET */
 
 #ifndef NETSNMP_FEATURE_REMOVE_UDPENDPOINTTABLE_REGISTRATION_GET
 udpEndpointTable_registration *
@@ -194,12 +195,12 @@ _udpEndpointTable_initialize_interface(udpEndpointTable_registration *
     udpEndpointTable_init_data(reg_ptr);
 
     /*
-     * set up the container
+     * set up the container and the cursor
      */
-    _udpEndpointTable_container_init(&udpEndpointTable_if_ctx);
-    if (NULL == udpEndpointTable_if_ctx.container) {
+    _udpEndpointTable_cursor_init(&udpEndpointTable_if_ctx);
+    if (NULL == udpEndpointTable_if_ctx.cursor) {
         snmp_log(LOG_ERR,
-                 "could not initialize container for udpEndpointTable\n");
+                 "could not initialize cursor for udpEndpointTable\n");
         return;
     }
 
@@ -286,13 +287,11 @@ _udpEndpointTable_initialize_interface(udpEndpointTable_registration *
 
     /*************************************************
      *
-     * inject container_table helper
+     * inject table_cursor helper
      */
     handler =
-        netsnmp_container_table_handler_get(tbl_info,
-                                            udpEndpointTable_if_ctx.
-                                            container,
-                                            TABLE_CONTAINER_KEY_NETSNMP_INDEX);
+        netsnmp_table_cursor_handler_get(tbl_info,
+                                         udpEndpointTable_if_ctx.cursor);
     netsnmp_inject_handler(reginfo, handler);
 
     /*************************************************
@@ -320,9 +319,9 @@ _udpEndpointTable_shutdown_interface(udpEndpointTable_registration *
                                      reg_ptr)
 {
     /*
-     * shutdown the container
+     * shutdown the cursor
      */
-    _udpEndpointTable_container_shutdown(&udpEndpointTable_if_ctx);
+    _udpEndpointTable_cursor_shutdown(&udpEndpointTable_if_ctx);
 }
 
 void
@@ -723,7 +722,7 @@ _mfd_udpEndpointTable_post_request(netsnmp_mib_handler *handler,
                                    netsnmp_request_info *requests)
 {
     udpEndpointTable_rowreq_ctx *rowreq_ctx = (udpEndpointTable_rowreq_ctx*)
-        netsnmp_container_table_row_extract(requests);
+        netsnmp_table_cursor_row_extract(requests);
     int             rc, packet_rc;
 
     DEBUGMSGTL(("internal:udpEndpointTable:_mfd_udpEndpointTable_post_request", "called\n"));
@@ -770,7 +769,7 @@ _mfd_udpEndpointTable_object_lookup(netsnmp_mib_handler *handler,
 {
     int             rc = SNMP_ERR_NOERROR;
     udpEndpointTable_rowreq_ctx *rowreq_ctx = (udpEndpointTable_rowreq_ctx*)
-        netsnmp_container_table_row_extract(requests);
+        netsnmp_table_cursor_row_extract(requests);
 
     DEBUGMSGTL(("internal:udpEndpointTable:_mfd_udpEndpointTable_object_lookup", "called\n"));
 
@@ -841,7 +840,7 @@ _mfd_udpEndpointTable_get_values(netsnmp_mib_handler *handler,
                                  netsnmp_request_info *requests)
 {
     udpEndpointTable_rowreq_ctx *rowreq_ctx = (udpEndpointTable_rowreq_ctx*)
-        netsnmp_container_table_row_extract(requests);
+        netsnmp_table_cursor_row_extract(requests);
     netsnmp_table_request_info *tri;
     u_char         *old_string;
     void            (*dataFreeHook) (void *);
@@ -969,22 +968,6 @@ _cache_free(netsnmp_cache * cache, void *magic)
     _container_free(container);
 }                               /* _cache_free */
 
-/**
- * @internal
- */
-static void
-_container_item_free(udpEndpointTable_rowreq_ctx * rowreq_ctx,
-                     void *context)
-{
-    DEBUGMSGTL(("internal:udpEndpointTable:_container_item_free",
-                "called\n"));
-
-    if (NULL == rowreq_ctx)
-        return;
-
-    udpEndpointTable_release_rowreq_ctx(rowreq_ctx);
-}                               /* _container_item_free */
-
 /**
  * @internal
  */
@@ -1000,26 +983,57 @@ _container_free(netsnmp_container *container)
     }
 
     /*
-     * call user code
+     * the pages were built from the old contents
      */
-    udpEndpointTable_container_free(container);
+    netsnmp_table_cursor_invalidate(udpEndpointTable_if_ctx.cursor);
 
     /*
-     * free all items. inefficient, but easy.
+     * call user code, which frees the endpoints
      */
-    CONTAINER_CLEAR(container,
-                    (netsnmp_container_obj_func *) _container_item_free,
-                    NULL);
+    udpEndpointTable_container_free(container);
 }                               /* _container_free */
 
 /**
  * @internal
- * initialize the container with functions or wrappers
+ */
+static int
+_cursor_fetch(netsnmp_table_cursor *cursor, netsnmp_table_cursor_page *page)
+{
+    udpEndpointTable_interface_ctx *if_ctx =
+        (udpEndpointTable_interface_ctx *) cursor->magic;
+
+    DEBUGMSGTL(("internal:udpEndpointTable:_cursor_fetch", "called\n"));
+
+    /*
+     * call user code
+     */
+    return udpEndpointTable_cursor_fetch(if_ctx->container, page);
+}                               /* _cursor_fetch */
+
+/**
+ * @internal
+ */
+static void
+_cursor_row_free(void *row, void *magic)
+{
+    DEBUGMSGTL(("internal:udpEndpointTable:_cursor_row_free", "called\n"));
+
+    if (NULL == row)
+        return;
+
+    udpEndpointTable_release_rowreq_ctx((udpEndpointTable_rowreq_ctx *)
+                                        row);
+}                               /* _cursor_row_free */
+
+/**
+ * @internal
+ * initialize the cache, the container of endpoints it loads and the
+ * cursor serving the rows, with functions or wrappers
  */
 void
-_udpEndpointTable_container_init(udpEndpointTable_interface_ctx * if_ctx)
+_udpEndpointTable_cursor_init(udpEndpointTable_interface_ctx * if_ctx)
 {
-    DEBUGMSGTL(("internal:udpEndpointTable:_udpEndpointTable_container_init", "called\n"));
+    DEBUGMSGTL(("internal:udpEndpointTable:_udpEndpointTable_cursor_init", "called\n"));
 
     /*
      * cache init
@@ -1047,25 +1061,34 @@ _udpEndpointTable_container_init(udpEndpointTable_interface_ctx * if_ctx)
     }
     if_ctx->container->container_name = strdup("udpEndpointTable");
 
-    if (NULL != if_ctx->cache)
-        if_ctx->cache->magic = (void *) if_ctx->container;
-}                               /* _udpEndpointTable_container_init */
+    if_ctx->cache->magic = (void *) if_ctx->container;
+
+    if_ctx->cursor = netsnmp_table_cursor_create(_cursor_fetch,
+                                                 _cursor_row_free, if_ctx);
+    if (NULL == if_ctx->cursor) {
+        snmp_log(LOG_ERR, "error creating cursor for udpEndpointTable\n");
+        return;
+    }
+
+    udpEndpointTable_cursor_init(if_ctx->cursor);
+}                               /* _udpEndpointTable_cursor_init */
 
 /**
  * @internal
- * shutdown the container with functions or wrappers
+ * shutdown the cursor with functions or wrappers
  */
 void
-_udpEndpointTable_container_shutdown(udpEndpointTable_interface_ctx *
-                                     if_ctx)
+_udpEndpointTable_cursor_shutdown(udpEndpointTable_interface_ctx * if_ctx)
 {
-    DEBUGMSGTL(("internal:udpEndpointTable:_udpEndpointTable_container_shutdown", "called\n"));
+    DEBUGMSGTL(("internal:udpEndpointTable:_udpEndpointTable_cursor_shutdown", "called\n"));
 
     udpEndpointTable_container_shutdown(if_ctx->container);
 
     _container_free(if_ctx->container);
 
-}                               /* _udpEndpointTable_container_shutdown */
+    netsnmp_table_cursor_free(if_ctx->cursor);
+    if_ctx->cursor = NULL;
+}                               /* _udpEndpointTable_cursor_shutdown */
 
 
 #ifndef NETSNMP_FEATURE_REMOVE_UDPENDPOINTTABLE_EXTERNAL_ACCESS
@@ -1092,7 +1115,7 @@ udpEndpointTable_row_find_by_mib_index(udpEndpointTable_mib_index *
         return NULL;
 
     rowreq_ctx = (udpEndpointTable_rowreq_ctx*)
-        CONTAINER_FIND(udpEndpointTable_if_ctx.container, &oid_idx);
+        netsnmp_table_cursor_find(udpEndpointTable_if_ctx.cursor, &oid_idx, 0);
 
     return rowreq_ctx;
 }
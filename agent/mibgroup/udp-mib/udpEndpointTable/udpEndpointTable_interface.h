@@ -65,7 +65,7 @@ extern          "C" {
         * udpEndpointTable_registration_set(udpEndpointTable_registration *
                                             newreg);
 
-    netsnmp_container *udpEndpointTable_container_get(void);
+    netsnmp_table_cursor *udpEndpointTable_cursor_get(void);
     int             udpEndpointTable_container_size(void);
 
         udpEndpointTable_rowreq_ctx
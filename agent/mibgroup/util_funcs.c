@@ -271,6 +271,11 @@ get_exec_output(struct extensible *ex)
 
     DEBUGMSGTL(("exec:get_exec_output","calling %s\n", ex->command));
 
+    /*
+     * the cache file and the cached command are shared with the pass
+     * scripts that agent worker threads may run
+     */
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_AGENT_EXEC);
     sprintf(cachefile, "%s/%s", get_persistent_directory(), NETSNMP_CACHEFILE);
 #ifdef NETSNMP_EXCACHETIME
     curtime = time(NULL);
@@ -293,6 +298,7 @@ get_exec_output(struct extensible *ex)
 #ifdef NETSNMP_EXCACHETIME
                 cachetime = 0;
 #endif
+                snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_EXEC);
                 return -1;
         }
         if (cachebytes > 0)
@@ -305,7 +311,9 @@ get_exec_output(struct extensible *ex)
     }
 #endif
     DEBUGMSGTL(("exec:get_exec_output","using cached value\n"));
-    if ((cfd = open(cachefile, O_RDONLY)) < 0) {
+    cfd = open(cachefile, O_RDONLY);
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_AGENT_EXEC);
+    if (cfd < 0) {
         snmp_log(LOG_ERR,"can not open cache file\n");
         setPerrorstatus(cachefile);
         return -1;
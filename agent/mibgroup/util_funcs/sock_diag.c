@@ -0,0 +1,130 @@
+/*
+ * util_funcs/sock_diag.c:  list sockets through NETLINK_SOCK_DIAG.
+ *
+ * The kernel streams the sockets in binary form, already filtered by
+ * state, which is far cheaper than formatting /proc/net/{tcp,udp}{,6}
+ * and parsing it back when there are many sockets.
+ */
+#include <net-snmp/net-snmp-config.h>
+
+#include <net-snmp/net-snmp-includes.h>
+
+#include "sock_diag.h"
+
+#include <errno.h>
+#if HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#if HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
+#ifdef HAVE_LINUX_SOCK_DIAG_H
+#include <linux/netlink.h>
+#include <linux/sock_diag.h>
+
+/*
+ * The kernel sizes the messages of a dump after the receive buffer, up to
+ * 32k, so a large one means fewer system calls.
+ */
+#define SOCK_DIAG_BUF_SIZE 65536
+
+int
+netsnmp_sock_diag_dump(int family, int protocol, unsigned int states,
+                       netsnmp_sock_diag_callback *callback, void *ctx)
+{
+    static unsigned int seq;
+    struct {
+        struct nlmsghdr         nlh;
+        struct inet_diag_req_v2 req;
+    } request;
+    struct sockaddr_nl nladdr;
+    struct nlmsghdr *nlh;
+    char           *buf;
+    int             fd, len, rc = -1, seen = 0, done = 0;
+
+    fd = socket(AF_NETLINK, SOCK_DGRAM, NETLINK_SOCK_DIAG);
+    if (fd < 0) {
+        DEBUGMSGTL(("sock_diag", "socket: %s\n", strerror(errno)));
+        return -1;
+    }
+
+    memset(&request, 0, sizeof(request));
+    request.nlh.nlmsg_len = sizeof(request);
+    request.nlh.nlmsg_type = SOCK_DIAG_BY_FAMILY;
+    request.nlh.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    request.nlh.nlmsg_seq = ++seq;
+    request.req.sdiag_family = family;
+    request.req.sdiag_protocol = protocol;
+    request.req.idiag_states = states;
+
+    memset(&nladdr, 0, sizeof(nladdr));
+    nladdr.nl_family = AF_NETLINK;
+    if (sendto(fd, &request, sizeof(request), 0,
+               (struct sockaddr *) &nladdr, sizeof(nladdr)) < 0) {
+        DEBUGMSGTL(("sock_diag", "sendto: %s\n", strerror(errno)));
+        close(fd);
+        return -1;
+    }
+
+    buf = malloc(SOCK_DIAG_BUF_SIZE);
+    if (NULL == buf) {
+        close(fd);
+        return -1;
+    }
+
+    while (!done) {
+        len = recv(fd, buf, SOCK_DIAG_BUF_SIZE, 0);
+        if (len < 0 && EINTR == errno)
+            continue;
+        if (len <= 0) {
+            DEBUGMSGTL(("sock_diag", "recv: %s\n",
+                        len ? strerror(errno) : "end of file"));
+            rc = seen ? -2 : -1;
+            break;
+        }
+        for (nlh = (struct nlmsghdr *) buf; NLMSG_OK(nlh, len);
+             nlh = NLMSG_NEXT(nlh, len)) {
+            if (nlh->nlmsg_seq != request.nlh.nlmsg_seq)
+                continue;
+            if (NLMSG_DONE == nlh->nlmsg_type) {
+                rc = 0;
+                done = 1;
+                break;
+            }
+            if (NLMSG_ERROR == nlh->nlmsg_type) {
+                /** e.g. no diag support for this protocol in the kernel */
+                struct nlmsgerr *err = (struct nlmsgerr *) NLMSG_DATA(nlh);
+
+                DEBUGMSGTL(("sock_diag", "family %d protocol %d: error %d\n",
+                            family, protocol, -err->error));
+                rc = seen ? -2 : -1;
+                done = 1;
+                break;
+            }
+            if (SOCK_DIAG_BY_FAMILY != nlh->nlmsg_type ||
+                nlh->nlmsg_len < NLMSG_LENGTH(sizeof(struct inet_diag_msg)))
+                continue;
+            seen = 1;
+            if (callback((const struct inet_diag_msg *) NLMSG_DATA(nlh),
+                         ctx) < 0) {
+                rc = -2;
+                done = 1;
+                break;
+            }
+        }
+    }
+
+    free(buf);
+    close(fd);
+    return rc;
+}
+#endif /* HAVE_LINUX_SOCK_DIAG_H */
@@ -0,0 +1,34 @@
+/*
+ * util_funcs/sock_diag.h:  utility function to list the sockets of one
+ * family and protocol through NETLINK_SOCK_DIAG on linux.
+ */
+#ifndef NETSNMP_MIBGROUP_UTIL_FUNCS_SOCK_DIAG_H
+#define NETSNMP_MIBGROUP_UTIL_FUNCS_SOCK_DIAG_H
+
+#ifndef linux
+config_error(sock_diag is only suppored on linux)
+#endif
+
+#ifdef HAVE_LINUX_SOCK_DIAG_H
+#include <linux/inet_diag.h>
+
+/*
+ * Called for every socket dumped; a negative return value stops the dump.
+ */
+typedef int (netsnmp_sock_diag_callback)(const struct inet_diag_msg *msg,
+                                         void *ctx);
+
+/*
+ * Dumps the sockets of family (AF_INET or AF_INET6) and protocol
+ * (IPPROTO_TCP or IPPROTO_UDP) whose state is in states, a bit mask of
+ * (1 << TCP_xxx) values, filtered by the kernel.
+ *
+ * @retval  0 all sockets were passed to callback
+ * @retval -1 sock_diag is not available; callback was not called
+ * @retval -2 the dump failed, or callback stopped it
+ */
+int netsnmp_sock_diag_dump(int family, int protocol, unsigned int states,
+                           netsnmp_sock_diag_callback *callback, void *ctx);
+#endif /* HAVE_LINUX_SOCK_DIAG_H */
+
+#endif /* NETSNMP_MIBGROUP_UTIL_FUNCS_SOCK_DIAG_H */
@@ -83,6 +83,7 @@ SOFTWARE.
 #include <net-snmp/agent/net-snmp-agent-includes.h>
 #include <net-snmp/library/large_fd_set.h>
 #include <net-snmp/library/snmp_assert.h>
+#include <net-snmp/agent/agent_workers.h>
 #include "agent_global_vars.h"
 
 #if HAVE_SYSLOG_H
@@ -331,6 +332,100 @@ netsnmp_free_agent_request_info(netsnmp_agent_request_info *ari)
     }
 }
 
+/**
+ * Returns the arena of the agent session that ari belongs to.  Memory
+ * allocated from it stays valid until the session has been answered and
+ * is released all at once, so handlers can use it for per request data
+ * instead of allocating and freeing every item.
+ *
+ * Returns NULL when no arena is available, e.g. for handlers called from
+ * a worker thread, which get a private copy of the request info; callers
+ * must fall back to malloc() then.
+ */
+netsnmp_arena *
+netsnmp_agent_arena(netsnmp_agent_request_info *ari)
+{
+    if (ari == NULL || ari->asp == NULL || ari->asp->reqinfo != ari)
+        return NULL;
+    return ari->asp->arena;
+}
+
+/**
+ * Creates a data list node for per request data, from the agent session
+ * arena when possible.  The node can be added to and removed from the
+ * request or agent data lists like any other node.
+ */
+netsnmp_data_list *
+netsnmp_agent_create_list_data(netsnmp_agent_request_info *ari,
+                               const char *name, void *data,
+                               Netsnmp_Free_List_Data *beer)
+{
+    netsnmp_arena  *arena = netsnmp_agent_arena(ari);
+
+    if (arena)
+        return netsnmp_create_data_list_arena(arena, name, data, beer);
+    return netsnmp_create_data_list(name, data, beer);
+}
+
+/*
+ * Arenas of finished agent sessions are kept for reuse, so that a busy
+ * agent does not need to allocate them for every request.  Only the first
+ * chunk survives a reset; it is sized to hold a GETNEXT of about a dozen
+ * table columns, whose table_request_info takes 1 KB each.
+ */
+#define AGENT_ARENA_CHUNK 16384
+#define AGENT_ARENA_POOL_SIZE 8
+static netsnmp_arena *agent_arena_pool[AGENT_ARENA_POOL_SIZE];
+static int      agent_arena_pooled;
+
+static netsnmp_arena *
+_agent_arena_get(void)
+{
+    if (agent_arena_pooled > 0)
+        return agent_arena_pool[--agent_arena_pooled];
+    return netsnmp_arena_create(AGENT_ARENA_CHUNK);
+}
+
+static void
+_agent_arena_put(netsnmp_arena *arena)
+{
+    if (arena == NULL)
+        return;
+    if (agent_arena_pooled < AGENT_ARENA_POOL_SIZE) {
+        netsnmp_arena_reset(arena);
+        agent_arena_pool[agent_arena_pooled++] = arena;
+    } else
+        netsnmp_arena_free(arena);
+}
+
+static void
+_agent_arena_shutdown(void)
+{
+    while (agent_arena_pooled > 0)
+        netsnmp_arena_free(agent_arena_pool[--agent_arena_pooled]);
+}
+
+/*
+ * Allocate and free the per request arrays of an agent session; they come
+ * from the session arena if it has one.
+ */
+static void *
+_asp_calloc(netsnmp_agent_session *asp, size_t nmemb, size_t size)
+{
+    if (asp->arena == NULL)
+        return calloc(nmemb, size);
+    if (size && nmemb > (size_t) -1 / size)
+        return NULL;
+    return netsnmp_arena_alloc(asp->arena, nmemb * size);
+}
+
+static void
+_asp_free(netsnmp_agent_session *asp, void *ptr)
+{
+    if (asp->arena == NULL)
+        free(ptr);
+}
+
 const oid version_sysoid[] = { NETSNMP_SYSTEM_MIB };
 const int version_sysoid_len = OID_LENGTH(version_sysoid);
 
@@ -451,6 +546,7 @@ typedef struct agent_set_cache_s {
     netsnmp_request_info *requests;
     netsnmp_variable_list *saved_vars;
     netsnmp_data_list *agent_data;
+    netsnmp_arena  *arena;
 
     /*
      * list 
@@ -486,6 +582,7 @@ save_set_cache(netsnmp_agent_session *asp)
     ptr->requests = asp->requests;
     ptr->saved_vars = asp->pdu->variables; /* requests contains pointers to variables */
     ptr->vbcount = asp->vbcount;
+    ptr->arena = asp->arena;    /* the saved data may live in it */
 
     /*
      * make the agent forget about what we've saved 
@@ -494,6 +591,7 @@ save_set_cache(netsnmp_agent_session *asp)
     asp->reqinfo->agent_data = NULL;
     asp->pdu->variables = NULL;
     asp->requests = NULL;
+    asp->arena = NULL;
 
     ptr->next = Sets;
     Sets = ptr;
@@ -519,6 +617,7 @@ get_set_cache(netsnmp_agent_session *asp)
             /*
              * found it.  Get the needed data 
              */
+            _asp_free(asp, asp->treecache);
             asp->treecache = ptr->treecache;
             asp->treecache_len = ptr->treecache_len;
             asp->treecache_num = ptr->treecache_num;
@@ -538,8 +637,17 @@ get_set_cache(netsnmp_agent_session *asp)
 		for (i = 0; i < asp->vbcount; i++) {
 		    netsnmp_free_request_data_sets(&asp->requests[i]);
 		}
-		free(asp->requests);
+		_asp_free(asp, asp->requests);
 	    }
+            /*
+             * Nothing allocated for this pass is left, so continue with
+             * the arena the cached data came from, or with the heap if it
+             * had none; _asp_free() decides by asp->arena.
+             */
+            _asp_free(asp, asp->bulkcache);
+            asp->bulkcache = NULL;
+            _agent_arena_put(asp->arena);
+            asp->arena = ptr->arena;
 	    /*
 	     * If we replace asp->requests with the info from the set cache,
 	     * we should replace asp->pdu->variables also with the cached
@@ -1456,6 +1564,8 @@ init_master_agent(void)
     /* default to a default cache size */
     netsnmp_set_lookup_cache_size(-1);
 
+    netsnmp_agent_workers_init();
+
     if (netsnmp_ds_get_boolean(NETSNMP_DS_APPLICATION_ID, 
 			       NETSNMP_DS_AGENT_ROLE) != MASTER_AGENT) {
         DEBUGMSGTL(("snmp_agent",
@@ -1555,6 +1665,9 @@ shutdown_master_agent(void)
 {
     clear_nsap_list();
 
+    netsnmp_agent_workers_shutdown();
+    _agent_arena_shutdown();
+
 #ifndef NETSNMP_NO_PDU_STATS
     _pdu_stats_shutdown();
 #endif /* NETSNMP_NO_PDU_STATS */
@@ -1590,6 +1703,7 @@ init_agent_snmp_session(netsnmp_session * session, netsnmp_pdu *pdu)
     asp->treecache_len = 0;
     asp->reqinfo = SNMP_MALLOC_TYPEDEF(netsnmp_agent_request_info);
     asp->flags = SNMP_AGENT_FLAGS_NONE;
+    asp->arena = _agent_arena_get();
     DEBUGMSGTL(("verbose:asp", "asp %p reqinfo %p created\n",
                 asp, asp->reqinfo));
 
@@ -1611,6 +1725,7 @@ free_agent_snmp_session(netsnmp_agent_session *asp)
     DEBUGMSGTL(("snmp_agent","agent_session %8p released\n", asp));
 
     netsnmp_remove_from_delegated(asp);
+    netsnmp_agent_workers_cancel(asp);
     
     DEBUGMSGTL(("verbose:asp", "asp %p reqinfo %p freed\n",
                 asp, asp->reqinfo));
@@ -1621,19 +1736,20 @@ free_agent_snmp_session(netsnmp_agent_session *asp)
         snmp_free_pdu(asp->pdu);
     if (asp->reqinfo)
         netsnmp_free_agent_request_info(asp->reqinfo);
-    SNMP_FREE(asp->treecache);
-    SNMP_FREE(asp->bulkcache);
+    _asp_free(asp, asp->treecache);
+    _asp_free(asp, asp->bulkcache);
     if (asp->requests) {
         int             i;
         for (i = 0; i < asp->vbcount; i++) {
             netsnmp_free_request_data_sets(&asp->requests[i]);
         }
-        SNMP_FREE(asp->requests);
+        _asp_free(asp, asp->requests);
     }
     if (asp->cache_store) {
         netsnmp_free_cachemap(asp->cache_store);
         asp->cache_store = NULL;
     }
+    _agent_arena_put(asp->arena);
     SNMP_FREE(asp);
 }
 
@@ -2461,16 +2577,20 @@ netsnmp_add_varbind_to_cache(netsnmp_agent_session *asp, int vbcount,
                  * WWW: non-linear expansion needed (with cap) 
                  */
 #define CACHE_GROW_SIZE 16
+                netsnmp_tree_cache *old_treecache = asp->treecache;
+                int             old_len = asp->treecache_len;
+
                 asp->treecache_len =
                     (asp->treecache_len + CACHE_GROW_SIZE);
-                asp->treecache =
-                    (netsnmp_tree_cache *)realloc(asp->treecache,
-                            sizeof(netsnmp_tree_cache) *
-                            asp->treecache_len);
+                asp->treecache = (netsnmp_tree_cache *)
+                    _asp_calloc(asp, asp->treecache_len,
+                                sizeof(netsnmp_tree_cache));
                 if (asp->treecache == NULL)
                     return NULL;
-                memset(asp->treecache + cacheid, 0,
-                       sizeof(netsnmp_tree_cache) * (CACHE_GROW_SIZE));
+                if (old_treecache)
+                    memcpy(asp->treecache, old_treecache,
+                           sizeof(netsnmp_tree_cache) * old_len);
+                _asp_free(asp, old_treecache);
             }
             asp->treecache[cacheid].subtree = tp;
             asp->treecache[cacheid].requests_begin = request;
@@ -2600,8 +2720,8 @@ netsnmp_create_subtree_cache(netsnmp_agent_session *asp)
 
     if (asp->treecache == NULL && asp->treecache_len == 0) {
         asp->treecache_len = SNMP_MAX(1 + asp->vbcount / 4, 16);
-        asp->treecache =
-            (netsnmp_tree_cache *)calloc(asp->treecache_len, sizeof(netsnmp_tree_cache));
+        asp->treecache = (netsnmp_tree_cache *)
+            _asp_calloc(asp, asp->treecache_len, sizeof(netsnmp_tree_cache));
         if (asp->treecache == NULL)
             return SNMP_ERR_GENERR;
     }
@@ -2679,9 +2799,9 @@ netsnmp_create_subtree_cache(netsnmp_agent_session *asp)
                             asp->pdu->errindex));
             }
 
-            asp->bulkcache =
-                (netsnmp_variable_list **) malloc(
-                    (n + asp->pdu->errindex * r) * sizeof(struct varbind_list *));
+            asp->bulkcache = (netsnmp_variable_list **)
+                _asp_calloc(asp, n + asp->pdu->errindex * r,
+                            sizeof(struct varbind_list *));
 
             if (!asp->bulkcache) {
                 DEBUGMSGTL(("snmp_agent:bulk", "Bulkcache malloc failed\n"));
@@ -2832,9 +2952,8 @@ netsnmp_reassign_requests(netsnmp_agent_session *asp)
     /*
      * malloc new space 
      */
-    asp->treecache =
-        (netsnmp_tree_cache *) calloc(asp->treecache_len,
-                                      sizeof(netsnmp_tree_cache));
+    asp->treecache = (netsnmp_tree_cache *)
+        _asp_calloc(asp, asp->treecache_len, sizeof(netsnmp_tree_cache));
 
     if (asp->treecache == NULL)
         return SNMP_ERR_GENERR;
@@ -2857,7 +2976,8 @@ netsnmp_reassign_requests(netsnmp_agent_session *asp)
             if (!netsnmp_add_varbind_to_cache(asp, asp->requests[i].index,
                                               asp->requests[i].requestvb,
                                               asp->requests[i].subtree->next)) {
-                SNMP_FREE(old_treecache);
+                _asp_free(asp, old_treecache);
+                old_treecache = NULL;
             }
         } else if (asp->requests[i].requestvb->type == ASN_PRIV_RETRY) {
             /*
@@ -2867,12 +2987,13 @@ netsnmp_reassign_requests(netsnmp_agent_session *asp)
             if (!netsnmp_add_varbind_to_cache(asp, asp->requests[i].index,
                                               asp->requests[i].requestvb,
                                               asp->requests[i].subtree)) {
-                SNMP_FREE(old_treecache);
+                _asp_free(asp, old_treecache);
+                old_treecache = NULL;
             }
         }
     }
 
-    SNMP_FREE(old_treecache);
+    _asp_free(asp, old_treecache);
     return SNMP_ERR_NOERROR;
 }
 
@@ -3766,7 +3887,8 @@ handle_pdu(netsnmp_agent_session *asp)
     case SNMP_MSG_INTERNAL_SET_RESERVE1:
 #endif /* NETSNMP_NO_WRITE_SUPPORT */
         asp->vbcount = count_varbinds(asp->pdu->variables);
-        asp->requests = calloc(asp->vbcount, sizeof(netsnmp_request_info));
+        asp->requests = (netsnmp_request_info *)
+            _asp_calloc(asp, asp->vbcount, sizeof(netsnmp_request_info));
         /*
          * collect varbinds 
          */
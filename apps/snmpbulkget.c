@@ -177,8 +177,10 @@ main(int argc, char *argv[])
     }
 
     /*
-     * open an SNMP session 
+     * open an SNMP session; the responses are only printed, so their
+     * values can be decoded in place
      */
+    session.flags |= SNMP_FLAGS_DECODE_IN_PLACE;
     ss = snmp_open(&session);
     if (ss == NULL) {
         /*
@@ -0,0 +1,740 @@
+/*
+ * snmpbulkpoll.c - walk subtrees on many network entities at once.
+ *
+ * Every agent gets its own single session, and all the walks are driven
+ * from one completion queue: as a response arrives its variables are
+ * printed, one line each prefixed by the agent, and the next GETBULK
+ * request of that walk is sent.  The number of walks in flight is limited
+ * per agent and in total, and an agent's session is only open while it
+ * has walks in flight.
+ */
+#include <net-snmp/net-snmp-config.h>
+
+#if HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#include <sys/types.h>
+#if HAVE_NETINET_IN_H
+#include <netinet/in.h>
+#endif
+#if TIME_WITH_SYS_TIME
+# include <sys/time.h>
+# include <time.h>
+#else
+# if HAVE_SYS_TIME_H
+#  include <sys/time.h>
+# else
+#  include <time.h>
+# endif
+#endif
+#if HAVE_SYS_SELECT_H
+#include <sys/select.h>
+#endif
+#include <stdio.h>
+#include <ctype.h>
+#if HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#if HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/snmp_completion.h>
+
+#define NETSNMP_DS_POLL_PRINT_STATISTICS	1
+#define NETSNMP_DS_POLL_DONT_CHECK_LEXICOGRAPHIC	2
+#define NETSNMP_DS_POLL_SPLIT_SUBTREES		3
+
+struct poll_root {
+    oid             name[MAX_OID_LEN];
+    size_t          name_length;
+};
+
+struct poll_agent {
+    char           *peername;
+    struct session_list *slp;
+    size_t          next_root;  /* the next root to start a walk on */
+    int             active;     /* walks in flight */
+    int             failed;
+    int             waiting;
+    struct poll_agent *next_wait;
+};
+
+struct poll_walk {
+    struct poll_agent *agent;
+    const struct poll_root *root;
+    oid             name[MAX_OID_LEN];
+    size_t          name_length;
+    int             count;
+    int             get;        /* nothing found, GET the root itself */
+};
+
+oid             objid_mib[] = { 1, 3, 6, 1, 2, 1 };
+int             reps = 10, non_reps = 0;
+int             agent_window = 4, total_window = 256;
+
+static netsnmp_session session;
+static netsnmp_completion_queue *cq;
+static struct poll_root *roots;
+static size_t   nroots;
+static struct poll_agent *agents;
+static size_t   nagents, next_agent;
+static struct poll_agent *wait_head, *wait_tail;
+static int      inflight, numprinted, agents_failed;
+static int      exitval;
+static u_char  *outbuf;
+static size_t   outbuf_len;
+
+void
+usage(void)
+{
+    fprintf(stderr, "USAGE: snmpbulkpoll ");
+    snmp_parse_args_usage(stderr);
+    fprintf(stderr, " [OID...]\n\n");
+    snmp_parse_args_descriptions(stderr);
+    fprintf(stderr,
+            "  -C APPOPTS\t\tSet various application specific behaviours:\n");
+    fprintf(stderr,
+            "\t\t\t  a<NUM>:  walk at most <NUM> subtrees of an agent at once\n");
+    fprintf(stderr,
+            "\t\t\t  c:       do not check returned OIDs are increasing\n");
+    fprintf(stderr,
+            "\t\t\t  g<NUM>:  walk at most <NUM> subtrees in total at once\n");
+    fprintf(stderr, "\t\t\t  n<NUM>:  set non-repeaters to <NUM>\n");
+    fprintf(stderr,
+            "\t\t\t  p:       print the number of variables found\n");
+    fprintf(stderr, "\t\t\t  r<NUM>:  set max-repeaters to <NUM>\n");
+    fprintf(stderr,
+            "\t\t\t  s:       walk each child of an OID known in the MIB\n\t\t\t\t    separately\n");
+    fprintf(stderr,
+            "\nAGENT is a comma separated list of agents, or @FILE to read them from\n"
+            "FILE (one per line, - for standard input).\n");
+}
+
+static
+    void
+optProc(int argc, char *const *argv, int opt)
+{
+    char           *endptr = NULL;
+    long            val;
+    char            flag;
+
+    switch (opt) {
+    case 'C':
+        while (*optarg) {
+            switch (flag = *optarg++) {
+            case 'c':
+                netsnmp_ds_toggle_boolean(NETSNMP_DS_APPLICATION_ID,
+                                NETSNMP_DS_POLL_DONT_CHECK_LEXICOGRAPHIC);
+                break;
+
+            case 'p':
+                netsnmp_ds_toggle_boolean(NETSNMP_DS_APPLICATION_ID,
+                                          NETSNMP_DS_POLL_PRINT_STATISTICS);
+                break;
+
+            case 's':
+                netsnmp_ds_toggle_boolean(NETSNMP_DS_APPLICATION_ID,
+                                          NETSNMP_DS_POLL_SPLIT_SUBTREES);
+                break;
+
+            case 'a':
+            case 'g':
+            case 'n':
+            case 'r':
+                val = strtol(optarg, &endptr, 0);
+                if (endptr == optarg || val < 0 ||
+                    (val == 0 && (flag == 'a' || flag == 'g'))) {
+                    /*
+                     * No number given -- error.
+                     */
+                    usage();
+                    exit(1);
+                }
+                switch (flag) {
+                case 'a':
+                    agent_window = val;
+                    break;
+                case 'g':
+                    total_window = val;
+                    break;
+                case 'n':
+                    non_reps = val;
+                    break;
+                default:
+                    reps = val;
+                    break;
+                }
+                optarg = endptr;
+                if (isspace((unsigned char)(*optarg))) {
+                    return;
+                }
+                break;
+
+            default:
+                fprintf(stderr, "Unknown flag passed to -C: %c\n",
+                        optarg[-1]);
+                exit(1);
+            }
+        }
+        break;
+    }
+}
+
+static void
+add_agent(const char *peername)
+{
+    struct poll_agent *tmp;
+
+    if (*peername == '\0')
+        return;
+    if ((nagents & (nagents - 1)) == 0) {
+        tmp = realloc(agents, (nagents ? 2 * nagents : 16) * sizeof(*tmp));
+        if (tmp == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        agents = tmp;
+    }
+    memset(&agents[nagents], 0, sizeof(agents[nagents]));
+    agents[nagents].peername = strdup(peername);
+    if (agents[nagents].peername == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    nagents++;
+}
+
+/*
+ * Reads the agents from a comma separated list or, for @FILE, from FILE.
+ */
+static int
+read_agents(const char *spec)
+{
+    char           *copy, *cp, *st = NULL;
+    char            line[1024];
+    FILE           *fp;
+
+    if (*spec != '@') {
+        copy = strdup(spec);
+        if (copy == NULL)
+            return 0;
+        for (cp = strtok_r(copy, ",", &st); cp;
+             cp = strtok_r(NULL, ",", &st))
+            add_agent(cp);
+        free(copy);
+        return 1;
+    }
+
+    if (strcmp(spec + 1, "-") == 0)
+        fp = stdin;
+    else if ((fp = fopen(spec + 1, "r")) == NULL) {
+        perror(spec + 1);
+        return 0;
+    }
+    while (fgets(line, sizeof(line), fp)) {
+        for (cp = line; isspace((unsigned char)*cp); cp++)
+            ;
+        if (*cp == '#')
+            continue;
+        cp[strcspn(cp, " \t\r\n")] = '\0';
+        add_agent(cp);
+    }
+    if (fp != stdin)
+        fclose(fp);
+    return 1;
+}
+
+static void
+add_root(const oid * name, size_t name_length)
+{
+    struct poll_root *tmp;
+
+    if ((nroots & (nroots - 1)) == 0) {
+        tmp = realloc(roots, (nroots ? 2 * nroots : 8) * sizeof(*tmp));
+        if (tmp == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        roots = tmp;
+    }
+    memcpy(roots[nroots].name, name, name_length * sizeof(oid));
+    roots[nroots].name_length = name_length;
+    nroots++;
+}
+
+static int
+compare_subid(const void *a, const void *b)
+{
+    const struct tree *ta = *(struct tree * const *) a;
+    const struct tree *tb = *(struct tree * const *) b;
+
+    return ta->subid < tb->subid ? -1 : ta->subid > tb->subid;
+}
+
+/*
+ * Adds the subtree name as one root or, with -Cs, one root per child of the
+ * first node below it in the MIB that has several, in OID order.  Walking a
+ * table this way walks its columns side by side.
+ */
+static void
+add_subtree(const oid * name, size_t name_length)
+{
+    oid             child[MAX_OID_LEN];
+    size_t          child_length, i, n;
+    struct tree    *tp = NULL, *cp, **children;
+
+    if (netsnmp_ds_get_boolean(NETSNMP_DS_APPLICATION_ID,
+                               NETSNMP_DS_POLL_SPLIT_SUBTREES))
+        tp = name_length ? get_tree_head() : NULL;
+    for (i = 0; tp && i < name_length; i++) {
+        while (tp && tp->subid != name[i])
+            tp = tp->next_peer;
+        if (tp && i + 1 < name_length)
+            tp = tp->child_list;
+    }
+
+    memcpy(child, name, name_length * sizeof(oid));
+    child_length = name_length;
+    while (tp && tp->child_list && tp->child_list->next_peer == NULL &&
+           child_length < MAX_OID_LEN - 1) {
+        tp = tp->child_list;
+        child[child_length++] = tp->subid;
+    }
+    if (tp == NULL || tp->child_list == NULL) {
+        add_root(name, name_length);
+        return;
+    }
+
+    for (n = 0, cp = tp->child_list; cp; cp = cp->next_peer)
+        n++;
+    children = malloc(n * sizeof(*children));
+    if (children == NULL) {
+        add_root(name, name_length);
+        return;
+    }
+    for (n = 0, cp = tp->child_list; cp; cp = cp->next_peer)
+        children[n++] = cp;
+    qsort(children, n, sizeof(*children), compare_subid);
+    for (i = 0; i < n; i++) {
+        child[child_length] = children[i]->subid;
+        add_root(child, child_length + 1);
+    }
+    free(children);
+}
+
+static void
+print_record(struct poll_agent *a, netsnmp_variable_list * vars)
+{
+    size_t          out_len = 0, i;
+
+    numprinted++;
+    if (!sprint_realloc_variable(&outbuf, &outbuf_len, &out_len, 1,
+                                 vars->name, vars->name_length, vars)) {
+        printf("%s %s [TRUNCATED]\n", a->peername, outbuf ? (char *) outbuf : "");
+        return;
+    }
+    /*
+     * one record per line
+     */
+    for (i = 0; i < out_len; i++)
+        if (outbuf[i] == '\n' || outbuf[i] == '\r')
+            outbuf[i] = ' ';
+    printf("%s %s\n", a->peername, outbuf);
+}
+
+static void
+agent_close(struct poll_agent *a)
+{
+    if (a->slp) {
+        snmp_sess_close(a->slp);
+        a->slp = NULL;
+        if (a->failed)
+            agents_failed++;
+    }
+}
+
+static void
+agent_fail(struct poll_agent *a)
+{
+    a->failed = 1;
+    a->next_root = nroots;
+    exitval = 1;
+}
+
+/*
+ * Sends the next request of a walk.
+ */
+static int
+walk_send(struct poll_walk *w)
+{
+    netsnmp_pdu    *pdu;
+    char           *err = NULL;
+
+    if (w->get)
+        pdu = snmp_pdu_create(SNMP_MSG_GET);
+    else if (session.version == SNMP_VERSION_1)
+        pdu = snmp_pdu_create(SNMP_MSG_GETNEXT);
+    else {
+        pdu = snmp_pdu_create(SNMP_MSG_GETBULK);
+        pdu->non_repeaters = non_reps;
+        pdu->max_repetitions = reps;
+    }
+    if (w->get)
+        snmp_add_null_var(pdu, w->root->name, w->root->name_length);
+    else
+        snmp_add_null_var(pdu, w->name, w->name_length);
+
+    if (netsnmp_completion_submit(cq, w->agent->slp, pdu, w) == NULL) {
+        snmp_sess_error(w->agent->slp, NULL, NULL, &err);
+        fprintf(stderr, "%s: %s\n", w->agent->peername,
+                err ? err : "send failed");
+        free(err);
+        return 0;
+    }
+    inflight++;
+    return 1;
+}
+
+static void
+walk_start(struct poll_agent *a)
+{
+    struct poll_walk *w;
+
+    w = calloc(1, sizeof(*w));
+    if (w == NULL) {
+        agent_fail(a);
+        return;
+    }
+    w->agent = a;
+    w->root = &roots[a->next_root++];
+    memcpy(w->name, w->root->name, w->root->name_length * sizeof(oid));
+    w->name_length = w->root->name_length;
+    if (walk_send(w))
+        a->active++;
+    else {
+        free(w);
+        agent_fail(a);
+    }
+}
+
+static void
+wait_push(struct poll_agent *a, int front)
+{
+    if (a->waiting)
+        return;
+    a->waiting = 1;
+    if (front) {
+        a->next_wait = wait_head;
+        wait_head = a;
+        if (wait_tail == NULL)
+            wait_tail = a;
+    } else {
+        a->next_wait = NULL;
+        if (wait_tail)
+            wait_tail->next_wait = a;
+        else
+            wait_head = a;
+        wait_tail = a;
+    }
+}
+
+/*
+ * Starts walks until the total window is full, first on the agents that
+ * have subtrees left to walk, then on new agents.
+ */
+static void
+fill_window(void)
+{
+    struct poll_agent *a;
+    netsnmp_session s;
+
+    while (inflight < total_window) {
+        if ((a = wait_head) != NULL) {
+            wait_head = a->next_wait;
+            if (wait_head == NULL)
+                wait_tail = NULL;
+            a->waiting = 0;
+        } else if (next_agent < nagents) {
+            a = &agents[next_agent++];
+            s = session;
+            s.peername = a->peername;
+            a->slp = snmp_sess_open(&s);
+            if (a->slp == NULL) {
+                snmp_sess_perror(a->peername, &s);
+                agents_failed++;
+                exitval = 1;
+                continue;
+            }
+        } else
+            break;
+
+        while (a->active < agent_window && a->next_root < nroots &&
+               inflight < total_window)
+            walk_start(a);
+        if (a->active == 0)
+            agent_close(a);
+        else if (a->active < agent_window && a->next_root < nroots)
+            wait_push(a, 1);
+    }
+}
+
+static void
+walk_done(struct poll_walk *w)
+{
+    struct poll_agent *a = w->agent;
+
+    free(w);
+    a->active--;
+    if (a->next_root < nroots)
+        wait_push(a, 0);
+    else if (a->active == 0)
+        agent_close(a);
+}
+
+/*
+ * Prints the response to a walk's request and sends the next one.
+ */
+static void
+walk_response(struct poll_walk *w, netsnmp_pdu *response)
+{
+    netsnmp_variable_list *vars;
+    const struct poll_root *root = w->root;
+    int             running = 1, count;
+
+    if (response->errstat != SNMP_ERR_NOERROR) {
+        running = 0;
+        if (response->errstat != SNMP_ERR_NOSUCHNAME) {
+            fflush(stdout);
+            fprintf(stderr, "%s: Error in packet.\nReason: %s\n",
+                    w->agent->peername, snmp_errstring(response->errstat));
+            if (response->errindex != 0) {
+                fprintf(stderr, "Failed object: ");
+                for (count = 1, vars = response->variables;
+                     vars && count != response->errindex;
+                     vars = vars->next_variable, count++)
+                    /*EMPTY*/;
+                if (vars)
+                    fprint_objid(stderr, vars->name, vars->name_length);
+                fprintf(stderr, "\n");
+            }
+            exitval = 2;
+            w->count = -1;
+        }
+    } else if (w->get) {
+        /*
+         * an only existing instance, or nothing at all
+         */
+        for (vars = response->variables; vars; vars = vars->next_variable)
+            if (vars->type != SNMP_ENDOFMIBVIEW &&
+                vars->type != SNMP_NOSUCHOBJECT &&
+                vars->type != SNMP_NOSUCHINSTANCE)
+                print_record(w->agent, vars);
+        running = 0;
+    } else {
+        if (response->variables == NULL)
+            running = 0;
+        for (vars = response->variables; vars; vars = vars->next_variable) {
+            if ((vars->name_length < root->name_length)
+                || (memcmp(root->name, vars->name,
+                           root->name_length * sizeof(oid)) != 0)) {
+                /*
+                 * not part of this subtree
+                 */
+                running = 0;
+                continue;
+            }
+            if ((vars->type == SNMP_ENDOFMIBVIEW) ||
+                (vars->type == SNMP_NOSUCHOBJECT) ||
+                (vars->type == SNMP_NOSUCHINSTANCE)) {
+                /*
+                 * an exception value, so stop
+                 */
+                running = 0;
+                continue;
+            }
+            if (!running)
+                continue;
+            if (!netsnmp_ds_get_boolean(NETSNMP_DS_APPLICATION_ID,
+                                NETSNMP_DS_POLL_DONT_CHECK_LEXICOGRAPHIC)
+                && snmp_oid_compare(w->name, w->name_length,
+                                    vars->name, vars->name_length) >= 0) {
+                fflush(stdout);
+                fprintf(stderr, "%s: Error: OID not increasing: ",
+                        w->agent->peername);
+                fprint_objid(stderr, w->name, w->name_length);
+                fprintf(stderr, " >= ");
+                fprint_objid(stderr, vars->name, vars->name_length);
+                fprintf(stderr, "\n");
+                running = 0;
+                exitval = 1;
+                w->count = -1;
+                continue;
+            }
+            w->count++;
+            print_record(w->agent, vars);
+            /*
+             * save the last one for the next request
+             */
+            memmove(w->name, vars->name, vars->name_length * sizeof(oid));
+            w->name_length = vars->name_length;
+        }
+    }
+
+    if (!running && !w->get && w->count == 0) {
+        /*
+         * nothing found, which may mean we were pointed at an only
+         * existing instance
+         */
+        running = w->get = 1;
+    }
+
+    if (running && !walk_send(w)) {
+        agent_fail(w->agent);
+        running = 0;
+    }
+    if (!running)
+        walk_done(w);
+}
+
+static void
+walk_complete(netsnmp_completion *c)
+{
+    struct poll_walk *w = netsnmp_completion_user_data(c);
+    netsnmp_pdu    *response;
+
+    inflight--;
+    switch (netsnmp_completion_status(c)) {
+    case STAT_SUCCESS:
+        response = netsnmp_completion_response(c);
+        walk_response(w, response);
+        snmp_free_pdu(response);
+        break;
+    case STAT_TIMEOUT:
+        fflush(stdout);
+        fprintf(stderr, "Timeout: No Response from %s\n",
+                w->agent->peername);
+        agent_fail(w->agent);
+        walk_done(w);
+        break;
+    default:
+        fflush(stdout);
+        fprintf(stderr, "%s: %s\n", w->agent->peername,
+                snmp_api_errstring(netsnmp_completion_errno(c)));
+        agent_fail(w->agent);
+        walk_done(w);
+        break;
+    }
+    netsnmp_completion_free(c);
+}
+
+int
+main(int argc, char *argv[])
+{
+    netsnmp_completion *c;
+    oid             root[MAX_OID_LEN];
+    size_t          rootlen, i;
+    int             arg;
+
+    exitval = 1;
+
+    SOCK_STARTUP;
+
+    netsnmp_ds_register_config(ASN_BOOLEAN, "snmpwalk", "printStatistics",
+			       NETSNMP_DS_APPLICATION_ID,
+			       NETSNMP_DS_POLL_PRINT_STATISTICS);
+    netsnmp_ds_register_config(ASN_BOOLEAN, "snmpwalk", "dontCheckOrdering",
+			       NETSNMP_DS_APPLICATION_ID,
+			       NETSNMP_DS_POLL_DONT_CHECK_LEXICOGRAPHIC);
+
+    /*
+     * get the common command line arguments
+     */
+    switch (arg = snmp_parse_args(argc, argv, &session, "C:", optProc)) {
+    case NETSNMP_PARSE_ARGS_ERROR:
+        goto out;
+    case NETSNMP_PARSE_ARGS_SUCCESS_EXIT:
+        exitval = 0;
+        goto out;
+    case NETSNMP_PARSE_ARGS_ERROR_USAGE:
+        usage();
+        goto out;
+    default:
+        break;
+    }
+
+    if (!read_agents(session.peername))
+        goto out;
+    if (nagents == 0) {
+        fprintf(stderr, "No agents specified.\n");
+        goto out;
+    }
+
+    /*
+     * get the subtrees
+     */
+    for (; arg < argc; arg++) {
+        rootlen = MAX_OID_LEN;
+        if (snmp_parse_oid(argv[arg], root, &rootlen) == NULL) {
+            snmp_perror(argv[arg]);
+            goto out;
+        }
+        add_subtree(root, rootlen);
+    }
+    if (nroots == 0)
+        add_subtree(objid_mib, OID_LENGTH(objid_mib));
+
+    /*
+     * hex strings on one line
+     */
+    netsnmp_ds_set_int(NETSNMP_DS_LIBRARY_ID,
+                       NETSNMP_DS_LIB_HEX_OUTPUT_LENGTH, 0);
+
+    cq = netsnmp_completion_queue_create();
+    if (cq == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        goto out;
+    }
+
+    exitval = 0;
+    for (;;) {
+        fill_window();
+        if (inflight == 0)
+            break;
+        c = netsnmp_completion_queue_next(cq, NULL);
+        if (c == NULL) {
+            fprintf(stderr, "snmpbulkpoll: select failed\n");
+            exitval = 1;
+            break;
+        }
+        walk_complete(c);
+    }
+    netsnmp_completion_queue_free(cq);
+    for (i = 0; i < nagents; i++) {
+        agent_close(&agents[i]);
+        free(agents[i].peername);
+    }
+
+    if (netsnmp_ds_get_boolean(NETSNMP_DS_APPLICATION_ID,
+			       NETSNMP_DS_POLL_PRINT_STATISTICS)) {
+        printf("Agents polled: %d\n", (int) nagents);
+        printf("Agents failed: %d\n", agents_failed);
+        printf("Variables found: %d\n", numprinted);
+    }
+
+out:
+    free(outbuf);
+    free(agents);
+    free(roots);
+    SOCK_CLEANUP;
+    return exitval;
+}
@@ -0,0 +1,145 @@
+/*
+ * snmpmibcache.c - build a MIB cache file for fast MIB loading
+ *
+ * Loads the MIBs the way every other application would with the same
+ * options and configuration, then saves them to the file given on the
+ * command line or by the mibCache token, for netsnmp_init_mib() to load
+ * instead of the MIB files.
+ */
+#include <net-snmp/net-snmp-config.h>
+
+#if HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#include <sys/types.h>
+#include <stdio.h>
+#include <net-snmp/utilities.h>
+#include <net-snmp/config_api.h>
+#include <net-snmp/output_api.h>
+#include <net-snmp/mib_api.h>
+
+static void
+usage(void)
+{
+    fprintf(stderr, "USAGE: snmpmibcache [OPTIONS] [FILE]\n\n");
+    fprintf(stderr, "  Version:  %s\n", netsnmp_get_version());
+    fprintf(stderr, "  Web:      http://www.net-snmp.org/\n");
+    fprintf(stderr,
+            "  Email:    net-snmp-coders@lists.sourceforge.net\n\nOPTIONS:\n");
+
+    fprintf(stderr, "  -h\t\t\tdisplay this help message\n");
+    fprintf(stderr, "  -V\t\t\tdisplay package version number\n");
+    fprintf(stderr,
+            "  -m MIB[" ENV_SEPARATOR "...]\t\tload given list of MIBs (ALL loads everything)\n");
+    fprintf(stderr,
+            "  -M DIR[" ENV_SEPARATOR "...]\t\tlook in given list of directories for MIBs\n");
+    fprintf(stderr,
+            "  -D[TOKEN[,...]]\tturn on debugging output for the specified TOKENs\n\t\t\t   (ALL gives extremely verbose debugging output)\n");
+#ifndef NETSNMP_DISABLE_MIB_LOADING
+    fprintf(stderr,
+            "  -P MIBOPTS\t\tToggle various defaults controlling mib parsing:\n");
+    snmp_mib_toggle_options_usage("\t\t\t  ", stderr);
+#endif /* NETSNMP_DISABLE_MIB_LOADING */
+    fprintf(stderr,
+            "  -L LOGOPTS\t\tToggle various defaults controlling logging:\n");
+    snmp_log_options_usage("\t\t\t  ", stderr);
+    fprintf(stderr,
+            "\nFILE defaults to the mibCache token or MIBCACHE variable.\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+    int             arg;
+    char           *cp, *env_file = NULL;
+    const char     *file = NULL;
+    int             exit_code = 1;
+
+    SOCK_STARTUP;
+
+    while ((arg = getopt(argc, argv, "Vhm:M:D:P:L:")) != EOF) {
+        switch (arg) {
+        case 'h':
+            usage();
+            goto out;
+
+        case 'm':
+            setenv("MIBS", optarg, 1);
+            break;
+        case 'M':
+            setenv("MIBDIRS", optarg, 1);
+            break;
+        case 'D':
+            debug_register_tokens(optarg);
+            snmp_set_do_debugging(1);
+            break;
+        case 'V':
+            fprintf(stderr, "NET-SNMP version: %s\n",
+                    netsnmp_get_version());
+            exit_code = 0;
+            goto out;
+#ifndef NETSNMP_DISABLE_MIB_LOADING
+        case 'P':
+            cp = snmp_mib_toggle_options(optarg);
+            if (cp != NULL) {
+                fprintf(stderr, "Unknown parser option to -P: %c.\n", *cp);
+                usage();
+                goto out;
+            }
+            break;
+#endif /* NETSNMP_DISABLE_MIB_LOADING */
+        case 'L':
+            if (snmp_log_options(optarg, argc, argv) < 0)
+                goto out;
+            break;
+        default:
+            fprintf(stderr, "invalid option: -%c\n", arg);
+            usage();
+            goto out;
+        }
+    }
+    if (optind < argc)
+        file = argv[optind++];
+    if (optind < argc) {
+        usage();
+        goto out;
+    }
+
+    /*
+     * Read the MIB files themselves, not an existing cache.
+     */
+    if (file == NULL && (cp = getenv("MIBCACHE")) != NULL && *cp)
+        file = env_file = strdup(cp);
+    setenv("MIBCACHE", "", 1);
+    init_snmp(NETSNMP_APPLICATION_CONFIG_TYPE);
+
+#ifndef NETSNMP_DISABLE_MIB_LOADING
+    if (file == NULL)
+        file = netsnmp_ds_get_string(NETSNMP_DS_LIBRARY_ID,
+                                     NETSNMP_DS_LIB_MIB_CACHE);
+    if (file == NULL) {
+        fprintf(stderr, "No MIB cache file given or configured.\n");
+        usage();
+    } else if (netsnmp_save_mib_cache(file) == 0)
+        exit_code = 0;
+    else
+        fprintf(stderr, "Cannot write the MIB cache %s.\n", file);
+#else
+    fprintf(stderr, "MIB loading is disabled.\n");
+#endif /* NETSNMP_DISABLE_MIB_LOADING */
+
+    snmp_shutdown(NETSNMP_APPLICATION_CONFIG_TYPE);
+    free(env_file);
+
+  out:
+    SOCK_CLEANUP;
+    return exit_code;
+}
@@ -97,6 +97,7 @@ SOFTWARE.
 #include <net-snmp/net-snmp-includes.h>
 #include <net-snmp/agent/net-snmp-agent-includes.h>
 #include <net-snmp/library/fd_event_manager.h>
+#include <net-snmp/library/event_loop.h>
 #include <net-snmp/agent/netsnmp_close_fds.h>
 #include "../snmplib/snmp_syslog.h"
 #include "../agent_global_vars.h"
@@ -108,6 +109,7 @@ SOFTWARE.
 #include "snmptrapd_log.h"
 #include "snmptrapd_auth.h"
 #include "snmptrapd_sql.h"
+#include "snmptrapd_workers.h"
 #include "notification-log-mib/notification_log.h"
 #include "tlstm-mib/snmpTlstmCertToTSNTable/snmpTlstmCertToTSNTable.h"
 #include "mibII/vacm_conf.h"
@@ -133,6 +135,8 @@ SOFTWARE.
 
 #include <net-snmp/net-snmp-features.h>
 
+netsnmp_feature_require(event_loop);
+
 #ifndef NETSNMP_NO_SYSTEMD
 #include <net-snmp/library/sd-daemon.h>
 #endif
@@ -509,11 +513,23 @@ parse_config_addForwarderInfo(const char *token, char *cptr)
 static void
 snmptrapd_main_loop(void)
 {
-    int             count, numfds, block;
-    fd_set          readfds,writefds,exceptfds;
+    netsnmp_event_loop *loop;
+    int             count;
     struct timeval  timeout;
-    NETSNMP_SELECT_TIMEVAL timeout2;
 
+    loop = netsnmp_event_loop_create(NETSNMP_SELECT_NOFLAGS);
+    if (loop == NULL) {
+        snmp_log(LOG_ERR, "could not create the event loop\n");
+        netsnmp_running = 0;
+        return;
+    }
+    DEBUGMSGTL(("snmptrapd", "main loop uses %s\n",
+                netsnmp_event_loop_backend(loop)));
+
+    /*
+     * With worker threads, only let them run while waiting for input.
+     */
+    netsnmp_trapd_lock();
     while (netsnmp_running) {
         if (reconfig) {
                 /*
@@ -531,49 +547,26 @@ snmptrapd_main_loop(void)
             }
             reconfig = 0;
         }
-        numfds = 0;
-        FD_ZERO(&readfds);
-        FD_ZERO(&writefds);
-        FD_ZERO(&exceptfds);
-        block = 0;
         timerclear(&timeout);
         timeout.tv_sec = 5;
-        snmp_select_info(&numfds, &readfds, &timeout, &block);
-#ifndef NETSNMP_FEATURE_REMOVE_FD_EVENT_MANAGER
-        netsnmp_external_event_info(&numfds, &readfds, &writefds, &exceptfds);
-#endif /* NETSNMP_FEATURE_REMOVE_FD_EVENT_MANAGER */
-        timeout2.tv_sec = timeout.tv_sec;
-        timeout2.tv_usec = timeout.tv_usec;
-        count = select(numfds, &readfds, &writefds, &exceptfds,
-                       !block ? &timeout2 : NULL);
-        if (count > 0) {
-#ifndef NETSNMP_FEATURE_REMOVE_FD_EVENT_MANAGER
-            netsnmp_dispatch_external_events(&count, &readfds, &writefds,
-                                             &exceptfds);
-#endif /* NETSNMP_FEATURE_REMOVE_FD_EVENT_MANAGER */
-            /* If there are any more events after external events, then
-             * try SNMP events. */
-            if (count > 0) {
-                snmp_read(&readfds);
-            }
-        } else {
-            switch (count) {
-            case 0:
-                snmp_timeout();
-                break;
-            case -1:
-                if (errno == EINTR)
-                    continue;
-                snmp_log_perror("select");
-                netsnmp_running = 0;
-                break;
-            default:
-                fprintf(stderr, "select returned %d\n", count);
-                netsnmp_running = 0;
-            }
-	}
-	run_alarms();
+        netsnmp_trapd_unlock();
+        count = netsnmp_event_loop_wait(loop, &timeout);
+        netsnmp_trapd_lock();
+        if (count < 0) {
+            if (errno == EINTR)
+                continue;
+            /* already logged */
+            netsnmp_running = 0;
+            break;
+        }
+        /*
+         * Reads the traps, calls the fd event manager callbacks, handles
+         * request timeouts and runs the alarms.
+         */
+        netsnmp_event_loop_dispatch(loop);
     }
+    netsnmp_trapd_unlock();
+    netsnmp_event_loop_free(loop);
 }
 
 /*******************************************************************-o-******
@@ -650,7 +643,8 @@ main(int argc, char *argv[])
      * register our configuration handlers now so -H properly displays them 
      */
     snmptrapd_register_configs( );
-#ifdef NETSNMP_USE_MYSQL
+    snmptrapd_register_workers_configs( );
+#ifdef NETSNMP_TRAPD_SQL
     snmptrapd_register_sql_configs( );
 #endif
 #ifdef NETSNMP_SECMOD_USM
@@ -1170,9 +1164,9 @@ main(int argc, char *argv[])
     }
     SNMP_FREE(listen_ports); /* done with them */
 
-#ifdef NETSNMP_USE_MYSQL
-    if( netsnmp_mysql_init() ) {
-        fprintf(stderr, "MySQL initialization failed\n");
+#ifdef NETSNMP_TRAPD_SQL
+    if( netsnmp_sql_init() ) {
+        fprintf(stderr, "SQL initialization failed\n");
         goto sock_cleanup;
     }
 #endif
@@ -1288,7 +1282,15 @@ main(int argc, char *argv[])
     trapd_status = SNMPTRAPD_RUNNING;
 #endif
 
+    netsnmp_trapd_workers_init();
+#ifdef NETSNMP_TRAPD_SQL
+    netsnmp_sql_writer_start();
+#endif
     snmptrapd_main_loop();
+    netsnmp_trapd_workers_shutdown();
+#ifdef NETSNMP_TRAPD_SQL
+    netsnmp_sql_writer_stop();
+#endif
 
     if (snmp_get_do_logging()) {
         struct tm      *tm;
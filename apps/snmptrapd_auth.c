@@ -187,3 +187,22 @@ netsnmp_trapd_check_auth(int authtypes)
     return ((authtypes & lastlookup) == authtypes);
 }
 
+/**
+ * Returns the authorization result of the notification being handled,
+ * so that a handler which lets another thread run (see
+ * netsnmp_trapd_unlock()) can restore it afterwards.
+ */
+int
+netsnmp_trapd_get_auth(void)
+{
+    return lastlookup;
+}
+
+/**
+ * Restores an authorization result saved by netsnmp_trapd_get_auth().
+ */
+void
+netsnmp_trapd_set_auth(int authtypes)
+{
+    lastlookup = authtypes;
+}
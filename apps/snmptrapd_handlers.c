@@ -39,6 +39,7 @@
 #include "snmptrapd_handlers.h"
 #include "snmptrapd_auth.h"
 #include "snmptrapd_log.h"
+#include "snmptrapd_workers.h"
 #include "notification-log-mib/notification_log.h"
 
 netsnmp_feature_child_of(add_default_traphandler, snmptrapd);
@@ -360,6 +361,27 @@ typedef struct netsnmp_handler_map_t {
    const char             *descr;
 } netsnmp_handler_map;
 
+/*
+ * The trap-specific handlers are also indexed by a trie with one level
+ * per sub-identifier, so that looking up the handlers for a trap takes
+ * one step per sub-identifier of its OID rather than a comparison with
+ * every registered OID.  Each node points to the first handler of the
+ * list registered for its OID, if any.
+ */
+typedef struct netsnmp_traphandler_trie_s netsnmp_traphandler_trie;
+struct netsnmp_traphandler_trie_s {
+     oid                        subid;
+     netsnmp_trapd_handler     *traph;
+     netsnmp_traphandler_trie **children;   /* sorted by subid */
+     int                        nchildren;
+     int                        maxchildren;
+};
+
+static netsnmp_traphandler_trie *traphandler_trie = NULL;
+
+/* bumped whenever the handler lists are freed, see netsnmp_trapd_handle_pdu */
+static u_int traphandle_generation;
+
 static netsnmp_handler_map handlers[] = {
     { &netsnmp_auth_global_traphandlers, "auth trap" },
     { &netsnmp_pre_global_traphandlers, "pre-global trap" },
@@ -427,6 +449,62 @@ netsnmp_add_default_traphandler(Netsnmp_Trap_Handler *handler) {
 #endif /* NETSNMP_FEATURE_REMOVE_ADD_DEFAULT_TRAPHANDLER */
 
 
+/*
+ * Find the child of a trie node for the next sub-identifier,
+ *   optionally creating it.
+ */
+static netsnmp_traphandler_trie *
+_traphandler_trie_child(netsnmp_traphandler_trie *node, oid subid,
+                        int create)
+{
+    netsnmp_traphandler_trie *child, **children;
+    int lo = 0, hi = node->nchildren, mid;
+
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (node->children[mid]->subid == subid)
+            return node->children[mid];
+        if (node->children[mid]->subid < subid)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (!create)
+        return NULL;
+
+    if (node->nchildren == node->maxchildren) {
+        children = realloc(node->children, (node->maxchildren ?
+                                            node->maxchildren * 2 : 4) *
+                           sizeof(*children));
+        if (!children)
+            return NULL;
+        node->children = children;
+        node->maxchildren = node->maxchildren ? node->maxchildren * 2 : 4;
+    }
+    child = SNMP_MALLOC_TYPEDEF(netsnmp_traphandler_trie);
+    if (!child)
+        return NULL;
+    child->subid = subid;
+    memmove(&node->children[lo + 1], &node->children[lo],
+            (node->nchildren - lo) * sizeof(*node->children));
+    node->children[lo] = child;
+    node->nchildren++;
+    return child;
+}
+
+static void
+_traphandler_trie_free(netsnmp_traphandler_trie *node)
+{
+    int i;
+
+    if (!node)
+        return;
+    for (i = 0; i < node->nchildren; i++)
+        _traphandler_trie_free(node->children[i]);
+    SNMP_FREE(node->children);
+    SNMP_FREE(node);
+}
+
 /*
  * Register a new trap-specific traphandler
  */
@@ -434,10 +512,23 @@ netsnmp_trapd_handler *
 netsnmp_add_traphandler(Netsnmp_Trap_Handler* handler,
                         oid *trapOid, int trapOidLen ) {
     netsnmp_trapd_handler *traph, *traph2;
+    netsnmp_traphandler_trie *node;
+    int i;
 
     if ( !handler )
         return NULL;
 
+    /*
+     * Find (or make) the trie node for this trap OID first,
+     *   so that there is nothing to undo if that fails.
+     */
+    if (!traphandler_trie)
+        traphandler_trie = SNMP_MALLOC_TYPEDEF(netsnmp_traphandler_trie);
+    for (node = traphandler_trie, i = 0; node && i < trapOidLen; i++)
+        node = _traphandler_trie_child(node, trapOid[i], 1);
+    if ( !node )
+        return NULL;
+
     traph = SNMP_MALLOC_TYPEDEF(netsnmp_trapd_handler);
     if ( !traph )
         return NULL;
@@ -511,6 +602,8 @@ netsnmp_add_traphandler(Netsnmp_Trap_Handler* handler,
         }
     }
 
+    if (!node->traph)
+        node->traph = traph;
     return traph;
 }
 
@@ -554,6 +647,9 @@ snmptrapd_free_traphandle(void)
 	traph = nextt;
     }
     netsnmp_specific_traphandlers = NULL;
+    _traphandler_trie_free(traphandler_trie);
+    traphandler_trie = NULL;
+    traphandle_generation++;
 }
 
 /*
@@ -562,7 +658,9 @@ snmptrapd_free_traphandle(void)
  */
 netsnmp_trapd_handler *
 netsnmp_get_traphandler( oid *trapOid, int trapOidLen ) {
-    netsnmp_trapd_handler *traph;
+    netsnmp_trapd_handler *traph, *subtree = NULL;
+    netsnmp_traphandler_trie *node;
+    int i;
     
     if (!trapOid || !trapOidLen) {
         DEBUGMSGTL(( "snmptrapd:lookup", "get_traphandler no OID!\n"));
@@ -573,46 +671,44 @@ netsnmp_get_traphandler( oid *trapOid, int trapOidLen ) {
     DEBUGMSG(( "snmptrapd:lookup", "\n"));
 
     /*
-     * Look for a matching OID, and return that list...
+     * Follow the trap OID down the trie.  The handlers registered for
+     *   the longest matching OID win, as they come first in the (sorted)
+     *   list of trap-specific handlers: those for the trapOID itself,
+     *   unless they are for its strict subtree, or else those for the
+     *   nearest wildcarded prefix of it.
      */
-    for (traph = netsnmp_specific_traphandlers;
-         traph; traph=traph->nextt ) {
-
-        /*
-         * If the trap handler wasn't wildcarded, then the trapOID
-         *   should match the registered OID exactly.
-         */
-        if (!(traph->flags & NETSNMP_TRAPHANDLER_FLAG_MATCH_TREE)) {
-            if (snmp_oid_compare(traph->trapoid, traph->trapoid_len,
-                                 trapOid, trapOidLen) == 0) {
+    for (node = traphandler_trie, i = 0; node; i++) {
+        traph = node->traph;
+        if (traph && i == trapOidLen) {
+            /*
+             * If the trap handler wasn't wildcarded, then the trapOID
+             *   should match the registered OID exactly.
+             */
+            if (!(traph->flags & NETSNMP_TRAPHANDLER_FLAG_MATCH_TREE)) {
                 DEBUGMSGTL(( "snmptrapd:lookup",
                              "get_traphandler exact match (%p)\n", traph));
 	        return traph;
             }
-	} else {
-           /*
-            * If the trap handler *was* wildcarded, then the trapOID
-            *   should have the registered OID as a prefix...
-            */
-            if (snmp_oidsubtree_compare(traph->trapoid,
-                                        traph->trapoid_len,
-                                        trapOid, trapOidLen) == 0) {
-                if (traph->flags & NETSNMP_TRAPHANDLER_FLAG_STRICT_SUBTREE) {
-                    /*
-                     * ... and (optionally) *strictly* as a prefix
-                     *   i.e. not including an exact match.
-                     */
-                    if (snmp_oid_compare(traph->trapoid, traph->trapoid_len,
-                                         trapOid, trapOidLen) != 0) {
-                        DEBUGMSGTL(( "snmptrapd:lookup", "get_traphandler strict subtree match (%p)\n", traph));
-	                return traph;
-                    }
-                } else {
-                    DEBUGMSGTL(( "snmptrapd:lookup", "get_traphandler subtree match (%p)\n", traph));
-	            return traph;
-                }
+            /*
+             * If it *was* wildcarded, then (optionally) *strictly*
+             *   as a prefix, i.e. not including an exact match.
+             */
+            if (!(traph->flags & NETSNMP_TRAPHANDLER_FLAG_STRICT_SUBTREE)) {
+                DEBUGMSGTL(( "snmptrapd:lookup", "get_traphandler subtree match (%p)\n", traph));
+	        return traph;
             }
-	}
+        } else if (traph && (traph->flags & NETSNMP_TRAPHANDLER_FLAG_MATCH_TREE))
+            subtree = traph;
+        if (i == trapOidLen)
+            break;
+        node = _traphandler_trie_child(node, trapOid[i], 0);
+    }
+    if (subtree) {
+        if (subtree->flags & NETSNMP_TRAPHANDLER_FLAG_STRICT_SUBTREE)
+            DEBUGMSGTL(( "snmptrapd:lookup", "get_traphandler strict subtree match (%p)\n", subtree));
+        else
+            DEBUGMSGTL(( "snmptrapd:lookup", "get_traphandler subtree match (%p)\n", subtree));
+        return subtree;
     }
 
     /*
@@ -808,7 +904,8 @@ int   command_handler( netsnmp_pdu           *pdu,
 #else
     u_char         *rbuf = NULL;
     size_t          r_len = 64, o_len = 0;
-    int             oldquick;
+    int             oldquick, lastauth;
+    char           *command;
 
     DEBUGMSGTL(( "snmptrapd", "command_handler\n"));
     DEBUGMSGTL(( "snmptrapd", "token = '%s'\n", handler->token));
@@ -856,14 +953,25 @@ int   command_handler( netsnmp_pdu           *pdu,
             }
 	}
 
-        /*
-         *  and pass this formatted string to the command specified
-         */
-        run_shell_command(handler->token, (char*)rbuf, NULL, NULL);   /* Not interested in output */
         netsnmp_ds_set_boolean(NETSNMP_DS_LIBRARY_ID, 
                                NETSNMP_DS_LIB_QUICK_PRINT, oldquick);
         if (pdu->command == SNMP_MSG_TRAP)
             snmp_free_pdu(v2_pdu);
+
+        /*
+         *  and pass this formatted string to the command specified.
+         *  With worker threads, let the others run meanwhile; the
+         *  handler may be freed by then, so keep a copy of the command.
+         */
+        command = strdup(handler->token);
+        if (command) {
+            lastauth = netsnmp_trapd_get_auth();
+            netsnmp_trapd_unlock();
+            run_shell_command(command, (char*)rbuf, NULL, NULL);   /* Not interested in output */
+            netsnmp_trapd_lock();
+            netsnmp_trapd_set_auth(lastauth);
+            free(command);
+        }
         free(rbuf);
     }
     return NETSNMPTRAPD_HANDLER_OK;
@@ -1077,9 +1185,14 @@ int   notification_handler(netsnmp_pdu           *pdu,
 
 
 
-int
-snmp_input(int op, netsnmp_session *session,
-           int reqid, netsnmp_pdu *pdu, void *magic)
+/*
+ * Runs the handlers for a notification and answers it if it is an INFORM.
+ * Called from snmp_input(), or from a worker thread holding the big lock
+ * (see snmptrapd_workers.c).
+ */
+void
+netsnmp_trapd_handle_pdu(netsnmp_session *session, netsnmp_pdu *pdu,
+                         netsnmp_transport *transport)
 {
     oid stdTrapOidRoot[] = { 1, 3, 6, 1, 6, 3, 1, 1, 5 };
     oid snmpTrapOid[]    = { 1, 3, 6, 1, 6, 3, 1, 1, 4, 1, 0 };
@@ -1087,141 +1200,160 @@ snmp_input(int op, netsnmp_session *session,
     int trapOidLen;
     netsnmp_variable_list *vars;
     netsnmp_trapd_handler *traph;
-    netsnmp_transport *transport = (netsnmp_transport *) magic;
     int ret, idx;
+    u_int generation;
 
-    switch (op) {
-    case NETSNMP_CALLBACK_OP_RECEIVED_MESSAGE:
+    /*
+     * Determine the OID that identifies the trap being handled
+     */
+    DEBUGMSGTL(("snmptrapd", "input: %x\n", pdu->command));
+    switch (pdu->command) {
+    case SNMP_MSG_TRAP:
         /*
-         * Drops packets with reception problems
-         */
-        if (session->s_snmp_errno) {
-            /* drop problem packets */
-            return 1;
+	 * Convert v1 traps into a v2-style trap OID
+	 *    (following RFC 2576)
+	 */
+        if (pdu->trap_type == SNMP_TRAP_ENTERPRISESPECIFIC) {
+            trapOidLen = pdu->enterprise_length;
+            memcpy(trapOid, pdu->enterprise, sizeof(oid) * trapOidLen);
+            if (trapOid[trapOidLen - 1] != 0) {
+                trapOid[trapOidLen++] = 0;
+            }
+            trapOid[trapOidLen++] = pdu->specific_type;
+        } else {
+            memcpy(trapOid, stdTrapOidRoot, sizeof(stdTrapOidRoot));
+            trapOidLen = OID_LENGTH(stdTrapOidRoot);  /* 9 */
+            trapOid[trapOidLen++] = pdu->trap_type+1;
         }
+        break;
 
+    case SNMP_MSG_TRAP2:
+    case SNMP_MSG_INFORM:
         /*
-	 * Determine the OID that identifies the trap being handled
+	 * v2c/v3 notifications *should* have snmpTrapOID as the
+	 *    second varbind, so we can go straight there.
+	 *    But check, just to make sure
 	 */
-        DEBUGMSGTL(("snmptrapd", "input: %x\n", pdu->command));
-        switch (pdu->command) {
-        case SNMP_MSG_TRAP:
-            /*
-	     * Convert v1 traps into a v2-style trap OID
-	     *    (following RFC 2576)
+        vars = pdu->variables;
+        if (vars)
+            vars = vars->next_variable;
+        if (!vars || snmp_oid_compare(vars->name, vars->name_length,
+                                      snmpTrapOid, OID_LENGTH(snmpTrapOid))) {
+	    /*
+	     * Didn't find it!
+	     * Let's look through the full list....
 	     */
-            if (pdu->trap_type == SNMP_TRAP_ENTERPRISESPECIFIC) {
-                trapOidLen = pdu->enterprise_length;
-                memcpy(trapOid, pdu->enterprise, sizeof(oid) * trapOidLen);
-                if (trapOid[trapOidLen - 1] != 0) {
-                    trapOid[trapOidLen++] = 0;
-                }
-                trapOid[trapOidLen++] = pdu->specific_type;
-            } else {
-                memcpy(trapOid, stdTrapOidRoot, sizeof(stdTrapOidRoot));
-                trapOidLen = OID_LENGTH(stdTrapOidRoot);  /* 9 */
-                trapOid[trapOidLen++] = pdu->trap_type+1;
+	    for ( vars = pdu->variables; vars; vars=vars->next_variable) {
+                if (!snmp_oid_compare(vars->name, vars->name_length,
+                                      snmpTrapOid, OID_LENGTH(snmpTrapOid)))
+                    break;
             }
-            break;
-
-        case SNMP_MSG_TRAP2:
-        case SNMP_MSG_INFORM:
-            /*
-	     * v2c/v3 notifications *should* have snmpTrapOID as the
-	     *    second varbind, so we can go straight there.
-	     *    But check, just to make sure
-	     */
-            vars = pdu->variables;
-            if (vars)
-                vars = vars->next_variable;
-            if (!vars || snmp_oid_compare(vars->name, vars->name_length,
-                                          snmpTrapOid, OID_LENGTH(snmpTrapOid))) {
-	        /*
-		 * Didn't find it!
-		 * Let's look through the full list....
+            if (!vars) {
+		/*
+		 * Still can't find it!  Give up.
 		 */
-		for ( vars = pdu->variables; vars; vars=vars->next_variable) {
-                    if (!snmp_oid_compare(vars->name, vars->name_length,
-                                          snmpTrapOid, OID_LENGTH(snmpTrapOid)))
-                        break;
-                }
-                if (!vars) {
-	            /*
-		     * Still can't find it!  Give up.
-		     */
-		    snmp_log(LOG_ERR, "Cannot find TrapOID in TRAP2 PDU\n");
-		    return 1;		/* ??? */
-		}
+		snmp_log(LOG_ERR, "Cannot find TrapOID in TRAP2 PDU\n");
+		return;		/* ??? */
 	    }
-            memcpy(trapOid, vars->val.objid, vars->val_len);
-            trapOidLen = vars->val_len /sizeof(oid);
-            break;
-
-        default:
-            /* SHOULDN'T HAPPEN! */
-            return 1;	/* ??? */
 	}
-        DEBUGMSGTL(( "snmptrapd", "Trap OID: "));
-        DEBUGMSGOID(("snmptrapd", trapOid, trapOidLen));
-        DEBUGMSG(( "snmptrapd", "\n"));
-
-
-        /*
-	 *  OK - We've found the Trap OID used to identify this trap.
-         *  Call each of the various lists of handlers:
-         *     a) authentication-related handlers,
-         *     b) other handlers to be applied to all traps
-         *		(*before* trap-specific handlers)
-         *     c) the handler(s) specific to this trap
-t        *     d) any other global handlers
-         *
-	 *  In each case, a particular trap handler can abort further
-         *     processing - either just for that particular list,
-         *     or for the trap completely.
-         *
-	 *  This is particularly designed for authentication-related
-	 *     handlers, but can also be used elsewhere.
-         *
-         *  OK - Enough waffling, let's get to work.....
-	 */
-
-        for( idx = 0; handlers[idx].descr; ++idx ) {
-            DEBUGMSGTL(("snmptrapd", "Running %s handlers\n",
-                        handlers[idx].descr));
-            if (NULL == handlers[idx].handler) /* specific */
-                traph = netsnmp_get_traphandler(trapOid, trapOidLen);
-            else
-                traph = *handlers[idx].handler;
+        memcpy(trapOid, vars->val.objid, vars->val_len);
+        trapOidLen = vars->val_len /sizeof(oid);
+        break;
 
-            for( ; traph; traph = traph->nexth) {
-                if (!netsnmp_trapd_check_auth(traph->authtypes))
-                    continue; /* we continue on and skip this one */
+    default:
+        /* SHOULDN'T HAPPEN! */
+        return;	/* ??? */
+    }
+    DEBUGMSGTL(( "snmptrapd", "Trap OID: "));
+    DEBUGMSGOID(("snmptrapd", trapOid, trapOidLen));
+    DEBUGMSG(( "snmptrapd", "\n"));
 
-                ret = (*(traph->handler))(pdu, transport, traph);
-                if(NETSNMPTRAPD_HANDLER_FINISH == ret)
-                    return 1;
-                if (ret == NETSNMPTRAPD_HANDLER_BREAK)
-                    break; /* move on to next type */
-            } /* traph */
-        } /* handlers */
 
+    /*
+     *  OK - We've found the Trap OID used to identify this trap.
+     *  Call each of the various lists of handlers:
+     *     a) authentication-related handlers,
+     *     b) other handlers to be applied to all traps
+     *		(*before* trap-specific handlers)
+     *     c) the handler(s) specific to this trap
+t        *     d) any other global handlers
+     *
+     *  In each case, a particular trap handler can abort further
+     *     processing - either just for that particular list,
+     *     or for the trap completely.
+     *
+     *  This is particularly designed for authentication-related
+     *     handlers, but can also be used elsewhere.
+     *
+     *  OK - Enough waffling, let's get to work.....
+     */
 
-	if (pdu->command == SNMP_MSG_INFORM) {
-	    netsnmp_pdu *reply = snmp_clone_pdu(pdu);
-	    if (!reply) {
-		snmp_log(LOG_ERR, "couldn't clone PDU for INFORM response\n");
-	    } else {
-		reply->command = SNMP_MSG_RESPONSE;
-		reply->errstat = 0;
-		reply->errindex = 0;
-		if (!snmp_send(session, reply)) {
-		    snmp_sess_perror("snmptrapd: Couldn't respond to inform pdu",
-                                    session);
-		    snmp_free_pdu(reply);
-		}
+    for( idx = 0; handlers[idx].descr; ++idx ) {
+        DEBUGMSGTL(("snmptrapd", "Running %s handlers\n",
+                    handlers[idx].descr));
+        if (NULL == handlers[idx].handler) /* specific */
+            traph = netsnmp_get_traphandler(trapOid, trapOidLen);
+        else
+            traph = *handlers[idx].handler;
+
+        for( ; traph; traph = traph->nexth) {
+            if (!netsnmp_trapd_check_auth(traph->authtypes))
+                continue; /* we continue on and skip this one */
+
+            generation = traphandle_generation;
+            ret = (*(traph->handler))(pdu, transport, traph);
+            if(NETSNMPTRAPD_HANDLER_FINISH == ret)
+                return;
+            if (generation != traphandle_generation) {
+                /*
+                 * The handler let another thread run, and that one
+                 * re-read the configuration: traph is gone.
+                 */
+                DEBUGMSGTL(("snmptrapd",
+                            "handlers changed, skipping the rest\n"));
+                goto reply;
+            }
+            if (ret == NETSNMPTRAPD_HANDLER_BREAK)
+                break; /* move on to next type */
+        } /* traph */
+    } /* handlers */
+
+  reply:
+    if (pdu->command == SNMP_MSG_INFORM) {
+	netsnmp_pdu *reply = snmp_clone_pdu(pdu);
+	if (!reply) {
+	    snmp_log(LOG_ERR, "couldn't clone PDU for INFORM response\n");
+	} else {
+	    reply->command = SNMP_MSG_RESPONSE;
+	    reply->errstat = 0;
+	    reply->errindex = 0;
+	    if (!snmp_send(session, reply)) {
+		snmp_sess_perror("snmptrapd: Couldn't respond to inform pdu",
+                                session);
+		snmp_free_pdu(reply);
 	    }
 	}
+    }
+}
+
+int
+snmp_input(int op, netsnmp_session *session,
+           int reqid, netsnmp_pdu *pdu, void *magic)
+{
+    netsnmp_transport *transport = (netsnmp_transport *) magic;
+
+    switch (op) {
+    case NETSNMP_CALLBACK_OP_RECEIVED_MESSAGE:
+        /*
+         * Drops packets with reception problems
+         */
+        if (session->s_snmp_errno) {
+            /* drop problem packets */
+            return 1;
+        }
 
+        if (!netsnmp_trapd_workers_dispatch(session, pdu, transport))
+            netsnmp_trapd_handle_pdu(session, pdu, transport);
         break;
 
     case NETSNMP_CALLBACK_OP_TIMED_OUT:
@@ -64,6 +64,8 @@ netsnmp_trapd_handler *netsnmp_get_traphandler(oid *trapOid, int trapOidLen);
 const char *trap_description(int trap);
 int snmp_input(int op, netsnmp_session *session,
            int reqid, netsnmp_pdu *pdu, void *magic);
+void netsnmp_trapd_handle_pdu(netsnmp_session *session, netsnmp_pdu *pdu,
+                              netsnmp_transport *transport);
 
 void parse_format(const char *token, char *line);
 
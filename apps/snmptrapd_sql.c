@@ -7,17 +7,29 @@
  * distributed with the Net-SNMP package.
  *
  * This file implements a handler for snmptrapd which will cache incoming
- * traps and then write them to a MySQL database.
+ * traps and then write them to a MySQL or SQLite database.
  *
+ * The handler only copies the trap to a queue.  Where threads are
+ * available, a writer thread empties the queue every sqlSaveInterval
+ * seconds, or as soon as sqlMaxQueue traps are waiting, inserting up to
+ * sqlBatchSize traps (and their varbinds) per INSERT statement and
+ * committing once per batch.  The database round trips run without the
+ * snmptrapd lock (see snmptrapd_workers.c), so they no longer hold up
+ * trap reception.  If the database cannot keep up and sqlQueueLimit
+ * traps are waiting, further traps are logged as text instead.  Without
+ * threads the queue is written from an alarm on the main thread.
  */
 #include <net-snmp/net-snmp-config.h>
 #include <net-snmp/net-snmp-features.h>
 
-#ifdef NETSNMP_USE_MYSQL
+#include "snmptrapd_sql.h"
+
+#ifdef NETSNMP_TRAPD_SQL
 
 /*
  * SQL includes
  */
+#ifdef NETSNMP_USE_MYSQL
 #undef PACKAGE_BUGREPORT
 #undef PACKAGE_NAME
 #undef PACKAGE_STRING
@@ -31,6 +43,10 @@
 #endif
 #include <mysql.h>
 #include <errmsg.h>
+#endif /* NETSNMP_USE_MYSQL */
+#ifdef NETSNMP_USE_SQLITE
+#include <sqlite3.h>
+#endif
 
 #if HAVE_STDLIB_H
 #include <stdlib.h>
@@ -45,6 +61,7 @@
 #include <strings.h>
 #endif
 #include <ctype.h>
+#include <time.h>
 #include <sys/types.h>
 #if HAVE_NETINET_IN_H
 #include <netinet/in.h>
@@ -52,68 +69,30 @@
 #if HAVE_NETDB_H
 #include <netdb.h>
 #endif
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#define NETSNMP_SQL_WRITER 1
+#endif
 
 #include <net-snmp/net-snmp-includes.h>
 #include <net-snmp/agent/net-snmp-agent-includes.h>
 #include "snmptrapd_handlers.h"
 #include "snmptrapd_auth.h"
 #include "snmptrapd_log.h"
-#include "snmptrapd_sql.h"
+#include "snmptrapd_workers.h"
 
 netsnmp_feature_require(container_fifo);
 
-/*
- * define a structure to hold all the file globals
- */
-typedef struct netsnmp_sql_globals_t {
-    char        *host_name;       /* server host (def=localhost) */
-    char        *user_name;       /* username (def=login name) */
-    char        *password;        /* password (def=none) */
-    u_int        port_num;        /* port number (built-in value) */
-    char        *socket_name;     /* socket name (built-in value) */
-    const char  *db_name;         /* database name (def=none) */
-    u_int        flags;           /* connection flags (none) */
-    MYSQL       *conn;            /* connection */
-    u_char       connected;       /* connected flag */
-    const char  *groups[3];
-    MYSQL_STMT  *trap_stmt, *vb_stmt; /* prepared statements */
-    u_int        alarm_id;        /* id of periodic save alarm */
-    netsnmp_container *queue;     /* container; traps pending database write */
-    u_int        queue_max;       /* auto save queue when it gets this big */
-    int          queue_interval;  /* auto save every N seconds */
-} netsnmp_sql_globals;
-
-static netsnmp_sql_globals _sql = {
-    NULL,                  /* host */
-    NULL,                  /* username */
-    NULL,                  /* password */
-    0,                     /* port */
-    NULL,                  /* socket */
-    "net_snmp",            /* database */
-    0,                     /* conn flags */
-    NULL,                  /* connection */
-    0,                     /* connected */
-    { "client", "snmptrapd", NULL },  /* groups to read from .my.cnf */
-    NULL,                  /* trap_stmt */
-    NULL,                  /* vb_stmt */
-    0,                     /* alarm_id */
-    NULL,                  /* queue */
-    1,                     /* queue_max */
-    -1                     /* queue_interval */
-};
-
 /*
  * log traps as text, or binary blobs?
  */
 #define NETSNMP_MYSQL_TRAP_VALUE_TEXT 1
 
 /*
- * We will be using prepared statements for performance reasons. This
- * requires a sql bind structure for each cell to be inserted in the
- * database. We will be using 2 global static structures to bind to,
- * and a netsnmp container to store the necessary data until it is
- * written to the database. Fixed size buffers are also used to
- * simplify memory management.
+ * Queued traps are inserted in batches, with one multi-row INSERT per
+ * table.  Each row has a parameter for every column, and the values are
+ * bound to the fields of the buffers below, which hold the data until it
+ * is written to the database.
  */
 /** enums for the trap fields to be bound */
 enum{
@@ -144,6 +123,12 @@ enum {
     VBIND_MAX
 };
 
+static const char _trap_insert[] = "INSERT INTO notifications "
+    "(date_time, host, auth, type, version, request_id, snmpTrapOID, transport, security_model, v3msgid, v3security_level, v3context_name, v3context_engine, v3security_name, v3security_engine) "
+    "VALUES ";
+static const char _vb_insert[] = "INSERT INTO varbinds "
+    "(trap_id, oid, type, value) VALUES ";
+
 /** buffer struct for varbind data */
 typedef struct sql_vb_buf_t {
 
@@ -168,7 +153,7 @@ typedef struct sql_buf_t {
     char      *user;
     u_long     user_len;
 
-    MYSQL_TIME time;
+    time_t     date;
     uint16_t   version, type;
     uint32_t   reqid;
 
@@ -192,16 +177,71 @@ typedef struct sql_buf_t {
 
     netsnmp_container *varbinds;
 
+    u_long     trap_id;           /* set once inserted */
     char       logged;
+
+    struct sql_buf_t *next;       /* next in the queue */
 } sql_buf;
 
 /*
- * static bind structures, plus 2 static buffers to bind to.
+ * A database the queued traps can be written to.
  */
-static MYSQL_BIND _tbind[TBIND_MAX], _vbind[VBIND_MAX];
-static char       _no_v3;
+typedef struct sql_backend_t {
+    const char *name;
+    int       (*init)(void);
+    int       (*connect)(void);
+    /** inserts and commits a batch; returns 0 on success */
+    int       (*save)(sql_buf **batch, int count);
+    void      (*cleanup)(void);
+} sql_backend;
+
+/*
+ * define a structure to hold all the file globals
+ */
+typedef struct netsnmp_sql_globals_t {
+    u_char       connected;       /* connected flag */
+    const sql_backend *backend;   /* database in use */
+    u_int        alarm_id;        /* id of periodic save alarm */
+    sql_buf     *queue_head;      /* traps pending database write */
+    sql_buf     *queue_tail;
+    u_int        queue_len;
+    u_int        queue_max;       /* auto save queue when it gets this big */
+    int          queue_interval;  /* auto save every N seconds */
+    u_int        queue_limit;     /* log traps as text beyond this */
+    u_int        batch_size;      /* traps per INSERT */
+    u_long       overflows;       /* traps logged as text, queue full */
+    u_char       overflowing;     /* currently logging traps as text */
+} netsnmp_sql_globals;
+
+static netsnmp_sql_globals _sql = {
+    0,                     /* connected */
+    NULL,                  /* backend */
+    0,                     /* alarm_id */
+    NULL,                  /* queue_head */
+    NULL,                  /* queue_tail */
+    0,                     /* queue_len */
+    1,                     /* queue_max */
+    -1,                    /* queue_interval */
+    10000,                 /* queue_limit */
+    100,                   /* batch_size */
+    0,                     /* overflows */
+    0                      /* overflowing */
+};
+
+#ifdef NETSNMP_SQL_WRITER
+static pthread_mutex_t _sql_queue_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  _sql_queue_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t       _sql_writer;
+static int             _sql_writer_running, _sql_writer_stopping;
+#define SQL_QUEUE_LOCK()    pthread_mutex_lock(&_sql_queue_lock)
+#define SQL_QUEUE_UNLOCK()  pthread_mutex_unlock(&_sql_queue_lock)
+#else
+#define SQL_QUEUE_LOCK()
+#define SQL_QUEUE_UNLOCK()
+#endif
 
 static void _sql_process_queue(u_int dontcare, void *meeither);
+static void _sql_log(sql_buf *sqlb, void* dontcare);
 
 /*
  * parse the sqlMaxQueue configuration token
@@ -224,6 +264,43 @@ _parse_interval_fmt(const char *token, char *cptr)
                 _sql.queue_interval));
 }
 
+/*
+ * parse the sqlQueueLimit configuration token
+ */
+static void
+_parse_limit_fmt(const char *token, char *cptr)
+{
+    int limit = atoi(cptr);
+
+    if (limit <= 0) {
+        netsnmp_config_error("%s must be positive", token);
+        return;
+    }
+    _sql.queue_limit = limit;
+    DEBUGMSGTL(("sql:queue","queue limit now %d\n", _sql.queue_limit));
+}
+
+/*
+ * parse the sqlBatchSize configuration token
+ */
+static void
+_parse_batch_fmt(const char *token, char *cptr)
+{
+    int size = atoi(cptr);
+
+    if (size <= 0) {
+        netsnmp_config_error("%s must be positive", token);
+        return;
+    }
+    _sql.batch_size = size;
+    DEBUGMSGTL(("sql:queue","batch size now %d\n", _sql.batch_size));
+}
+
+#ifdef NETSNMP_USE_SQLITE
+static void _parse_sqlite_file(const char *token, char *cptr);
+static void _free_sqlite_file(void);
+#endif
+
 /*
  * register sql related configuration tokens
  */
@@ -234,8 +311,101 @@ snmptrapd_register_sql_configs( void )
                             _parse_queue_fmt, NULL, "integer");
     register_config_handler("snmptrapd", "sqlSaveInterval",
                             _parse_interval_fmt, NULL, "seconds");
+    register_config_handler("snmptrapd", "sqlQueueLimit",
+                            _parse_limit_fmt, NULL, "integer");
+    register_config_handler("snmptrapd", "sqlBatchSize",
+                            _parse_batch_fmt, NULL, "integer");
+#ifdef NETSNMP_USE_SQLITE
+    register_config_handler("snmptrapd", "sqliteDatabase",
+                            _parse_sqlite_file, _free_sqlite_file, "file");
+#endif
+}
+
+/*
+ * builds the text of an INSERT of rows rows of ncols parameters each
+ */
+static char *
+_sql_insert_text(const char *insert, int ncols, int rows)
+{
+    size_t  len = strlen(insert), row_len = 2 * ncols + 2;
+    char   *text, *cp;
+    int     row, col;
+
+    text = (char *) malloc(len + rows * row_len + 1);
+    if (NULL == text)
+        return NULL;
+    memcpy(text, insert, len);
+    cp = text + len;
+    for (row = 0; row < rows; row++) {
+        if (row)
+            *cp++ = ',';
+        *cp++ = '(';
+        for (col = 0; col < ncols; col++) {
+            if (col)
+                *cp++ = ',';
+            *cp++ = '?';
+        }
+        *cp++ = ')';
+    }
+    *cp = '\0';
+    return text;
 }
 
+/*
+ * counts the varbinds of a batch of traps
+ */
+static int
+_sql_batch_varbinds(sql_buf **batch, int count)
+{
+    int i, n = 0;
+
+    for (i = 0; i < count; i++)
+        n += CONTAINER_SIZE(batch[i]->varbinds);
+    return n;
+}
+
+#ifdef NETSNMP_USE_MYSQL
+/*------------------------------------------------------------------
+ *
+ * MySQL
+ *
+ */
+
+/*
+ * MySQL connection details and state
+ */
+typedef struct netsnmp_mysql_globals_t {
+    char        *host_name;       /* server host (def=localhost) */
+    char        *user_name;       /* username (def=login name) */
+    char        *password;        /* password (def=none) */
+    u_int        port_num;        /* port number (built-in value) */
+    char        *socket_name;     /* socket name (built-in value) */
+    const char  *db_name;         /* database name (def=none) */
+    u_int        flags;           /* connection flags (none) */
+    MYSQL       *conn;            /* connection */
+    const char  *groups[3];
+    MYSQL_STMT  *trap_stmt, *vb_stmt; /* prepared statements */
+    int          trap_rows, vb_rows;  /* rows they insert */
+    u_long       id_increment;    /* auto_increment_increment */
+} netsnmp_mysql_globals;
+
+static netsnmp_mysql_globals _mysql = {
+    NULL,                  /* host */
+    NULL,                  /* username */
+    NULL,                  /* password */
+    0,                     /* port */
+    NULL,                  /* socket */
+    "net_snmp",            /* database */
+    0,                     /* conn flags */
+    NULL,                  /* connection */
+    { "client", "snmptrapd", NULL },  /* groups to read from .my.cnf */
+    NULL,                  /* trap_stmt */
+    NULL,                  /* vb_stmt */
+    0,                     /* trap_rows */
+    0,                     /* vb_rows */
+    1                      /* id_increment */
+};
+
 static void
 netsnmp_sql_disconnected(void)
 {
@@ -244,13 +414,13 @@ netsnmp_sql_disconnected(void)
     _sql.connected = 0;
 
     /** release prepared statements */
-    if (_sql.trap_stmt) {
-        mysql_stmt_close(_sql.trap_stmt);
-        _sql.trap_stmt = NULL;
+    if (_mysql.trap_stmt) {
+        mysql_stmt_close(_mysql.trap_stmt);
+        _mysql.trap_stmt = NULL;
     }
-    if (_sql.vb_stmt) {
-        mysql_stmt_close(_sql.vb_stmt);
-        _sql.vb_stmt = NULL;
+    if (_mysql.vb_stmt) {
+        mysql_stmt_close(_mysql.vb_stmt);
+        _mysql.vb_stmt = NULL;
     }
 }
 
@@ -260,15 +430,15 @@ netsnmp_sql_disconnected(void)
 static void
 netsnmp_sql_error(const char *message)
 {
-    u_int err = mysql_errno(_sql.conn);
+    u_int err = mysql_errno(_mysql.conn);
     snmp_log(LOG_ERR, "%s\n", message);
-    if (_sql.conn != NULL) {
+    if (_mysql.conn != NULL) {
 #if MYSQL_VERSION_ID >= 40101
         snmp_log(LOG_ERR, "Error %u (%s): %s\n",
-                 err, mysql_sqlstate(_sql.conn), mysql_error(_sql.conn));
+                 err, mysql_sqlstate(_mysql.conn), mysql_error(_mysql.conn));
 #else
-        snmp(LOG_ERR, "Error %u: %s\n",
-             mysql_errno(_sql.conn), mysql_error(_sql.conn));
+        snmp_log(LOG_ERR, "Error %u: %s\n",
+             mysql_errno(_mysql.conn), mysql_error(_mysql.conn));
 #endif
     }
     if (CR_SERVER_GONE_ERROR == err)
@@ -281,7 +451,7 @@ netsnmp_sql_error(const char *message)
 static void
 netsnmp_sql_stmt_error (MYSQL_STMT *stmt, const char *message)
 {
-    u_int err = mysql_errno(_sql.conn);
+    u_int err = mysql_errno(_mysql.conn);
 
     snmp_log(LOG_ERR, "%s\n", message);
     if (stmt) {
@@ -289,76 +459,84 @@ netsnmp_sql_stmt_error (MYSQL_STMT *stmt, const char *message)
                  mysql_stmt_errno(stmt), mysql_stmt_sqlstate(stmt),
                  mysql_stmt_error(stmt));
     }
-    
+
     if (CR_SERVER_GONE_ERROR == err)
         netsnmp_sql_disconnected();
 }
 
 /*
- * sql cleanup function, called at exit
+ * mysql cleanup function, called at exit
  */
 static void
 netsnmp_mysql_cleanup(void)
 {
-    DEBUGMSGTL(("sql:cleanup"," called\n"));
-
-    /** unregister alarm */
-    if (_sql.alarm_id)
-        snmp_alarm_unregister(_sql.alarm_id);
-
-    /** save any queued traps */
-    if (CONTAINER_SIZE(_sql.queue))
-        _sql_process_queue(0,NULL);
-
-    CONTAINER_FREE(_sql.queue);
-    _sql.queue = NULL;
-
-    if (_sql.trap_stmt) {
-        mysql_stmt_close(_sql.trap_stmt);
-        _sql.trap_stmt = NULL;
-    }
-    if (_sql.vb_stmt) {
-        mysql_stmt_close(_sql.vb_stmt);
-        _sql.vb_stmt = NULL;
-    }
-    
     /** disconnect from server */
     netsnmp_sql_disconnected();
 
-    if (_sql.conn) {
-        mysql_close(_sql.conn);
-        _sql.conn = NULL;
+    if (_mysql.conn) {
+        mysql_close(_mysql.conn);
+        _mysql.conn = NULL;
     }
 
     mysql_library_end();
 }
 
 /*
- * setup (initialize, prepare and bind) a prepared statement
+ * initialize and prepare a statement inserting rows rows of ncols
+ * parameters each
  */
-static int
-netsnmp_mysql_bind(const char *text, size_t text_size, MYSQL_STMT **stmt,
-                   MYSQL_BIND *bind)
+static MYSQL_STMT *
+netsnmp_mysql_prepare(const char *insert, int ncols, int rows)
 {
-    if ((NULL == text) || (NULL == stmt) || (NULL == bind)) {
-        snmp_log(LOG_ERR,"invalid paramaters to netsnmp_mysql_bind()\n");
-        return -1;
+    MYSQL_STMT *stmt;
+    char       *text;
+
+    text = _sql_insert_text(insert, ncols, rows);
+    if (NULL == text) {
+        snmp_log(LOG_ERR,"could not allocate INSERT statement\n");
+        return NULL;
     }
 
-    *stmt = mysql_stmt_init(_sql.conn);
-    if (NULL == *stmt) {
+    stmt = mysql_stmt_init(_mysql.conn);
+    if (NULL == stmt) {
         netsnmp_sql_error("could not initialize trap statement handler");
-        return -1;
+        free(text);
+        return NULL;
     }
 
-    if (mysql_stmt_prepare(*stmt, text, text_size) != 0) {
-        netsnmp_sql_stmt_error(*stmt, "Could not prepare INSERT");
-        mysql_stmt_close(*stmt);
-        *stmt = NULL;
-        return -1;
+    if (mysql_stmt_prepare(stmt, text, strlen(text)) != 0) {
+        netsnmp_sql_stmt_error(stmt, "Could not prepare INSERT");
+        mysql_stmt_close(stmt);
+        stmt = NULL;
     }
+    free(text);
 
-    return 0;
+    return stmt;
+}
+
+/*
+ * returns the prepared statement for rows rows, reusing the cached one
+ * when it has as many rows.  Statements for other row counts are cached
+ * when they are for a full batch, and must be closed by the caller
+ * otherwise.
+ */
+static MYSQL_STMT *
+netsnmp_mysql_stmt(const char *insert, int ncols, int rows, int full,
+                   MYSQL_STMT **cached, int *cached_rows)
+{
+    MYSQL_STMT *stmt;
+
+    if (*cached && *cached_rows == rows)
+        return *cached;
+
+    stmt = netsnmp_mysql_prepare(insert, ncols, rows);
+    if (stmt && rows == full) {
+        if (*cached)
+            mysql_stmt_close(*cached);
+        *cached = stmt;
+        *cached_rows = rows;
+    }
+    return stmt;
 }
 
 /*
@@ -367,11 +545,8 @@ netsnmp_mysql_bind(const char *text, size_t text_size, MYSQL_STMT **stmt,
 static int
 netsnmp_mysql_connect(void)
 {
-    char trap_stmt[] = "INSERT INTO notifications "
-        "(date_time, host, auth, type, version, request_id, snmpTrapOID, transport, security_model, v3msgid, v3security_level, v3context_name, v3context_engine, v3security_name, v3security_engine) "
-        "VALUES(?,?,?,?,?,?,?,?,?,?,?,?,?,?,?)";
-    char vb_stmt[] = "INSERT INTO varbinds "
-        "(trap_id, oid, type, value) VALUES (?,?,?,?)";
+    MYSQL_RES *res;
+    MYSQL_ROW  row;
 
     /** initialize connection handler */
     if (_sql.connected)
@@ -380,34 +555,34 @@ netsnmp_mysql_connect(void)
     DEBUGMSGTL(("sql:connection","connecting\n"));
 
     /** connect to server */
-    if (mysql_real_connect (_sql.conn, _sql.host_name, _sql.user_name,
-                            _sql.password, _sql.db_name, _sql.port_num,
-                            _sql.socket_name, _sql.flags) == NULL) {
+    if (mysql_real_connect (_mysql.conn, _mysql.host_name, _mysql.user_name,
+                            _mysql.password, _mysql.db_name, _mysql.port_num,
+                            _mysql.socket_name, _mysql.flags) == NULL) {
         netsnmp_sql_error("mysql_real_connect() failed");
         goto err;
     }
     _sql.connected = 1;
 
     /** disable autocommit */
-    if(0 != mysql_autocommit(_sql.conn, 0)) {
+    if(0 != mysql_autocommit(_mysql.conn, 0)) {
         netsnmp_sql_error("mysql_autocommit(0) failed");
         goto err;
     }
 
-    netsnmp_assert((_sql.trap_stmt == NULL) && (_sql.vb_stmt == NULL));
-
-    /** prepared statement for inserts */
-    if (0 != netsnmp_mysql_bind(trap_stmt,sizeof(trap_stmt), &_sql.trap_stmt,
-                                _tbind))
-        goto err;
-
-    if (0 != netsnmp_mysql_bind(vb_stmt,sizeof(vb_stmt),&_sql.vb_stmt,
-                                _vbind)) {
-        mysql_stmt_close(_sql.trap_stmt);
-        _sql.trap_stmt = NULL;
-        goto err;
+    /*
+     * A multi-row INSERT returns the first trap_id it generated, the
+     * others follow at this interval.
+     */
+    _mysql.id_increment = 1;
+    if (mysql_query(_mysql.conn, "SELECT @@auto_increment_increment") == 0 &&
+        (res = mysql_store_result(_mysql.conn)) != NULL) {
+        if ((row = mysql_fetch_row(res)) != NULL && row[0] && atol(row[0]) > 0)
+            _mysql.id_increment = atol(row[0]);
+        mysql_free_result(res);
     }
 
+    netsnmp_assert((_mysql.trap_stmt == NULL) && (_mysql.vb_stmt == NULL));
+
     return 0;
 
   err:
@@ -418,175 +593,653 @@ netsnmp_mysql_connect(void)
 }
 
 /** one-time initialization for mysql */
-int
-netsnmp_mysql_init(void)
+static int
+netsnmp_mysql_backend_init(void)
 {
-    netsnmp_trapd_handler *traph;
+#if defined(HAVE_MYSQL_INIT)
+    mysql_init(NULL);
+#elif defined(HAVE_MY_INIT)
+    MY_INIT("snmptrapd");
+#else
+    my_init();
+#endif
 
-    DEBUGMSGTL(("sql:init","called\n"));
+#if !defined(HAVE_MYSQL_OPTIONS)
+    {
+    int not_argc = 0, i;
+    char *not_args[] = { NULL };
+    char **not_argv = not_args;
 
-    /** negative or 0 interval disables sql logging */
-    if (_sql.queue_interval <= 0) {
-        DEBUGMSGTL(("sql:init",
-                    "mysql not enabled (sqlSaveInterval is <= 0)\n"));
+    /** load .my.cnf values */
+#if HAVE_MY_LOAD_DEFAULTS
+    my_load_defaults ("my", _mysql.groups, &not_argc, &not_argv, 0);
+#elif defined(HAVE_LOAD_DEFAULTS)
+    load_defaults ("my", _mysql.groups, &not_argc, &not_argv);
+#else
+#error Neither load_defaults() nor mysql_options() are available.
+#endif
+
+    for (i = 0; i < not_argc; ++i) {
+        if (NULL == not_argv[i])
+            continue;
+        if (strncmp(not_argv[i],"--password=",11) == 0)
+            _mysql.password = &not_argv[i][11];
+        else if (strncmp(not_argv[i],"--host=",7) == 0)
+            _mysql.host_name = &not_argv[i][7];
+        else if (strncmp(not_argv[i],"--user=",7) == 0)
+            _mysql.user_name = &not_argv[i][7];
+        else if (strncmp(not_argv[i],"--port=",7) == 0)
+            _mysql.port_num = atoi(&not_argv[i][7]);
+        else if (strncmp(not_argv[i],"--socket=",9) == 0)
+            _mysql.socket_name = &not_argv[i][9];
+        else if (strncmp(not_argv[i],"--database=",11) == 0)
+            _mysql.db_name = &not_argv[i][11];
+        else
+            snmp_log(LOG_WARNING, "unknown argument[%d] %s\n", i, not_argv[i]);
+    }
+    }
+#endif /* !defined(HAVE_MYSQL_OPTIONS) */
+
+    _mysql.conn = mysql_init (NULL);
+    if (_mysql.conn == NULL) {
+        netsnmp_sql_error("mysql_init() failed (out of memory?)");
+        return -1;
+    }
+
+#if HAVE_MYSQL_OPTIONS
+    mysql_options(_mysql.conn, MYSQL_READ_DEFAULT_GROUP, "snmptrapd");
+#endif
+
+    return 0;
+}
+
+static void
+_mysql_bind_string(MYSQL_BIND *bind, char *value, u_long len)
+{
+    bind->buffer_type = MYSQL_TYPE_STRING;
+    bind->buffer = value ? value : (char *) "";
+    bind->buffer_length = value ? len : 0;
+    bind->length = &bind->buffer_length;
+}
+
+static void
+_mysql_bind_short(MYSQL_BIND *bind, uint16_t *value)
+{
+    bind->buffer_type = MYSQL_TYPE_SHORT;
+    bind->buffer = (void *) value;
+    bind->is_unsigned = 1;
+}
+
+static void
+_mysql_bind_long(MYSQL_BIND *bind, uint32_t *value)
+{
+    bind->buffer_type = MYSQL_TYPE_LONG;
+    bind->buffer = (void *) value;
+    bind->is_unsigned = 1;
+}
+
+/*
+ * bind the columns of a notifications row
+ */
+static void
+_mysql_bind_trap(MYSQL_BIND *bind, MYSQL_TIME *date, sql_buf *sqlb)
+{
+    struct tm   *cur_time;
+    int          i;
+
+    cur_time = localtime(&sqlb->date);
+    date->year = cur_time->tm_year + 1900;
+    date->month = cur_time->tm_mon + 1;
+    date->day = cur_time->tm_mday;
+    date->hour = cur_time->tm_hour;
+    date->minute = cur_time->tm_min;
+    date->second = cur_time->tm_sec;
+    date->second_part = 0;
+    date->neg = 0;
+    bind[TBIND_DATE].buffer_type = MYSQL_TYPE_DATETIME;
+    bind[TBIND_DATE].buffer = (void *) date;
+
+    _mysql_bind_string(&bind[TBIND_HOST], sqlb->host, sqlb->host_len);
+    _mysql_bind_string(&bind[TBIND_OID], sqlb->oid, sqlb->oid_len);
+    _mysql_bind_string(&bind[TBIND_USER], sqlb->user, sqlb->user_len);
+    _mysql_bind_string(&bind[TBIND_TRANSPORT], sqlb->transport,
+                       sqlb->transport_len);
+    _mysql_bind_long(&bind[TBIND_REQID], &sqlb->reqid);
+    _mysql_bind_short(&bind[TBIND_VER], &sqlb->version);
+    _mysql_bind_short(&bind[TBIND_TYPE], &sqlb->type);
+    _mysql_bind_short(&bind[TBIND_SECURITY_MODEL], &sqlb->security_model);
+
+    if ((SNMP_MP_MODEL_SNMPv3+1) == sqlb->version) {
+        _mysql_bind_long(&bind[TBIND_v3_MSGID], &sqlb->msgid);
+        _mysql_bind_short(&bind[TBIND_v3_SECURITY_LEVEL],
+                          &sqlb->security_level);
+        _mysql_bind_string(&bind[TBIND_v3_CONTEXT_NAME], sqlb->context,
+                           sqlb->context_len);
+        _mysql_bind_string(&bind[TBIND_v3_CONTEXT_ENGINE],
+                           sqlb->context_engine, sqlb->context_engine_len);
+        _mysql_bind_string(&bind[TBIND_v3_SECURITY_NAME],
+                           sqlb->security_name, sqlb->security_name_len);
+        _mysql_bind_string(&bind[TBIND_v3_SECURITY_ENGINE],
+                           sqlb->security_engine, sqlb->security_engine_len);
+    }
+    else {
+        for (i = TBIND_v3_MSGID; i <= TBIND_v3_SECURITY_ENGINE; i++)
+            bind[i].buffer_type = MYSQL_TYPE_NULL;
+    }
+}
+
+/*
+ * bind the columns of a varbinds row
+ */
+static void
+_mysql_bind_varbind(MYSQL_BIND *bind, uint32_t *trap_id, sql_vb_buf *sqlvb)
+{
+    _mysql_bind_long(&bind[VBIND_ID], trap_id);
+    _mysql_bind_string(&bind[VBIND_OID], sqlvb->oid, sqlvb->oid_len);
+    _mysql_bind_short(&bind[VBIND_TYPE], &sqlvb->type);
+#ifdef NETSNMP_MYSQL_TRAP_VALUE_TEXT
+    _mysql_bind_string(&bind[VBIND_VAL], (char *) sqlvb->val, sqlvb->val_len);
+#else
+    bind[VBIND_VAL].buffer_type = MYSQL_TYPE_BLOB;
+    bind[VBIND_VAL].buffer = sqlvb->val;
+    bind[VBIND_VAL].buffer_length = sqlvb->val_len;
+    bind[VBIND_VAL].length = &bind[VBIND_VAL].buffer_length;
+#endif
+}
+
+/*
+ * bind and execute a prepared statement, without holding the snmptrapd
+ * lock while the server works on it
+ */
+static int
+_mysql_execute(MYSQL_STMT *stmt, MYSQL_BIND *bind)
+{
+    int rc;
+
+    if (mysql_stmt_bind_param(stmt, bind) != 0) {
+        netsnmp_sql_stmt_error(stmt, "Could not bind parameters for INSERT");
+        return -1;
+    }
+
+    netsnmp_trapd_unlock();
+    rc = mysql_stmt_execute(stmt);
+    netsnmp_trapd_lock();
+    if (rc != 0) {
+        netsnmp_sql_stmt_error(stmt, "Could not execute insert statement");
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * insert the traps of a batch with one statement, and note the trap_id
+ * each of them got
+ */
+static int
+_mysql_save_traps(sql_buf **batch, int count)
+{
+    MYSQL_STMT  *stmt;
+    MYSQL_BIND  *bind;
+    MYSQL_TIME  *dates;
+    u_long       trap_id;
+    int          i, rc = -1;
+
+    bind = (MYSQL_BIND *) calloc(count * TBIND_MAX, sizeof(MYSQL_BIND));
+    dates = (MYSQL_TIME *) calloc(count, sizeof(MYSQL_TIME));
+    if ((NULL == bind) || (NULL == dates)) {
+        snmp_log(LOG_ERR,"Could not allocate trap bindings\n");
+        goto out;
+    }
+    for (i = 0; i < count; i++)
+        _mysql_bind_trap(&bind[i * TBIND_MAX], &dates[i], batch[i]);
+
+    stmt = netsnmp_mysql_stmt(_trap_insert, TBIND_MAX, count,
+                              _sql.batch_size, &_mysql.trap_stmt,
+                              &_mysql.trap_rows);
+    if (NULL == stmt)
+        goto out;
+    rc = _mysql_execute(stmt, bind);
+    if (stmt != _mysql.trap_stmt)
+        mysql_stmt_close(stmt);
+    if (rc)
+        goto out;
+
+    trap_id = mysql_insert_id(_mysql.conn);
+    for (i = 0; i < count; i++, trap_id += _mysql.id_increment)
+        batch[i]->trap_id = trap_id;
+
+  out:
+    free(bind);
+    free(dates);
+    return rc;
+}
+
+/*
+ * insert the varbinds of a batch of traps, up to as many per statement
+ * as there are traps in a full batch
+ */
+static int
+_mysql_save_varbinds(sql_buf **batch, int count)
+{
+    netsnmp_iterator *it;
+    sql_vb_buf       *sqlvb;
+    MYSQL_STMT       *stmt;
+    MYSQL_BIND       *bind;
+    uint32_t         *ids;
+    int               total, chunk, rows = 0, i, rc = 0;
+
+    total = _sql_batch_varbinds(batch, count);
+    if (0 == total)
         return 0;
+    chunk = total < (int)_sql.batch_size ? total : (int)_sql.batch_size;
+
+    bind = (MYSQL_BIND *) calloc(chunk * VBIND_MAX, sizeof(MYSQL_BIND));
+    ids = (uint32_t *) calloc(count, sizeof(uint32_t));
+    if ((NULL == bind) || (NULL == ids)) {
+        snmp_log(LOG_ERR,"Could not allocate varbind bindings\n");
+        free(bind);
+        free(ids);
+        return -1;
+    }
+
+    for (i = 0; i < count && 0 == rc; i++) {
+        ids[i] = batch[i]->trap_id;
+        it = CONTAINER_ITERATOR(batch[i]->varbinds);
+        if (NULL == it) {
+            snmp_log(LOG_ERR,"Could not allocate iterator\n");
+            rc = -1;
+            break;
+        }
+        for (sqlvb = ITERATOR_FIRST(it); sqlvb; sqlvb = ITERATOR_NEXT(it)) {
+            _mysql_bind_varbind(&bind[rows * VBIND_MAX], &ids[i], sqlvb);
+            if (++rows < chunk)
+                continue;
+            total -= rows;
+            stmt = netsnmp_mysql_stmt(_vb_insert, VBIND_MAX, rows,
+                                      _sql.batch_size, &_mysql.vb_stmt,
+                                      &_mysql.vb_rows);
+            rc = stmt ? _mysql_execute(stmt, bind) : -1;
+            if (stmt && stmt != _mysql.vb_stmt)
+                mysql_stmt_close(stmt);
+            if (rc)
+                break;
+            rows = 0;
+            memset(bind, 0, chunk * VBIND_MAX * sizeof(MYSQL_BIND));
+            if (total < chunk)
+                chunk = total;
+        }
+        ITERATOR_RELEASE(it);
     }
 
-    /** create queue for storing traps til they are written to the db */
-    _sql.queue = netsnmp_container_find("fifo");
-    if (NULL == _sql.queue) {
-        snmp_log(LOG_ERR, "Could not allocate sql buf container\n");
+    free(bind);
+    free(ids);
+    return rc;
+}
+
+/*
+ * save a batch of traps to the mysql database
+ */
+static int
+_mysql_save(sql_buf **batch, int count)
+{
+    int rc;
+
+    if ((_mysql_save_traps(batch, count) != 0) ||
+        (_mysql_save_varbinds(batch, count) != 0)) {
+        if (_sql.connected)
+            mysql_rollback(_mysql.conn);
+        return -1;
+    }
+
+    netsnmp_trapd_unlock();
+    rc = mysql_commit(_mysql.conn);
+    netsnmp_trapd_lock();
+    if (rc) { /* nuts... now what? */
+        netsnmp_sql_error("commit failed");
+        return -1;
+    }
+    return 0;
+}
+
+static const sql_backend _mysql_backend = {
+    "MySQL",
+    netsnmp_mysql_backend_init,
+    netsnmp_mysql_connect,
+    _mysql_save,
+    netsnmp_mysql_cleanup
+};
+#endif /* NETSNMP_USE_MYSQL */
+
+#ifdef NETSNMP_USE_SQLITE
+/*------------------------------------------------------------------
+ *
+ * SQLite
+ *
+ */
+
+/*
+ * SQLite limits the number of parameters of a statement to 999 by
+ * default, which caps the rows of a multi-row INSERT.
+ */
+#define SQLITE_PARAMS_MAX 999
+
+static char    *_sqlite_file;
+static sqlite3 *_sqlite;
+
+static const char _sqlite_schema[] =
+    "CREATE TABLE IF NOT EXISTS notifications ("
+    "trap_id INTEGER PRIMARY KEY, date_time TEXT NOT NULL, "
+    "host TEXT NOT NULL, auth TEXT NOT NULL, type INTEGER NOT NULL, "
+    "version INTEGER NOT NULL, request_id INTEGER NOT NULL, "
+    "snmpTrapOID TEXT NOT NULL, transport TEXT NOT NULL, "
+    "security_model INTEGER NOT NULL, v3msgid INTEGER, "
+    "v3security_level INTEGER, v3context_name TEXT, "
+    "v3context_engine TEXT, v3security_name TEXT, "
+    "v3security_engine TEXT);"
+    "CREATE TABLE IF NOT EXISTS varbinds ("
+    "trap_id INTEGER NOT NULL, oid TEXT NOT NULL, "
+    "type INTEGER NOT NULL, value BLOB NOT NULL);"
+    "CREATE INDEX IF NOT EXISTS varbinds_trap_id ON varbinds (trap_id);";
+
+static void
+_parse_sqlite_file(const char *token, char *cptr)
+{
+    SNMP_FREE(_sqlite_file);
+    _sqlite_file = strdup(cptr);
+}
+
+static void
+_free_sqlite_file(void)
+{
+    SNMP_FREE(_sqlite_file);
+}
+
+/*
+ * convenience function to log sqlite errors
+ */
+static void
+netsnmp_sqlite_error(const char *message)
+{
+    snmp_log(LOG_ERR, "%s\n", message);
+    if (_sqlite)
+        snmp_log(LOG_ERR, "SQLite error %d: %s\n", sqlite3_errcode(_sqlite),
+                 sqlite3_errmsg(_sqlite));
+}
+
+static int
+netsnmp_sqlite_init(void)
+{
+    if (NULL == _sqlite_file)
+        return -1;
+    return 0;
+}
+
+/*
+ * open the database, creating the tables if need be
+ */
+static int
+netsnmp_sqlite_connect(void)
+{
+    if (_sql.connected)
+        return 0;
+
+    DEBUGMSGTL(("sql:connection","opening %s\n", _sqlite_file));
+
+    if (sqlite3_open(_sqlite_file, &_sqlite) != SQLITE_OK) {
+        netsnmp_sqlite_error("Could not open the SQLite database");
+        goto err;
+    }
+    if (sqlite3_exec(_sqlite, _sqlite_schema, NULL, NULL, NULL) != SQLITE_OK) {
+        netsnmp_sqlite_error("Could not create the SQLite tables");
+        goto err;
+    }
+    _sql.connected = 1;
+    return 0;
+
+  err:
+    sqlite3_close(_sqlite);
+    _sqlite = NULL;
+    return -1;
+}
+
+static void
+netsnmp_sqlite_cleanup(void)
+{
+    _sql.connected = 0;
+    if (_sqlite) {
+        sqlite3_close(_sqlite);
+        _sqlite = NULL;
+    }
+}
+
+static void
+_sqlite_bind_string(sqlite3_stmt *stmt, int col, const char *value,
+                    u_long len)
+{
+    sqlite3_bind_text(stmt, col, value ? value : "", value ? len : 0,
+                      SQLITE_STATIC);
+}
+
+/*
+ * bind the columns of a notifications row, starting at column col
+ */
+static void
+_sqlite_bind_trap(sqlite3_stmt *stmt, int col, sql_buf *sqlb, char *date,
+                  size_t date_len)
+{
+    struct tm *cur_time;
+    int        i;
+
+    cur_time = localtime(&sqlb->date);
+    strftime(date, date_len, "%Y-%m-%d %H:%M:%S", cur_time);
+    sqlite3_bind_text(stmt, col + TBIND_DATE, date, -1, SQLITE_TRANSIENT);
+    _sqlite_bind_string(stmt, col + TBIND_HOST, sqlb->host, sqlb->host_len);
+    _sqlite_bind_string(stmt, col + TBIND_USER, sqlb->user, sqlb->user_len);
+    sqlite3_bind_int(stmt, col + TBIND_TYPE, sqlb->type);
+    sqlite3_bind_int(stmt, col + TBIND_VER, sqlb->version);
+    sqlite3_bind_int64(stmt, col + TBIND_REQID, sqlb->reqid);
+    _sqlite_bind_string(stmt, col + TBIND_OID, sqlb->oid, sqlb->oid_len);
+    _sqlite_bind_string(stmt, col + TBIND_TRANSPORT, sqlb->transport,
+                        sqlb->transport_len);
+    sqlite3_bind_int(stmt, col + TBIND_SECURITY_MODEL, sqlb->security_model);
+
+    if ((SNMP_MP_MODEL_SNMPv3+1) == sqlb->version) {
+        sqlite3_bind_int64(stmt, col + TBIND_v3_MSGID, sqlb->msgid);
+        sqlite3_bind_int(stmt, col + TBIND_v3_SECURITY_LEVEL,
+                         sqlb->security_level);
+        _sqlite_bind_string(stmt, col + TBIND_v3_CONTEXT_NAME, sqlb->context,
+                            sqlb->context_len);
+        _sqlite_bind_string(stmt, col + TBIND_v3_CONTEXT_ENGINE,
+                            sqlb->context_engine, sqlb->context_engine_len);
+        _sqlite_bind_string(stmt, col + TBIND_v3_SECURITY_NAME,
+                            sqlb->security_name, sqlb->security_name_len);
+        _sqlite_bind_string(stmt, col + TBIND_v3_SECURITY_ENGINE,
+                            sqlb->security_engine, sqlb->security_engine_len);
+    }
+    else {
+        for (i = TBIND_v3_MSGID; i <= TBIND_v3_SECURITY_ENGINE; i++)
+            sqlite3_bind_null(stmt, col + i);
+    }
+}
+
+/*
+ * prepare a statement inserting rows rows of ncols parameters each
+ */
+static sqlite3_stmt *
+netsnmp_sqlite_prepare(const char *insert, int ncols, int rows)
+{
+    sqlite3_stmt *stmt = NULL;
+    char         *text;
+
+    text = _sql_insert_text(insert, ncols, rows);
+    if (NULL == text) {
+        snmp_log(LOG_ERR,"could not allocate INSERT statement\n");
+        return NULL;
+    }
+    if (sqlite3_prepare_v2(_sqlite, text, -1, &stmt, NULL) != SQLITE_OK) {
+        netsnmp_sqlite_error("Could not prepare INSERT");
+        stmt = NULL;
+    }
+    free(text);
+    return stmt;
+}
+
+/*
+ * execute a bound statement without holding the snmptrapd lock
+ */
+static int
+_sqlite_execute(sqlite3_stmt *stmt)
+{
+    int rc;
+
+    netsnmp_trapd_unlock();
+    rc = sqlite3_step(stmt);
+    netsnmp_trapd_lock();
+    if (rc != SQLITE_DONE) {
+        netsnmp_sqlite_error("Could not execute insert statement");
         return -1;
     }
+    return 0;
+}
 
-#if defined(HAVE_MYSQL_INIT)
-    mysql_init(NULL);
-#elif defined(HAVE_MY_INIT)
-    MY_INIT("snmptrapd");
-#else
-    my_init();
-#endif
-
-#if !defined(HAVE_MYSQL_OPTIONS)
-    {
-    int not_argc = 0, i;
-    char *not_args[] = { NULL };
-    char **not_argv = not_args;
-
-    /** load .my.cnf values */
-#if HAVE_MY_LOAD_DEFAULTS
-    my_load_defaults ("my", _sql.groups, &not_argc, &not_argv, 0);
-#elif defined(HAVE_LOAD_DEFAULTS)
-    load_defaults ("my", _sql.groups, &not_argc, &not_argv);
-#else
-#error Neither load_defaults() nor mysql_options() are available.
-#endif
+static int
+_sqlite_save_traps(sql_buf **batch, int count)
+{
+    sqlite3_stmt *stmt = NULL;
+    char          dates[SQLITE_PARAMS_MAX / TBIND_MAX][20];
+    sqlite3_int64 trap_id;
+    int           per_stmt, rows, stmt_rows = 0, i, j, rc = 0;
+
+    per_stmt = SQLITE_PARAMS_MAX / TBIND_MAX;
+    for (i = 0; i < count && 0 == rc; i += rows) {
+        rows = count - i < per_stmt ? count - i : per_stmt;
+        if (rows != stmt_rows) {
+            sqlite3_finalize(stmt);
+            stmt = netsnmp_sqlite_prepare(_trap_insert, TBIND_MAX, rows);
+            if (NULL == stmt)
+                return -1;
+            stmt_rows = rows;
+        } else
+            sqlite3_reset(stmt);
+
+        for (j = 0; j < rows; j++)
+            _sqlite_bind_trap(stmt, j * TBIND_MAX + 1, batch[i + j],
+                              dates[j], sizeof(dates[j]));
+        rc = _sqlite_execute(stmt);
+        if (rc)
+            break;
 
-    for (i = 0; i < not_argc; ++i) {
-        if (NULL == not_argv[i])
-            continue;
-        if (strncmp(not_argv[i],"--password=",11) == 0)
-            _sql.password = &not_argv[i][11];
-        else if (strncmp(not_argv[i],"--host=",7) == 0)
-            _sql.host_name = &not_argv[i][7];
-        else if (strncmp(not_argv[i],"--user=",7) == 0)
-            _sql.user_name = &not_argv[i][7];
-        else if (strncmp(not_argv[i],"--port=",7) == 0)
-            _sql.port_num = atoi(&not_argv[i][7]);
-        else if (strncmp(not_argv[i],"--socket=",9) == 0)
-            _sql.socket_name = &not_argv[i][9];
-        else if (strncmp(not_argv[i],"--database=",11) == 0)
-            _sql.db_name = &not_argv[i][11];
-        else
-            snmp_log(LOG_WARNING, "unknown argument[%d] %s\n", i, not_argv[i]);
-    }
+        /* the rows got consecutive rowids, up to the last one */
+        trap_id = sqlite3_last_insert_rowid(_sqlite) - rows + 1;
+        for (j = 0; j < rows; j++)
+            batch[i + j]->trap_id = trap_id + j;
     }
-#endif /* !defined(HAVE_MYSQL_OPTIONS) */
-
-    /** init bind structures */
-    memset(_tbind, 0x0, sizeof(_tbind));
-    memset(_vbind, 0x0, sizeof(_vbind));
-
-    /** trap static bindings */
-    _tbind[TBIND_HOST].buffer_type = MYSQL_TYPE_STRING;
-    _tbind[TBIND_HOST].length = &_tbind[TBIND_HOST].buffer_length;
-
-    _tbind[TBIND_OID].buffer_type = MYSQL_TYPE_STRING;
-    _tbind[TBIND_OID].length = &_tbind[TBIND_OID].buffer_length;
-
-    _tbind[TBIND_REQID].buffer_type = MYSQL_TYPE_LONG;
-    _tbind[TBIND_REQID].is_unsigned = 1;
-
-    _tbind[TBIND_VER].buffer_type = MYSQL_TYPE_SHORT;
-    _tbind[TBIND_VER].is_unsigned = 1;
-
-    _tbind[TBIND_TYPE].buffer_type = MYSQL_TYPE_SHORT;
-    _tbind[TBIND_TYPE].is_unsigned = 1;
-
-    _tbind[TBIND_DATE].buffer_type = MYSQL_TYPE_DATETIME;
-
-    _tbind[TBIND_USER].buffer_type = MYSQL_TYPE_STRING;
-    _tbind[TBIND_USER].length = &_tbind[TBIND_USER].buffer_length;
-
-    _tbind[TBIND_TRANSPORT].buffer_type = MYSQL_TYPE_STRING;
-    _tbind[TBIND_TRANSPORT].length = &_tbind[TBIND_TRANSPORT].buffer_length;
-
-    _tbind[TBIND_SECURITY_MODEL].buffer_type = MYSQL_TYPE_SHORT;
-    _tbind[TBIND_SECURITY_MODEL].is_unsigned = 1;
-
-    _tbind[TBIND_v3_MSGID].buffer_type = MYSQL_TYPE_LONG;
-    _tbind[TBIND_v3_MSGID].is_unsigned = 1;
-    _tbind[TBIND_v3_SECURITY_LEVEL].buffer_type = MYSQL_TYPE_SHORT;
-    _tbind[TBIND_v3_SECURITY_LEVEL].is_unsigned = 1;
-    _tbind[TBIND_v3_CONTEXT_NAME].buffer_type = MYSQL_TYPE_STRING;
-    _tbind[TBIND_v3_CONTEXT_ENGINE].buffer_type = MYSQL_TYPE_STRING;
-    _tbind[TBIND_v3_SECURITY_NAME].buffer_type = MYSQL_TYPE_STRING;
-    _tbind[TBIND_v3_SECURITY_NAME].length =
-        &_tbind[TBIND_v3_SECURITY_NAME].buffer_length;
-    _tbind[TBIND_v3_CONTEXT_NAME].length =
-        &_tbind[TBIND_v3_CONTEXT_NAME].buffer_length;
-    _tbind[TBIND_v3_SECURITY_ENGINE].buffer_type = MYSQL_TYPE_STRING;
-    _tbind[TBIND_v3_SECURITY_ENGINE].length =
-        &_tbind[TBIND_v3_SECURITY_ENGINE].buffer_length;
-    _tbind[TBIND_v3_CONTEXT_ENGINE].length =
-        &_tbind[TBIND_v3_CONTEXT_ENGINE].buffer_length;
-
-    _tbind[TBIND_v3_MSGID].is_null =
-        _tbind[TBIND_v3_SECURITY_LEVEL].is_null =
-        _tbind[TBIND_v3_CONTEXT_NAME].is_null =
-        _tbind[TBIND_v3_CONTEXT_ENGINE].is_null =
-        _tbind[TBIND_v3_SECURITY_NAME].is_null =
-        _tbind[TBIND_v3_SECURITY_ENGINE].is_null = &_no_v3;
-    
-    /** variable static bindings */
-    _vbind[VBIND_ID].buffer_type = MYSQL_TYPE_LONG;
-    _vbind[VBIND_ID].is_unsigned = 1;
-
-    _vbind[VBIND_OID].buffer_type = MYSQL_TYPE_STRING;
-    _vbind[VBIND_OID].length = &_vbind[VBIND_OID].buffer_length;
-
-    _vbind[VBIND_TYPE].buffer_type = MYSQL_TYPE_SHORT;
-    _vbind[VBIND_TYPE].is_unsigned = 1;
+    sqlite3_finalize(stmt);
+    return rc;
+}
 
+static int
+_sqlite_save_varbinds(sql_buf **batch, int count)
+{
+    netsnmp_iterator *it;
+    sql_vb_buf       *sqlvb;
+    sqlite3_stmt     *stmt = NULL;
+    int               total, per_stmt, rows = 0, stmt_rows = 0, i, col;
+    int               rc = 0;
+
+    total = _sql_batch_varbinds(batch, count);
+    per_stmt = SQLITE_PARAMS_MAX / VBIND_MAX;
+    if (per_stmt > (int)_sql.batch_size)
+        per_stmt = _sql.batch_size;
+
+    for (i = 0; i < count && 0 == rc; i++) {
+        it = CONTAINER_ITERATOR(batch[i]->varbinds);
+        if (NULL == it) {
+            snmp_log(LOG_ERR,"Could not allocate iterator\n");
+            rc = -1;
+            break;
+        }
+        for (sqlvb = ITERATOR_FIRST(it); sqlvb; sqlvb = ITERATOR_NEXT(it)) {
+            if (0 == rows) {
+                int want = total < per_stmt ? total : per_stmt;
+                if (want != stmt_rows) {
+                    sqlite3_finalize(stmt);
+                    stmt = netsnmp_sqlite_prepare(_vb_insert, VBIND_MAX, want);
+                    if (NULL == stmt) {
+                        rc = -1;
+                        break;
+                    }
+                    stmt_rows = want;
+                } else
+                    sqlite3_reset(stmt);
+            }
+            col = rows * VBIND_MAX + 1;
+            sqlite3_bind_int64(stmt, col + VBIND_ID, batch[i]->trap_id);
+            _sqlite_bind_string(stmt, col + VBIND_OID, sqlvb->oid,
+                                sqlvb->oid_len);
+            sqlite3_bind_int(stmt, col + VBIND_TYPE, sqlvb->type);
 #ifdef NETSNMP_MYSQL_TRAP_VALUE_TEXT
-    _vbind[VBIND_VAL].buffer_type = MYSQL_TYPE_STRING;
+            _sqlite_bind_string(stmt, col + VBIND_VAL, (char *) sqlvb->val,
+                                sqlvb->val_len);
 #else
-    _vbind[VBIND_VAL].buffer_type = MYSQL_TYPE_BLOB;
+            sqlite3_bind_blob(stmt, col + VBIND_VAL, sqlvb->val,
+                              sqlvb->val_len, SQLITE_STATIC);
 #endif
-    _vbind[VBIND_VAL].length = &_vbind[VBIND_VAL].buffer_length;
+            if (++rows < stmt_rows)
+                continue;
+            total -= rows;
+            rows = 0;
+            rc = _sqlite_execute(stmt);
+            if (rc)
+                break;
+        }
+        ITERATOR_RELEASE(it);
+    }
+    sqlite3_finalize(stmt);
+    return rc;
+}
 
-    _sql.conn = mysql_init (NULL);
-    if (_sql.conn == NULL) {
-        netsnmp_sql_error("mysql_init() failed (out of memory?)");
+/*
+ * save a batch of traps to the sqlite database
+ */
+static int
+_sqlite_save(sql_buf **batch, int count)
+{
+    if (sqlite3_exec(_sqlite, "BEGIN", NULL, NULL, NULL) != SQLITE_OK) {
+        netsnmp_sqlite_error("Could not begin a transaction");
         return -1;
     }
-
-#if HAVE_MYSQL_OPTIONS
-    mysql_options(_sql.conn, MYSQL_READ_DEFAULT_GROUP, "snmptrapd");
-#endif
-
-    /** try to connect; we'll try again later if we fail */
-    (void) netsnmp_mysql_connect();
-
-    /** register periodic queue save */
-    _sql.alarm_id = snmp_alarm_register(_sql.queue_interval, /* seconds */
-                                        1,                   /* repeat */
-                                        _sql_process_queue,  /* function */
-                                        NULL);               /* client args */
-
-    /** add handler */
-    traph = netsnmp_add_global_traphandler(NETSNMPTRAPD_PRE_HANDLER,
-                                           mysql_handler);
-    if (NULL == traph) {
-        snmp_log(LOG_ERR, "Could not allocate sql trap handler\n");
+    if ((_sqlite_save_traps(batch, count) != 0) ||
+        (_sqlite_save_varbinds(batch, count) != 0)) {
+        sqlite3_exec(_sqlite, "ROLLBACK", NULL, NULL, NULL);
         return -1;
     }
-    traph->authtypes = TRAP_AUTH_LOG;
-
-    atexit(netsnmp_mysql_cleanup);
+    netsnmp_trapd_unlock();
+    if (sqlite3_exec(_sqlite, "COMMIT", NULL, NULL, NULL) != SQLITE_OK) {
+        netsnmp_trapd_lock();
+        netsnmp_sqlite_error("commit failed");
+        sqlite3_exec(_sqlite, "ROLLBACK", NULL, NULL, NULL);
+        return -1;
+    }
+    netsnmp_trapd_lock();
     return 0;
 }
 
+static const sql_backend _sqlite_backend = {
+    "SQLite",
+    netsnmp_sqlite_init,
+    netsnmp_sqlite_connect,
+    _sqlite_save,
+    netsnmp_sqlite_cleanup
+};
+#endif /* NETSNMP_USE_SQLITE */
+
+/*------------------------------------------------------------------
+ *
+ * Queueing and writing traps
+ *
+ */
+
 /*
  * log CSV version of trap.
  * dontcare param is there so this function can be passed directly
@@ -597,6 +1250,7 @@ _sql_log(sql_buf *sqlb, void* dontcare)
 {
     netsnmp_iterator     *it;
     sql_vb_buf           *sqlvb;
+    struct tm            *cur_time;
 
     if ((NULL == sqlb) || sqlb->logged)
         return;
@@ -606,10 +1260,12 @@ _sql_log(sql_buf *sqlb, void* dontcare)
      * nothing done to protect against data insertion attacks with
      * respect to bad data (commas, newlines, etc)
      */
+    cur_time = localtime(&sqlb->date);
     snmp_log(LOG_ERR,
              "trap:%d-%d-%d %d:%d:%d,%s,%d,%d,%d,%s,%s,%d,%d,%d,%s,%s,%s,%s\n",
-             sqlb->time.year,sqlb->time.month,sqlb->time.day,
-             sqlb->time.hour,sqlb->time.minute,sqlb->time.second,
+             cur_time->tm_year + 1900, cur_time->tm_mon + 1,
+             cur_time->tm_mday, cur_time->tm_hour, cur_time->tm_min,
+             cur_time->tm_sec,
              sqlb->user,
              sqlb->type, sqlb->version, sqlb->reqid, sqlb->oid,
              sqlb->transport, sqlb->security_model, sqlb->msgid,
@@ -644,7 +1300,7 @@ _sql_log(sql_buf *sqlb, void* dontcare)
 #endif
     }
     ITERATOR_RELEASE(it);
-   
+
 }
 
 /*
@@ -707,7 +1363,7 @@ _sql_buf_get(void)
     sqlb = SNMP_MALLOC_TYPEDEF(sql_buf);
     if (NULL == sqlb)
         return NULL;
-    
+
     /** fifo for varbinds */
     sqlb->varbinds = netsnmp_container_find("fifo");
     if (NULL == sqlb->varbinds) {
@@ -729,8 +1385,6 @@ _sql_save_trap_info(sql_buf *sqlb, netsnmp_pdu  *pdu,
 {
     static oid   trapoids[] = { 1, 3, 6, 1, 6, 3, 1, 1, 5, 0 };
     oid         *trap_oid, tmp_oid[MAX_OID_LEN];
-    time_t       now;
-    struct tm   *cur_time;
     size_t       tmp_size;
     size_t       buf_host_len_t, buf_oid_len_t, buf_user_len_t;
     int          oid_overflow, trap_oid_len;
@@ -742,16 +1396,7 @@ _sql_save_trap_info(sql_buf *sqlb, netsnmp_pdu  *pdu,
     DEBUGMSGTL(("sql:queue", "queueing incoming trap\n"));
 
     /** time */
-    (void) time(&now);
-    cur_time = localtime(&now);
-    sqlb->time.year = cur_time->tm_year + 1900;
-    sqlb->time.month = cur_time->tm_mon + 1;
-    sqlb->time.day = cur_time->tm_mday;
-    sqlb->time.hour = cur_time->tm_hour;
-    sqlb->time.minute = cur_time->tm_min;
-    sqlb->time.second = cur_time->tm_sec;
-    sqlb->time.second_part = 0;
-    sqlb->time.neg = 0;
+    (void) time(&sqlb->date);
 
     /** host name */
     buf_host_len_t = 0;
@@ -818,6 +1463,8 @@ _sql_save_trap_info(sql_buf *sqlb, netsnmp_pdu  *pdu,
     /** transport */
     sqlb->transport = transport->f_fmtaddr(transport, pdu->transport_data,
                                            pdu->transport_data_length);
+    if (sqlb->transport)
+        sqlb->transport_len = strlen(sqlb->transport);
 
     /** security model */
     sqlb->security_model = pdu->securityModel;
@@ -833,7 +1480,7 @@ _sql_save_trap_info(sql_buf *sqlb, netsnmp_pdu  *pdu,
             sqlb->context_len = pdu->contextNameLen;
         }
         if (pdu->contextEngineID) {
-            sqlb->context_engine_len = 
+            sqlb->context_engine_len =
                 binary_to_hex(pdu->contextEngineID, pdu->contextEngineIDLen,
                               &sqlb->context_engine);
         }
@@ -845,7 +1492,7 @@ _sql_save_trap_info(sql_buf *sqlb, netsnmp_pdu  *pdu,
             sqlb->security_name_len = pdu->securityNameLen;
         }
         if (pdu->securityEngineID) {
-            sqlb->security_engine_len = 
+            sqlb->security_engine_len =
                 binary_to_hex(pdu->securityEngineID, pdu->securityEngineIDLen,
                               &sqlb->security_engine);
         }
@@ -889,7 +1536,7 @@ _sql_save_varbind_info(sql_buf *sqlb, netsnmp_pdu  *pdu)
         sqlvb->oid_len = buf_oid_len_t;
         if (oid_overflow)
             snmp_log(LOG_WARNING,"OID truncated in sql insert\n");
-        
+
         /** type */
         if (var->type > ASN_OBJECT_ID)
             /** convert application types to sql enum */
@@ -920,6 +1567,157 @@ _sql_save_varbind_info(sql_buf *sqlb, netsnmp_pdu  *pdu)
     return 0;
 }
 
+/*
+ * if we don't have a database connection, try to reconnect. We
+ * don't care if we fail - traps will be logged in that case.
+ */
+static void
+_sql_reconnect(void)
+{
+    if (0 == _sql.connected) {
+        DEBUGMSGT(("sql:process", "no sql connection; reconnecting\n"));
+        (void) _sql.backend->connect();
+    }
+}
+
+/*
+ * save a list of queued traps to the database, in batches, then free
+ * them.  Traps that could not be saved are logged.
+ */
+static void
+_sql_save_list(sql_buf *list)
+{
+    sql_buf  **batch, *sqlb;
+    int        count, i;
+
+    batch = (sql_buf **) calloc(_sql.batch_size, sizeof(sql_buf *));
+
+    while (list) {
+        for (count = 0; list && count < (int)_sql.batch_size; count++) {
+            sqlb = list;
+            list = sqlb->next;
+            if (NULL == batch) {
+                /* no memory for a batch: log them all */
+                _sql_log(sqlb, NULL);
+                _sql_buf_free(sqlb, NULL);
+                count = -1;
+                continue;
+            }
+            batch[count] = sqlb;
+        }
+        if (count <= 0)
+            continue;
+
+        DEBUGMSGT(("sql:process", "saving %d traps\n", count));
+        if (!_sql.connected || _sql.backend->save(batch, count) != 0)
+            for (i = 0; i < count; i++)
+                _sql_log(batch[i], NULL);
+        for (i = 0; i < count; i++)
+            _sql_buf_free(batch[i], NULL);
+    }
+    free(batch);
+}
+
+/*
+ * takes all traps off the queue
+ */
+static sql_buf *
+_sql_queue_take(void)
+{
+    sql_buf *list;
+
+    list = _sql.queue_head;
+    _sql.queue_head = _sql.queue_tail = NULL;
+    _sql.queue_len = 0;
+    if (_sql.overflowing) {
+        _sql.overflowing = 0;
+        snmp_log(LOG_WARNING, "sql queue accepting traps again "
+                 "(%lu logged as text so far)\n", _sql.overflows);
+    }
+    return list;
+}
+
+/*
+ * process (save) queued items to sql database.
+ *
+ * dontcare & meeither are dummy params so this function can be used
+ * as a netsnmp_alarm callback function.
+ */
+static void
+_sql_process_queue(u_int dontcare, void *meeither)
+{
+    sql_buf *list;
+
+    SQL_QUEUE_LOCK();
+    list = _sql_queue_take();
+    SQL_QUEUE_UNLOCK();
+
+    /** bail if the queue is empty */
+    if (NULL == list)
+        return;
+
+    _sql_reconnect();
+    _sql_save_list(list);
+}
+
+#ifdef NETSNMP_SQL_WRITER
+/*
+ * writer thread: waits for sqlMaxQueue traps or for sqlSaveInterval
+ * seconds, then saves the queue
+ */
+static void *
+_sql_writer_main(void *arg)
+{
+    struct timespec deadline;
+    sql_buf        *list;
+
+#ifdef NETSNMP_USE_MYSQL
+    if (&_mysql_backend == _sql.backend)
+        mysql_thread_init();
+#endif
+
+    SQL_QUEUE_LOCK();
+    deadline.tv_sec = time(NULL) + _sql.queue_interval;
+    deadline.tv_nsec = 0;
+    for (;;) {
+        while (!_sql_writer_stopping && _sql.queue_len < _sql.queue_max) {
+            if (pthread_cond_timedwait(&_sql_queue_cond, &_sql_queue_lock,
+                                       &deadline) != 0 &&
+                time(NULL) >= deadline.tv_sec)
+                break;
+        }
+        if (time(NULL) >= deadline.tv_sec)
+            deadline.tv_sec = time(NULL) + _sql.queue_interval;
+
+        list = _sql_queue_take();
+        if (NULL == list && _sql_writer_stopping)
+            break;
+        SQL_QUEUE_UNLOCK();
+
+        if (list) {
+            /*
+             * connecting may take as long as the server needs to answer
+             * or time out, so it is done before taking the snmptrapd
+             * lock; the backends drop the lock while executing, too.
+             */
+            _sql_reconnect();
+            netsnmp_trapd_lock();
+            _sql_save_list(list);
+            netsnmp_trapd_unlock();
+        }
+
+        SQL_QUEUE_LOCK();
+    }
+    SQL_QUEUE_UNLOCK();
+
+#ifdef NETSNMP_USE_MYSQL
+    if (&_mysql_backend == _sql.backend)
+        mysql_thread_end();
+#endif
+    return NULL;
+}
+#endif /* NETSNMP_SQL_WRITER */
+
 /*
  * sql trap handler
  */
@@ -929,7 +1727,7 @@ mysql_handler(netsnmp_pdu           *pdu,
               netsnmp_trapd_handler *handler)
 {
     sql_buf     *sqlb;
-    int          old_format, rc;
+    int          old_format, rc, save_now = 0;
 
     DEBUGMSGTL(("sql:handler", "called\n"));
 
@@ -954,190 +1752,172 @@ mysql_handler(netsnmp_pdu           *pdu,
     netsnmp_ds_set_int(NETSNMP_DS_LIBRARY_ID, NETSNMP_DS_LIB_OID_OUTPUT_FORMAT,
                        old_format);
 
-    /** insert into queue */
-    rc = CONTAINER_INSERT(_sql.queue, sqlb);
-    if(rc) {
-        snmp_log(LOG_ERR, "Could not log queue sql trap buffer\n");
+    /** insert into queue, unless the database is too far behind */
+    SQL_QUEUE_LOCK();
+    rc = _sql.queue_len >= _sql.queue_limit;
+    if (rc) {
+        _sql.overflows++;
+        if (!_sql.overflowing) {
+            _sql.overflowing = 1;
+            snmp_log(LOG_WARNING, "sql queue full (%u traps); "
+                     "logging traps as text\n", _sql.queue_len);
+        }
+    } else {
+        if (_sql.queue_tail)
+            _sql.queue_tail->next = sqlb;
+        else
+            _sql.queue_head = sqlb;
+        _sql.queue_tail = sqlb;
+        /** save queue if size is > max */
+        if (++_sql.queue_len >= _sql.queue_max) {
+#ifdef NETSNMP_SQL_WRITER
+            if (_sql_writer_running)
+                pthread_cond_signal(&_sql_queue_cond);
+            else
+#endif
+                save_now = 1;
+        }
+    }
+    SQL_QUEUE_UNLOCK();
+
+    if (rc) {
         _sql_log(sqlb, NULL);
         _sql_buf_free(sqlb, NULL);
         return -1;
     }
 
-    /** save queue if size is > max */
-    if (CONTAINER_SIZE(_sql.queue) >= _sql.queue_max)
+    if (save_now)
         _sql_process_queue(0,NULL);
 
     return 0;
 }
 
 /*
- * save a buffered trap to sql database
+ * sql cleanup function, called at exit
  */
 static void
-_sql_save(sql_buf *sqlb, void *dontcare)
+netsnmp_sql_cleanup(void)
 {
-    netsnmp_iterator     *it;
-    sql_vb_buf           *sqlvb;
-    u_long                trap_id;
-
-    /*
-     * don't even try if we don't have a database connection
-     */
-    if (0 == _sql.connected) {
-        _sql_log(sqlb, NULL);
-        return;
-    }
-
-    /*
-     * the prepared statements are bound to the static buffer objects,
-     * so copy the queued data to the static version.
-     */
-    _tbind[TBIND_HOST].buffer = sqlb->host;
-    _tbind[TBIND_HOST].buffer_length = sqlb->host_len;
-
-    _tbind[TBIND_OID].buffer = sqlb->oid;
-    _tbind[TBIND_OID].buffer_length = sqlb->oid_len;
-
-    _tbind[TBIND_REQID].buffer = (void *)&sqlb->reqid;
-    _tbind[TBIND_VER].buffer = (void *)&sqlb->version;
-    _tbind[TBIND_TYPE].buffer = (void *)&sqlb->type;
-    _tbind[TBIND_SECURITY_MODEL].buffer = (void *)&sqlb->security_model;
-
-    _tbind[TBIND_DATE].buffer = (void *)&sqlb->time;
-
-    _tbind[TBIND_USER].buffer = sqlb->user;
-    _tbind[TBIND_USER].buffer_length = sqlb->user_len;
-
-    _tbind[TBIND_TRANSPORT].buffer = sqlb->transport;
-    if (sqlb->transport)
-        _tbind[TBIND_TRANSPORT].buffer_length = strlen(sqlb->transport);
-    else
-        _tbind[TBIND_TRANSPORT].buffer_length = 0;
-
+    DEBUGMSGTL(("sql:cleanup"," called\n"));
 
-    if ((SNMP_MP_MODEL_SNMPv3+1) == sqlb->version) {
-        _no_v3 = 0;
+    netsnmp_sql_writer_stop();
 
-        _tbind[TBIND_v3_MSGID].buffer = &sqlb->msgid;
-        
-        _tbind[TBIND_v3_SECURITY_LEVEL].buffer = &sqlb->security_level;
-        
-        _tbind[TBIND_v3_CONTEXT_NAME].buffer = sqlb->context;
-        _tbind[TBIND_v3_CONTEXT_NAME].buffer_length = sqlb->context_len;
+    /** unregister alarm */
+    if (_sql.alarm_id)
+        snmp_alarm_unregister(_sql.alarm_id);
 
-        _tbind[TBIND_v3_CONTEXT_ENGINE].buffer = sqlb->context_engine;
-        _tbind[TBIND_v3_CONTEXT_ENGINE].buffer_length =
-            sqlb->context_engine_len;
+    /** save any queued traps */
+    _sql_process_queue(0,NULL);
 
-        _tbind[TBIND_v3_SECURITY_NAME].buffer = sqlb->security_name;
-        _tbind[TBIND_v3_SECURITY_NAME].buffer_length = sqlb->security_name_len;
+    _sql.backend->cleanup();
+}
 
-        _tbind[TBIND_v3_SECURITY_ENGINE].buffer = sqlb->security_engine;
-        _tbind[TBIND_v3_SECURITY_ENGINE].buffer_length =
-            sqlb->security_engine_len;
-    }
-    else {
-        _no_v3 = 1;
-    }
+/** one-time initialization for sql logging */
+int
+netsnmp_sql_init(void)
+{
+    netsnmp_trapd_handler *traph;
 
-    if (mysql_stmt_bind_param(_sql.trap_stmt, _tbind) != 0) {
-        netsnmp_sql_stmt_error(_sql.trap_stmt,
-                               "Could not bind parameters for INSERT");
-        _sql_log(sqlb, NULL);
-        return;
-    }
+    DEBUGMSGTL(("sql:init","called\n"));
 
-    /** execute the prepared statement */
-    if (mysql_stmt_execute(_sql.trap_stmt) != 0) {
-        netsnmp_sql_stmt_error(_sql.trap_stmt,
-                               "Could not execute insert statement for trap");
-        _sql_log(sqlb, NULL);
-        return;
+    /** negative or 0 interval disables sql logging */
+    if (_sql.queue_interval <= 0) {
+        DEBUGMSGTL(("sql:init",
+                    "sql not enabled (sqlSaveInterval is <= 0)\n"));
+        return 0;
     }
-    trap_id = mysql_insert_id(_sql.conn);
 
-    /*
-     * iterate over the varbinds, copy data and insert
-     */
-    it = CONTAINER_ITERATOR(sqlb->varbinds);
-    if (NULL == it) {
-        snmp_log(LOG_ERR,"Could not allocate iterator\n");
-        _sql_log(sqlb, NULL);
-        return;
+    /** SQLite if configured, MySQL otherwise */
+#ifdef NETSNMP_USE_SQLITE
+    if (_sqlite_file)
+        _sql.backend = &_sqlite_backend;
+#endif
+#ifdef NETSNMP_USE_MYSQL
+    if (NULL == _sql.backend)
+        _sql.backend = &_mysql_backend;
+#endif
+    if (NULL == _sql.backend) {
+        snmp_log(LOG_ERR, "sqlSaveInterval set, but no sqliteDatabase\n");
+        return -1;
     }
+    DEBUGMSGTL(("sql:init","using %s\n", _sql.backend->name));
 
-    for( sqlvb = ITERATOR_FIRST(it); sqlvb; sqlvb = ITERATOR_NEXT(it)) {
+    if (_sql.backend->init() != 0)
+        return -1;
 
-        _vbind[VBIND_ID].buffer = (void *)&trap_id;
-        _vbind[VBIND_TYPE].buffer = (void *)&sqlvb->type;
+    /** try to connect; we'll try again later if we fail */
+    (void) _sql.backend->connect();
 
-        _vbind[VBIND_OID].buffer = sqlvb->oid;
-        _vbind[VBIND_OID].buffer_length = sqlvb->oid_len;
+    /** add handler */
+    traph = netsnmp_add_global_traphandler(NETSNMPTRAPD_PRE_HANDLER,
+                                           mysql_handler);
+    if (NULL == traph) {
+        snmp_log(LOG_ERR, "Could not allocate sql trap handler\n");
+        return -1;
+    }
+    traph->authtypes = TRAP_AUTH_LOG;
 
-        _vbind[VBIND_VAL].buffer = sqlvb->val;
-        _vbind[VBIND_VAL].buffer_length = sqlvb->val_len;
+    atexit(netsnmp_sql_cleanup);
+    return 0;
+}
 
-        if (mysql_stmt_bind_param(_sql.vb_stmt, _vbind) != 0) {
-            netsnmp_sql_stmt_error(_sql.vb_stmt,
-                                   "Could not bind parameters for INSERT");
-            _sql_log(sqlb, NULL);
-            break;
-        }
+/*
+ * Starts the writer thread, or falls back to saving the queue from an
+ * alarm.  Must be called after snmptrapd has forked into the background,
+ * and before the main loop takes the snmptrapd lock.
+ */
+void
+netsnmp_sql_writer_start(void)
+{
+    if (NULL == _sql.backend || _sql.alarm_id)
+        return;
 
-        if (mysql_stmt_execute(_sql.vb_stmt) != 0) {
-            netsnmp_sql_stmt_error(_sql.vb_stmt,
-                                   "Could not execute insert statement for varbind");
-            _sql_log(sqlb, NULL);
-            break;
+#ifdef NETSNMP_SQL_WRITER
+    if (!_sql_writer_running) {
+        _sql_writer_stopping = 0;
+        netsnmp_trapd_threads_started();
+        if (pthread_create(&_sql_writer, NULL, _sql_writer_main, NULL) == 0) {
+            _sql_writer_running = 1;
+            DEBUGMSGTL(("sql:init","started writer thread\n"));
+            return;
         }
+        netsnmp_trapd_threads_stopped();
+        snmp_log(LOG_ERR, "Could not start the sql writer thread\n");
     }
-    ITERATOR_RELEASE(it);
+    if (_sql_writer_running)
+        return;
+#endif
+
+    /** register periodic queue save */
+    _sql.alarm_id = snmp_alarm_register(_sql.queue_interval, /* seconds */
+                                        1,                   /* repeat */
+                                        _sql_process_queue,  /* function */
+                                        NULL);               /* client args */
 }
 
 /*
- * process (save) queued items to sql database.
- *
- * dontcare & meeither are dummy params so this function can be used
- * as a netsnmp_alarm callback function.
+ * Stops the writer thread once it has saved the queue.  Must be called
+ * without holding the snmptrapd lock.
  */
-static void
-_sql_process_queue(u_int dontcare, void *meeither)
+void
+netsnmp_sql_writer_stop(void)
 {
-    int        rc;
-
-    /** bail if the queue is empty */
-    if( 0 == CONTAINER_SIZE(_sql.queue))
+#ifdef NETSNMP_SQL_WRITER
+    if (!_sql_writer_running)
         return;
 
-    DEBUGMSGT(("sql:process", "processing %d queued traps\n",
-               (int)CONTAINER_SIZE(_sql.queue)));
-
-    /*
-     * if we don't have a database connection, try to reconnect. We
-     * don't care if we fail - traps will be logged in that case.
-     */
-    if (0 == _sql.connected) {
-        DEBUGMSGT(("sql:process", "no sql connection; reconnecting\n"));
-        (void) netsnmp_mysql_connect();
-    }
-
-    CONTAINER_FOR_EACH(_sql.queue, (netsnmp_container_obj_func*)_sql_save,
-                       NULL);
-
-    if (_sql.connected) {
-        rc = mysql_commit(_sql.conn);
-        if (rc) { /* nuts... now what? */
-            netsnmp_sql_error("commit failed");
-            CONTAINER_FOR_EACH(_sql.queue,
-                               (netsnmp_container_obj_func*)_sql_log,
-                               NULL);
-        }
-    }
+    SQL_QUEUE_LOCK();
+    _sql_writer_stopping = 1;
+    pthread_cond_signal(&_sql_queue_cond);
+    SQL_QUEUE_UNLOCK();
 
-    CONTAINER_CLEAR(_sql.queue, (netsnmp_container_obj_func*)_sql_buf_free,
-                    NULL);
+    pthread_join(_sql_writer, NULL);
+    _sql_writer_running = 0;
+    netsnmp_trapd_threads_stopped();
+    DEBUGMSGTL(("sql:init","stopped writer thread\n"));
+#endif
 }
 
 #else
 int unused;	/* Suppress "empty translation unit" warning */
-#endif /* NETSNMP_USE_MYSQL */
+#endif /* NETSNMP_TRAPD_SQL */
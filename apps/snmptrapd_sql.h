@@ -1,2 +1,13 @@
+#ifndef SNMPTRAPD_SQL_H
+#define SNMPTRAPD_SQL_H
+
+#if defined(NETSNMP_USE_MYSQL) || defined(NETSNMP_USE_SQLITE)
+#define NETSNMP_TRAPD_SQL 1
+#endif
+
 void snmptrapd_register_sql_configs(void);
-int netsnmp_mysql_init(void);
+int netsnmp_sql_init(void);
+void netsnmp_sql_writer_start(void);
+void netsnmp_sql_writer_stop(void);
+
+#endif                          /* SNMPTRAPD_SQL_H */
@@ -0,0 +1,406 @@
+/*
+ * snmptrapd_workers.c - run notification handlers on worker threads
+ *
+ * By default snmptrapd runs every handler of a notification on the thread
+ * that receives it, so a slow handler (typically a traphandle program)
+ * keeps it from reading the next one, and notifications are lost once the
+ * socket buffer fills up.  With "workerThreads N" set, snmp_input() only
+ * queues a copy of each notification, and a pool of N threads runs the
+ * handlers and answers INFORMs.  The queue is bounded ("workerQueueLength");
+ * notifications arriving while it is full are dropped and counted.
+ *
+ * The library and the handlers are not reentrant, so all threads share one
+ * lock (netsnmp_trapd_lock()), handed out in FIFO order.  The main thread
+ * only releases it while waiting in select(), the workers hold it while
+ * running handlers, and the traphandle command_handler() releases it
+ * while the external program runs, which is where the time goes.
+ * So this is one receiving thread feeding a pool of handler threads, not
+ * a pipeline of separately locked stages: authentication, formatting and
+ * the built-in handlers still take turns under the one lock, and only
+ * overlap with the work done while it is released (external programs,
+ * SQL statements).
+ */
+#include <net-snmp/net-snmp-config.h>
+
+#if HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#include <sys/types.h>
+#include <stdio.h>
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+#include <net-snmp/net-snmp-includes.h>
+#include "snmptrapd_handlers.h"
+#include "snmptrapd_workers.h"
+
+#ifdef HAVE_PTHREAD_H
+#define NETSNMP_TRAPD_WORKERS 1
+#endif
+
+/** Upper limit for the workerThreads token. */
+#define TRAPD_WORKERS_MAX 64
+
+static int      workers_wanted;
+static int      workers_queue_length = 1000;
+static int      workers_stats_interval;
+
+static void
+parse_workerThreads(const char *token, char *cptr)
+{
+    int             n = atoi(cptr);
+
+    if (n < 0 || n > TRAPD_WORKERS_MAX) {
+        netsnmp_config_error("%s must be between 0 and %d", token,
+                             TRAPD_WORKERS_MAX);
+        return;
+    }
+    workers_wanted = n;
+}
+
+static void
+parse_workerQueueLength(const char *token, char *cptr)
+{
+    int             n = atoi(cptr);
+
+    if (n <= 0) {
+        netsnmp_config_error("%s must be positive", token);
+        return;
+    }
+    workers_queue_length = n;
+}
+
+static void
+parse_workerStatsInterval(const char *token, char *cptr)
+{
+    int             n = atoi(cptr);
+
+    if (n < 0) {
+        netsnmp_config_error("%s must not be negative", token);
+        return;
+    }
+    workers_stats_interval = n;
+}
+
+void
+snmptrapd_register_workers_configs(void)
+{
+    register_config_handler("snmptrapd", "workerThreads",
+                            parse_workerThreads, NULL, "count");
+    register_config_handler("snmptrapd", "workerQueueLength",
+                            parse_workerQueueLength, NULL, "count");
+    register_config_handler("snmptrapd", "workerStatsInterval",
+                            parse_workerStatsInterval, NULL, "seconds");
+}
+
+#ifdef NETSNMP_TRAPD_WORKERS
+
+typedef struct trapd_worker_job_s {
+    netsnmp_session   *session;
+    netsnmp_pdu       *pdu;
+    netsnmp_transport *transport;
+    struct trapd_worker_job_s *next;
+} trapd_worker_job;
+
+/* the big lock: a ticket lock, so that no thread can starve the others */
+static pthread_mutex_t trapd_lock_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  trapd_lock_cond = PTHREAD_COND_INITIALIZER;
+static u_long          trapd_lock_next, trapd_lock_serving;
+static int             trapd_locking;   /* helper threads running */
+static int             trapd_lock_ticket_held; /* holder took a ticket */
+
+/* the queue between the receiving thread and the workers */
+static pthread_mutex_t workers_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  workers_cond = PTHREAD_COND_INITIALIZER;
+static trapd_worker_job *workers_head, *workers_tail;
+static int             workers_stopping;
+
+static pthread_t      *workers;
+static int             workers_count;
+static unsigned int    workers_stats_alarm;
+static netsnmp_trapd_workers_stats workers_stats;
+
+static void *
+_worker_main(void *arg)
+{
+    trapd_worker_job *job;
+
+    pthread_mutex_lock(&workers_lock);
+    for (;;) {
+        while (!workers_stopping && !workers_head)
+            pthread_cond_wait(&workers_cond, &workers_lock);
+        /* finish what is queued before stopping */
+        if (!workers_head)
+            break;
+
+        job = workers_head;
+        workers_head = job->next;
+        if (!workers_head)
+            workers_tail = NULL;
+        workers_stats.queued--;
+        workers_stats.busy++;
+        pthread_mutex_unlock(&workers_lock);
+
+        netsnmp_trapd_lock();
+        netsnmp_trapd_handle_pdu(job->session, job->pdu, job->transport);
+        snmp_free_pdu(job->pdu);
+        netsnmp_trapd_unlock();
+        free(job);
+
+        pthread_mutex_lock(&workers_lock);
+        workers_stats.busy--;
+        workers_stats.handled++;
+    }
+    pthread_mutex_unlock(&workers_lock);
+    return NULL;
+}
+
+static void
+_workers_log_stats(unsigned int clientreg, void *clientarg)
+{
+    netsnmp_trapd_workers_stats stats;
+
+    netsnmp_trapd_workers_get_stats(&stats);
+    snmp_log(LOG_INFO, "snmptrapd workers: %lu received, %lu dropped, "
+             "%lu handled, %u queued (%u max), %u of %u busy\n",
+             stats.received, stats.dropped, stats.handled, stats.queued,
+             stats.queued_max, stats.busy, stats.workers);
+}
+
+#endif /* NETSNMP_TRAPD_WORKERS */
+
+/** Starts the worker threads, if "workerThreads" asks for any.  Must be
+ *  called after snmptrapd has forked into the background, and before
+ *  the main loop takes the big lock.
+ */
+void
+netsnmp_trapd_workers_init(void)
+{
+#ifdef NETSNMP_TRAPD_WORKERS
+    int             i;
+
+    if (workers_count || workers_wanted <= 0)
+        return;
+
+    workers = calloc(workers_wanted, sizeof(*workers));
+    if (!workers)
+        return;
+
+    netsnmp_trapd_threads_started();
+    workers_stopping = 0;
+    for (i = 0; i < workers_wanted; i++) {
+        if (pthread_create(&workers[i], NULL, _worker_main, NULL) != 0) {
+            snmp_log(LOG_ERR, "snmptrapd workers: could not start thread %d\n",
+                     i);
+            break;
+        }
+        workers_count++;
+    }
+    if (workers_count == 0) {
+        netsnmp_trapd_threads_stopped();
+        SNMP_FREE(workers);
+        return;
+    }
+    workers_stats.workers = workers_count;
+
+    if (workers_stats_interval > 0)
+        workers_stats_alarm = snmp_alarm_register(workers_stats_interval,
+                                                  SA_REPEAT,
+                                                  _workers_log_stats, NULL);
+    DEBUGMSGTL(("snmptrapd:workers", "started %d worker threads\n",
+                workers_count));
+#else
+    if (workers_wanted > 0)
+        snmp_log(LOG_WARNING,
+                 "workerThreads ignored: no thread support available\n");
+#endif /* NETSNMP_TRAPD_WORKERS */
+}
+
+/** Stops the worker threads once they have handled every queued
+ *  notification.  Must be called without holding the big lock.
+ */
+void
+netsnmp_trapd_workers_shutdown(void)
+{
+#ifdef NETSNMP_TRAPD_WORKERS
+    int             i;
+
+    if (!workers_count)
+        return;
+
+    if (workers_stats_alarm) {
+        snmp_alarm_unregister(workers_stats_alarm);
+        workers_stats_alarm = 0;
+    }
+
+    pthread_mutex_lock(&workers_lock);
+    workers_stopping = 1;
+    pthread_cond_broadcast(&workers_cond);
+    pthread_mutex_unlock(&workers_lock);
+
+    for (i = 0; i < workers_count; i++)
+        pthread_join(workers[i], NULL);
+    SNMP_FREE(workers);
+    workers_count = 0;
+    workers_stats.workers = 0;
+    netsnmp_trapd_threads_stopped();
+    DEBUGMSGTL(("snmptrapd:workers", "stopped worker threads\n"));
+#endif /* NETSNMP_TRAPD_WORKERS */
+}
+
+/** Returns non-zero if notifications are handled by worker threads. */
+int
+netsnmp_trapd_workers_active(void)
+{
+#ifdef NETSNMP_TRAPD_WORKERS
+    return workers_count > 0;
+#else
+    return 0;
+#endif
+}
+
+/** Queues a notification for the worker threads.
+ *
+ *  @param session   The session the notification was received on.
+ *
+ *  @param pdu       The notification; it is copied, the caller keeps it.
+ *
+ *  @param transport The transport the notification was received on.
+ *
+ *  @return 1 if the notification was queued or dropped because the queue
+ *          was full, 0 if the caller has to run the handlers itself.
+ */
+int
+netsnmp_trapd_workers_dispatch(netsnmp_session *session, netsnmp_pdu *pdu,
+                               netsnmp_transport *transport)
+{
+#ifdef NETSNMP_TRAPD_WORKERS
+    trapd_worker_job *job;
+
+    if (!workers_count)
+        return 0;
+
+    pthread_mutex_lock(&workers_lock);
+    workers_stats.received++;
+    if (workers_stats.queued >= (u_int) workers_queue_length) {
+        workers_stats.dropped++;
+        pthread_mutex_unlock(&workers_lock);
+        DEBUGMSGTL(("snmptrapd:workers", "queue full, dropping PDU\n"));
+        return 1;
+    }
+    pthread_mutex_unlock(&workers_lock);
+
+    job = SNMP_MALLOC_TYPEDEF(trapd_worker_job);
+    if (job)
+        job->pdu = snmp_clone_pdu(pdu);
+    if (!job || !job->pdu) {
+        snmp_log(LOG_ERR, "snmptrapd workers: couldn't queue PDU\n");
+        free(job);
+        pthread_mutex_lock(&workers_lock);
+        workers_stats.dropped++;
+        pthread_mutex_unlock(&workers_lock);
+        return 1;
+    }
+    job->session = session;
+    job->transport = transport;
+
+    pthread_mutex_lock(&workers_lock);
+    if (workers_tail)
+        workers_tail->next = job;
+    else
+        workers_head = job;
+    workers_tail = job;
+    if (++workers_stats.queued > workers_stats.queued_max)
+        workers_stats.queued_max = workers_stats.queued;
+    pthread_cond_signal(&workers_cond);
+    pthread_mutex_unlock(&workers_lock);
+    return 1;
+#else
+    return 0;
+#endif /* NETSNMP_TRAPD_WORKERS */
+}
+
+/** Copies the current pipeline counters to stats. */
+void
+netsnmp_trapd_workers_get_stats(netsnmp_trapd_workers_stats *stats)
+{
+#ifdef NETSNMP_TRAPD_WORKERS
+    pthread_mutex_lock(&workers_lock);
+    *stats = workers_stats;
+    pthread_mutex_unlock(&workers_lock);
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+/** Enables the big lock for a thread about to be started besides the main
+ *  thread, such as a worker or the SQL writer.  Must be called before the
+ *  main loop takes the lock.
+ */
+void
+netsnmp_trapd_threads_started(void)
+{
+#ifdef NETSNMP_TRAPD_WORKERS
+    pthread_mutex_lock(&trapd_lock_mutex);
+    trapd_locking++;
+    pthread_mutex_unlock(&trapd_lock_mutex);
+#endif
+}
+
+/** Undoes netsnmp_trapd_threads_started() once that thread has exited. */
+void
+netsnmp_trapd_threads_stopped(void)
+{
+#ifdef NETSNMP_TRAPD_WORKERS
+    pthread_mutex_lock(&trapd_lock_mutex);
+    if (trapd_locking > 0)
+        trapd_locking--;
+    pthread_mutex_unlock(&trapd_lock_mutex);
+#endif
+}
+
+/** Takes the lock serializing all use of the library and of the handler
+ *  lists while worker or writer threads are running; does nothing
+ *  otherwise.
+ *
+ *  Whether to take a ticket is decided once, under the mutex, and noted
+ *  for netsnmp_trapd_unlock(): a thread stopping while the lock is held
+ *  must not keep the holder from handing it on.
+ */
+void
+netsnmp_trapd_lock(void)
+{
+#ifdef NETSNMP_TRAPD_WORKERS
+    u_long          ticket;
+
+    pthread_mutex_lock(&trapd_lock_mutex);
+    if (trapd_locking) {
+        ticket = trapd_lock_next++;
+        while (ticket != trapd_lock_serving)
+            pthread_cond_wait(&trapd_lock_cond, &trapd_lock_mutex);
+        trapd_lock_ticket_held = 1;
+    }
+    pthread_mutex_unlock(&trapd_lock_mutex);
+#endif
+}
+
+/** Releases the lock taken by netsnmp_trapd_lock(). */
+void
+netsnmp_trapd_unlock(void)
+{
+#ifdef NETSNMP_TRAPD_WORKERS
+    pthread_mutex_lock(&trapd_lock_mutex);
+    if (trapd_lock_ticket_held) {
+        trapd_lock_ticket_held = 0;
+        trapd_lock_serving++;
+        pthread_cond_broadcast(&trapd_lock_cond);
+    }
+    pthread_mutex_unlock(&trapd_lock_mutex);
+#endif
+}
@@ -0,0 +1,31 @@
+#ifndef SNMPTRAPD_WORKERS_H
+#define SNMPTRAPD_WORKERS_H
+
+/*
+ * Counters of the notification pipeline, see
+ * netsnmp_trapd_workers_get_stats().
+ */
+typedef struct netsnmp_trapd_workers_stats_s {
+    u_long  received;   /* notifications handed to the pipeline */
+    u_long  dropped;    /* ... dropped because the queue was full */
+    u_long  handled;    /* ... the handlers have been run for */
+    u_int   queued;     /* notifications waiting for a worker */
+    u_int   queued_max; /* largest number ever waiting */
+    u_int   busy;       /* workers running handlers */
+    u_int   workers;    /* worker threads */
+} netsnmp_trapd_workers_stats;
+
+void snmptrapd_register_workers_configs(void);
+void netsnmp_trapd_workers_init(void);
+void netsnmp_trapd_workers_shutdown(void);
+int  netsnmp_trapd_workers_active(void);
+int  netsnmp_trapd_workers_dispatch(netsnmp_session *session,
+                                    netsnmp_pdu *pdu,
+                                    netsnmp_transport *transport);
+void netsnmp_trapd_workers_get_stats(netsnmp_trapd_workers_stats *stats);
+void netsnmp_trapd_threads_started(void);
+void netsnmp_trapd_threads_stopped(void);
+void netsnmp_trapd_lock(void);
+void netsnmp_trapd_unlock(void);
+
+#endif                          /* SNMPTRAPD_WORKERS_H */
@@ -0,0 +1,30 @@
+#ifndef AGENT_WORKERS_H
+#define AGENT_WORKERS_H
+
+/*
+ * Optional pool of worker threads for calling handlers registered with
+ * HANDLER_CAN_THREADSAFE.  Requests handed to a worker are marked as
+ * delegated, and the main thread picks up the results through the normal
+ * delegated request processing once the worker has finished.
+ */
+
+#ifdef __cplusplus
+extern          "C" {
+#endif
+
+    void            netsnmp_agent_workers_init(void);
+    void            netsnmp_agent_workers_shutdown(void);
+    int             netsnmp_agent_workers_active(void);
+    int             netsnmp_agent_workers_dispatch(netsnmp_handler_registration
+                                                   *reginfo,
+                                                   netsnmp_agent_request_info
+                                                   *reqinfo,
+                                                   netsnmp_request_info
+                                                   *requests);
+    void            netsnmp_agent_workers_cancel(netsnmp_agent_session *asp);
+    void            netsnmp_agent_workers_drain(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif                          /* AGENT_WORKERS_H */
@@ -29,6 +29,7 @@ extern          "C" {
 #include <net-snmp/agent/table_tdata.h>
 #include <net-snmp/agent/table_iterator.h>
 #include <net-snmp/agent/table_container.h>
+#include <net-snmp/agent/table_cursor.h>
 #include <net-snmp/agent/table_array.h> 
 
 #include <net-snmp/agent/mfd.h>
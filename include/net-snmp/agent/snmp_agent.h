@@ -216,6 +216,10 @@ extern          "C" {
         netsnmp_cachemap *cache_store;
         int             vbcount;
         int             flags;
+        /*
+         * memory that is released together with the session
+         */
+        netsnmp_arena  *arena;
     } netsnmp_agent_session;
 
     /*
@@ -329,6 +333,12 @@ extern          "C" {
     void
         netsnmp_free_agent_request_info(netsnmp_agent_request_info *ari);
 
+    netsnmp_arena  *netsnmp_agent_arena(netsnmp_agent_request_info *ari);
+    netsnmp_data_list *
+        netsnmp_agent_create_list_data(netsnmp_agent_request_info *ari,
+                                       const char *name, void *data,
+                                       Netsnmp_Free_List_Data *beer);
+
 
 #ifndef NETSNMP_NO_PDU_STATS
     /*
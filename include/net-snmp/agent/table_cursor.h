@@ -0,0 +1,142 @@
+/*
+ * table_cursor.h
+ */
+#ifndef _TABLE_CURSOR_HANDLER_H_
+#define _TABLE_CURSOR_HANDLER_H_
+
+#ifdef __cplusplus
+extern          "C" {
+#endif
+
+    /*
+     * The table cursor helper serves GET and GETNEXT for tables too
+     * large to keep in a container.  Instead of loading every row when a
+     * cache expires, it asks the module for a page of rows: the rows
+     * following a given index, in index order, up to a maximum count.
+     * A few recently used pages are kept, so the GETNEXTs of a walk or
+     * of a GETBULK are answered from the page that holds the previous
+     * row, and memory only depends on the page sizes.
+     *
+     * Rows must start with a netsnmp_index, as for the table_container
+     * helper, and are handed to sub-handlers the same way: retrieve them
+     * with netsnmp_table_cursor_row_extract().
+     */
+
+#include <net-snmp/library/container.h>
+#include <net-snmp/agent/table.h>
+
+#define TABLE_CURSOR_ROW       "table_cursor:row"
+
+    typedef struct netsnmp_table_cursor_s netsnmp_table_cursor;
+    typedef struct netsnmp_table_cursor_page_s netsnmp_table_cursor_page;
+
+    /*
+     * Fill page with netsnmp_table_cursor_page_add().  Rows may be added
+     * in any order; the page keeps the smallest ones following its start
+     * and frees the others.  A source that produces rows in index order
+     * may stop as soon as netsnmp_table_cursor_page_done() returns 1.
+     * Return 0 on success.
+     */
+    typedef int (Netsnmp_Table_Cursor_Fetch)(netsnmp_table_cursor *cursor,
+                                             netsnmp_table_cursor_page *page);
+    typedef void (Netsnmp_Table_Cursor_Free)(void *row, void *magic);
+    /*
+     * turns an entry inserted in a page sink into a row, or returns NULL
+     * to skip it.  It owns the entry.
+     */
+    typedef void *(Netsnmp_Table_Cursor_Convert)(void *entry, void *magic);
+
+    struct netsnmp_table_cursor_s {
+        Netsnmp_Table_Cursor_Fetch *fetch;
+        Netsnmp_Table_Cursor_Free  *free_row;
+        void           *magic;
+
+        /** rows in the first page of a walk */
+        size_t          page_rows;
+        /** pages grow up to this while a walk continues from page to page */
+        size_t          max_page_rows;
+        /** pages kept once a request is done */
+        int             max_pages;
+        /** seconds before a page must be fetched again */
+        int             timeout;
+
+        /** rows seen by the last fetch, i.e. the size of the table */
+        size_t          size;
+        /** number of fetches, for statistics */
+        u_long          fetches;
+
+        /*
+         * private
+         */
+        netsnmp_table_cursor_page *pages;       /* most recently used first */
+        int             npages;
+        int             pinned;
+    };
+
+/* ====================================
+ * Table Cursor API: MIB maintenance
+ * ==================================== */
+
+    netsnmp_table_cursor *
+    netsnmp_table_cursor_create(Netsnmp_Table_Cursor_Fetch *fetch,
+                                Netsnmp_Table_Cursor_Free *free_row,
+                                void *magic);
+    void    netsnmp_table_cursor_free(netsnmp_table_cursor *cursor);
+    /** forget all pages, e.g. because the data changed */
+    void    netsnmp_table_cursor_invalidate(netsnmp_table_cursor *cursor);
+
+    netsnmp_mib_handler *
+    netsnmp_table_cursor_handler_get(netsnmp_table_registration_info *tabreq,
+                                     netsnmp_table_cursor *cursor);
+    int
+    netsnmp_table_cursor_register(netsnmp_handler_registration *reginfo,
+                                  netsnmp_table_registration_info *tabreq,
+                                  netsnmp_table_cursor *cursor);
+
+    /** find the row found by the table_cursor helper for a request */
+    void   *netsnmp_table_cursor_row_extract(netsnmp_request_info *request);
+
+/* ===================================
+ * Table Cursor API: Row operations
+ * =================================== */
+
+    /*
+     * Find the row with index (next == 0) or the first one after it
+     * (next != 0; a NULL index means the first row).  The row is valid
+     * until the next call for this cursor.
+     */
+    void   *netsnmp_table_cursor_find(netsnmp_table_cursor *cursor,
+                                      const netsnmp_index *index, int next);
+
+/* ===================================
+ * Table Cursor API: Page filling
+ * =================================== */
+
+    /** add a row to a page, which owns it from now on. 0 if it was kept */
+    int     netsnmp_table_cursor_page_add(netsnmp_table_cursor_page *page,
+                                          void *row);
+    /** 1 once the page is full and a row after its last one was seen */
+    int     netsnmp_table_cursor_page_done(netsnmp_table_cursor_page *page);
+    /*
+     * 1 if the page would not keep a row with index, which then counts as
+     * added, so the source need not build it.  Otherwise build the row and
+     * add it.
+     */
+    int     netsnmp_table_cursor_page_skip(netsnmp_table_cursor_page *page,
+                                           const netsnmp_index *index);
+
+    /*
+     * A container whose insert converts the entry and adds it to page,
+     * for data access functions which load a container.  Free it with
+     * CONTAINER_FREE().
+     */
+    netsnmp_container *
+    netsnmp_table_cursor_page_sink(netsnmp_table_cursor_page *page,
+                                   Netsnmp_Table_Cursor_Convert *convert,
+                                   void *magic);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif                          /* _TABLE_CURSOR_HANDLER_H_ */
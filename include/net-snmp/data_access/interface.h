@@ -250,6 +250,31 @@ void netsnmp_access_interface_container_free(netsnmp_container *container,
 #define NETSNMP_ACCESS_INTERFACE_FREE_NOFLAGS               0x0000
 #define NETSNMP_ACCESS_INTERFACE_FREE_DONT_CLEAR            0x0001
 
+/*
+ * load a single interface, or just refresh the statistics of an entry.
+ * Only supported where the interface events below are; the load returns
+ * NULL and the refresh -1 elsewhere.
+ */
+netsnmp_interface_entry *
+netsnmp_access_interface_entry_load(oid if_index, u_int load_flags);
+int netsnmp_access_interface_entry_stats_refresh(netsnmp_interface_entry *entry);
+
+/*
+ * interface change events (linux netlink). The callback is called from
+ * the agent's main loop with the ifIndex of an interface that was added,
+ * changed or removed, or with an ifIndex of 0 and EVENT_OVERFLOW when
+ * events were lost and everything should be reloaded.
+ */
+typedef void (netsnmp_access_interface_event_cb)(oid if_index, int event,
+                                                 void *ctx);
+#define NETSNMP_ACCESS_INTERFACE_EVENT_CHANGED              1
+#define NETSNMP_ACCESS_INTERFACE_EVENT_REMOVED              2
+#define NETSNMP_ACCESS_INTERFACE_EVENT_OVERFLOW             3
+
+int netsnmp_access_interface_events_register(netsnmp_access_interface_event_cb
+                                             *cb, void *ctx);
+void netsnmp_access_interface_events_unregister(void);
+
 
 /*
  * create/free an ifentry
@@ -288,6 +313,12 @@ const char *netsnmp_access_interface_name_find(oid index);
  */
 int netsnmp_access_interface_entry_copy(netsnmp_interface_entry * lhs,
                                         netsnmp_interface_entry * rhs);
+int netsnmp_access_interface_entry_update_stats(netsnmp_interface_entry *
+                                                prev_vals,
+                                                netsnmp_interface_entry *
+                                                new_vals);
+int netsnmp_access_interface_entry_calculate_stats(netsnmp_interface_entry *
+                                                   entry);
 
 /*
  * utility routines
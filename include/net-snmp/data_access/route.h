@@ -32,6 +32,7 @@ typedef struct netsnmp_route_s {
 
    int       flags; /* for net-snmp use */
 
+   unsigned  generation;
    oid       if_index;
 
     /*
@@ -119,11 +120,47 @@ int
 netsnmp_access_route_entry_copy(netsnmp_route_entry *lhs,
                                 netsnmp_route_entry *rhs);
 
+void
+netsnmp_access_route_entry_update(netsnmp_route_entry *lhs,
+                                  const netsnmp_route_entry *rhs);
+
 /*
  * find entry in container
  */
 /** not yet */
 
+/*
+ * keep a table's container in sync with the kernel route table
+ */
+struct netsnmp_route_access_s;
+typedef struct netsnmp_route_access_s netsnmp_route_access;
+
+typedef void (NetsnmpAccessRouteUpdate)(netsnmp_route_access *,
+                                        netsnmp_route_entry *);
+typedef void (NetsnmpAccessRouteGC)    (netsnmp_route_access *);
+
+struct netsnmp_route_access_s {
+    void *magic;
+    void *arch_magic;
+    int synchronized;
+    unsigned generation;
+    u_int load_flags;
+    NetsnmpAccessRouteUpdate *update_hook;
+    NetsnmpAccessRouteGC *gc_hook;
+    char *cache_expired;
+};
+
+netsnmp_route_access *
+netsnmp_access_route_create(u_int load_flags,
+                            NetsnmpAccessRouteUpdate *update_hook,
+                            NetsnmpAccessRouteGC *gc_hook,
+                            int *cache_timeout, int *cache_flags,
+                            char *cache_expired);
+
+int netsnmp_access_route_delete(netsnmp_route_access *access);
+int netsnmp_access_route_load(netsnmp_route_access *access);
+int netsnmp_access_route_unload(netsnmp_route_access *access);
+
 /*
  * create/change/delete
  */
@@ -141,6 +178,8 @@ netsnmp_access_route_entry_set(netsnmp_route_entry * entry);
 #define NETSNMP_ACCESS_ROUTE_CHANGE                         0x20000000
 #define NETSNMP_ACCESS_ROUTE_POLICY_STATIC                  0x10000000
 #define NETSNMP_ACCESS_ROUTE_POLICY_DEEP_COPY               0x08000000
+#define NETSNMP_ACCESS_ROUTE_ENTRY_FLAG_DELETE              0x04000000
+#define NETSNMP_ACCESS_ROUTE_ENTRY_FLAG_REPLACE             0x02000000
 
 /* 
  * mask for change flag bits
@@ -51,9 +51,21 @@ extern "C" {
          */
         int32_t         hrSWRunPerfCPU;
         int32_t         hrSWRunPerfMem;
+
+        /*
+         * attributes not read yet, see netsnmp_swrun_entry_refresh()
+         */
+        u_char          stale;
+        struct timeval  refreshed;  /* when hrSWRunStatus/Perf were read */
         
     } netsnmp_swrun_entry;
 
+    /*
+     * bits for stale
+     */
+#define NETSNMP_SWRUN_STALE_CMDLINE     0x01 /* path, parameters and type */
+#define NETSNMP_SWRUN_STALE_STAT        0x02 /* status and perf values */
+
     /*
      * enums for column hrSWRunType
      */
@@ -84,6 +96,7 @@ extern "C" {
     netsnmp_swrun_entry_create(int32_t swIndex);
 
     void netsnmp_swrun_entry_free(netsnmp_swrun_entry *entry);
+    void netsnmp_swrun_entry_refresh(netsnmp_swrun_entry *entry, u_char what);
 
     int  swrun_count_processes( int include_kthreads );
     int  swrun_max_processes(   void );
@@ -64,6 +64,8 @@ extern          "C" {
     netsnmp_access_udp_endpoint_container_load(netsnmp_container* c,
                                           u_int load_flags);
 #define NETSNMP_ACCESS_UDP_ENDPOINT_LOAD_NOFLAGS               0x0000
+#define NETSNMP_ACCESS_UDP_ENDPOINT_LOAD_NO_SOCK_DIAG          0x0001
+#define NETSNMP_ACCESS_UDP_ENDPOINT_LOAD_NO_PID                0x0002
 
     void netsnmp_access_udp_endpoint_container_free(netsnmp_container *c,
                                                u_int free_flags);
@@ -80,6 +82,13 @@ extern          "C" {
 
     void netsnmp_access_udp_endpoint_entry_free(netsnmp_udp_endpoint_entry *e);
 
+    /*
+     * pid of the process owning the endpoint with instance, for entries
+     * loaded with NETSNMP_ACCESS_UDP_ENDPOINT_LOAD_NO_PID. The processes
+     * are scanned again if refresh is set.
+     */
+    u_int netsnmp_access_udp_endpoint_pid(u_int instance, int refresh);
+
 /*
  * update/compare
  */
@@ -0,0 +1,61 @@
+/*
+ * arena.h: a bump allocator for data that is released all at once.
+ *
+ * Memory is handed out from large chunks and is only given back when the
+ * whole arena is reset or freed.  There is no locking; an arena must only
+ * be used by one thread at a time.
+ */
+#ifndef NETSNMP_ARENA_H
+#define NETSNMP_ARENA_H
+
+#ifdef __cplusplus
+extern          "C" {
+#endif
+
+    typedef struct netsnmp_arena_s netsnmp_arena;
+
+    /*
+     * Create an arena whose chunks hold chunk_size bytes (a default size is
+     * used for 0).  Larger requests get a chunk of their own.
+     */
+    NETSNMP_IMPORT
+    netsnmp_arena  *netsnmp_arena_create(size_t chunk_size);
+    NETSNMP_IMPORT
+    void            netsnmp_arena_free(netsnmp_arena *arena);
+
+    /*
+     * Release everything allocated from the arena, but keep its first
+     * chunk for reuse.
+     */
+    NETSNMP_IMPORT
+    void            netsnmp_arena_reset(netsnmp_arena *arena);
+
+    /*
+     * Returns size bytes of zeroed memory, suitably aligned for any type,
+     * or NULL if memory is exhausted.
+     */
+    NETSNMP_IMPORT
+    void           *netsnmp_arena_alloc(netsnmp_arena *arena, size_t size);
+    NETSNMP_IMPORT
+    char           *netsnmp_arena_strdup(netsnmp_arena *arena, const char *s);
+
+    /*
+     * Move all memory of src into dst and free src, so that memory that was
+     * allocated from src lives as long as dst.
+     */
+    NETSNMP_IMPORT
+    void            netsnmp_arena_adopt(netsnmp_arena *dst, netsnmp_arena *src);
+
+    /*
+     * Report how many allocations the arena served, and how many chunks it
+     * had to take from malloc() for them, since it was created or last
+     * reset.
+     */
+    NETSNMP_IMPORT
+    void            netsnmp_arena_stats(const netsnmp_arena *arena,
+                                        size_t *allocs, size_t *chunks);
+
+#ifdef __cplusplus
+}
+#endif
+#endif                          /* NETSNMP_ARENA_H */
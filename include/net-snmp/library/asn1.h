@@ -209,6 +209,9 @@ SOFTWARE.
     u_char         *asn_parse_string(u_char *, size_t *, u_char *,
                                      u_char *, size_t *);
     NETSNMP_IMPORT
+    u_char         *asn_parse_string_ptr(u_char *, size_t *, u_char *,
+                                         u_char **, size_t *);
+    NETSNMP_IMPORT
     u_char         *asn_build_string(u_char *, size_t *, u_char,
                                      const u_char *, size_t);
     NETSNMP_IMPORT
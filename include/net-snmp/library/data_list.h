@@ -35,6 +35,7 @@ extern          "C" {
 
 #include <net-snmp/library/snmp_impl.h>
 #include <net-snmp/library/tools.h>
+#include <net-snmp/library/arena.h>
 
     typedef void    (Netsnmp_Free_List_Data) (void *);
     typedef int     (Netsnmp_Save_List_Data) (char *buf, size_t buf_len, void *);
@@ -64,6 +65,10 @@ extern          "C" {
     NETSNMP_IMPORT
     netsnmp_data_list *
       netsnmp_create_data_list(const char *, void *, Netsnmp_Free_List_Data* );
+    NETSNMP_IMPORT
+    netsnmp_data_list *
+      netsnmp_create_data_list_arena(netsnmp_arena *arena, const char *,
+                                     void *, Netsnmp_Free_List_Data *);
     void            netsnmp_data_list_add_node(netsnmp_data_list **head,
                                                netsnmp_data_list *node);
     netsnmp_data_list *
@@ -0,0 +1,76 @@
+/*
+ * event_loop.h: wait for and dispatch activity on the library sessions and
+ * on the file descriptors registered with the fd event manager.
+ *
+ * Where epoll is available the event loop keeps a persistent epoll interest
+ * set that is only updated for the session that is opened or closed or the
+ * file descriptor that is (un)registered, instead of rebuilding select()
+ * file descriptor sets on every iteration.  Elsewhere it falls back to
+ * snmp_select_info2() and select().
+ */
+#ifndef NETSNMP_EVENT_LOOP_H
+#define NETSNMP_EVENT_LOOP_H
+
+#ifdef __cplusplus
+extern          "C" {
+#endif
+
+    struct session_list;
+
+    typedef struct netsnmp_event_loop_s netsnmp_event_loop;
+
+    /*
+     * Create an event loop.  flags is either NETSNMP_SELECT_NOFLAGS or
+     * NETSNMP_SELECT_NOALARMS; with the latter, alarms are neither taken
+     * into account for the timeout nor run.
+     */
+    NETSNMP_IMPORT
+    netsnmp_event_loop *netsnmp_event_loop_create(int flags);
+    NETSNMP_IMPORT
+    void            netsnmp_event_loop_free(netsnmp_event_loop *loop);
+
+    /*
+     * Returns the name of the mechanism used to wait for activity, i.e.
+     * "epoll" or "select".
+     */
+    NETSNMP_IMPORT
+    const char     *netsnmp_event_loop_backend(netsnmp_event_loop *loop);
+
+    /*
+     * Wait for activity for at most *timeout (forever if timeout is NULL,
+     * unless a request or alarm is due earlier), then read from the
+     * sessions that are ready, call the callbacks of the external file
+     * descriptors that are ready, process request timeouts and run alarms.
+     *
+     * Returns the number of file descriptors that had activity, 0 on
+     * timeout or -1 on error (with errno set).
+     */
+    NETSNMP_IMPORT
+    int             netsnmp_event_loop_run_once(netsnmp_event_loop *loop,
+                                                struct timeval *timeout);
+
+    /*
+     * The two halves of netsnmp_event_loop_run_once(), for applications
+     * that release a lock of their own while waiting: wait() returns what
+     * run_once() returns, and dispatch() handles what wait() found.
+     */
+    NETSNMP_IMPORT
+    int             netsnmp_event_loop_wait(netsnmp_event_loop *loop,
+                                            struct timeval *timeout);
+    NETSNMP_IMPORT
+    void            netsnmp_event_loop_dispatch(netsnmp_event_loop *loop);
+
+    /*
+     * Called by the library when a session is added to or removed from
+     * the session list and when an fd event manager registration for fd
+     * changes.
+     */
+    void            netsnmp_event_loop_session_added(struct session_list *slp);
+    void            netsnmp_event_loop_session_removed(struct session_list
+                                                       *slp);
+    void            netsnmp_event_loop_external_changed(int fd);
+
+#ifdef __cplusplus
+}
+#endif
+#endif                          /* NETSNMP_EVENT_LOOP_H */
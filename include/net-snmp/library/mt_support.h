@@ -38,8 +38,12 @@ extern          "C" {
 #define MT_LIB_MESSAGEID   3
 #define MT_LIB_SESSIONID   4
 #define MT_LIB_TRANSID     5
+#define MT_LIB_KEYCACHE    6
+#define MT_LIB_AGENT_WORKERS 7
+#define MT_LIB_AGENT_EXEC  8
+#define MT_LIB_AGENT_PASS  9
 
-#define MT_LIB_MAXIMUM     6    /* must be one greater than the last one */
+#define MT_LIB_MAXIMUM     10   /* must be one greater than the last one */
 
 
 #if defined(NETSNMP_REENTRANT) || defined(WIN32)
@@ -202,6 +202,12 @@ SOFTWARE.
     void            netsnmp_init_mib_internals(void);
     void            unload_all_mibs(void);
     int             add_mibfile(const char*, const char*);
+    int             netsnmp_read_mib_cache(const char *filename,
+                                           const char *key);
+    NETSNMP_IMPORT
+    int             netsnmp_write_mib_cache(const char *filename,
+                                            const char *key,
+                                            const char *dirs);
     int             which_module(const char *);
     NETSNMP_IMPORT
     char           *module_name(int, char *);
@@ -319,6 +319,7 @@ SOFTWARE.
 #define UCD_MSG_FLAG_FORWARD_ENCODE         0x8000
 #endif
 #define UCD_MSG_FLAG_BULK_TOOBIG          0x010000
+#define UCD_MSG_FLAG_DECODE_IN_PLACE      0x020000
 
     /*
      * view status 
@@ -91,6 +91,9 @@ SOFTWARE.
 #ifdef SNMP_NEED_REQUEST_LIST
 typedef struct request_list {
     struct request_list *next_request;
+    struct request_list *prev_request;
+    struct request_list *next_hashed;   /* next in the same hash bucket */
+    size_t          heap_index;     /* position in the expiry heap */
     long            request_id;     /* request id */
     long            message_id;     /* message id */
     netsnmp_callback callback;      /* user callback per request (NULL if unused) */
@@ -180,6 +183,7 @@ typedef struct request_list {
 
 #define SNMP_DETAIL_SIZE        512
 
+#define SNMP_FLAGS_DECODE_IN_PLACE 0x1000     /* share rx buffer with values */
 #define SNMP_FLAGS_UDP_BROADCAST   0x800
 #define SNMP_FLAGS_RESP_CALLBACK   0x400      /* Additional callback on response */
 #define SNMP_FLAGS_USER_CREATED    0x200      /* USM user has been created */
@@ -315,6 +319,17 @@ typedef struct request_list {
 
     NETSNMP_IMPORT void snmp_free_var_internals(netsnmp_variable_list *);     /* frees contents only */
 
+    /*
+     * Values of PDUs decoded in place (see SNMP_FLAGS_DECODE_IN_PLACE) point
+     * into a reference counted copy of the received packet.  The reference
+     * is held in the data and dataFreeHook members of such varbinds.  The
+     * first function makes dst share the value of src, the second one drops
+     * the reference of var and resets its value to the local buffer.
+     */
+    NETSNMP_IMPORT int  netsnmp_var_share_rxbuf(netsnmp_variable_list *dst,
+                                                const netsnmp_variable_list *src);
+    NETSNMP_IMPORT void netsnmp_var_release_rxbuf(netsnmp_variable_list *var);
+
 
     /*
      * This routine must be supplied by the application:
@@ -396,6 +411,8 @@ typedef struct request_list {
     int             netsnmp_oid_find_prefix(const oid * in_name1, size_t len1,
                                             const oid * in_name2, size_t len2);
     NETSNMP_IMPORT
+    const char     *netsnmp_oid_compare_select(int vector);
+    NETSNMP_IMPORT
     void            init_snmp(const char *);
 
     NETSNMP_IMPORT
@@ -0,0 +1,130 @@
+/*
+ * snmp_completion.h: send requests on single sessions and collect their
+ * responses through completion handles.
+ *
+ * snmp_sess_synch_response() sends one request and runs a private select()
+ * loop until it is answered, so a program with many requests in flight needs
+ * as many threads.  With a completion queue one thread submits any number
+ * of requests, on any number of sessions opened with snmp_sess_open(), and
+ * then waits for a particular one, for all of them, or for whichever
+ * finishes next.
+ *
+ * A queue, and the sessions it has requests pending on, must only be used
+ * by one thread at a time.  Sessions must stay open while requests
+ * submitted on them are pending.
+ */
+#ifndef NETSNMP_SNMP_COMPLETION_H
+#define NETSNMP_SNMP_COMPLETION_H
+
+#ifdef __cplusplus
+extern          "C" {
+#endif
+
+    typedef struct netsnmp_completion_queue_s netsnmp_completion_queue;
+    typedef struct netsnmp_completion_s netsnmp_completion;
+
+    NETSNMP_IMPORT
+    netsnmp_completion_queue *netsnmp_completion_queue_create(void);
+
+    /*
+     * Frees the queue and the completions that have finished but were not
+     * freed yet.  Completions still pending are freed when their request
+     * is answered or times out.
+     */
+    NETSNMP_IMPORT
+    void            netsnmp_completion_queue_free(netsnmp_completion_queue
+                                                  *cq);
+
+    /*
+     * Sends pdu on the single session sessp.  Returns a completion handle
+     * or, if the PDU could not be sent, NULL after freeing the PDU (the
+     * error is left in the session's s_snmp_errno).
+     */
+    NETSNMP_IMPORT
+    netsnmp_completion *netsnmp_completion_submit(netsnmp_completion_queue
+                                                  *cq, struct session_list
+                                                  *sessp, netsnmp_pdu *pdu,
+                                                  void *user_data);
+
+    /*
+     * Waits at most *timeout (as long as it takes if timeout is NULL) for
+     * activity on the sessions with pending requests and processes it.
+     * Returns the number of requests that finished, or -1 on error.
+     */
+    NETSNMP_IMPORT
+    int             netsnmp_completion_queue_run(netsnmp_completion_queue
+                                                 *cq, struct timeval *timeout);
+
+    /*
+     * Returns the next finished completion, in the order they finished,
+     * waiting at most *timeout for one.  Returns NULL on timeout or if no
+     * request is pending.
+     */
+    NETSNMP_IMPORT
+    netsnmp_completion *netsnmp_completion_queue_next(netsnmp_completion_queue
+                                                      *cq,
+                                                      struct timeval *timeout);
+
+    /*
+     * Waits at most *timeout for all pending requests to finish.  Returns 1
+     * if none is pending any more, 0 otherwise.
+     */
+    NETSNMP_IMPORT
+    int             netsnmp_completion_queue_wait_all(netsnmp_completion_queue
+                                                      *cq,
+                                                      struct timeval *timeout);
+
+    /** Returns the number of requests pending on the queue. */
+    NETSNMP_IMPORT
+    int             netsnmp_completion_queue_pending(netsnmp_completion_queue
+                                                     *cq);
+
+    /*
+     * Waits at most *timeout for c to finish, processing the other requests
+     * of its queue meanwhile.  Returns 1 if c has finished, 0 otherwise.
+     * A completion waited for is not returned by
+     * netsnmp_completion_queue_next().
+     */
+    NETSNMP_IMPORT
+    int             netsnmp_completion_wait(netsnmp_completion *c,
+                                            struct timeval *timeout);
+
+    /** Returns non-zero once the request of c has finished. */
+    NETSNMP_IMPORT
+    int             netsnmp_completion_done(netsnmp_completion *c);
+
+    /*
+     * Returns STAT_SUCCESS, STAT_ERROR or STAT_TIMEOUT, as
+     * snmp_sess_synch_response() would, once c has finished.
+     */
+    NETSNMP_IMPORT
+    int             netsnmp_completion_status(netsnmp_completion *c);
+
+    /** Returns the SNMPERR_* code the request finished with. */
+    NETSNMP_IMPORT
+    int             netsnmp_completion_errno(netsnmp_completion *c);
+
+    /*
+     * Returns the response PDU, which the caller must free, and forgets it;
+     * NULL unless the request finished with STAT_SUCCESS.
+     */
+    NETSNMP_IMPORT
+    netsnmp_pdu    *netsnmp_completion_response(netsnmp_completion *c);
+
+    NETSNMP_IMPORT
+    void           *netsnmp_completion_user_data(netsnmp_completion *c);
+
+    NETSNMP_IMPORT
+    struct session_list *netsnmp_completion_session(netsnmp_completion *c);
+
+    /*
+     * Frees c and its response.  If its request is still pending, c is
+     * freed once the request is answered or times out.
+     */
+    NETSNMP_IMPORT
+    void            netsnmp_completion_free(netsnmp_completion *c);
+
+#ifdef __cplusplus
+}
+#endif
+#endif                          /* NETSNMP_SNMP_COMPLETION_H */
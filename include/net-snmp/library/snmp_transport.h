@@ -57,6 +57,8 @@ extern          "C" {
 #define		NETSNMP_TRANSPORT_FLAG_OPENED	 0x20  /* f_open called */
 #define		NETSNMP_TRANSPORT_FLAG_SHARED	 0x40
 #define		NETSNMP_TRANSPORT_FLAG_HOSTNAME	 0x80  /* for fmtaddr hook */
+#define		NETSNMP_TRANSPORT_FLAG_RECV_PENDING 0x100 /* f_recv has more
+                                                       * messages buffered */
 
 /*  The standard SNMP domains.  */
 
@@ -217,6 +219,14 @@ typedef struct netsnmp_transport_s {
     void           (*f_get_taddr)(struct netsnmp_transport_s *t,
                                   void **addr, size_t *addr_len);
 
+    /*  Optional callback to send whatever f_send queued up while a batch
+        of received messages was being processed (see
+        NETSNMP_TRANSPORT_FLAG_RECV_PENDING) */
+    int            (*f_flush)(struct netsnmp_transport_s *);
+
+    /*  Batched I/O state, private to the transport */
+    void           *io_batch;
+
 } netsnmp_transport;
 
 typedef struct netsnmp_transport_list_s {
@@ -80,8 +80,13 @@ extern          "C" {
        /* these are actually DH * pointers but only if openssl is avail. */
         void           *usmDHUserAuthKeyChange;
         void           *usmDHUserPrivKeyChange;
+        /* key setup kept between messages and redone when the key no
+           longer matches, see sc_encrypt_cached() etc. */
+        struct netsnmp_sc_key_cache_s *authKeyCache;
+        struct netsnmp_sc_key_cache_s *privKeyCache;
         struct usmUser *next;
         struct usmUser *prev;
+        struct usmUser *hashNext;       /* next in the same hash bucket */
     };
 
 #define USMUSER_FLAG_KEEP_MASTER_KEY             0x01
@@ -175,6 +175,9 @@ extern          "C" {
     int             snmp_sess_select_info2_flags(struct session_list *, int *,
                                                  netsnmp_large_fd_set *,
                                                  struct timeval *, int *, int);
+    NETSNMP_IMPORT
+    int             snmp_sess_select_timeout(struct session_list *,
+                                             struct timeval *, int *, int);
 
     /*
      * void snmp_timeout();
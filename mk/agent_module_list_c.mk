@@ -0,0 +1,14 @@
+# contents below built automatically by configure; do not edit by hand
+agent_module_list_c= \
+	snmpv3/usmConf.c \
+	agentx/master.c \
+	agentx/subagent.c \
+	utilities/execute.c \
+	utilities/iquery.c \
+	mibII/vacm_conf.c \
+	agentx/protocol.c \
+	agentx/master_admin.c \
+	agentx/agentx_config.c \
+	agentx/client.c
+
+# end configure generated code
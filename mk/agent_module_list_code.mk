@@ -0,0 +1,12 @@
+# contents below built automatically by configure; do not edit by hand
+agent_module_list_code= \
+	snmpv3/usmConf \
+	agentx/master \
+	agentx/subagent \
+	utilities/execute \
+	utilities/iquery \
+	mibII/vacm_conf \
+	agentx/protocol \
+	agentx/master_admin \
+	agentx/agentx_config \
+	agentx/client \
@@ -0,0 +1,11 @@
+# contents below built automatically by configure; do not edit by hand
+snmp_vars.lo: mibgroup/snmpv3/usmConf.h
+snmp_vars.lo: mibgroup/agentx/master.h
+snmp_vars.lo: mibgroup/agentx/subagent.h
+snmp_vars.lo: mibgroup/utilities/execute.h
+snmp_vars.lo: mibgroup/utilities/iquery.h
+snmp_vars.lo: mibgroup/mibII/vacm_conf.h
+snmp_vars.lo: mibgroup/agentx/protocol.h
+snmp_vars.lo: mibgroup/agentx/master_admin.h
+snmp_vars.lo: mibgroup/agentx/agentx_config.h
+snmp_vars.lo: mibgroup/agentx/client.h
@@ -0,0 +1,14 @@
+# contents below built automatically by configure; do not edit by hand
+agent_module_list_ft= \
+	snmpv3/usmConf.ft \
+	agentx/master.ft \
+	agentx/subagent.ft \
+	utilities/execute.ft \
+	utilities/iquery.ft \
+	mibII/vacm_conf.ft \
+	agentx/protocol.ft \
+	agentx/master_admin.ft \
+	agentx/agentx_config.ft \
+	agentx/client.ft
+
+# end configure generated code
@@ -0,0 +1,14 @@
+# contents below built automatically by configure; do not edit by hand
+agent_module_list_lo= \
+	snmpv3/usmConf.lo \
+	agentx/master.lo \
+	agentx/subagent.lo \
+	utilities/execute.lo \
+	utilities/iquery.lo \
+	mibII/vacm_conf.lo \
+	agentx/protocol.lo \
+	agentx/master_admin.lo \
+	agentx/agentx_config.lo \
+	agentx/client.lo
+
+# end configure generated code
@@ -0,0 +1,14 @@
+# contents below built automatically by configure; do not edit by hand
+agent_module_list_o= \
+	snmpv3/usmConf.o \
+	agentx/master.o \
+	agentx/subagent.o \
+	utilities/execute.o \
+	utilities/iquery.o \
+	mibII/vacm_conf.o \
+	agentx/protocol.o \
+	agentx/master_admin.o \
+	agentx/agentx_config.o \
+	agentx/client.o
+
+# end configure generated code
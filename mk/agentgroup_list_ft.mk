@@ -0,0 +1,14 @@
+# contents below built automatically by configure; do not edit by hand
+agentgroup_list_ft= \
+	mibgroup/snmpv3/usmConf.ft \
+	mibgroup/agentx/master.ft \
+	mibgroup/agentx/subagent.ft \
+	mibgroup/utilities/execute.ft \
+	mibgroup/utilities/iquery.ft \
+	mibgroup/mibII/vacm_conf.ft \
+	mibgroup/agentx/protocol.ft \
+	mibgroup/agentx/master_admin.ft \
+	mibgroup/agentx/agentx_config.ft \
+	mibgroup/agentx/client.ft
+
+# end configure generated code
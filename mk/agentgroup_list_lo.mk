@@ -0,0 +1,14 @@
+# contents below built automatically by configure; do not edit by hand
+agentgroup_list_lo= \
+	mibgroup/snmpv3/usmConf.lo \
+	mibgroup/agentx/master.lo \
+	mibgroup/agentx/subagent.lo \
+	mibgroup/utilities/execute.lo \
+	mibgroup/utilities/iquery.lo \
+	mibgroup/mibII/vacm_conf.lo \
+	mibgroup/agentx/protocol.lo \
+	mibgroup/agentx/master_admin.lo \
+	mibgroup/agentx/agentx_config.lo \
+	mibgroup/agentx/client.lo
+
+# end configure generated code
@@ -0,0 +1,14 @@
+# contents below built automatically by configure; do not edit by hand
+agentgroup_list_o= \
+	mibgroup/snmpv3/usmConf.o \
+	mibgroup/agentx/master.o \
+	mibgroup/agentx/subagent.o \
+	mibgroup/utilities/execute.o \
+	mibgroup/utilities/iquery.o \
+	mibgroup/mibII/vacm_conf.o \
+	mibgroup/agentx/protocol.o \
+	mibgroup/agentx/master_admin.o \
+	mibgroup/agentx/agentx_config.o \
+	mibgroup/agentx/client.o
+
+# end configure generated code
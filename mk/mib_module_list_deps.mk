@@ -0,0 +1,206 @@
+# contents below built automatically by configure; do not edit by hand
+mib_modules.lo: mibgroup/default_modules.h
+mib_modules.lo: mibgroup/snmpv3mibs.h
+mib_modules.lo: mibgroup/mibII.h
+mib_modules.lo: mibgroup/ucd_snmp.h
+mib_modules.lo: mibgroup/notification.h
+mib_modules.lo: mibgroup/notification-log-mib.h
+mib_modules.lo: mibgroup/target.h
+mib_modules.lo: mibgroup/agent_mibs.h
+mib_modules.lo: mibgroup/agentx.h
+mib_modules.lo: mibgroup/disman/event.h
+mib_modules.lo: mibgroup/disman/schedule.h
+mib_modules.lo: mibgroup/utilities.h
+mib_modules.lo: mibgroup/host.h
+mib_modules.lo: mibgroup/snmpv3/snmpEngine.h
+mib_modules.lo: mibgroup/snmpv3/snmpMPDStats.h
+mib_modules.lo: mibgroup/snmpv3/usmStats.h
+mib_modules.lo: mibgroup/snmpv3/usmUser.h
+mib_modules.lo: mibgroup/mibII/system_mib.h
+mib_modules.lo: mibgroup/mibII/sysORTable.h
+mib_modules.lo: mibgroup/mibII/snmp_mib.h
+mib_modules.lo: mibgroup/mibII/vacm_vars.h
+mib_modules.lo: mibgroup/mibII/setSerialNo.h
+mib_modules.lo: mibgroup/mibII/at.h
+mib_modules.lo: mibgroup/mibII/ifTable.h
+mib_modules.lo: mibgroup/mibII/ip.h
+mib_modules.lo: mibgroup/mibII/tcp.h
+mib_modules.lo: mibgroup/mibII/udp.h
+mib_modules.lo: mibgroup/mibII/ipv6.h
+mib_modules.lo: mibgroup/mibII/icmp.h
+mib_modules.lo: mibgroup/if-mib.h
+mib_modules.lo: mibgroup/ip-mib.h
+mib_modules.lo: mibgroup/ip-forward-mib.h
+mib_modules.lo: mibgroup/tcp-mib.h
+mib_modules.lo: mibgroup/udp-mib.h
+mib_modules.lo: mibgroup/ucd-snmp/disk_hw.h
+mib_modules.lo: mibgroup/ucd-snmp/proc.h
+mib_modules.lo: mibgroup/ucd-snmp/versioninfo.h
+mib_modules.lo: mibgroup/ucd-snmp/pass.h
+mib_modules.lo: mibgroup/ucd-snmp/pass_persist.h
+mib_modules.lo: mibgroup/ucd-snmp/loadave.h
+mib_modules.lo: mibgroup/agent/extend.h
+mib_modules.lo: mibgroup/ucd-snmp/errormib.h
+mib_modules.lo: mibgroup/ucd-snmp/file.h
+mib_modules.lo: mibgroup/ucd-snmp/dlmod.h
+mib_modules.lo: mibgroup/ucd-snmp/proxy.h
+mib_modules.lo: mibgroup/ucd-snmp/logmatch.h
+mib_modules.lo: mibgroup/ucd-snmp/memory.h
+mib_modules.lo: mibgroup/ucd-snmp/vmstat.h
+mib_modules.lo: mibgroup/notification/snmpNotifyTable.h
+mib_modules.lo: mibgroup/snmp-notification-mib/snmpNotifyFilterTable.h
+mib_modules.lo: mibgroup/notification/snmpNotifyFilterProfileTable.h
+mib_modules.lo: mibgroup/notification-log-mib/notification_log.h
+mib_modules.lo: mibgroup/target/snmpTargetAddrEntry.h
+mib_modules.lo: mibgroup/target/snmpTargetParamsEntry.h
+mib_modules.lo: mibgroup/target/target.h
+mib_modules.lo: mibgroup/target/target_counters.h
+mib_modules.lo: mibgroup/agent/nsTransactionTable.h
+mib_modules.lo: mibgroup/agent/nsModuleTable.h
+mib_modules.lo: mibgroup/agent/nsDebug.h
+mib_modules.lo: mibgroup/agent/nsCache.h
+mib_modules.lo: mibgroup/agent/nsLogging.h
+mib_modules.lo: mibgroup/agent/nsVacmAccessTable.h
+mib_modules.lo: mibgroup/disman/event/mteScalars.h
+mib_modules.lo: mibgroup/disman/event/mteTrigger.h
+mib_modules.lo: mibgroup/disman/event/mteTriggerTable.h
+mib_modules.lo: mibgroup/disman/event/mteTriggerDeltaTable.h
+mib_modules.lo: mibgroup/disman/event/mteTriggerExistenceTable.h
+mib_modules.lo: mibgroup/disman/event/mteTriggerBooleanTable.h
+mib_modules.lo: mibgroup/disman/event/mteTriggerThresholdTable.h
+mib_modules.lo: mibgroup/disman/event/mteTriggerConf.h
+mib_modules.lo: mibgroup/disman/event/mteEvent.h
+mib_modules.lo: mibgroup/disman/event/mteEventTable.h
+mib_modules.lo: mibgroup/disman/event/mteEventSetTable.h
+mib_modules.lo: mibgroup/disman/event/mteEventNotificationTable.h
+mib_modules.lo: mibgroup/disman/event/mteEventConf.h
+mib_modules.lo: mibgroup/disman/event/mteObjects.h
+mib_modules.lo: mibgroup/disman/event/mteObjectsTable.h
+mib_modules.lo: mibgroup/disman/event/mteObjectsConf.h
+mib_modules.lo: mibgroup/disman/schedule/schedCore.h
+mib_modules.lo: mibgroup/disman/schedule/schedConf.h
+mib_modules.lo: mibgroup/disman/schedule/schedTable.h
+mib_modules.lo: mibgroup/utilities/override.h
+mib_modules.lo: mibgroup/host/hrh_storage.h
+mib_modules.lo: mibgroup/host/hrh_filesys.h
+mib_modules.lo: mibgroup/host/hrSWInstalledTable.h
+mib_modules.lo: mibgroup/host/hrSWRunTable.h
+mib_modules.lo: mibgroup/host/hr_system.h
+mib_modules.lo: mibgroup/host/hr_device.h
+mib_modules.lo: mibgroup/host/hr_other.h
+mib_modules.lo: mibgroup/host/hr_proc.h
+mib_modules.lo: mibgroup/host/hr_network.h
+mib_modules.lo: mibgroup/host/hr_print.h
+mib_modules.lo: mibgroup/host/hr_disk.h
+mib_modules.lo: mibgroup/host/hr_partition.h
+mib_modules.lo: mibgroup/util_funcs/header_generic.h
+mib_modules.lo: mibgroup/util_funcs.h
+mib_modules.lo: mibgroup/mibII/updates.h
+mib_modules.lo: mibgroup/mibII/vacm_context.h
+mib_modules.lo: mibgroup/mibII/data_access/at_unix.h
+mib_modules.lo: mibgroup/if-mib/ifTable.h
+mib_modules.lo: mibgroup/mibII/kernel_linux.h
+mib_modules.lo: mibgroup/mibII/ipAddr.h
+mib_modules.lo: mibgroup/mibII/var_route.h
+mib_modules.lo: mibgroup/mibII/route_write.h
+mib_modules.lo: mibgroup/mibII/tcpTable.h
+mib_modules.lo: mibgroup/mibII/udpTable.h
+mib_modules.lo: mibgroup/if-mib/ifXTable.h
+mib_modules.lo: mibgroup/ip-mib/ipAddressTable.h
+mib_modules.lo: mibgroup/ip-mib/ipAddressPrefixTable.h
+mib_modules.lo: mibgroup/ip-mib/ipDefaultRouterTable.h
+mib_modules.lo: mibgroup/ip-mib/inetNetToMediaTable.h
+mib_modules.lo: mibgroup/ip-mib/ipSystemStatsTable.h
+mib_modules.lo: mibgroup/ip-mib/ip_scalars.h
+mib_modules.lo: mibgroup/ip-mib/ipv6ScopeZoneIndexTable.h
+mib_modules.lo: mibgroup/ip-mib/ipIfStatsTable.h
+mib_modules.lo: mibgroup/ip-forward-mib/ipCidrRouteTable.h
+mib_modules.lo: mibgroup/ip-forward-mib/inetCidrRouteTable.h
+mib_modules.lo: mibgroup/tcp-mib/tcpConnectionTable.h
+mib_modules.lo: mibgroup/tcp-mib/tcpListenerTable.h
+mib_modules.lo: mibgroup/udp-mib/udpEndpointTable.h
+mib_modules.lo: mibgroup/util_funcs/header_simple_table.h
+mib_modules.lo: mibgroup/hardware/fsys.h
+mib_modules.lo: mibgroup/util_funcs/restart.h
+mib_modules.lo: mibgroup/ucd-snmp/pass_common.h
+mib_modules.lo: mibgroup/hardware/memory.h
+mib_modules.lo: mibgroup/hardware/cpu.h
+mib_modules.lo: mibgroup/notification/snmpNotifyTable_data.h
+mib_modules.lo: mibgroup/header_complex.h
+mib_modules.lo: mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_storage.h
+mib_modules.lo: mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable.h
+mib_modules.lo: mibgroup/notification/snmpNotifyFilterProfileTable_data.h
+mib_modules.lo: mibgroup/target/snmpTargetAddrEntry_data.h
+mib_modules.lo: mibgroup/target/snmpTargetParamsEntry_data.h
+mib_modules.lo: mibgroup/host/data_access/swinst.h
+mib_modules.lo: mibgroup/host/data_access/swrun.h
+mib_modules.lo: mibgroup/host/hrSWRunPerfTable.h
+mib_modules.lo: mibgroup/if-mib/ifTable/ifTable.h
+mib_modules.lo: mibgroup/if-mib/ifXTable/ifXTable.h
+mib_modules.lo: mibgroup/ip-mib/ipAddressTable/ipAddressTable.h
+mib_modules.lo: mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable.h
+mib_modules.lo: mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable.h
+mib_modules.lo: mibgroup/ip-mib/data_access/arp.h
+mib_modules.lo: mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable.h
+mib_modules.lo: mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable_interface.h
+mib_modules.lo: mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable_data_access.h
+mib_modules.lo: mibgroup/ip-mib/data_access/systemstats.h
+mib_modules.lo: mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable.h
+mib_modules.lo: mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable_interface.h
+mib_modules.lo: mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable_data_access.h
+mib_modules.lo: mibgroup/ip-mib/data_access/scalars_common.h
+mib_modules.lo: mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable.h
+mib_modules.lo: mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable.h
+mib_modules.lo: mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_interface.h
+mib_modules.lo: mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_data_access.h
+mib_modules.lo: mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable.h
+mib_modules.lo: mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable.h
+mib_modules.lo: mibgroup/tcp-mib/data_access/tcpConn.h
+mib_modules.lo: mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable.h
+mib_modules.lo: mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable.h
+mib_modules.lo: mibgroup/udp-mib/udpEndpointTable/udpEndpointTable.h
+mib_modules.lo: mibgroup/hardware/fsys/hw_fsys.h
+mib_modules.lo: mibgroup/hardware/memory/hw_mem.h
+mib_modules.lo: mibgroup/hardware/memory/memory_linux.h
+mib_modules.lo: mibgroup/hardware/cpu/cpu.h
+mib_modules.lo: mibgroup/hardware/cpu/cpu_linux.h
+mib_modules.lo: mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_interface.h
+mib_modules.lo: mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_access.h
+mib_modules.lo: mibgroup/if-mib/data_access/interface.h
+mib_modules.lo: mibgroup/if-mib/ifTable/ifTable_interface.h
+mib_modules.lo: mibgroup/if-mib/ifTable/ifTable_data_access.h
+mib_modules.lo: mibgroup/if-mib/ifXTable/ifXTable_interface.h
+mib_modules.lo: mibgroup/if-mib/ifXTable/ifXTable_data_access.h
+mib_modules.lo: mibgroup/ip-mib/data_access/ipaddress.h
+mib_modules.lo: mibgroup/ip-mib/ipAddressTable/ipAddressTable_interface.h
+mib_modules.lo: mibgroup/ip-mib/ipAddressTable/ipAddressTable_data_access.h
+mib_modules.lo: mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_interface.h
+mib_modules.lo: mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_data_access.h
+mib_modules.lo: mibgroup/ip-mib/data_access/defaultrouter.h
+mib_modules.lo: mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_interface.h
+mib_modules.lo: mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_access.h
+mib_modules.lo: mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_get.h
+mib_modules.lo: mibgroup/ip-mib/data_access/ipv6scopezone.h
+mib_modules.lo: mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_interface.h
+mib_modules.lo: mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_data_access.h
+mib_modules.lo: mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_data_get.h
+mib_modules.lo: mibgroup/ip-forward-mib/data_access/route.h
+mib_modules.lo: mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_interface.h
+mib_modules.lo: mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_data_access.h
+mib_modules.lo: mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_interface.h
+mib_modules.lo: mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_data_access.h
+mib_modules.lo: mibgroup/util_funcs/get_pid_from_inode.h
+mib_modules.lo: mibgroup/util_funcs/sock_diag.h
+mib_modules.lo: mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable_interface.h
+mib_modules.lo: mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable_data_access.h
+mib_modules.lo: mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable_interface.h
+mib_modules.lo: mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable_data_access.h
+mib_modules.lo: mibgroup/udp-mib/data_access/udp_endpoint.h
+mib_modules.lo: mibgroup/udp-mib/udpEndpointTable/udpEndpointTable_interface.h
+mib_modules.lo: mibgroup/udp-mib/udpEndpointTable/udpEndpointTable_data_access.h
+mib_modules.lo: mibgroup/if-mib/data_access/interface_ioctl.h
+mib_modules.lo: mibgroup/ip-mib/data_access/ipaddress_linux.h
+mib_modules.lo: mibgroup/ip-forward-mib/data_access/route_linux.h
+mib_modules.lo: mibgroup/ip-forward-mib/data_access/route_ioctl.h
+mib_modules.lo: mibgroup/ip-forward-mib/data_access/route_netlink.h
+mib_modules.lo: mibgroup/ip-mib/data_access/ipaddress_ioctl.h
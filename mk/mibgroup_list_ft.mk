@@ -0,0 +1,185 @@
+# contents below built automatically by configure; do not edit by hand
+mibgroup_list_ft= \
+	mibgroup/snmpv3/snmpEngine.ft \
+	mibgroup/snmpv3/snmpMPDStats.ft \
+	mibgroup/snmpv3/usmStats.ft \
+	mibgroup/snmpv3/usmUser.ft \
+	mibgroup/mibII/system_mib.ft \
+	mibgroup/mibII/sysORTable.ft \
+	mibgroup/mibII/snmp_mib.ft \
+	mibgroup/mibII/vacm_vars.ft \
+	mibgroup/mibII/setSerialNo.ft \
+	mibgroup/mibII/at.ft \
+	mibgroup/mibII/ip.ft \
+	mibgroup/mibII/tcp.ft \
+	mibgroup/mibII/udp.ft \
+	mibgroup/mibII/ipv6.ft \
+	mibgroup/mibII/icmp.ft \
+	mibgroup/ucd-snmp/disk_hw.ft \
+	mibgroup/ucd-snmp/proc.ft \
+	mibgroup/ucd-snmp/versioninfo.ft \
+	mibgroup/ucd-snmp/pass.ft \
+	mibgroup/ucd-snmp/pass_persist.ft \
+	mibgroup/ucd-snmp/loadave.ft \
+	mibgroup/agent/extend.ft \
+	mibgroup/ucd-snmp/errormib.ft \
+	mibgroup/ucd-snmp/file.ft \
+	mibgroup/ucd-snmp/dlmod.ft \
+	mibgroup/ucd-snmp/proxy.ft \
+	mibgroup/ucd-snmp/logmatch.ft \
+	mibgroup/ucd-snmp/memory.ft \
+	mibgroup/ucd-snmp/vmstat.ft \
+	mibgroup/notification/snmpNotifyTable.ft \
+	mibgroup/notification/snmpNotifyFilterProfileTable.ft \
+	mibgroup/notification-log-mib/notification_log.ft \
+	mibgroup/target/snmpTargetAddrEntry.ft \
+	mibgroup/target/snmpTargetParamsEntry.ft \
+	mibgroup/target/target.ft \
+	mibgroup/target/target_counters.ft \
+	mibgroup/agent/nsTransactionTable.ft \
+	mibgroup/agent/nsModuleTable.ft \
+	mibgroup/agent/nsDebug.ft \
+	mibgroup/agent/nsCache.ft \
+	mibgroup/agent/nsLogging.ft \
+	mibgroup/agent/nsVacmAccessTable.ft \
+	mibgroup/disman/event/mteScalars.ft \
+	mibgroup/disman/event/mteTrigger.ft \
+	mibgroup/disman/event/mteTriggerTable.ft \
+	mibgroup/disman/event/mteTriggerDeltaTable.ft \
+	mibgroup/disman/event/mteTriggerExistenceTable.ft \
+	mibgroup/disman/event/mteTriggerBooleanTable.ft \
+	mibgroup/disman/event/mteTriggerThresholdTable.ft \
+	mibgroup/disman/event/mteTriggerConf.ft \
+	mibgroup/disman/event/mteEvent.ft \
+	mibgroup/disman/event/mteEventTable.ft \
+	mibgroup/disman/event/mteEventSetTable.ft \
+	mibgroup/disman/event/mteEventNotificationTable.ft \
+	mibgroup/disman/event/mteEventConf.ft \
+	mibgroup/disman/event/mteObjects.ft \
+	mibgroup/disman/event/mteObjectsTable.ft \
+	mibgroup/disman/event/mteObjectsConf.ft \
+	mibgroup/disman/schedule/schedCore.ft \
+	mibgroup/disman/schedule/schedConf.ft \
+	mibgroup/disman/schedule/schedTable.ft \
+	mibgroup/utilities/override.ft \
+	mibgroup/host/hrh_storage.ft \
+	mibgroup/host/hrh_filesys.ft \
+	mibgroup/host/hrSWInstalledTable.ft \
+	mibgroup/host/hrSWRunTable.ft \
+	mibgroup/host/hr_system.ft \
+	mibgroup/host/hr_device.ft \
+	mibgroup/host/hr_other.ft \
+	mibgroup/host/hr_proc.ft \
+	mibgroup/host/hr_network.ft \
+	mibgroup/host/hr_print.ft \
+	mibgroup/host/hr_disk.ft \
+	mibgroup/host/hr_partition.ft \
+	mibgroup/util_funcs/header_generic.ft \
+	mibgroup/util_funcs.ft \
+	mibgroup/mibII/updates.ft \
+	mibgroup/mibII/vacm_context.ft \
+	mibgroup/mibII/data_access/at_linux.ft \
+	mibgroup/mibII/data_access/at_unix.ft \
+	mibgroup/mibII/kernel_linux.ft \
+	mibgroup/mibII/ipAddr.ft \
+	mibgroup/mibII/var_route.ft \
+	mibgroup/mibII/route_write.ft \
+	mibgroup/mibII/tcpTable.ft \
+	mibgroup/mibII/udpTable.ft \
+	mibgroup/ip-mib/ip_scalars.ft \
+	mibgroup/util_funcs/header_simple_table.ft \
+	mibgroup/util_funcs/restart.ft \
+	mibgroup/ucd-snmp/pass_common.ft \
+	mibgroup/notification/snmpNotifyTable_data.ft \
+	mibgroup/header_complex.ft \
+	mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_storage.ft \
+	mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable.ft \
+	mibgroup/notification/snmpNotifyFilterProfileTable_data.ft \
+	mibgroup/target/snmpTargetAddrEntry_data.ft \
+	mibgroup/target/snmpTargetParamsEntry_data.ft \
+	mibgroup/host/data_access/swinst.ft \
+	mibgroup/host/data_access/swrun.ft \
+	mibgroup/host/hrSWRunPerfTable.ft \
+	mibgroup/host/data_access/hr_disk_linux.ft \
+	mibgroup/host/data_access/hr_partition_other.ft \
+	mibgroup/if-mib/ifTable/ifTable.ft \
+	mibgroup/if-mib/ifXTable/ifXTable.ft \
+	mibgroup/ip-mib/ipAddressTable/ipAddressTable.ft \
+	mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable.ft \
+	mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable.ft \
+	mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable.ft \
+	mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable_interface.ft \
+	mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable_data_access.ft \
+	mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable.ft \
+	mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable_interface.ft \
+	mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable_data_access.ft \
+	mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable.ft \
+	mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable.ft \
+	mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_interface.ft \
+	mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_data_access.ft \
+	mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable.ft \
+	mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable.ft \
+	mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable.ft \
+	mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable.ft \
+	mibgroup/udp-mib/udpEndpointTable/udpEndpointTable.ft \
+	mibgroup/hardware/fsys/hw_fsys.ft \
+	mibgroup/hardware/fsys/fsys_mntent.ft \
+	mibgroup/hardware/memory/hw_mem.ft \
+	mibgroup/hardware/memory/memory_linux.ft \
+	mibgroup/hardware/cpu/cpu.ft \
+	mibgroup/hardware/cpu/cpu_linux.ft \
+	mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_interface.ft \
+	mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_access.ft \
+	mibgroup/host/data_access/swinst_apt.ft \
+	mibgroup/host/data_access/swrun_procfs_status.ft \
+	mibgroup/if-mib/data_access/interface.ft \
+	mibgroup/if-mib/ifTable/ifTable_interface.ft \
+	mibgroup/if-mib/ifTable/ifTable_data_access.ft \
+	mibgroup/if-mib/ifXTable/ifXTable_interface.ft \
+	mibgroup/if-mib/ifXTable/ifXTable_data_access.ft \
+	mibgroup/ip-mib/ipAddressTable/ipAddressTable_interface.ft \
+	mibgroup/ip-mib/ipAddressTable/ipAddressTable_data_access.ft \
+	mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_interface.ft \
+	mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_data_access.ft \
+	mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_interface.ft \
+	mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_access.ft \
+	mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_get.ft \
+	mibgroup/ip-mib/data_access/arp_common.ft \
+	mibgroup/ip-mib/data_access/arp_netlink.ft \
+	mibgroup/ip-mib/data_access/systemstats_common.ft \
+	mibgroup/ip-mib/data_access/systemstats_linux.ft \
+	mibgroup/ip-mib/data_access/scalars_linux.ft \
+	mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_interface.ft \
+	mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_data_access.ft \
+	mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_data_get.ft \
+	mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_interface.ft \
+	mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_data_access.ft \
+	mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_interface.ft \
+	mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_data_access.ft \
+	mibgroup/tcp-mib/data_access/tcpConn_common.ft \
+	mibgroup/tcp-mib/data_access/tcpConn_linux.ft \
+	mibgroup/util_funcs/get_pid_from_inode.ft \
+	mibgroup/util_funcs/sock_diag.ft \
+	mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable_interface.ft \
+	mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable_data_access.ft \
+	mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable_interface.ft \
+	mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable_data_access.ft \
+	mibgroup/udp-mib/udpEndpointTable/udpEndpointTable_interface.ft \
+	mibgroup/udp-mib/udpEndpointTable/udpEndpointTable_data_access.ft \
+	mibgroup/if-mib/data_access/interface_linux.ft \
+	mibgroup/if-mib/data_access/interface_ioctl.ft \
+	mibgroup/ip-mib/data_access/ipaddress_common.ft \
+	mibgroup/ip-mib/data_access/ipaddress_linux.ft \
+	mibgroup/ip-mib/data_access/defaultrouter_common.ft \
+	mibgroup/ip-mib/data_access/defaultrouter_linux.ft \
+	mibgroup/ip-mib/data_access/ipv6scopezone_common.ft \
+	mibgroup/ip-mib/data_access/ipv6scopezone_linux.ft \
+	mibgroup/ip-forward-mib/data_access/route_common.ft \
+	mibgroup/ip-forward-mib/data_access/route_linux.ft \
+	mibgroup/ip-forward-mib/data_access/route_ioctl.ft \
+	mibgroup/ip-forward-mib/data_access/route_netlink.ft \
+	mibgroup/udp-mib/data_access/udp_endpoint_common.ft \
+	mibgroup/udp-mib/data_access/udp_endpoint_linux.ft \
+	mibgroup/ip-mib/data_access/ipaddress_ioctl.ft
+
+# end configure generated code
@@ -0,0 +1,185 @@
+# contents below built automatically by configure; do not edit by hand
+mibgroup_list_lo= \
+	mibgroup/snmpv3/snmpEngine.lo \
+	mibgroup/snmpv3/snmpMPDStats.lo \
+	mibgroup/snmpv3/usmStats.lo \
+	mibgroup/snmpv3/usmUser.lo \
+	mibgroup/mibII/system_mib.lo \
+	mibgroup/mibII/sysORTable.lo \
+	mibgroup/mibII/snmp_mib.lo \
+	mibgroup/mibII/vacm_vars.lo \
+	mibgroup/mibII/setSerialNo.lo \
+	mibgroup/mibII/at.lo \
+	mibgroup/mibII/ip.lo \
+	mibgroup/mibII/tcp.lo \
+	mibgroup/mibII/udp.lo \
+	mibgroup/mibII/ipv6.lo \
+	mibgroup/mibII/icmp.lo \
+	mibgroup/ucd-snmp/disk_hw.lo \
+	mibgroup/ucd-snmp/proc.lo \
+	mibgroup/ucd-snmp/versioninfo.lo \
+	mibgroup/ucd-snmp/pass.lo \
+	mibgroup/ucd-snmp/pass_persist.lo \
+	mibgroup/ucd-snmp/loadave.lo \
+	mibgroup/agent/extend.lo \
+	mibgroup/ucd-snmp/errormib.lo \
+	mibgroup/ucd-snmp/file.lo \
+	mibgroup/ucd-snmp/dlmod.lo \
+	mibgroup/ucd-snmp/proxy.lo \
+	mibgroup/ucd-snmp/logmatch.lo \
+	mibgroup/ucd-snmp/memory.lo \
+	mibgroup/ucd-snmp/vmstat.lo \
+	mibgroup/notification/snmpNotifyTable.lo \
+	mibgroup/notification/snmpNotifyFilterProfileTable.lo \
+	mibgroup/notification-log-mib/notification_log.lo \
+	mibgroup/target/snmpTargetAddrEntry.lo \
+	mibgroup/target/snmpTargetParamsEntry.lo \
+	mibgroup/target/target.lo \
+	mibgroup/target/target_counters.lo \
+	mibgroup/agent/nsTransactionTable.lo \
+	mibgroup/agent/nsModuleTable.lo \
+	mibgroup/agent/nsDebug.lo \
+	mibgroup/agent/nsCache.lo \
+	mibgroup/agent/nsLogging.lo \
+	mibgroup/agent/nsVacmAccessTable.lo \
+	mibgroup/disman/event/mteScalars.lo \
+	mibgroup/disman/event/mteTrigger.lo \
+	mibgroup/disman/event/mteTriggerTable.lo \
+	mibgroup/disman/event/mteTriggerDeltaTable.lo \
+	mibgroup/disman/event/mteTriggerExistenceTable.lo \
+	mibgroup/disman/event/mteTriggerBooleanTable.lo \
+	mibgroup/disman/event/mteTriggerThresholdTable.lo \
+	mibgroup/disman/event/mteTriggerConf.lo \
+	mibgroup/disman/event/mteEvent.lo \
+	mibgroup/disman/event/mteEventTable.lo \
+	mibgroup/disman/event/mteEventSetTable.lo \
+	mibgroup/disman/event/mteEventNotificationTable.lo \
+	mibgroup/disman/event/mteEventConf.lo \
+	mibgroup/disman/event/mteObjects.lo \
+	mibgroup/disman/event/mteObjectsTable.lo \
+	mibgroup/disman/event/mteObjectsConf.lo \
+	mibgroup/disman/schedule/schedCore.lo \
+	mibgroup/disman/schedule/schedConf.lo \
+	mibgroup/disman/schedule/schedTable.lo \
+	mibgroup/utilities/override.lo \
+	mibgroup/host/hrh_storage.lo \
+	mibgroup/host/hrh_filesys.lo \
+	mibgroup/host/hrSWInstalledTable.lo \
+	mibgroup/host/hrSWRunTable.lo \
+	mibgroup/host/hr_system.lo \
+	mibgroup/host/hr_device.lo \
+	mibgroup/host/hr_other.lo \
+	mibgroup/host/hr_proc.lo \
+	mibgroup/host/hr_network.lo \
+	mibgroup/host/hr_print.lo \
+	mibgroup/host/hr_disk.lo \
+	mibgroup/host/hr_partition.lo \
+	mibgroup/util_funcs/header_generic.lo \
+	mibgroup/util_funcs.lo \
+	mibgroup/mibII/updates.lo \
+	mibgroup/mibII/vacm_context.lo \
+	mibgroup/mibII/data_access/at_linux.lo \
+	mibgroup/mibII/data_access/at_unix.lo \
+	mibgroup/mibII/kernel_linux.lo \
+	mibgroup/mibII/ipAddr.lo \
+	mibgroup/mibII/var_route.lo \
+	mibgroup/mibII/route_write.lo \
+	mibgroup/mibII/tcpTable.lo \
+	mibgroup/mibII/udpTable.lo \
+	mibgroup/ip-mib/ip_scalars.lo \
+	mibgroup/util_funcs/header_simple_table.lo \
+	mibgroup/util_funcs/restart.lo \
+	mibgroup/ucd-snmp/pass_common.lo \
+	mibgroup/notification/snmpNotifyTable_data.lo \
+	mibgroup/header_complex.lo \
+	mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_storage.lo \
+	mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable.lo \
+	mibgroup/notification/snmpNotifyFilterProfileTable_data.lo \
+	mibgroup/target/snmpTargetAddrEntry_data.lo \
+	mibgroup/target/snmpTargetParamsEntry_data.lo \
+	mibgroup/host/data_access/swinst.lo \
+	mibgroup/host/data_access/swrun.lo \
+	mibgroup/host/hrSWRunPerfTable.lo \
+	mibgroup/host/data_access/hr_disk_linux.lo \
+	mibgroup/host/data_access/hr_partition_other.lo \
+	mibgroup/if-mib/ifTable/ifTable.lo \
+	mibgroup/if-mib/ifXTable/ifXTable.lo \
+	mibgroup/ip-mib/ipAddressTable/ipAddressTable.lo \
+	mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable.lo \
+	mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable.lo \
+	mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable.lo \
+	mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable_interface.lo \
+	mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable_data_access.lo \
+	mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable.lo \
+	mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable_interface.lo \
+	mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable_data_access.lo \
+	mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable.lo \
+	mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable.lo \
+	mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_interface.lo \
+	mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_data_access.lo \
+	mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable.lo \
+	mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable.lo \
+	mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable.lo \
+	mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable.lo \
+	mibgroup/udp-mib/udpEndpointTable/udpEndpointTable.lo \
+	mibgroup/hardware/fsys/hw_fsys.lo \
+	mibgroup/hardware/fsys/fsys_mntent.lo \
+	mibgroup/hardware/memory/hw_mem.lo \
+	mibgroup/hardware/memory/memory_linux.lo \
+	mibgroup/hardware/cpu/cpu.lo \
+	mibgroup/hardware/cpu/cpu_linux.lo \
+	mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_interface.lo \
+	mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_access.lo \
+	mibgroup/host/data_access/swinst_apt.lo \
+	mibgroup/host/data_access/swrun_procfs_status.lo \
+	mibgroup/if-mib/data_access/interface.lo \
+	mibgroup/if-mib/ifTable/ifTable_interface.lo \
+	mibgroup/if-mib/ifTable/ifTable_data_access.lo \
+	mibgroup/if-mib/ifXTable/ifXTable_interface.lo \
+	mibgroup/if-mib/ifXTable/ifXTable_data_access.lo \
+	mibgroup/ip-mib/ipAddressTable/ipAddressTable_interface.lo \
+	mibgroup/ip-mib/ipAddressTable/ipAddressTable_data_access.lo \
+	mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_interface.lo \
+	mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_data_access.lo \
+	mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_interface.lo \
+	mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_access.lo \
+	mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_get.lo \
+	mibgroup/ip-mib/data_access/arp_common.lo \
+	mibgroup/ip-mib/data_access/arp_netlink.lo \
+	mibgroup/ip-mib/data_access/systemstats_common.lo \
+	mibgroup/ip-mib/data_access/systemstats_linux.lo \
+	mibgroup/ip-mib/data_access/scalars_linux.lo \
+	mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_interface.lo \
+	mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_data_access.lo \
+	mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_data_get.lo \
+	mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_interface.lo \
+	mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_data_access.lo \
+	mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_interface.lo \
+	mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_data_access.lo \
+	mibgroup/tcp-mib/data_access/tcpConn_common.lo \
+	mibgroup/tcp-mib/data_access/tcpConn_linux.lo \
+	mibgroup/util_funcs/get_pid_from_inode.lo \
+	mibgroup/util_funcs/sock_diag.lo \
+	mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable_interface.lo \
+	mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable_data_access.lo \
+	mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable_interface.lo \
+	mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable_data_access.lo \
+	mibgroup/udp-mib/udpEndpointTable/udpEndpointTable_interface.lo \
+	mibgroup/udp-mib/udpEndpointTable/udpEndpointTable_data_access.lo \
+	mibgroup/if-mib/data_access/interface_linux.lo \
+	mibgroup/if-mib/data_access/interface_ioctl.lo \
+	mibgroup/ip-mib/data_access/ipaddress_common.lo \
+	mibgroup/ip-mib/data_access/ipaddress_linux.lo \
+	mibgroup/ip-mib/data_access/defaultrouter_common.lo \
+	mibgroup/ip-mib/data_access/defaultrouter_linux.lo \
+	mibgroup/ip-mib/data_access/ipv6scopezone_common.lo \
+	mibgroup/ip-mib/data_access/ipv6scopezone_linux.lo \
+	mibgroup/ip-forward-mib/data_access/route_common.lo \
+	mibgroup/ip-forward-mib/data_access/route_linux.lo \
+	mibgroup/ip-forward-mib/data_access/route_ioctl.lo \
+	mibgroup/ip-forward-mib/data_access/route_netlink.lo \
+	mibgroup/udp-mib/data_access/udp_endpoint_common.lo \
+	mibgroup/udp-mib/data_access/udp_endpoint_linux.lo \
+	mibgroup/ip-mib/data_access/ipaddress_ioctl.lo
+
+# end configure generated code
@@ -0,0 +1,2 @@
+# contents below built automatically by configure; do not edit by hand
+module_list= \
@@ -0,0 +1,193 @@
+# contents below built automatically by configure; do not edit by hand
+module_list_code= \
+	snmpv3/snmpEngine \
+	snmpv3/snmpMPDStats \
+	snmpv3/usmStats \
+	snmpv3/usmConf \
+	snmpv3/usmUser \
+	mibII/system_mib \
+	mibII/sysORTable \
+	mibII/snmp_mib \
+	mibII/vacm_vars \
+	mibII/setSerialNo \
+	mibII/at \
+	mibII/ip \
+	mibII/tcp \
+	mibII/udp \
+	mibII/ipv6 \
+	mibII/icmp \
+	ucd-snmp/disk_hw \
+	ucd-snmp/proc \
+	ucd-snmp/versioninfo \
+	ucd-snmp/pass \
+	ucd-snmp/pass_persist \
+	ucd-snmp/loadave \
+	agent/extend \
+	ucd-snmp/errormib \
+	ucd-snmp/file \
+	ucd-snmp/dlmod \
+	ucd-snmp/proxy \
+	ucd-snmp/logmatch \
+	ucd-snmp/memory \
+	ucd-snmp/vmstat \
+	notification/snmpNotifyTable \
+	notification/snmpNotifyFilterProfileTable \
+	notification-log-mib/notification_log \
+	target/snmpTargetAddrEntry \
+	target/snmpTargetParamsEntry \
+	target/target \
+	target/target_counters \
+	agent/nsTransactionTable \
+	agent/nsModuleTable \
+	agent/nsDebug \
+	agent/nsCache \
+	agent/nsLogging \
+	agent/nsVacmAccessTable \
+	agentx/master \
+	agentx/subagent \
+	disman/event/mteScalars \
+	disman/event/mteTrigger \
+	disman/event/mteTriggerTable \
+	disman/event/mteTriggerDeltaTable \
+	disman/event/mteTriggerExistenceTable \
+	disman/event/mteTriggerBooleanTable \
+	disman/event/mteTriggerThresholdTable \
+	disman/event/mteTriggerConf \
+	disman/event/mteEvent \
+	disman/event/mteEventTable \
+	disman/event/mteEventSetTable \
+	disman/event/mteEventNotificationTable \
+	disman/event/mteEventConf \
+	disman/event/mteObjects \
+	disman/event/mteObjectsTable \
+	disman/event/mteObjectsConf \
+	disman/schedule/schedCore \
+	disman/schedule/schedConf \
+	disman/schedule/schedTable \
+	utilities/override \
+	utilities/execute \
+	utilities/iquery \
+	host/hrh_storage \
+	host/hrh_filesys \
+	host/hrSWInstalledTable \
+	host/hrSWRunTable \
+	host/hr_system \
+	host/hr_device \
+	host/hr_other \
+	host/hr_proc \
+	host/hr_network \
+	host/hr_print \
+	host/hr_disk \
+	host/hr_partition \
+	util_funcs/header_generic \
+	util_funcs \
+	mibII/updates \
+	mibII/vacm_context \
+	mibII/vacm_conf \
+	mibII/data_access/at_linux \
+	mibII/data_access/at_unix \
+	mibII/kernel_linux \
+	mibII/ipAddr \
+	mibII/var_route \
+	mibII/route_write \
+	mibII/tcpTable \
+	mibII/udpTable \
+	ip-mib/ip_scalars \
+	util_funcs/header_simple_table \
+	util_funcs/restart \
+	ucd-snmp/pass_common \
+	notification/snmpNotifyTable_data \
+	header_complex \
+	snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_storage \
+	snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable \
+	notification/snmpNotifyFilterProfileTable_data \
+	target/snmpTargetAddrEntry_data \
+	target/snmpTargetParamsEntry_data \
+	agentx/protocol \
+	agentx/master_admin \
+	agentx/agentx_config \
+	agentx/client \
+	host/data_access/swinst \
+	host/data_access/swrun \
+	host/hrSWRunPerfTable \
+	host/data_access/hr_disk_linux \
+	host/data_access/hr_partition_other \
+	if-mib/ifTable/ifTable \
+	if-mib/ifXTable/ifXTable \
+	ip-mib/ipAddressTable/ipAddressTable \
+	ip-mib/ipAddressPrefixTable/ipAddressPrefixTable \
+	ip-mib/ipDefaultRouterTable/ipDefaultRouterTable \
+	ip-mib/inetNetToMediaTable/inetNetToMediaTable \
+	ip-mib/inetNetToMediaTable/inetNetToMediaTable_interface \
+	ip-mib/inetNetToMediaTable/inetNetToMediaTable_data_access \
+	ip-mib/ipSystemStatsTable/ipSystemStatsTable \
+	ip-mib/ipSystemStatsTable/ipSystemStatsTable_interface \
+	ip-mib/ipSystemStatsTable/ipSystemStatsTable_data_access \
+	ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable \
+	ip-mib/ipIfStatsTable/ipIfStatsTable \
+	ip-mib/ipIfStatsTable/ipIfStatsTable_interface \
+	ip-mib/ipIfStatsTable/ipIfStatsTable_data_access \
+	ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable \
+	ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable \
+	tcp-mib/tcpConnectionTable/tcpConnectionTable \
+	tcp-mib/tcpListenerTable/tcpListenerTable \
+	udp-mib/udpEndpointTable/udpEndpointTable \
+	hardware/fsys/hw_fsys \
+	hardware/fsys/fsys_mntent \
+	hardware/memory/hw_mem \
+	hardware/memory/memory_linux \
+	hardware/cpu/cpu \
+	hardware/cpu/cpu_linux \
+	snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_interface \
+	snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_access \
+	host/data_access/swinst_apt \
+	host/data_access/swrun_procfs_status \
+	if-mib/data_access/interface \
+	if-mib/ifTable/ifTable_interface \
+	if-mib/ifTable/ifTable_data_access \
+	if-mib/ifXTable/ifXTable_interface \
+	if-mib/ifXTable/ifXTable_data_access \
+	ip-mib/ipAddressTable/ipAddressTable_interface \
+	ip-mib/ipAddressTable/ipAddressTable_data_access \
+	ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_interface \
+	ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_data_access \
+	ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_interface \
+	ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_access \
+	ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_get \
+	ip-mib/data_access/arp_common \
+	ip-mib/data_access/arp_netlink \
+	ip-mib/data_access/systemstats_common \
+	ip-mib/data_access/systemstats_linux \
+	ip-mib/data_access/scalars_linux \
+	ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_interface \
+	ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_data_access \
+	ip-mib/ipIfStatsTable/ipIfStatsTable_data_get \
+	ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_interface \
+	ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_data_access \
+	ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_interface \
+	ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_data_access \
+	tcp-mib/data_access/tcpConn_common \
+	tcp-mib/data_access/tcpConn_linux \
+	util_funcs/get_pid_from_inode \
+	util_funcs/sock_diag \
+	tcp-mib/tcpConnectionTable/tcpConnectionTable_interface \
+	tcp-mib/tcpConnectionTable/tcpConnectionTable_data_access \
+	tcp-mib/tcpListenerTable/tcpListenerTable_interface \
+	tcp-mib/tcpListenerTable/tcpListenerTable_data_access \
+	udp-mib/udpEndpointTable/udpEndpointTable_interface \
+	udp-mib/udpEndpointTable/udpEndpointTable_data_access \
+	if-mib/data_access/interface_linux \
+	if-mib/data_access/interface_ioctl \
+	ip-mib/data_access/ipaddress_common \
+	ip-mib/data_access/ipaddress_linux \
+	ip-mib/data_access/defaultrouter_common \
+	ip-mib/data_access/defaultrouter_linux \
+	ip-mib/data_access/ipv6scopezone_common \
+	ip-mib/data_access/ipv6scopezone_linux \
+	ip-forward-mib/data_access/route_common \
+	ip-forward-mib/data_access/route_linux \
+	ip-forward-mib/data_access/route_ioctl \
+	ip-forward-mib/data_access/route_netlink \
+	udp-mib/data_access/udp_endpoint_common \
+	udp-mib/data_access/udp_endpoint_linux \
+	ip-mib/data_access/ipaddress_ioctl \
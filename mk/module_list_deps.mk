@@ -0,0 +1,216 @@
+# contents below built automatically by configure; do not edit by hand
+read_config.lo: mibgroup/default_modules.h
+read_config.lo: mibgroup/snmpv3mibs.h
+read_config.lo: mibgroup/mibII.h
+read_config.lo: mibgroup/ucd_snmp.h
+read_config.lo: mibgroup/notification.h
+read_config.lo: mibgroup/notification-log-mib.h
+read_config.lo: mibgroup/target.h
+read_config.lo: mibgroup/agent_mibs.h
+read_config.lo: mibgroup/agentx.h
+read_config.lo: mibgroup/disman/event.h
+read_config.lo: mibgroup/disman/schedule.h
+read_config.lo: mibgroup/utilities.h
+read_config.lo: mibgroup/host.h
+read_config.lo: mibgroup/snmpv3/snmpEngine.h
+read_config.lo: mibgroup/snmpv3/snmpMPDStats.h
+read_config.lo: mibgroup/snmpv3/usmStats.h
+read_config.lo: mibgroup/snmpv3/usmConf.h
+read_config.lo: mibgroup/snmpv3/usmUser.h
+read_config.lo: mibgroup/mibII/system_mib.h
+read_config.lo: mibgroup/mibII/sysORTable.h
+read_config.lo: mibgroup/mibII/snmp_mib.h
+read_config.lo: mibgroup/mibII/vacm_vars.h
+read_config.lo: mibgroup/mibII/setSerialNo.h
+read_config.lo: mibgroup/mibII/at.h
+read_config.lo: mibgroup/mibII/ifTable.h
+read_config.lo: mibgroup/mibII/ip.h
+read_config.lo: mibgroup/mibII/tcp.h
+read_config.lo: mibgroup/mibII/udp.h
+read_config.lo: mibgroup/mibII/ipv6.h
+read_config.lo: mibgroup/mibII/icmp.h
+read_config.lo: mibgroup/if-mib.h
+read_config.lo: mibgroup/ip-mib.h
+read_config.lo: mibgroup/ip-forward-mib.h
+read_config.lo: mibgroup/tcp-mib.h
+read_config.lo: mibgroup/udp-mib.h
+read_config.lo: mibgroup/ucd-snmp/disk_hw.h
+read_config.lo: mibgroup/ucd-snmp/proc.h
+read_config.lo: mibgroup/ucd-snmp/versioninfo.h
+read_config.lo: mibgroup/ucd-snmp/pass.h
+read_config.lo: mibgroup/ucd-snmp/pass_persist.h
+read_config.lo: mibgroup/ucd-snmp/loadave.h
+read_config.lo: mibgroup/agent/extend.h
+read_config.lo: mibgroup/ucd-snmp/errormib.h
+read_config.lo: mibgroup/ucd-snmp/file.h
+read_config.lo: mibgroup/ucd-snmp/dlmod.h
+read_config.lo: mibgroup/ucd-snmp/proxy.h
+read_config.lo: mibgroup/ucd-snmp/logmatch.h
+read_config.lo: mibgroup/ucd-snmp/memory.h
+read_config.lo: mibgroup/ucd-snmp/vmstat.h
+read_config.lo: mibgroup/notification/snmpNotifyTable.h
+read_config.lo: mibgroup/snmp-notification-mib/snmpNotifyFilterTable.h
+read_config.lo: mibgroup/notification/snmpNotifyFilterProfileTable.h
+read_config.lo: mibgroup/notification-log-mib/notification_log.h
+read_config.lo: mibgroup/target/snmpTargetAddrEntry.h
+read_config.lo: mibgroup/target/snmpTargetParamsEntry.h
+read_config.lo: mibgroup/target/target.h
+read_config.lo: mibgroup/target/target_counters.h
+read_config.lo: mibgroup/agent/nsTransactionTable.h
+read_config.lo: mibgroup/agent/nsModuleTable.h
+read_config.lo: mibgroup/agent/nsDebug.h
+read_config.lo: mibgroup/agent/nsCache.h
+read_config.lo: mibgroup/agent/nsLogging.h
+read_config.lo: mibgroup/agent/nsVacmAccessTable.h
+read_config.lo: mibgroup/agentx/master.h
+read_config.lo: mibgroup/agentx/subagent.h
+read_config.lo: mibgroup/disman/event/mteScalars.h
+read_config.lo: mibgroup/disman/event/mteTrigger.h
+read_config.lo: mibgroup/disman/event/mteTriggerTable.h
+read_config.lo: mibgroup/disman/event/mteTriggerDeltaTable.h
+read_config.lo: mibgroup/disman/event/mteTriggerExistenceTable.h
+read_config.lo: mibgroup/disman/event/mteTriggerBooleanTable.h
+read_config.lo: mibgroup/disman/event/mteTriggerThresholdTable.h
+read_config.lo: mibgroup/disman/event/mteTriggerConf.h
+read_config.lo: mibgroup/disman/event/mteEvent.h
+read_config.lo: mibgroup/disman/event/mteEventTable.h
+read_config.lo: mibgroup/disman/event/mteEventSetTable.h
+read_config.lo: mibgroup/disman/event/mteEventNotificationTable.h
+read_config.lo: mibgroup/disman/event/mteEventConf.h
+read_config.lo: mibgroup/disman/event/mteObjects.h
+read_config.lo: mibgroup/disman/event/mteObjectsTable.h
+read_config.lo: mibgroup/disman/event/mteObjectsConf.h
+read_config.lo: mibgroup/disman/schedule/schedCore.h
+read_config.lo: mibgroup/disman/schedule/schedConf.h
+read_config.lo: mibgroup/disman/schedule/schedTable.h
+read_config.lo: mibgroup/utilities/override.h
+read_config.lo: mibgroup/utilities/execute.h
+read_config.lo: mibgroup/utilities/iquery.h
+read_config.lo: mibgroup/host/hrh_storage.h
+read_config.lo: mibgroup/host/hrh_filesys.h
+read_config.lo: mibgroup/host/hrSWInstalledTable.h
+read_config.lo: mibgroup/host/hrSWRunTable.h
+read_config.lo: mibgroup/host/hr_system.h
+read_config.lo: mibgroup/host/hr_device.h
+read_config.lo: mibgroup/host/hr_other.h
+read_config.lo: mibgroup/host/hr_proc.h
+read_config.lo: mibgroup/host/hr_network.h
+read_config.lo: mibgroup/host/hr_print.h
+read_config.lo: mibgroup/host/hr_disk.h
+read_config.lo: mibgroup/host/hr_partition.h
+read_config.lo: mibgroup/util_funcs/header_generic.h
+read_config.lo: mibgroup/util_funcs.h
+read_config.lo: mibgroup/mibII/updates.h
+read_config.lo: mibgroup/mibII/vacm_context.h
+read_config.lo: mibgroup/mibII/vacm_conf.h
+read_config.lo: mibgroup/mibII/data_access/at_unix.h
+read_config.lo: mibgroup/if-mib/ifTable.h
+read_config.lo: mibgroup/mibII/kernel_linux.h
+read_config.lo: mibgroup/mibII/ipAddr.h
+read_config.lo: mibgroup/mibII/var_route.h
+read_config.lo: mibgroup/mibII/route_write.h
+read_config.lo: mibgroup/mibII/tcpTable.h
+read_config.lo: mibgroup/mibII/udpTable.h
+read_config.lo: mibgroup/if-mib/ifXTable.h
+read_config.lo: mibgroup/ip-mib/ipAddressTable.h
+read_config.lo: mibgroup/ip-mib/ipAddressPrefixTable.h
+read_config.lo: mibgroup/ip-mib/ipDefaultRouterTable.h
+read_config.lo: mibgroup/ip-mib/inetNetToMediaTable.h
+read_config.lo: mibgroup/ip-mib/ipSystemStatsTable.h
+read_config.lo: mibgroup/ip-mib/ip_scalars.h
+read_config.lo: mibgroup/ip-mib/ipv6ScopeZoneIndexTable.h
+read_config.lo: mibgroup/ip-mib/ipIfStatsTable.h
+read_config.lo: mibgroup/ip-forward-mib/ipCidrRouteTable.h
+read_config.lo: mibgroup/ip-forward-mib/inetCidrRouteTable.h
+read_config.lo: mibgroup/tcp-mib/tcpConnectionTable.h
+read_config.lo: mibgroup/tcp-mib/tcpListenerTable.h
+read_config.lo: mibgroup/udp-mib/udpEndpointTable.h
+read_config.lo: mibgroup/util_funcs/header_simple_table.h
+read_config.lo: mibgroup/hardware/fsys.h
+read_config.lo: mibgroup/util_funcs/restart.h
+read_config.lo: mibgroup/ucd-snmp/pass_common.h
+read_config.lo: mibgroup/hardware/memory.h
+read_config.lo: mibgroup/hardware/cpu.h
+read_config.lo: mibgroup/notification/snmpNotifyTable_data.h
+read_config.lo: mibgroup/header_complex.h
+read_config.lo: mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_storage.h
+read_config.lo: mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable.h
+read_config.lo: mibgroup/notification/snmpNotifyFilterProfileTable_data.h
+read_config.lo: mibgroup/target/snmpTargetAddrEntry_data.h
+read_config.lo: mibgroup/target/snmpTargetParamsEntry_data.h
+read_config.lo: mibgroup/agentx/protocol.h
+read_config.lo: mibgroup/agentx/master_admin.h
+read_config.lo: mibgroup/agentx/agentx_config.h
+read_config.lo: mibgroup/agentx/client.h
+read_config.lo: mibgroup/host/data_access/swinst.h
+read_config.lo: mibgroup/host/data_access/swrun.h
+read_config.lo: mibgroup/host/hrSWRunPerfTable.h
+read_config.lo: mibgroup/if-mib/ifTable/ifTable.h
+read_config.lo: mibgroup/if-mib/ifXTable/ifXTable.h
+read_config.lo: mibgroup/ip-mib/ipAddressTable/ipAddressTable.h
+read_config.lo: mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable.h
+read_config.lo: mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable.h
+read_config.lo: mibgroup/ip-mib/data_access/arp.h
+read_config.lo: mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable.h
+read_config.lo: mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable_interface.h
+read_config.lo: mibgroup/ip-mib/inetNetToMediaTable/inetNetToMediaTable_data_access.h
+read_config.lo: mibgroup/ip-mib/data_access/systemstats.h
+read_config.lo: mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable.h
+read_config.lo: mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable_interface.h
+read_config.lo: mibgroup/ip-mib/ipSystemStatsTable/ipSystemStatsTable_data_access.h
+read_config.lo: mibgroup/ip-mib/data_access/scalars_common.h
+read_config.lo: mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable.h
+read_config.lo: mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable.h
+read_config.lo: mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_interface.h
+read_config.lo: mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_data_access.h
+read_config.lo: mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable.h
+read_config.lo: mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable.h
+read_config.lo: mibgroup/tcp-mib/data_access/tcpConn.h
+read_config.lo: mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable.h
+read_config.lo: mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable.h
+read_config.lo: mibgroup/udp-mib/udpEndpointTable/udpEndpointTable.h
+read_config.lo: mibgroup/hardware/fsys/hw_fsys.h
+read_config.lo: mibgroup/hardware/memory/hw_mem.h
+read_config.lo: mibgroup/hardware/memory/memory_linux.h
+read_config.lo: mibgroup/hardware/cpu/cpu.h
+read_config.lo: mibgroup/hardware/cpu/cpu_linux.h
+read_config.lo: mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_interface.h
+read_config.lo: mibgroup/snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_access.h
+read_config.lo: mibgroup/if-mib/data_access/interface.h
+read_config.lo: mibgroup/if-mib/ifTable/ifTable_interface.h
+read_config.lo: mibgroup/if-mib/ifTable/ifTable_data_access.h
+read_config.lo: mibgroup/if-mib/ifXTable/ifXTable_interface.h
+read_config.lo: mibgroup/if-mib/ifXTable/ifXTable_data_access.h
+read_config.lo: mibgroup/ip-mib/data_access/ipaddress.h
+read_config.lo: mibgroup/ip-mib/ipAddressTable/ipAddressTable_interface.h
+read_config.lo: mibgroup/ip-mib/ipAddressTable/ipAddressTable_data_access.h
+read_config.lo: mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_interface.h
+read_config.lo: mibgroup/ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_data_access.h
+read_config.lo: mibgroup/ip-mib/data_access/defaultrouter.h
+read_config.lo: mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_interface.h
+read_config.lo: mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_access.h
+read_config.lo: mibgroup/ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_get.h
+read_config.lo: mibgroup/ip-mib/data_access/ipv6scopezone.h
+read_config.lo: mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_interface.h
+read_config.lo: mibgroup/ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_data_access.h
+read_config.lo: mibgroup/ip-mib/ipIfStatsTable/ipIfStatsTable_data_get.h
+read_config.lo: mibgroup/ip-forward-mib/data_access/route.h
+read_config.lo: mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_interface.h
+read_config.lo: mibgroup/ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_data_access.h
+read_config.lo: mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_interface.h
+read_config.lo: mibgroup/ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_data_access.h
+read_config.lo: mibgroup/util_funcs/get_pid_from_inode.h
+read_config.lo: mibgroup/util_funcs/sock_diag.h
+read_config.lo: mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable_interface.h
+read_config.lo: mibgroup/tcp-mib/tcpConnectionTable/tcpConnectionTable_data_access.h
+read_config.lo: mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable_interface.h
+read_config.lo: mibgroup/tcp-mib/tcpListenerTable/tcpListenerTable_data_access.h
+read_config.lo: mibgroup/udp-mib/data_access/udp_endpoint.h
+read_config.lo: mibgroup/udp-mib/udpEndpointTable/udpEndpointTable_interface.h
+read_config.lo: mibgroup/udp-mib/udpEndpointTable/udpEndpointTable_data_access.h
+read_config.lo: mibgroup/if-mib/data_access/interface_ioctl.h
+read_config.lo: mibgroup/ip-mib/data_access/ipaddress_linux.h
+read_config.lo: mibgroup/ip-forward-mib/data_access/route_linux.h
+read_config.lo: mibgroup/ip-forward-mib/data_access/route_ioctl.h
+read_config.lo: mibgroup/ip-forward-mib/data_access/route_netlink.h
+read_config.lo: mibgroup/ip-mib/data_access/ipaddress_ioctl.h
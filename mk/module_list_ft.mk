@@ -0,0 +1,195 @@
+# contents below built automatically by configure; do not edit by hand
+module_list_ft= \
+	snmpv3/snmpEngine.ft \
+	snmpv3/snmpMPDStats.ft \
+	snmpv3/usmStats.ft \
+	snmpv3/usmConf.ft \
+	snmpv3/usmUser.ft \
+	mibII/system_mib.ft \
+	mibII/sysORTable.ft \
+	mibII/snmp_mib.ft \
+	mibII/vacm_vars.ft \
+	mibII/setSerialNo.ft \
+	mibII/at.ft \
+	mibII/ip.ft \
+	mibII/tcp.ft \
+	mibII/udp.ft \
+	mibII/ipv6.ft \
+	mibII/icmp.ft \
+	ucd-snmp/disk_hw.ft \
+	ucd-snmp/proc.ft \
+	ucd-snmp/versioninfo.ft \
+	ucd-snmp/pass.ft \
+	ucd-snmp/pass_persist.ft \
+	ucd-snmp/loadave.ft \
+	agent/extend.ft \
+	ucd-snmp/errormib.ft \
+	ucd-snmp/file.ft \
+	ucd-snmp/dlmod.ft \
+	ucd-snmp/proxy.ft \
+	ucd-snmp/logmatch.ft \
+	ucd-snmp/memory.ft \
+	ucd-snmp/vmstat.ft \
+	notification/snmpNotifyTable.ft \
+	notification/snmpNotifyFilterProfileTable.ft \
+	notification-log-mib/notification_log.ft \
+	target/snmpTargetAddrEntry.ft \
+	target/snmpTargetParamsEntry.ft \
+	target/target.ft \
+	target/target_counters.ft \
+	agent/nsTransactionTable.ft \
+	agent/nsModuleTable.ft \
+	agent/nsDebug.ft \
+	agent/nsCache.ft \
+	agent/nsLogging.ft \
+	agent/nsVacmAccessTable.ft \
+	agentx/master.ft \
+	agentx/subagent.ft \
+	disman/event/mteScalars.ft \
+	disman/event/mteTrigger.ft \
+	disman/event/mteTriggerTable.ft \
+	disman/event/mteTriggerDeltaTable.ft \
+	disman/event/mteTriggerExistenceTable.ft \
+	disman/event/mteTriggerBooleanTable.ft \
+	disman/event/mteTriggerThresholdTable.ft \
+	disman/event/mteTriggerConf.ft \
+	disman/event/mteEvent.ft \
+	disman/event/mteEventTable.ft \
+	disman/event/mteEventSetTable.ft \
+	disman/event/mteEventNotificationTable.ft \
+	disman/event/mteEventConf.ft \
+	disman/event/mteObjects.ft \
+	disman/event/mteObjectsTable.ft \
+	disman/event/mteObjectsConf.ft \
+	disman/schedule/schedCore.ft \
+	disman/schedule/schedConf.ft \
+	disman/schedule/schedTable.ft \
+	utilities/override.ft \
+	utilities/execute.ft \
+	utilities/iquery.ft \
+	host/hrh_storage.ft \
+	host/hrh_filesys.ft \
+	host/hrSWInstalledTable.ft \
+	host/hrSWRunTable.ft \
+	host/hr_system.ft \
+	host/hr_device.ft \
+	host/hr_other.ft \
+	host/hr_proc.ft \
+	host/hr_network.ft \
+	host/hr_print.ft \
+	host/hr_disk.ft \
+	host/hr_partition.ft \
+	util_funcs/header_generic.ft \
+	util_funcs.ft \
+	mibII/updates.ft \
+	mibII/vacm_context.ft \
+	mibII/vacm_conf.ft \
+	mibII/data_access/at_linux.ft \
+	mibII/data_access/at_unix.ft \
+	mibII/kernel_linux.ft \
+	mibII/ipAddr.ft \
+	mibII/var_route.ft \
+	mibII/route_write.ft \
+	mibII/tcpTable.ft \
+	mibII/udpTable.ft \
+	ip-mib/ip_scalars.ft \
+	util_funcs/header_simple_table.ft \
+	util_funcs/restart.ft \
+	ucd-snmp/pass_common.ft \
+	notification/snmpNotifyTable_data.ft \
+	header_complex.ft \
+	snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_storage.ft \
+	snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable.ft \
+	notification/snmpNotifyFilterProfileTable_data.ft \
+	target/snmpTargetAddrEntry_data.ft \
+	target/snmpTargetParamsEntry_data.ft \
+	agentx/protocol.ft \
+	agentx/master_admin.ft \
+	agentx/agentx_config.ft \
+	agentx/client.ft \
+	host/data_access/swinst.ft \
+	host/data_access/swrun.ft \
+	host/hrSWRunPerfTable.ft \
+	host/data_access/hr_disk_linux.ft \
+	host/data_access/hr_partition_other.ft \
+	if-mib/ifTable/ifTable.ft \
+	if-mib/ifXTable/ifXTable.ft \
+	ip-mib/ipAddressTable/ipAddressTable.ft \
+	ip-mib/ipAddressPrefixTable/ipAddressPrefixTable.ft \
+	ip-mib/ipDefaultRouterTable/ipDefaultRouterTable.ft \
+	ip-mib/inetNetToMediaTable/inetNetToMediaTable.ft \
+	ip-mib/inetNetToMediaTable/inetNetToMediaTable_interface.ft \
+	ip-mib/inetNetToMediaTable/inetNetToMediaTable_data_access.ft \
+	ip-mib/ipSystemStatsTable/ipSystemStatsTable.ft \
+	ip-mib/ipSystemStatsTable/ipSystemStatsTable_interface.ft \
+	ip-mib/ipSystemStatsTable/ipSystemStatsTable_data_access.ft \
+	ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable.ft \
+	ip-mib/ipIfStatsTable/ipIfStatsTable.ft \
+	ip-mib/ipIfStatsTable/ipIfStatsTable_interface.ft \
+	ip-mib/ipIfStatsTable/ipIfStatsTable_data_access.ft \
+	ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable.ft \
+	ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable.ft \
+	tcp-mib/tcpConnectionTable/tcpConnectionTable.ft \
+	tcp-mib/tcpListenerTable/tcpListenerTable.ft \
+	udp-mib/udpEndpointTable/udpEndpointTable.ft \
+	hardware/fsys/hw_fsys.ft \
+	hardware/fsys/fsys_mntent.ft \
+	hardware/memory/hw_mem.ft \
+	hardware/memory/memory_linux.ft \
+	hardware/cpu/cpu.ft \
+	hardware/cpu/cpu_linux.ft \
+	snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_interface.ft \
+	snmp-notification-mib/snmpNotifyFilterTable/snmpNotifyFilterTable_data_access.ft \
+	host/data_access/swinst_apt.ft \
+	host/data_access/swrun_procfs_status.ft \
+	if-mib/data_access/interface.ft \
+	if-mib/ifTable/ifTable_interface.ft \
+	if-mib/ifTable/ifTable_data_access.ft \
+	if-mib/ifXTable/ifXTable_interface.ft \
+	if-mib/ifXTable/ifXTable_data_access.ft \
+	ip-mib/ipAddressTable/ipAddressTable_interface.ft \
+	ip-mib/ipAddressTable/ipAddressTable_data_access.ft \
+	ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_interface.ft \
+	ip-mib/ipAddressPrefixTable/ipAddressPrefixTable_data_access.ft \
+	ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_interface.ft \
+	ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_access.ft \
+	ip-mib/ipDefaultRouterTable/ipDefaultRouterTable_data_get.ft \
+	ip-mib/data_access/arp_common.ft \
+	ip-mib/data_access/arp_netlink.ft \
+	ip-mib/data_access/systemstats_common.ft \
+	ip-mib/data_access/systemstats_linux.ft \
+	ip-mib/data_access/scalars_linux.ft \
+	ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_interface.ft \
+	ip-mib/ipv6ScopeZoneIndexTable/ipv6ScopeZoneIndexTable_data_access.ft \
+	ip-mib/ipIfStatsTable/ipIfStatsTable_data_get.ft \
+	ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_interface.ft \
+	ip-forward-mib/ipCidrRouteTable/ipCidrRouteTable_data_access.ft \
+	ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_interface.ft \
+	ip-forward-mib/inetCidrRouteTable/inetCidrRouteTable_data_access.ft \
+	tcp-mib/data_access/tcpConn_common.ft \
+	tcp-mib/data_access/tcpConn_linux.ft \
+	util_funcs/get_pid_from_inode.ft \
+	util_funcs/sock_diag.ft \
+	tcp-mib/tcpConnectionTable/tcpConnectionTable_interface.ft \
+	tcp-mib/tcpConnectionTable/tcpConnectionTable_data_access.ft \
+	tcp-mib/tcpListenerTable/tcpListenerTable_interface.ft \
+	tcp-mib/tcpListenerTable/tcpListenerTable_data_access.ft \
+	udp-mib/udpEndpointTable/udpEndpointTable_interface.ft \
+	udp-mib/udpEndpointTable/udpEndpointTable_data_access.ft \
+	if-mib/data_access/interface_linux.ft \
+	if-mib/data_access/interface_ioctl.ft \
+	ip-mib/data_access/ipaddress_common.ft \
+	ip-mib/data_access/ipaddress_linux.ft \
+	ip-mib/data_access/defaultrouter_common.ft \
+	ip-mib/data_access/defaultrouter_linux.ft \
+	ip-mib/data_access/ipv6scopezone_common.ft \
+	ip-mib/data_access/ipv6scopezone_linux.ft \
+	ip-forward-mib/data_access/route_common.ft \
+	ip-forward-mib/data_access/route_linux.ft \
+	ip-forward-mib/data_access/route_ioctl.ft \
+	ip-forward-mib/data_access/route_netlink.ft \
+	udp-mib/data_access/udp_endpoint_common.ft \
+	udp-mib/data_access/udp_endpoint_linux.ft \
+	ip-mib/data_access/ipaddress_ioctl.ft
+
+# end configure generated code
@@ -0,0 +1 @@
+# contents below built automatically by configure; do not edit by hand
@@ -0,0 +1,196 @@
+/*
+ * arena.c: a bump allocator for data that is released all at once.
+ */
+/** @defgroup arena Arena allocator
+ *  Allocate many small objects that are released together.
+ *  @ingroup library
+ *
+ *  An arena hands out memory from large chunks by moving a pointer
+ *  forward.  Individual allocations cannot be freed; netsnmp_arena_reset()
+ *  and netsnmp_arena_free() release everything at once.  This suits data
+ *  with a well defined lifetime, such as the per request state of the
+ *  agent.
+ *
+ *  @{
+ */
+#include <net-snmp/net-snmp-config.h>
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include <net-snmp/types.h>
+#include <net-snmp/library/arena.h>
+
+#define ARENA_DEFAULT_CHUNK 8192
+
+typedef union {
+    void           *p;
+    long            l;
+    double          d;
+} arena_align;
+
+#define ARENA_ALIGN(n) \
+    (((n) + sizeof(arena_align) - 1) & ~(sizeof(arena_align) - 1))
+
+typedef struct arena_chunk_s {
+    struct arena_chunk_s *next;
+    size_t          size;
+    size_t          used;
+    arena_align     data[1];
+} arena_chunk;
+
+struct netsnmp_arena_s {
+    arena_chunk    *chunks;      /* current chunk first, initial chunk last */
+    size_t          chunk_size;
+    size_t          allocs;      /* since creation or the last reset */
+    size_t          chunks_added;
+};
+
+static arena_chunk *
+_arena_chunk_new(size_t size)
+{
+    arena_chunk    *chunk;
+
+    chunk = (arena_chunk *) malloc(offsetof(arena_chunk, data) + size);
+    if (chunk == NULL)
+        return NULL;
+    chunk->next = NULL;
+    chunk->size = size;
+    chunk->used = 0;
+    return chunk;
+}
+
+netsnmp_arena *
+netsnmp_arena_create(size_t chunk_size)
+{
+    netsnmp_arena  *arena;
+
+    arena = (netsnmp_arena *) malloc(sizeof(*arena));
+    if (arena == NULL)
+        return NULL;
+    arena->chunk_size =
+        ARENA_ALIGN(chunk_size ? chunk_size : ARENA_DEFAULT_CHUNK);
+    arena->chunks = _arena_chunk_new(arena->chunk_size);
+    if (arena->chunks == NULL) {
+        free(arena);
+        return NULL;
+    }
+    arena->allocs = 0;
+    arena->chunks_added = 1;
+    return arena;
+}
+
+void
+netsnmp_arena_free(netsnmp_arena *arena)
+{
+    arena_chunk    *chunk;
+
+    if (arena == NULL)
+        return;
+    while ((chunk = arena->chunks) != NULL) {
+        arena->chunks = chunk->next;
+        free(chunk);
+    }
+    free(arena);
+}
+
+void
+netsnmp_arena_reset(netsnmp_arena *arena)
+{
+    arena_chunk    *chunk;
+
+    if (arena == NULL || arena->chunks == NULL)
+        return;
+    while ((chunk = arena->chunks)->next != NULL) {
+        arena->chunks = chunk->next;
+        free(chunk);
+    }
+    chunk->used = 0;
+    arena->allocs = 0;
+    arena->chunks_added = 0;
+}
+
+void *
+netsnmp_arena_alloc(netsnmp_arena *arena, size_t size)
+{
+    arena_chunk    *chunk;
+    void           *ptr;
+
+    if (arena == NULL)
+        return NULL;
+    if (size == 0)
+        size = 1;
+    if (size > (size_t) -1 - sizeof(arena_align))
+        return NULL;
+    size = ARENA_ALIGN(size);
+
+    chunk = arena->chunks;
+    if (chunk == NULL || chunk->size - chunk->used < size) {
+        chunk = _arena_chunk_new(size > arena->chunk_size ?
+                                 size : arena->chunk_size);
+        if (chunk == NULL)
+            return NULL;
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+        arena->chunks_added++;
+    }
+    ptr = (char *) chunk->data + chunk->used;
+    chunk->used += size;
+    arena->allocs++;
+    memset(ptr, 0, size);
+    return ptr;
+}
+
+char *
+netsnmp_arena_strdup(netsnmp_arena *arena, const char *s)
+{
+    size_t          len;
+    char           *copy;
+
+    if (s == NULL)
+        return NULL;
+    len = strlen(s) + 1;
+    copy = (char *) netsnmp_arena_alloc(arena, len);
+    if (copy != NULL)
+        memcpy(copy, s, len);
+    return copy;
+}
+
+void
+netsnmp_arena_adopt(netsnmp_arena *dst, netsnmp_arena *src)
+{
+    arena_chunk    *last;
+
+    if (dst == NULL || src == NULL || dst == src)
+        return;
+    if (src->chunks != NULL) {
+        /*
+         * Keep the current chunk of dst in front, and its initial chunk
+         * last, so that a reset keeps the right one.
+         */
+        for (last = src->chunks; last->next; last = last->next)
+            ;
+        if (dst->chunks != NULL) {
+            last->next = dst->chunks->next;
+            dst->chunks->next = src->chunks;
+        } else {
+            dst->chunks = src->chunks;
+        }
+    }
+    dst->allocs += src->allocs;
+    dst->chunks_added += src->chunks_added;
+    free(src);
+}
+
+void
+netsnmp_arena_stats(const netsnmp_arena *arena, size_t *allocs,
+                    size_t *chunks)
+{
+    if (allocs)
+        *allocs = arena ? arena->allocs : 0;
+    if (chunks)
+        *chunks = arena ? arena->chunks_added : 0;
+}
+/**  @} */
@@ -916,6 +916,60 @@ u_char         *
 asn_parse_string(u_char * data,
                  size_t * datalength,
                  u_char * type, u_char * str, size_t * strlength)
+{
+    static const char *errpre = "parse string";
+    u_char         *bufp, *src;
+    size_t          len, srclen;
+
+    if (NULL == data || NULL == datalength || NULL == type || NULL == str ||
+        NULL == strlength) {
+        ERROR_MSG("parse string: NULL pointer");
+        return NULL;
+    }
+
+    len = *datalength;
+    bufp = asn_parse_string_ptr(data, &len, type, &src, &srclen);
+    if (NULL == bufp)
+        return NULL;
+
+    if (srclen > *strlength) {
+        _asn_length_err(errpre, srclen, *strlength);
+        return NULL;
+    }
+
+    memmove(str, src, srclen);
+    if (*strlength > srclen)
+        str[srclen] = 0;
+    *strlength = srclen;
+    *datalength = len;
+
+    return bufp;
+}
+
+
+/**
+ * @internal
+ * asn_parse_string_ptr - locates the contents of an ASN octet string type
+ * without copying them.
+ *
+ *  On entry, datalength is input as the number of valid bytes following
+ *   "data".  On exit, it is returned as the number of valid bytes
+ *   following the beginning of the next object.
+ *
+ * @param data        IN - pointer to start of object
+ * @param datalength  IN/OUT - number of valid bytes left in buffer
+ * @param type        OUT - asn type of object
+ * @param str         OUT - pointer to the contents of the string in data
+ * @param strlength   OUT - length of the string
+ *
+ * @return  Returns a pointer to the first byte past the end
+ *          of this object (i.e. the start of the next object).
+ *          Returns NULL on any error.
+ */
+u_char         *
+asn_parse_string_ptr(u_char * data,
+                     size_t * datalength,
+                     u_char * type, u_char ** str, size_t * strlength)
 {
     static const char *errpre = "parse string";
     u_char         *bufp = data;
@@ -946,16 +1000,9 @@ asn_parse_string(u_char * data,
         return NULL;
     }
 
-    if (asn_length > *strlength) {
-        _asn_length_err(errpre, (size_t) asn_length, *strlength);
-        return NULL;
-    }
-
     DEBUGDUMPSETUP("recv", data, bufp - data + asn_length);
 
-    memmove(str, bufp, asn_length);
-    if (*strlength > asn_length)
-        str[asn_length] = 0;
+    *str = bufp;
     *strlength = asn_length;
     *datalength -= asn_length + (bufp - data);
 
@@ -964,7 +1011,7 @@ asn_parse_string(u_char * data,
         size_t          l = (buf != NULL) ? (1 + asn_length) : 0, ol = 0;
 
         if (sprint_realloc_asciistring
-            (&buf, &l, &ol, 1, str, asn_length)) {
+            (&buf, &l, &ol, 1, bufp, asn_length)) {
             DEBUGMSG(("dumpv_recv", "  String:\t%s\n", buf));
         } else {
             if (buf == NULL) {
@@ -24,6 +24,25 @@ netsnmp_feature_child_of(data_list_get_list_node, data_list_all);
  * @{
 */
 
+/*
+ * Nodes allocated from an arena keep their free function behind the public
+ * part of the node.  Their free_func is set to _data_list_arena_node, which
+ * is never called; it tells the functions below that the node and its name
+ * are released with the arena.
+ */
+typedef struct data_list_arena_node_s {
+    netsnmp_data_list node;
+    Netsnmp_Free_List_Data *free_func;
+} data_list_arena_node;
+
+static void
+_data_list_arena_node(void *data)
+{
+    netsnmp_assert(!"arena data list marker called");
+}
+
+#define IS_ARENA_NODE(node) ((node)->free_func == _data_list_arena_node)
+
 /** frees the data and a name at a given data_list node.
  * Note that this doesn't free the node itself.
  * @param node the node for which the data should be freed
@@ -35,6 +54,14 @@ netsnmp_free_list_data(netsnmp_data_list *node)
     if (!node)
         return;
 
+    if (IS_ARENA_NODE(node)) {
+        beer = ((data_list_arena_node *) node)->free_func;
+        if (beer)
+            (beer) (node->data);
+        ((data_list_arena_node *) node)->free_func = NULL;
+        node->name = NULL;
+        return;
+    }
     beer = node->free_func;
     if (beer)
         (beer) (node->data);
@@ -52,7 +79,8 @@ netsnmp_free_all_list_data(netsnmp_data_list *head)
         netsnmp_free_list_data(head);
         tmpptr = head;
         head = head->next;
-        SNMP_FREE(tmpptr);
+        if (!IS_ARENA_NODE(tmpptr))
+            SNMP_FREE(tmpptr);
     }
 }
 
@@ -83,6 +111,36 @@ netsnmp_create_data_list(const char *name, void *data,
     return node;
 }
 
+/** like netsnmp_create_data_list(), but allocates the node from an arena.
+ * The node is released with the arena; freeing it with the other data
+ * list functions only calls its free function.
+ * @param arena the arena to allocate the node from
+ * @param name the name of the node to cache the data.
+ * @param data the data to be stored under that name
+ * @param beer A function that can free the data pointer (in the future)
+ * @return a newly created data_list node, or NULL
+ */
+netsnmp_data_list *
+netsnmp_create_data_list_arena(netsnmp_arena *arena, const char *name,
+                               void *data, Netsnmp_Free_List_Data * beer)
+{
+    data_list_arena_node *anode;
+
+    if (!name)
+        return NULL;
+    anode = (data_list_arena_node *)
+        netsnmp_arena_alloc(arena, sizeof(data_list_arena_node));
+    if (!anode)
+        return NULL;
+    anode->node.name = netsnmp_arena_strdup(arena, name);
+    if (!anode->node.name)
+        return NULL;
+    anode->node.data = data;
+    anode->node.free_func = _data_list_arena_node;
+    anode->free_func = beer;
+    return &anode->node;
+}
+
 /** adds data to a datalist
  * @param head a pointer to the head node of a data_list
  * @param node a node to stash in the data_list
@@ -226,7 +284,8 @@ netsnmp_remove_list_node(netsnmp_data_list **realhead, const char *name)
             else
                 *realhead = head->next;
             netsnmp_free_list_data(head);
-            free(head);
+            if (!IS_ARENA_NODE(head))
+                free(head);
             return 0;
         }
     }
@@ -0,0 +1,593 @@
+/*
+ * event_loop.c: wait for and dispatch activity on the library sessions and
+ * on the file descriptors registered with the fd event manager.
+ *
+ * The select() based main loops rebuild their file descriptor sets from the
+ * session list and the fd event manager on every iteration, which costs time
+ * proportional to the number of open descriptors even if only one of them is
+ * active.  Where epoll is available this event loop instead keeps an epoll
+ * interest set.  snmp_api.c and fd_event_manager.c tell every event loop
+ * about each session that is added or removed and each descriptor that is
+ * (un)registered, and only that descriptor is updated in the set.  On other
+ * systems, or when no epoll instance can be created, it falls back to the
+ * select() based functions.
+ */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-features.h>
+
+#include <errno.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#ifdef HAVE_SYS_SELECT_H
+#include <sys/select.h>
+#endif
+#ifdef HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#define NETSNMP_EVENT_LOOP_EPOLL 1
+#endif
+
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/fd_event_manager.h>
+#include <net-snmp/library/snmp_transport.h>
+#include <net-snmp/library/event_loop.h>
+
+netsnmp_feature_child_of(event_loop, libnetsnmp);
+
+#ifndef NETSNMP_FEATURE_REMOVE_EVENT_LOOP
+
+#define EVENT_LOOP_MAX_EVENTS 64
+
+extern struct session_list *Sessions;   /* snmp_api.c */
+
+/*
+ * What is known about one file descriptor, indexed by its number.
+ */
+struct event_loop_fd {
+    struct session_list *slp;           /* session reading from it, if any */
+    unsigned int    armed;              /* events registered with epoll */
+};
+
+struct netsnmp_event_loop_s {
+    int             flags;
+    int             epfd;               /* -1 if select() is used */
+    int             count;              /* result of the last wait */
+    struct event_loop_fd *fds;
+    int             fds_len;
+    netsnmp_large_fd_set readfds;       /* handed to snmp_sess_read2() */
+    netsnmp_large_fd_set writefds;      /* select() only */
+    netsnmp_large_fd_set exceptfds;     /* select() only */
+#ifdef NETSNMP_EVENT_LOOP_EPOLL
+    struct epoll_event events[EVENT_LOOP_MAX_EVENTS];
+#endif
+    struct netsnmp_event_loop_s *next;
+};
+
+/* the loops that want to hear about session and fd changes (MT_LIB_SESSION) */
+static netsnmp_event_loop *event_loops;
+
+#ifdef NETSNMP_EVENT_LOOP_EPOLL
+
+static struct event_loop_fd *
+_event_loop_fd(netsnmp_event_loop *loop, int fd)
+{
+    struct event_loop_fd *fds;
+    int             len;
+
+    if (fd < 0)
+        return NULL;
+    if (fd >= loop->fds_len) {
+        len = loop->fds_len ? loop->fds_len : 64;
+        while (len <= fd)
+            len *= 2;
+        fds = realloc(loop->fds, len * sizeof(*fds));
+        if (fds == NULL) {
+            snmp_log(LOG_ERR, "event_loop: out of memory for fd %d\n", fd);
+            return NULL;
+        }
+        memset(fds + loop->fds_len, 0,
+               (len - loop->fds_len) * sizeof(*fds));
+        loop->fds = fds;
+        loop->fds_len = len;
+    }
+    return &loop->fds[fd];
+}
+
+/*
+ * Work out which events fd is wanted for and bring its epoll registration
+ * in line.  The registration is renewed even if it looks unchanged, which
+ * covers descriptors that have been closed and reopened behind our back
+ * (closing a descriptor silently removes it from the epoll set).
+ */
+static void
+_event_loop_update(netsnmp_event_loop *loop, int fd)
+{
+    struct event_loop_fd *efd;
+    struct epoll_event ev;
+    int             i, rc = -1;
+
+    efd = _event_loop_fd(loop, fd);
+    if (efd == NULL)
+        return;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.data.fd = fd;
+    if (efd->slp)
+        ev.events |= EPOLLIN;
+#ifndef NETSNMP_FEATURE_REMOVE_FD_EVENT_MANAGER
+    for (i = 0; i < external_readfdlen; i++)
+        if (external_readfd[i] == fd)
+            ev.events |= EPOLLIN;
+    for (i = 0; i < external_writefdlen; i++)
+        if (external_writefd[i] == fd)
+            ev.events |= EPOLLOUT;
+    for (i = 0; i < external_exceptfdlen; i++)
+        if (external_exceptfd[i] == fd)
+            ev.events |= EPOLLPRI;
+#endif
+
+    if (ev.events == 0) {
+        /* ENOENT or EBADF: already gone together with the descriptor */
+        if (efd->armed)
+            (void)epoll_ctl(loop->epfd, EPOLL_CTL_DEL, fd, &ev);
+        efd->armed = 0;
+        return;
+    }
+
+    if (efd->armed)
+        rc = epoll_ctl(loop->epfd, EPOLL_CTL_MOD, fd, &ev);
+    if (!efd->armed || (rc < 0 && errno == ENOENT))
+        rc = epoll_ctl(loop->epfd, EPOLL_CTL_ADD, fd, &ev);
+    if (rc < 0 && errno == EEXIST)
+        rc = epoll_ctl(loop->epfd, EPOLL_CTL_MOD, fd, &ev);
+    if (rc < 0) {
+        snmp_log(LOG_ERR, "event_loop: cannot watch fd %d: %s\n", fd,
+                 strerror(errno));
+        efd->armed = 0;
+        return;
+    }
+    efd->armed = ev.events;
+}
+
+static void
+_event_loop_add_session(netsnmp_event_loop *loop, struct session_list *slp)
+{
+    struct event_loop_fd *efd;
+    int             fd;
+
+    if (slp->transport == NULL || slp->transport->sock < 0)
+        return;
+    fd = slp->transport->sock;
+    efd = _event_loop_fd(loop, fd);
+    if (efd == NULL)
+        return;
+    efd->slp = slp;
+    _event_loop_update(loop, fd);
+    DEBUGMSGTL(("event_loop", "%p: watching session %p on fd %d\n", loop,
+                slp, fd));
+}
+
+static void
+_event_loop_remove_session(netsnmp_event_loop *loop,
+                           struct session_list *slp)
+{
+    int             fd = -1;
+
+    if (slp->transport && slp->transport->sock >= 0 &&
+        slp->transport->sock < loop->fds_len &&
+        loop->fds[slp->transport->sock].slp == slp)
+        fd = slp->transport->sock;
+    else
+        /* its socket is already gone; this is rare, so look it up */
+        for (fd = loop->fds_len - 1; fd >= 0; fd--)
+            if (loop->fds[fd].slp == slp)
+                break;
+    if (fd < 0)
+        return;
+    loop->fds[fd].slp = NULL;
+    _event_loop_update(loop, fd);
+    DEBUGMSGTL(("event_loop", "%p: no longer watching session %p on fd %d\n",
+                loop, slp, fd));
+}
+
+#endif                          /* NETSNMP_EVENT_LOOP_EPOLL */
+
+netsnmp_event_loop *
+netsnmp_event_loop_create(int flags)
+{
+    netsnmp_event_loop *loop;
+#ifdef NETSNMP_EVENT_LOOP_EPOLL
+    struct session_list *slp;
+    int             i;
+#endif
+
+    loop = SNMP_MALLOC_TYPEDEF(netsnmp_event_loop);
+    if (loop == NULL)
+        return NULL;
+
+    loop->flags = flags;
+    loop->epfd = -1;
+    netsnmp_large_fd_set_init(&loop->readfds, FD_SETSIZE);
+    netsnmp_large_fd_set_init(&loop->writefds, FD_SETSIZE);
+    netsnmp_large_fd_set_init(&loop->exceptfds, FD_SETSIZE);
+    NETSNMP_LARGE_FD_ZERO(&loop->readfds);
+
+#ifdef NETSNMP_EVENT_LOOP_EPOLL
+#ifdef EPOLL_CLOEXEC
+    loop->epfd = epoll_create1(EPOLL_CLOEXEC);
+#else
+    loop->epfd = epoll_create(EVENT_LOOP_MAX_EVENTS);
+#if defined(HAVE_FCNTL_H) && defined(FD_CLOEXEC)
+    if (loop->epfd >= 0)
+        fcntl(loop->epfd, F_SETFD, FD_CLOEXEC);
+#endif
+#endif
+    if (loop->epfd < 0)
+        DEBUGMSGTL(("event_loop", "epoll unavailable (%s), using select\n",
+                    strerror(errno)));
+
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_SESSION);
+    if (loop->epfd >= 0) {
+        /* from now on, changes are passed on as they happen */
+        for (slp = Sessions; slp; slp = slp->next)
+            _event_loop_add_session(loop, slp);
+#ifndef NETSNMP_FEATURE_REMOVE_FD_EVENT_MANAGER
+        for (i = 0; i < external_readfdlen; i++)
+            _event_loop_update(loop, external_readfd[i]);
+        for (i = 0; i < external_writefdlen; i++)
+            _event_loop_update(loop, external_writefd[i]);
+        for (i = 0; i < external_exceptfdlen; i++)
+            _event_loop_update(loop, external_exceptfd[i]);
+#endif
+    }
+    loop->next = event_loops;
+    event_loops = loop;
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_SESSION);
+#endif                          /* NETSNMP_EVENT_LOOP_EPOLL */
+
+    DEBUGMSGTL(("event_loop", "created %p using %s\n", loop,
+                netsnmp_event_loop_backend(loop)));
+    return loop;
+}
+
+void
+netsnmp_event_loop_free(netsnmp_event_loop *loop)
+{
+    netsnmp_event_loop **prev;
+
+    if (loop == NULL)
+        return;
+
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_SESSION);
+    for (prev = &event_loops; *prev; prev = &(*prev)->next) {
+        if (*prev == loop) {
+            *prev = loop->next;
+            break;
+        }
+    }
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_SESSION);
+
+    if (loop->epfd >= 0)
+        close(loop->epfd);
+    netsnmp_large_fd_set_cleanup(&loop->readfds);
+    netsnmp_large_fd_set_cleanup(&loop->writefds);
+    netsnmp_large_fd_set_cleanup(&loop->exceptfds);
+    SNMP_FREE(loop->fds);
+    free(loop);
+}
+
+const char *
+netsnmp_event_loop_backend(netsnmp_event_loop *loop)
+{
+    return (loop && loop->epfd >= 0) ? "epoll" : "select";
+}
+
+void
+netsnmp_event_loop_session_added(struct session_list *slp)
+{
+#ifdef NETSNMP_EVENT_LOOP_EPOLL
+    netsnmp_event_loop *loop;
+
+    for (loop = event_loops; loop; loop = loop->next)
+        if (loop->epfd >= 0)
+            _event_loop_add_session(loop, slp);
+#endif
+}
+
+void
+netsnmp_event_loop_session_removed(struct session_list *slp)
+{
+#ifdef NETSNMP_EVENT_LOOP_EPOLL
+    netsnmp_event_loop *loop;
+
+    for (loop = event_loops; loop; loop = loop->next)
+        if (loop->epfd >= 0)
+            _event_loop_remove_session(loop, slp);
+#endif
+}
+
+void
+netsnmp_event_loop_external_changed(int fd)
+{
+#ifdef NETSNMP_EVENT_LOOP_EPOLL
+    netsnmp_event_loop *loop;
+
+    for (loop = event_loops; loop; loop = loop->next)
+        if (loop->epfd >= 0)
+            _event_loop_update(loop, fd);
+#endif
+}
+
+/*
+ * The compatibility path: what agent_check_and_process() does, minus the
+ * agent specific parts.
+ */
+static int
+_event_loop_wait_select(netsnmp_event_loop *loop, struct timeval *timeout)
+{
+    struct timeval  tv, *tvp = &tv;
+    int             numfds = 0, block = 1;
+
+    NETSNMP_LARGE_FD_ZERO(&loop->readfds);
+    NETSNMP_LARGE_FD_ZERO(&loop->writefds);
+    NETSNMP_LARGE_FD_ZERO(&loop->exceptfds);
+
+    timerclear(&tv);
+    if (timeout) {
+        tv = *timeout;
+        block = 0;
+    }
+    snmp_sess_select_info2_flags(NULL, &numfds, &loop->readfds, &tv, &block,
+                                 loop->flags);
+    if (block) {
+        /* nothing due: tv is undefined, use the caller's timeout */
+        if (timeout)
+            tv = *timeout;
+        else
+            tvp = NULL;
+    }
+
+#ifndef NETSNMP_FEATURE_REMOVE_FD_EVENT_MANAGER
+    netsnmp_external_event_info2(&numfds, &loop->readfds, &loop->writefds,
+                                 &loop->exceptfds);
+#endif
+
+    return netsnmp_large_fd_set_select(numfds, &loop->readfds,
+                                       &loop->writefds, &loop->exceptfds,
+                                       tvp);
+}
+
+static void
+_event_loop_dispatch_select(netsnmp_event_loop *loop)
+{
+    if (loop->count > 0) {
+#ifndef NETSNMP_FEATURE_REMOVE_FD_EVENT_MANAGER
+        int             pending = loop->count;
+
+        netsnmp_dispatch_external_events2(&pending, &loop->readfds,
+                                          &loop->writefds, &loop->exceptfds);
+#endif
+        snmp_read2(&loop->readfds);
+    } else if (loop->count == 0) {
+        snmp_timeout();
+    }
+}
+
+#ifdef NETSNMP_EVENT_LOOP_EPOLL
+
+/*
+ * Work out how long to wait: at most *timeout, or forever if timeout is
+ * NULL, but no longer than until the next request or alarm is due.
+ */
+static struct timeval *
+_event_loop_timeout(netsnmp_event_loop *loop, struct timeval *timeout,
+                    struct timeval *tv)
+{
+    int             block = 1;
+
+    timerclear(tv);
+    if (timeout) {
+        *tv = *timeout;
+        block = 0;
+    }
+    snmp_sess_select_timeout(NULL, tv, &block, loop->flags);
+    if (block) {
+        /* nothing due: *tv is undefined, use the caller's timeout */
+        if (timeout == NULL)
+            return NULL;
+        *tv = *timeout;
+    }
+    return tv;
+}
+
+static int
+_event_loop_wait_epoll(netsnmp_event_loop *loop, struct timeval *timeout)
+{
+    struct timeval  tv, *tvp;
+    int             ms = -1;
+
+    tvp = _event_loop_timeout(loop, timeout, &tv);
+    if (tvp) {
+        if (tvp->tv_sec >= INT_MAX / 1000 - 1)
+            ms = INT_MAX;
+        else
+            ms = tvp->tv_sec * 1000 + (tvp->tv_usec + 999) / 1000;
+    }
+
+    return epoll_wait(loop->epfd, loop->events, EVENT_LOOP_MAX_EVENTS, ms);
+}
+
+#ifndef NETSNMP_FEATURE_REMOVE_FD_EVENT_MANAGER
+static void
+_event_loop_external(int fd, int *fds, int *len,
+                     void (**func) (int, void *), void **data)
+{
+    int             i;
+
+    for (i = 0; i < *len; i++) {
+        if (fds[i] == fd) {
+            DEBUGMSGTL(("event_loop", "external fd %d\n", fd));
+            func[i] (fd, data[i]);
+            return;
+        }
+    }
+}
+#endif
+
+/*
+ * Reads from the session on fd.  A stream transport that lost its peer
+ * marks itself with sock == -1; the session is closed right away, which
+ * snmp_sess_select_info2_flags() would otherwise do on the next pass.
+ */
+static void
+_event_loop_read(netsnmp_event_loop *loop, int fd, struct session_list *slp)
+{
+    NETSNMP_LARGE_FD_SET(fd, &loop->readfds);
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_SESSION);
+    snmp_sess_read2(slp, &loop->readfds);
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_SESSION);
+    NETSNMP_LARGE_FD_CLR(fd, &loop->readfds);
+
+    /* a callback may have closed the session */
+    if (fd >= loop->fds_len || loop->fds[fd].slp != slp)
+        return;
+    if (slp->transport && slp->transport->sock == fd)
+        return;
+
+    loop->fds[fd].slp = NULL;
+    _event_loop_update(loop, fd);
+    if (slp->transport && slp->transport->sock >= 0) {
+        _event_loop_add_session(loop, slp);
+    } else if (slp->transport) {
+        DEBUGMSGTL(("event_loop", "closing session %p\n", slp));
+        snmp_close(slp->session);
+    }
+}
+
+static void
+_event_loop_dispatch_epoll(netsnmp_event_loop *loop)
+{
+    struct session_list *slp;
+    unsigned int    events;
+    int             i, fd;
+
+    if (loop->count == 0) {
+        snmp_timeout();
+        return;
+    }
+
+    for (i = 0; i < loop->count; i++) {
+        fd = loop->events[i].data.fd;
+        events = loop->events[i].events;
+
+        /*
+         * Callbacks of earlier events may have closed fd; the change has
+         * been passed on to this loop already.
+         */
+        if (fd >= loop->fds_len || !loop->fds[fd].armed)
+            continue;
+
+        slp = loop->fds[fd].slp;
+        if (slp && (events & (EPOLLIN | EPOLLERR | EPOLLHUP)))
+            _event_loop_read(loop, fd, slp);
+
+#ifndef NETSNMP_FEATURE_REMOVE_FD_EVENT_MANAGER
+        if (events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+            _event_loop_external(fd, external_readfd, &external_readfdlen,
+                                 external_readfdfunc, external_readfd_data);
+        if (events & (EPOLLOUT | EPOLLERR))
+            _event_loop_external(fd, external_writefd, &external_writefdlen,
+                                 external_writefdfunc,
+                                 external_writefd_data);
+        if (events & EPOLLPRI)
+            _event_loop_external(fd, external_exceptfd,
+                                 &external_exceptfdlen,
+                                 external_exceptfdfunc,
+                                 external_exceptfd_data);
+#endif
+    }
+}
+#endif                          /* NETSNMP_EVENT_LOOP_EPOLL */
+
+int
+netsnmp_event_loop_wait(netsnmp_event_loop *loop, struct timeval *timeout)
+{
+    if (loop == NULL) {
+        errno = EINVAL;
+        return -1;
+    }
+
+#ifdef NETSNMP_EVENT_LOOP_EPOLL
+    if (loop->epfd >= 0)
+        loop->count = _event_loop_wait_epoll(loop, timeout);
+    else
+#endif
+        loop->count = _event_loop_wait_select(loop, timeout);
+
+    if (loop->count < 0 && errno != EINTR)
+        snmp_log_perror(loop->epfd >= 0 ? "epoll_wait" : "select");
+    return loop->count;
+}
+
+void
+netsnmp_event_loop_dispatch(netsnmp_event_loop *loop)
+{
+    if (loop == NULL || loop->count < 0)
+        return;
+
+#ifdef NETSNMP_EVENT_LOOP_EPOLL
+    if (loop->epfd >= 0)
+        _event_loop_dispatch_epoll(loop);
+    else
+#endif
+        _event_loop_dispatch_select(loop);
+    loop->count = -1;
+
+    if (!(loop->flags & NETSNMP_SELECT_NOALARMS))
+        run_alarms();
+}
+
+int
+netsnmp_event_loop_run_once(netsnmp_event_loop *loop,
+                            struct timeval *timeout)
+{
+    int             count;
+
+    count = netsnmp_event_loop_wait(loop, timeout);
+    netsnmp_event_loop_dispatch(loop);
+    return count;
+}
+
+#else  /* !NETSNMP_FEATURE_REMOVE_EVENT_LOOP */
+netsnmp_feature_unused(event_loop);
+
+void
+netsnmp_event_loop_session_added(struct session_list *slp)
+{
+}
+
+void
+netsnmp_event_loop_session_removed(struct session_list *slp)
+{
+}
+
+void
+netsnmp_event_loop_external_changed(int fd)
+{
+}
+#endif /* !NETSNMP_FEATURE_REMOVE_EVENT_LOOP */
@@ -9,6 +9,7 @@
 #include <net-snmp/library/fd_event_manager.h>
 #include <net-snmp/library/snmp_logging.h>
 #include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/event_loop.h>
 
 netsnmp_feature_child_of(fd_event_manager, libnetsnmp);
 
@@ -37,6 +38,7 @@ register_readfd(int fd, void (*func) (int, void *), void *data)
         external_readfdfunc[external_readfdlen] = func;
         external_readfd_data[external_readfdlen] = data;
         external_readfdlen++;
+        netsnmp_event_loop_external_changed(fd);
         DEBUGMSGTL(("fd_event_manager:register_readfd", "registered fd %d\n", fd));
         return FD_REGISTERED_OK;
     } else {
@@ -57,6 +59,7 @@ register_writefd(int fd, void (*func) (int, void *), void *data)
         external_writefdfunc[external_writefdlen] = func;
         external_writefd_data[external_writefdlen] = data;
         external_writefdlen++;
+        netsnmp_event_loop_external_changed(fd);
         DEBUGMSGTL(("fd_event_manager:register_writefd", "registered fd %d\n", fd));
         return FD_REGISTERED_OK;
     } else {
@@ -78,6 +81,7 @@ register_exceptfd(int fd, void (*func) (int, void *), void *data)
         external_exceptfdfunc[external_exceptfdlen] = func;
         external_exceptfd_data[external_exceptfdlen] = data;
         external_exceptfdlen++;
+        netsnmp_event_loop_external_changed(fd);
         DEBUGMSGTL(("fd_event_manager:register_exceptfd", "registered fd %d\n", fd));
         return FD_REGISTERED_OK;
     } else {
@@ -105,6 +109,7 @@ unregister_readfd(int fd)
             }
             DEBUGMSGTL(("fd_event_manager:unregister_readfd", "unregistered fd %d\n", fd));
             external_fd_unregistered = 1;
+            netsnmp_event_loop_external_changed(fd);
             return FD_UNREGISTERED_OK;
         }
     }
@@ -129,6 +134,7 @@ unregister_writefd(int fd)
             }
             DEBUGMSGTL(("fd_event_manager:unregister_writefd", "unregistered fd %d\n", fd));
             external_fd_unregistered = 1;
+            netsnmp_event_loop_external_changed(fd);
             return FD_UNREGISTERED_OK;
         }
     }
@@ -154,6 +160,7 @@ unregister_exceptfd(int fd)
             DEBUGMSGTL(("fd_event_manager:unregister_exceptfd", "unregistered fd %d\n",
                         fd));
             external_fd_unregistered = 1;
+            netsnmp_event_loop_external_changed(fd);
             return FD_UNREGISTERED_OK;
         }
     }
@@ -2498,6 +2498,8 @@ register_mib_handlers(void)
                        NETSNMP_DS_LIBRARY_ID, NETSNMP_DS_LIB_MIB_WARNINGS);
     netsnmp_ds_register_premib(ASN_BOOLEAN, "snmp", "mibReplaceWithLatest",
                        NETSNMP_DS_LIBRARY_ID, NETSNMP_DS_LIB_MIB_REPLACE);
+    netsnmp_ds_register_premib(ASN_OCTET_STR, "snmp", "mibCache",
+                       NETSNMP_DS_LIBRARY_ID, NETSNMP_DS_LIB_MIB_CACHE);
 #endif
 
     netsnmp_ds_register_premib(ASN_BOOLEAN, "snmp", "printNumericEnums",
@@ -2683,6 +2685,159 @@ netsnmp_fixup_mib_directory(void)
 
 }
 
+/*
+ * Returns the MIB modules and files to load, from the MIBS environment
+ * variable or the mibs token (to be freed by the caller).
+ */
+static char *
+_init_mib_get_mibs(void)
+{
+    char           *env_var, *entry;
+
+    env_var = netsnmp_getenv("MIBS");
+    if (env_var == NULL) {
+        if (confmibs != NULL)
+            env_var = strdup(confmibs);
+        else
+            env_var = strdup(NETSNMP_DEFAULT_MIBS);
+    } else {
+        env_var = strdup(env_var);
+    }
+    if (env_var && ((*env_var == '+') || (*env_var == '-'))) {
+        entry =
+            (char *) malloc(strlen(NETSNMP_DEFAULT_MIBS) + strlen(env_var) + 2);
+        if (!entry) {
+            DEBUGMSGTL(("init_mib", "env mibs malloc failed"));
+            SNMP_FREE(env_var);
+            return NULL;
+        } else {
+            if (*env_var == '+')
+                sprintf(entry, "%s%c%s", NETSNMP_DEFAULT_MIBS, ENV_SEPARATOR_CHAR,
+                        env_var+1);
+            else
+                sprintf(entry, "%s%c%s", env_var+1, ENV_SEPARATOR_CHAR,
+                        NETSNMP_DEFAULT_MIBS );
+        }
+        SNMP_FREE(env_var);
+        env_var = entry;
+    }
+    return env_var;
+}
+
+/*
+ * Returns the MIB files to read after the modules, from the MIBFILES
+ * environment variable (to be freed by the caller).
+ */
+static char *
+_init_mib_get_mibfiles(void)
+{
+    char           *env_var;
+
+    env_var = netsnmp_getenv("MIBFILES");
+    if (env_var != NULL) {
+        if ((*env_var == '+') || (*env_var == '-')) {
+#ifdef NETSNMP_DEFAULT_MIBFILES
+            char           *entry =
+                (char *) malloc(strlen(NETSNMP_DEFAULT_MIBFILES) +
+                                strlen(env_var) + 2);
+            if (!entry) {
+                DEBUGMSGTL(("init_mib", "env mibfiles malloc failed"));
+            } else {
+                if (*env_var++ == '+')
+                    sprintf(entry, "%s%c%s", NETSNMP_DEFAULT_MIBFILES, ENV_SEPARATOR_CHAR,
+                            env_var );
+                else
+                    sprintf(entry, "%s%c%s", env_var, ENV_SEPARATOR_CHAR,
+                            NETSNMP_DEFAULT_MIBFILES );
+            }
+            env_var = entry;
+#else
+            env_var = strdup(env_var + 1);
+#endif
+        } else {
+            env_var = strdup(env_var);
+        }
+    } else {
+#ifdef NETSNMP_DEFAULT_MIBFILES
+        env_var = strdup(NETSNMP_DEFAULT_MIBFILES);
+#endif
+    }
+    return env_var;
+}
+
+/*
+ * Describes the settings that decide which MIBs are loaded and how, so
+ * that a MIB cache is only used with the settings it was built with.
+ */
+static char *
+_mib_cache_key(void)
+{
+    char           *mibs, *mibfiles, *key;
+    int             rc;
+
+    mibs = _init_mib_get_mibs();
+    mibfiles = _init_mib_get_mibfiles();
+    rc = asprintf(&key, "%s\nmibdirs %s\nmibs %s\nmibfiles %s\n"
+                  "options %d%d%d%d\n", netsnmp_get_version(),
+                  netsnmp_get_mib_directory(), mibs ? mibs : "",
+                  mibfiles ? mibfiles : "",
+                  netsnmp_ds_get_boolean(NETSNMP_DS_LIBRARY_ID,
+                                         NETSNMP_DS_LIB_SAVE_MIB_DESCRS),
+                  netsnmp_ds_get_boolean(NETSNMP_DS_LIBRARY_ID,
+                                         NETSNMP_DS_LIB_MIB_PARSE_LABEL),
+                  netsnmp_ds_get_boolean(NETSNMP_DS_LIBRARY_ID,
+                                         NETSNMP_DS_LIB_MIB_COMMENT_TERM),
+                  netsnmp_ds_get_boolean(NETSNMP_DS_LIBRARY_ID,
+                                         NETSNMP_DS_LIB_MIB_REPLACE));
+    SNMP_FREE(mibs);
+    SNMP_FREE(mibfiles);
+    return rc < 0 ? NULL : key;
+}
+
+/*
+ * Returns the MIB cache file to use, from the MIBCACHE environment
+ * variable or the mibCache token, or NULL.
+ */
+static const char *
+_mib_cache_file(void)
+{
+    const char     *file;
+
+    file = netsnmp_getenv("MIBCACHE");
+    if (file == NULL)
+        file = netsnmp_ds_get_string(NETSNMP_DS_LIBRARY_ID,
+                                     NETSNMP_DS_LIB_MIB_CACHE);
+    return file && *file ? file : NULL;
+}
+
+/**
+ * Saves the MIBs loaded now to a MIB cache file, which netsnmp_init_mib()
+ * will load instead of reading the MIB files while the MIB settings are
+ * the same and none of the MIB files has changed.
+ *
+ * @param filename the cache file; the mibCache token or MIBCACHE
+ *                 environment variable if NULL.
+ *
+ * @return 0 on success, -1 on error.
+ */
+int
+netsnmp_save_mib_cache(const char *filename)
+{
+    char           *key;
+    int             rc;
+
+    if (filename == NULL)
+        filename = _mib_cache_file();
+    if (filename == NULL || tree_head == NULL)
+        return -1;
+    key = _mib_cache_key();
+    if (key == NULL)
+        return -1;
+    rc = netsnmp_write_mib_cache(filename, key, netsnmp_get_mib_directory());
+    free(key);
+    return rc;
+}
+
 /**
  * Initialises the mib reader.
  *
@@ -2691,7 +2846,7 @@ netsnmp_fixup_mib_directory(void)
 void
 netsnmp_init_mib(void)
 {
-    const char     *prefix;
+    const char     *prefix, *cache;
     char           *env_var, *entry;
     PrefixListPtr   pp = &mib_prefixes[0];
     char           *st = NULL;
@@ -2704,6 +2859,21 @@ netsnmp_init_mib(void)
      * Initialise the MIB directory/ies 
      */
     netsnmp_fixup_mib_directory();
+
+    /*
+     * A MIB cache built with the same settings replaces reading the MIBs
+     */
+    cache = _mib_cache_file();
+    if (cache) {
+        env_var = _mib_cache_key();
+        if (env_var && netsnmp_read_mib_cache(cache, env_var) == 0) {
+            DEBUGMSGTL(("init_mib", "Loaded MIBs from cache %s\n", cache));
+            SNMP_FREE(env_var);
+            goto mibs_loaded;
+        }
+        SNMP_FREE(env_var);
+    }
+
     env_var = strdup(netsnmp_get_mib_directory());
     if (!env_var)
         return;
@@ -2737,33 +2907,9 @@ netsnmp_init_mib(void)
      * Read in any modules or mibs requested 
      */
 
-    env_var = netsnmp_getenv("MIBS");
-    if (env_var == NULL) {
-        if (confmibs != NULL)
-            env_var = strdup(confmibs);
-        else
-            env_var = strdup(NETSNMP_DEFAULT_MIBS);
-    } else {
-        env_var = strdup(env_var);
-    }
-    if (env_var && ((*env_var == '+') || (*env_var == '-'))) {
-        entry =
-            (char *) malloc(strlen(NETSNMP_DEFAULT_MIBS) + strlen(env_var) + 2);
-        if (!entry) {
-            DEBUGMSGTL(("init_mib", "env mibs malloc failed"));
-            SNMP_FREE(env_var);
-            return;
-        } else {
-            if (*env_var == '+')
-                sprintf(entry, "%s%c%s", NETSNMP_DEFAULT_MIBS, ENV_SEPARATOR_CHAR,
-                        env_var+1);
-            else
-                sprintf(entry, "%s%c%s", env_var+1, ENV_SEPARATOR_CHAR,
-                        NETSNMP_DEFAULT_MIBS );
-        }
-        SNMP_FREE(env_var);
-        env_var = entry;
-    }
+    env_var = _init_mib_get_mibs();
+    if (env_var == NULL)
+        return;
 
     DEBUGMSGTL(("init_mib",
                 "Seen MIBS: Looking in '%s' for mib files ...\n",
@@ -2782,37 +2928,7 @@ netsnmp_init_mib(void)
     adopt_orphans();
     SNMP_FREE(env_var);
 
-    env_var = netsnmp_getenv("MIBFILES");
-    if (env_var != NULL) {
-        if ((*env_var == '+') || (*env_var == '-')) {
-#ifdef NETSNMP_DEFAULT_MIBFILES
-            entry =
-                (char *) malloc(strlen(NETSNMP_DEFAULT_MIBFILES) +
-                                strlen(env_var) + 2);
-            if (!entry) {
-                DEBUGMSGTL(("init_mib", "env mibfiles malloc failed"));
-            } else {
-                if (*env_var++ == '+')
-                    sprintf(entry, "%s%c%s", NETSNMP_DEFAULT_MIBFILES, ENV_SEPARATOR_CHAR,
-                            env_var );
-                else
-                    sprintf(entry, "%s%c%s", env_var, ENV_SEPARATOR_CHAR,
-                            NETSNMP_DEFAULT_MIBFILES );
-            }
-            SNMP_FREE(env_var);
-            env_var = entry;
-#else
-            env_var = strdup(env_var + 1);
-#endif
-        } else {
-            env_var = strdup(env_var);
-        }
-    } else {
-#ifdef NETSNMP_DEFAULT_MIBFILES
-        env_var = strdup(NETSNMP_DEFAULT_MIBFILES);
-#endif
-    }
-
+    env_var = _init_mib_get_mibfiles();
     if (env_var != NULL) {
         DEBUGMSGTL(("init_mib",
                     "Seen MIBFILES: Looking in '%s' for mib files ...\n",
@@ -2825,6 +2941,7 @@ netsnmp_init_mib(void)
         SNMP_FREE(env_var);
     }
 
+  mibs_loaded:
     prefix = netsnmp_getenv("PREFIX");
 
     if (!prefix)
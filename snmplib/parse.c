@@ -77,6 +77,13 @@ SOFTWARE.
 #if HAVE_UNISTD_H
 #include <unistd.h>
 #endif
+#if HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#include <sys/mman.h>
+#define MIB_CACHE_MMAP
+#endif
 
 #include <errno.h>
 
@@ -525,13 +532,24 @@ char gMibNames[STRINGMAX];
 #define HASHSIZE        32
 #define BUCKET(x)       (x & (HASHSIZE-1))
 
+/*
+ * The node and tree hash tables start out with NHASHSIZE buckets and
+ * grow with the number of nodes in them, so that name lookups stay short
+ * however many MIB objects are loaded.
+ */
 #define NHASHSIZE    128
-#define NBUCKET(x)   (x & (NHASHSIZE-1))
+#define NBUCKET(x)   ((x) & (nbucket_size-1))
+#define TBUCKET(x)   ((x) & (tbucket_size-1))
 
 static struct tok *buckets[HASHSIZE];
 
-static struct node *nbuckets[NHASHSIZE];
-static struct tree *tbuckets[NHASHSIZE];
+static struct node *nbuckets_init[NHASHSIZE];
+static struct node **nbuckets = nbuckets_init;
+static u_int    nbucket_size = NHASHSIZE;
+static struct tree *tbuckets_init[NHASHSIZE];
+static struct tree **tbuckets = tbuckets_init;
+static u_int    tbucket_size = NHASHSIZE;
+static u_int    tbucket_count = 0;
 static struct module *module_head = NULL;
 
 static struct node *orphan_nodes = NULL;
@@ -554,7 +572,9 @@ static int      get_token(FILE *, char *, int);
 static int      parseQuoteString(FILE *, char *, int);
 static int      tossObjectIdentifier(FILE *);
 static int      name_hash(const char *);
+static int      label_hash(const char *);
 static void     init_node_hash(struct node *);
+static void     reset_hash_tables(void);
 static void     print_error(const char *, const char *, int);
 static void     free_tree(struct tree *);
 static void     free_partial_tree(struct tree *, int);
@@ -599,7 +619,6 @@ static void     free_enums(struct enum_list **);
 static struct range_list *copy_ranges(struct range_list *);
 static struct enum_list *copy_enums(struct enum_list *);
 
-static u_int    compute_match(const char *search_base, const char *key);
 
 void
 snmp_mib_toggle_options_usage(const char *lead, FILE * outf)
@@ -695,6 +714,27 @@ name_hash(const char *name)
     return (hash);
 }
 
+/*
+ * Hash of a node or tree label: FNV-1a over the lower-cased label.  The
+ * sum of the characters that name_hash() computes for the parser's
+ * keywords puts labels like ifInOctets and ifOutOctets, or any that only
+ * differ in the order of their digits, in the same bucket.
+ */
+static int
+label_hash(const char *label)
+{
+    u_int           hash = 2166136261U;
+    const char     *cp;
+
+    if (!label)
+        return 0;
+    for (cp = label; *cp; cp++) {
+        hash ^= tolower((unsigned char)(*cp));
+        hash *= 16777619U;
+    }
+    return (int) (hash & 0x7fffffff);
+}
+
 void
 netsnmp_init_mib_internals(void)
 {
@@ -727,8 +767,7 @@ netsnmp_init_mib_internals(void)
     module_map[max_modc].next = NULL;
     module_map_head = module_map;
 
-    memset(nbuckets, 0, sizeof(nbuckets));
-    memset(tbuckets, 0, sizeof(tbuckets));
+    reset_hash_tables();
     tc_alloc = TC_INCR;
     tclist = calloc(tc_alloc, sizeof(struct tc));
     build_translation_table();
@@ -746,16 +785,51 @@ init_mib_internals(void)
 }
 #endif
 
+static void
+reset_hash_tables(void)
+{
+    if (nbuckets != nbuckets_init)
+        free(nbuckets);
+    nbuckets = nbuckets_init;
+    nbucket_size = NHASHSIZE;
+    memset(nbuckets_init, 0, sizeof(nbuckets_init));
+
+    if (tbuckets != tbuckets_init)
+        free(tbuckets);
+    tbuckets = tbuckets_init;
+    tbucket_size = NHASHSIZE;
+    tbucket_count = 0;
+    memset(tbuckets_init, 0, sizeof(tbuckets_init));
+}
+
+/*
+ * Set up the node hash for a list of nodes, sized for one node per
+ * bucket.  The nodes are hashed by the label of their parent.
+ */
 static void
 init_node_hash(struct node *nodes)
 {
-    struct node    *np, *nextp;
+    struct node    *np, *nextp, **nb;
+    u_int           count, size;
     int             hash;
 
-    memset(nbuckets, 0, sizeof(nbuckets));
+    for (count = 0, np = nodes; np; np = np->next)
+        count++;
+    for (size = NHASHSIZE; size < count && size < 0x40000000U; size <<= 1)
+        ;
+    if (size != nbucket_size) {
+        nb = size > NHASHSIZE ? calloc(size, sizeof(*nb)) : nbuckets_init;
+        if (nb) {
+            if (nbuckets != nbuckets_init)
+                free(nbuckets);
+            nbuckets = nb;
+            nbucket_size = size;
+        }
+    }
+    memset(nbuckets, 0, nbucket_size * sizeof(*nbuckets));
     for (np = nodes; np;) {
         nextp = np->next;
-        hash = NBUCKET(name_hash(np->parent));
+        hash = NBUCKET(label_hash(np->parent));
         np->next = nbuckets[hash];
         nbuckets[hash] = np;
         np = nextp;
@@ -821,10 +895,60 @@ alloc_node(int modid)
     return np;
 }
 
+/*
+ * Rehash the tree hash into size buckets.  Nodes with the same label stay
+ * in the same order, so that find_tree_node() keeps finding the most
+ * recently added one first.
+ */
+static void
+resize_tbuckets(u_int size)
+{
+    struct tree   **tb, *tp, *next, *rev;
+    u_int           i;
+    int             hash;
+
+    tb = calloc(size, sizeof(*tb));
+    if (tb == NULL)
+        return;                 /* keep the longer chains */
+    for (i = 0; i < tbucket_size; i++) {
+        /*
+         * Reverse the chain, then push each node onto its new chain.
+         */
+        for (rev = NULL, tp = tbuckets[i]; tp; tp = next) {
+            next = tp->next;
+            tp->next = rev;
+            rev = tp;
+        }
+        for (tp = rev; tp; tp = next) {
+            next = tp->next;
+            hash = label_hash(tp->label) & (size - 1);
+            tp->next = tb[hash];
+            tb[hash] = tp;
+        }
+    }
+    if (tbuckets != tbuckets_init)
+        free(tbuckets);
+    tbuckets = tb;
+    tbucket_size = size;
+}
+
+static void
+link_tbucket(struct tree *tp)
+{
+    int             hash;
+
+    if (tbucket_count >= tbucket_size && tbucket_size < 0x40000000U)
+        resize_tbuckets(tbucket_size << 1);
+    hash = TBUCKET(label_hash(tp->label));
+    tp->next = tbuckets[hash];
+    tbuckets[hash] = tp;
+    tbucket_count++;
+}
+
 static void
 unlink_tbucket(struct tree *tp)
 {
-    int             hash = NBUCKET(name_hash(tp->label));
+    int             hash = TBUCKET(label_hash(tp->label));
     struct tree    *otp = NULL, *ntp = tbuckets[hash];
 
     while (ntp && ntp != tp) {
@@ -833,10 +957,13 @@ unlink_tbucket(struct tree *tp)
     }
     if (!ntp)
         snmp_log(LOG_EMERG, "Can't find %s in tbuckets\n", tp->label);
-    else if (otp)
-        otp->next = ntp->next;
-    else
-        tbuckets[hash] = tp->next;
+    else {
+        if (otp)
+            otp->next = ntp->next;
+        else
+            tbuckets[hash] = tp->next;
+        tbucket_count--;
+    }
 }
 
 static void
@@ -1162,7 +1289,6 @@ init_tree_roots(void)
 {
     struct tree    *tp, *lasttp;
     int             base_modid;
-    int             hash;
 
     base_modid = which_module("SNMPv2-SMI");
     if (base_modid == -1)
@@ -1183,9 +1309,7 @@ init_tree_roots(void)
     tp->subid = 2;
     tp->tc_index = -1;
     set_function(tp);           /* from mib.c */
-    hash = NBUCKET(name_hash(tp->label));
-    tp->next = tbuckets[hash];
-    tbuckets[hash] = tp;
+    link_tbucket(tp);
     lasttp = tp;
     root_imports[0].label = strdup(tp->label);
     root_imports[0].modid = base_modid;
@@ -1204,9 +1328,7 @@ init_tree_roots(void)
     tp->subid = 0;
     tp->tc_index = -1;
     set_function(tp);           /* from mib.c */
-    hash = NBUCKET(name_hash(tp->label));
-    tp->next = tbuckets[hash];
-    tbuckets[hash] = tp;
+    link_tbucket(tp);
     lasttp = tp;
     root_imports[1].label = strdup(tp->label);
     root_imports[1].modid = base_modid;
@@ -1225,9 +1347,7 @@ init_tree_roots(void)
     tp->subid = 1;
     tp->tc_index = -1;
     set_function(tp);           /* from mib.c */
-    hash = NBUCKET(name_hash(tp->label));
-    tp->next = tbuckets[hash];
-    tbuckets[hash] = tp;
+    link_tbucket(tp);
     lasttp = tp;
     root_imports[2].label = strdup(tp->label);
     root_imports[2].modid = base_modid;
@@ -1251,7 +1371,7 @@ find_tree_node(const char *name, int modid)
     if (!name || !*name)
         return (NULL);
 
-    headtp = tbuckets[NBUCKET(name_hash(name))];
+    headtp = tbuckets[TBUCKET(label_hash(name))];
     for (tp = headtp; tp; tp = tp->next) {
         if (tp->label && !label_compare(tp->label, name)) {
 
@@ -1268,6 +1388,39 @@ find_tree_node(const char *name, int modid)
     return (NULL);
 }
 
+/*
+ * A pattern for find_best_tree_node(), prepared once for all the labels
+ * it is matched against.
+ */
+struct tree_pattern {
+    const char     *key;
+    int             literal;    /* no wildcard or regex characters */
+#if defined(HAVE_REGEX_H) && defined(HAVE_REGCOMP)
+    int             compiled;
+    regex_t         parsetree;
+#endif
+};
+
+static void
+init_tree_pattern(struct tree_pattern *pat, const char *key)
+{
+    pat->key = key;
+    pat->literal = strpbrk(key, "*.[]()+?{}|^$\\") == NULL;
+#if defined(HAVE_REGEX_H) && defined(HAVE_REGCOMP)
+    pat->compiled = !pat->literal &&
+        regcomp(&pat->parsetree, key, REG_ICASE | REG_EXTENDED) == 0;
+#endif
+}
+
+static void
+free_tree_pattern(struct tree_pattern *pat)
+{
+#if defined(HAVE_REGEX_H) && defined(HAVE_REGCOMP)
+    if (pat->compiled)
+        regfree(&pat->parsetree);
+#endif
+}
+
 /*
  * computes a value which represents how close name1 is to name2.
  * * high scores mean a worse match.
@@ -1276,23 +1429,28 @@ find_tree_node(const char *name, int modid)
 #define MAX_BAD 0xffffff
 
 static          u_int
-compute_match(const char *search_base, const char *key)
+compute_match(const char *search_base, struct tree_pattern *pat)
 {
+    const char     *key = pat->key;
 #if defined(HAVE_REGEX_H) && defined(HAVE_REGCOMP)
-    int             rc;
-    regex_t         parsetree;
     regmatch_t      pmatch;
-    rc = regcomp(&parsetree, key, REG_ICASE | REG_EXTENDED);
-    if (rc == 0)
-        rc = regexec(&parsetree, search_base, 1, &pmatch, 0);
-    regfree(&parsetree);
-    if (rc == 0) {
+#endif
+
+    if (pat->literal) {
+        const char     *result = strcasestr(search_base, key);
+
+        return result ? (u_int) (result - search_base) : MAX_BAD;
+    }
+#if defined(HAVE_REGEX_H) && defined(HAVE_REGCOMP)
+    if (pat->compiled &&
+        regexec(&pat->parsetree, search_base, 1, &pmatch, 0) == 0) {
         /*
          * found 
          */
         return pmatch.rm_so;
     }
 #else                           /* use our own wildcard matcher */
+    {
     /*
      * first find the longest matching substring (ick) 
      */
@@ -1321,6 +1479,7 @@ compute_match(const char *search_base, const char *key)
     free(newkey);
     if (result)
         return (first - search_base);
+    }
 #endif
 
     /*
@@ -1329,34 +1488,16 @@ compute_match(const char *search_base, const char *key)
     return MAX_BAD;
 }
 
-/*
- * Find the tree node that best matches the pattern string.
- * Use the "reported" flag such that only one match
- * is attempted for every node.
- *
- * Warning! This function may recurse.
- *
- * Caller _must_ invoke clear_tree_flags before first call
- * to this function.  This function may be called multiple times
- * to ensure that the entire tree is traversed.
- */
-
-struct tree    *
-find_best_tree_node(const char *pattrn, struct tree *tree_top,
-                    u_int * match)
+static struct tree *
+_find_best_tree_node(struct tree_pattern *pat, struct tree *tree_top,
+                     u_int * match)
 {
     struct tree    *tp, *best_so_far = NULL, *retptr;
     u_int           old_match = MAX_BAD, new_match = MAX_BAD;
 
-    if (!pattrn || !*pattrn)
-        return (NULL);
-
-    if (!tree_top)
-        tree_top = get_tree_head();
-
     for (tp = tree_top; tp; tp = tp->next_peer) {
         if (!tp->reported && tp->label)
-            new_match = compute_match(tp->label, pattrn);
+            new_match = compute_match(tp->label, pat);
         tp->reported = 1;
 
         if (new_match < old_match) {
@@ -1366,8 +1507,7 @@ find_best_tree_node(const char *pattrn, struct tree *tree_top,
         if (new_match == 0)
             break;              /* this is the best result we can get */
         if (tp->child_list) {
-            retptr =
-                find_best_tree_node(pattrn, tp->child_list, &new_match);
+            retptr = _find_best_tree_node(pat, tp->child_list, &new_match);
             if (new_match < old_match) {
                 best_so_far = retptr;
                 old_match = new_match;
@@ -1381,6 +1521,35 @@ find_best_tree_node(const char *pattrn, struct tree *tree_top,
     return (best_so_far);
 }
 
+/*
+ * Find the tree node that best matches the pattern string.
+ * Use the "reported" flag such that only one match
+ * is attempted for every node.
+ *
+ * Caller _must_ invoke clear_tree_flags before first call
+ * to this function.  This function may be called multiple times
+ * to ensure that the entire tree is traversed.
+ */
+
+struct tree    *
+find_best_tree_node(const char *pattrn, struct tree *tree_top,
+                    u_int * match)
+{
+    struct tree_pattern pat;
+    struct tree    *tp;
+
+    if (!pattrn || !*pattrn)
+        return (NULL);
+
+    if (!tree_top)
+        tree_top = get_tree_head();
+
+    init_tree_pattern(&pat, pattrn);
+    tp = _find_best_tree_node(&pat, tree_top, match);
+    free_tree_pattern(&pat);
+    return (tp);
+}
+
 
 static void
 merge_anon_children(struct tree *tp1, struct tree *tp2)
@@ -1485,7 +1654,6 @@ do_subtree(struct tree *root, struct node **nodes)
     struct tree    *xroot = root;
     struct node    *np, **headp;
     struct node    *oldnp = NULL, *child_list = NULL, *childp = NULL;
-    int             hash;
     int            *int_p;
 
     while (xroot->next_peer && xroot->next_peer->subid == root->subid) {
@@ -1497,7 +1665,7 @@ do_subtree(struct tree *root, struct node **nodes)
     }
 
     tp = root;
-    headp = &nbuckets[NBUCKET(name_hash(tp->label))];
+    headp = &nbuckets[NBUCKET(label_hash(tp->label))];
     /*
      * Search each of the nodes for one whose parent is root, and
      * move each into a separate list.
@@ -1604,9 +1772,7 @@ do_subtree(struct tree *root, struct node **nodes)
             otp->next_peer = tp;
         else
             xxroot->child_list = tp;
-        hash = NBUCKET(name_hash(tp->label));
-        tp->next = tbuckets[hash];
-        tbuckets[hash] = tp;
+        link_tbucket(tp);
         do_subtree(tp, nodes);
 
         if (anon_tp) {
@@ -1675,9 +1841,7 @@ do_subtree(struct tree *root, struct node **nodes)
                 /*
                  * hash in anon_tp in its new place 
                  */
-                hash = NBUCKET(name_hash(anon_tp->label));
-                anon_tp->next = tbuckets[hash];
-                tbuckets[hash] = anon_tp;
+                link_tbucket(anon_tp);
 
                 /*
                  * unlink and destroy tp 
@@ -1772,10 +1936,10 @@ do_linkup(struct module *mp, struct node *np)
      */
     oldp = orphan_nodes;
     do {
-        for (i = 0; i < NHASHSIZE; i++)
+        for (i = 0; i < (int) nbucket_size; i++)
             for (onp = nbuckets[i]; onp; onp = onp->next) {
                 struct node    *op = NULL;
-                int             hash = NBUCKET(name_hash(onp->label));
+                int             hash = NBUCKET(label_hash(onp->label));
                 np = nbuckets[hash];
                 while (np) {
                     if (label_compare(onp->label, np->parent)) {
@@ -1798,7 +1962,7 @@ do_linkup(struct module *mp, struct node *np)
         more = 0;
         for (onp = orphan_nodes; onp != oldp; onp = onp->next) {
             struct node    *op = NULL;
-            int             hash = NBUCKET(name_hash(onp->label));
+            int             hash = NBUCKET(label_hash(onp->label));
             np = nbuckets[hash];
             while (np) {
                 if (label_compare(onp->label, np->parent)) {
@@ -1824,7 +1988,7 @@ do_linkup(struct module *mp, struct node *np)
      * complain about left over nodes 
      */
     for (np = orphan_nodes; np && np->next; np = np->next);     /* find the end of the orphan list */
-    for (i = 0; i < NHASHSIZE; i++)
+    for (i = 0; i < (int) nbucket_size; i++)
         if (nbuckets[i]) {
             if (orphan_nodes)
                 onp = np->next = nbuckets[i];
@@ -3943,7 +4107,7 @@ adopt_orphans(void)
 
     while (adopted) {
         adopted = 0;
-        for (i = 0; i < NHASHSIZE; i++)
+        for (i = 0; i < (int) nbucket_size; i++)
             if (nbuckets[i]) {
                 for (np = nbuckets[i]; np != NULL; np = np->next) {
                     tp = find_tree_node(np->parent, -1);
@@ -3978,7 +4142,7 @@ adopt_orphans(void)
      * Report on outstanding orphans
      *    and link them back into the orphan list
      */
-    for (i = 0; i < NHASHSIZE; i++)
+    for (i = 0; i < (int) nbucket_size; i++)
         if (nbuckets[i]) {
             if (orphan_nodes)
                 onp = np->next = nbuckets[i];
@@ -4202,8 +4366,7 @@ unload_all_mibs(void)
     memset(tclist, 0, tc_alloc * sizeof(struct tc));
 
     memset(buckets, 0, sizeof(buckets));
-    memset(nbuckets, 0, sizeof(nbuckets));
-    memset(tbuckets, 0, sizeof(tbuckets));
+    reset_hash_tables();
 
     for (i = 0; i < sizeof(root_imports) / sizeof(root_imports[0]); i++) {
         SNMP_FREE(root_imports[i].label);
@@ -5050,6 +5213,927 @@ read_all_mibs(void)
 }
 
 
+/*
+ * Precompiled MIB tree images.
+ *
+ * Loading MIBs means reading the first tokens of every file in every MIB
+ * directory, then tokenizing and linking all the requested modules.  A MIB
+ * cache file holds the result: the module list, the textual conventions and
+ * the tree together with its hash buckets, so that the next program with
+ * the same MIB settings can rebuild them from one mapped file instead.
+ *
+ * The file is a header, a string table and a stream of 32-bit words, all in
+ * host byte order.  Strings are referred to by their offset in the string
+ * table plus one, 0 standing for NULL.  The image also holds a key
+ * describing the settings it was built with (see netsnmp_init_mib()) and
+ * the MIB directories and files it was built from, with their modification
+ * times and sizes; it is only used while the key matches and none of these
+ * has changed.
+ */
+#define MIB_CACHE_MAGIC         0x4d494243      /* "MIBC" */
+#define MIB_CACHE_VERSION       2
+#define MIB_CACHE_BYTE_ORDER    0x01020304
+
+struct mib_cache_header {
+    uint32_t        magic;
+    uint32_t        version;
+    uint32_t        byte_order;
+    uint32_t        strings_len;    /* follows the header, 4-byte padded */
+    uint32_t        words_len;      /* number of words after the strings */
+};
+
+struct mib_cache_buf {
+    char           *data;
+    size_t          len, size;
+    int             error;
+};
+
+struct mib_cache_writer {
+    struct mib_cache_buf strings, words;
+    struct mib_cache_node {
+        struct tree    *tp;
+        uint32_t        idx;
+    }              *nodes;          /* in preorder, sorted by tp later */
+    size_t          nnodes, nodes_size;
+};
+
+struct mib_cache_reader {
+    const char     *strings;
+    size_t          strings_len;
+    const uint32_t *words;
+    size_t          nwords, pos;
+    uint32_t        ntc;            /* textual conventions read so far */
+    int             error;
+};
+
+static void
+_mib_cache_append(struct mib_cache_buf *buf, const void *data, size_t len)
+{
+    char           *p;
+    size_t          size;
+
+    if (buf->error)
+        return;
+    if (buf->len + len > buf->size) {
+        size = buf->size ? buf->size : 4096;
+        while (size < buf->len + len)
+            size *= 2;
+        p = realloc(buf->data, size);
+        if (p == NULL) {
+            buf->error = 1;
+            return;
+        }
+        buf->data = p;
+        buf->size = size;
+    }
+    memcpy(buf->data + buf->len, data, len);
+    buf->len += len;
+}
+
+static void
+_mib_cache_put(struct mib_cache_writer *w, uint32_t word)
+{
+    _mib_cache_append(&w->words, &word, sizeof(word));
+}
+
+static void
+_mib_cache_patch(struct mib_cache_writer *w, size_t pos, uint32_t word)
+{
+    if (!w->words.error)
+        memcpy(w->words.data + pos, &word, sizeof(word));
+}
+
+static void
+_mib_cache_put_string(struct mib_cache_writer *w, const char *s)
+{
+    if (s == NULL) {
+        _mib_cache_put(w, 0);
+        return;
+    }
+    _mib_cache_put(w, w->strings.len + 1);
+    _mib_cache_append(&w->strings, s, strlen(s) + 1);
+}
+
+static void
+_mib_cache_put_enums(struct mib_cache_writer *w, struct enum_list *ep)
+{
+    struct enum_list *e;
+    uint32_t        n;
+
+    for (n = 0, e = ep; e; e = e->next)
+        n++;
+    _mib_cache_put(w, n);
+    for (e = ep; e; e = e->next) {
+        _mib_cache_put(w, e->value);
+        _mib_cache_put_string(w, e->label);
+    }
+}
+
+static void
+_mib_cache_put_ranges(struct mib_cache_writer *w, struct range_list *rp)
+{
+    struct range_list *r;
+    uint32_t        n;
+
+    for (n = 0, r = rp; r; r = r->next)
+        n++;
+    _mib_cache_put(w, n);
+    for (r = rp; r; r = r->next) {
+        _mib_cache_put(w, r->low);
+        _mib_cache_put(w, r->high);
+    }
+}
+
+/*
+ * Records the state of a file or directory the image depends on.
+ */
+static void
+_mib_cache_put_dep(struct mib_cache_writer *w, const char *path)
+{
+    struct stat     st;
+    uint64_t        mtime, size;
+
+    if (stat(path, &st) < 0) {
+        _mib_cache_put(w, 0);
+        _mib_cache_put_string(w, path);
+        return;
+    }
+    mtime = st.st_mtime;
+    size = st.st_size;
+    _mib_cache_put(w, 1);
+    _mib_cache_put_string(w, path);
+    _mib_cache_put(w, mtime & 0xffffffff);
+    _mib_cache_put(w, mtime >> 32);
+    _mib_cache_put(w, size & 0xffffffff);
+    _mib_cache_put(w, size >> 32);
+}
+
+static void
+_mib_cache_put_tree(struct mib_cache_writer *w, struct tree *tp)
+{
+    struct mib_cache_node *nodes;
+    struct index_list *ip;
+    struct varbind_list *vp;
+    struct tree    *child;
+    uint32_t        n;
+    int             i;
+
+    if (w->nnodes >= w->nodes_size) {
+        w->nodes_size = w->nodes_size ? 2 * w->nodes_size : 1024;
+        nodes = realloc(w->nodes, w->nodes_size * sizeof(*nodes));
+        if (nodes == NULL) {
+            w->words.error = 1;
+            return;
+        }
+        w->nodes = nodes;
+    }
+    w->nodes[w->nnodes].tp = tp;
+    w->nodes[w->nnodes].idx = w->nnodes;
+    w->nnodes++;
+
+    _mib_cache_put_string(w, tp->label);
+    _mib_cache_put(w, tp->subid);
+    _mib_cache_put(w, tp->modid);
+    _mib_cache_put(w, tp->number_modules);
+    if (tp->module_list != &tp->modid) {
+        _mib_cache_put(w, tp->number_modules);
+        for (i = 0; i < tp->number_modules; i++)
+            _mib_cache_put(w, tp->module_list[i]);
+    } else
+        _mib_cache_put(w, 0);
+    _mib_cache_put(w, tp->tc_index);
+    _mib_cache_put(w, tp->type);
+    _mib_cache_put(w, tp->access);
+    _mib_cache_put(w, tp->status);
+    _mib_cache_put_enums(w, tp->enums);
+    _mib_cache_put_ranges(w, tp->ranges);
+    for (n = 0, ip = tp->indexes; ip; ip = ip->next)
+        n++;
+    _mib_cache_put(w, n);
+    for (ip = tp->indexes; ip; ip = ip->next) {
+        _mib_cache_put_string(w, ip->ilabel);
+        _mib_cache_put(w, ip->isimplied);
+    }
+    _mib_cache_put_string(w, tp->augments);
+    for (n = 0, vp = tp->varbinds; vp; vp = vp->next)
+        n++;
+    _mib_cache_put(w, n);
+    for (vp = tp->varbinds; vp; vp = vp->next)
+        _mib_cache_put_string(w, vp->vblabel);
+    _mib_cache_put_string(w, tp->hint);
+    _mib_cache_put_string(w, tp->units);
+    _mib_cache_put_string(w, tp->description);
+    _mib_cache_put_string(w, tp->reference);
+    _mib_cache_put_string(w, tp->defaultValue);
+
+    for (n = 0, child = tp->child_list; child; child = child->next_peer)
+        n++;
+    _mib_cache_put(w, n);
+    for (child = tp->child_list; child; child = child->next_peer)
+        _mib_cache_put_tree(w, child);
+}
+
+static int
+_mib_cache_node_cmp(const void *a, const void *b)
+{
+    const struct mib_cache_node *n1 = a, *n2 = b;
+
+    if (n1->tp == n2->tp)
+        return 0;
+    return n1->tp < n2->tp ? -1 : 1;
+}
+
+/*
+ * netsnmp_write_mib_cache(): writes the MIB modules and tree loaded now to
+ * an image in @filename, which netsnmp_read_mib_cache() will load while
+ * @key is the same and no file in @dirs (a list of directories separated
+ * by ENV_SEPARATOR) or MIB module file has changed.
+ *
+ * Returns 0 on success, or -1 on error.
+ */
+int
+netsnmp_write_mib_cache(const char *filename, const char *key,
+                        const char *dirs)
+{
+    struct mib_cache_writer w;
+    struct mib_cache_header hdr;
+    struct mib_cache_node key_node, *np;
+    struct module  *mp;
+    struct tree    *tp;
+    char           *dirlist, *dir, *st = NULL, *tmpfile = NULL;
+    char          **filenames;
+    const char     *cp;
+    size_t          len, pos;
+    uint32_t        n;
+    int             i, j, count, rc = -1;
+    FILE           *fp = NULL;
+
+    memset(&w, 0, sizeof(w));
+    _mib_cache_put_string(&w, key);
+
+    /*
+     * What the image depends on: the MIB directories and the files in
+     * them, then any other files modules were found in.
+     */
+    dirlist = strdup(dirs ? dirs : "");
+    if (dirlist == NULL)
+        return -1;
+    pos = w.words.len;
+    _mib_cache_put(&w, 0);
+    for (n = 0, dir = strtok_r(dirlist, ENV_SEPARATOR, &st); dir;
+         dir = strtok_r(NULL, ENV_SEPARATOR, &st)) {
+        _mib_cache_put_dep(&w, dir);
+        n++;
+        count = scan_directory(&filenames, dir);
+        for (i = 0; i < count; i++) {
+            _mib_cache_put_dep(&w, filenames[i]);
+            free(filenames[i]);
+            n++;
+        }
+        free(filenames);
+    }
+    for (mp = module_head; mp; mp = mp->next) {
+        cp = strrchr(mp->file, '/');
+        len = cp ? (size_t)(cp - mp->file) : 0;
+        strcpy(dirlist, dirs ? dirs : "");
+        for (dir = strtok_r(dirlist, ENV_SEPARATOR, &st); dir;
+             dir = strtok_r(NULL, ENV_SEPARATOR, &st))
+            if (strlen(dir) == len && strncmp(dir, mp->file, len) == 0)
+                break;
+        if (dir == NULL) {
+            _mib_cache_put_dep(&w, mp->file);
+            n++;
+        }
+    }
+    free(dirlist);
+    _mib_cache_patch(&w, pos, n);
+
+    for (i = 0; i < NUMBER_OF_ROOT_NODES; i++) {
+        _mib_cache_put_string(&w, root_imports[i].label);
+        _mib_cache_put(&w, root_imports[i].modid);
+    }
+
+    _mib_cache_put(&w, max_module);
+    for (n = 0, mp = module_head; mp; mp = mp->next)
+        n++;
+    _mib_cache_put(&w, n);
+    for (mp = module_head; mp; mp = mp->next) {
+        _mib_cache_put_string(&w, mp->name);
+        _mib_cache_put_string(&w, mp->file);
+        _mib_cache_put(&w, mp->modid);
+        _mib_cache_put(&w, mp->no_imports);
+        if (mp->no_imports <= 0)
+            continue;
+        _mib_cache_put(&w, mp->imports == root_imports);
+        if (mp->imports == root_imports)
+            continue;
+        for (i = 0; i < mp->no_imports; i++) {
+            _mib_cache_put_string(&w, mp->imports[i].label);
+            _mib_cache_put(&w, mp->imports[i].modid);
+        }
+    }
+
+    for (n = tc_alloc; n > 0 && tclist[n - 1].type == 0; n--)
+        ;
+    _mib_cache_put(&w, n);
+    for (j = 0; j < (int)n; j++) {
+        _mib_cache_put(&w, tclist[j].type);
+        _mib_cache_put(&w, tclist[j].modid);
+        _mib_cache_put_string(&w, tclist[j].descriptor);
+        _mib_cache_put_string(&w, tclist[j].hint);
+        _mib_cache_put_string(&w, tclist[j].description);
+        _mib_cache_put_enums(&w, tclist[j].enums);
+        _mib_cache_put_ranges(&w, tclist[j].ranges);
+    }
+
+    pos = w.words.len;
+    _mib_cache_put(&w, 0);
+    for (n = 0, tp = tree_head; tp; tp = tp->next_peer)
+        n++;
+    _mib_cache_put(&w, n);
+    for (tp = tree_head; tp; tp = tp->next_peer)
+        _mib_cache_put_tree(&w, tp);
+    _mib_cache_patch(&w, pos, w.nnodes);
+
+    /*
+     * The hash chains one after the other, as preorder node numbers, so
+     * that names that are defined more than once resolve as they did.
+     */
+    if (w.nodes)
+        qsort(w.nodes, w.nnodes, sizeof(*w.nodes), _mib_cache_node_cmp);
+    pos = w.words.len;
+    _mib_cache_put(&w, 0);
+    n = 0;
+    for (i = 0; i < (int) tbucket_size; i++) {
+        for (tp = tbuckets[i]; tp; tp = tp->next) {
+            key_node.tp = tp;
+            np = w.nodes ? bsearch(&key_node, w.nodes, w.nnodes,
+                                   sizeof(*w.nodes),
+                                   _mib_cache_node_cmp) : NULL;
+            if (np == NULL) {
+                DEBUGMSGTL(("parse-mibs:cache",
+                            "%s is not in the tree\n", tp->label));
+                continue;
+            }
+            _mib_cache_put(&w, np->idx);
+            n++;
+        }
+    }
+    _mib_cache_patch(&w, pos, n);
+
+    while (w.strings.len % sizeof(uint32_t))
+        _mib_cache_append(&w.strings, "", 1);
+    if (w.strings.error || w.words.error) {
+        snmp_log(LOG_ERR, "Cannot build MIB cache %s\n", filename);
+        goto out;
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = MIB_CACHE_MAGIC;
+    hdr.version = MIB_CACHE_VERSION;
+    hdr.byte_order = MIB_CACHE_BYTE_ORDER;
+    hdr.strings_len = w.strings.len;
+    hdr.words_len = w.words.len / sizeof(uint32_t);
+
+    /*
+     * Write to a temporary file and rename it, so that nobody ever reads
+     * a partial image.
+     */
+    if (asprintf(&tmpfile, "%s.%ld", filename, (long) getpid()) < 0) {
+        tmpfile = NULL;
+        goto out;
+    }
+    fp = fopen(tmpfile, "wb");
+    if (fp == NULL) {
+        snmp_log_perror(tmpfile);
+        goto out;
+    }
+    if (fwrite(&hdr, sizeof(hdr), 1, fp) != 1 ||
+        fwrite(w.strings.data, 1, w.strings.len, fp) != w.strings.len ||
+        fwrite(w.words.data, 1, w.words.len, fp) != w.words.len) {
+        snmp_log_perror(tmpfile);
+        goto out;
+    }
+    if (fclose(fp) != 0) {
+        fp = NULL;
+        snmp_log_perror(tmpfile);
+        goto out;
+    }
+    fp = NULL;
+    if (rename(tmpfile, filename) < 0) {
+        snmp_log_perror(filename);
+        goto out;
+    }
+    DEBUGMSGTL(("parse-mibs:cache", "wrote %s: %d modules, %d nodes\n",
+                filename, max_module, (int)w.nnodes));
+    rc = 0;
+
+  out:
+    if (fp)
+        fclose(fp);
+    if (rc < 0 && tmpfile)
+        unlink(tmpfile);
+    free(tmpfile);
+    free(w.strings.data);
+    free(w.words.data);
+    free(w.nodes);
+    return rc;
+}
+
+static uint32_t
+_mib_cache_get(struct mib_cache_reader *r)
+{
+    if (r->pos >= r->nwords) {
+        r->error = 1;
+        return 0;
+    }
+    return r->words[r->pos++];
+}
+
+/*
+ * Reads the number of items that follow, each @size words or more.
+ */
+static uint32_t
+_mib_cache_get_count(struct mib_cache_reader *r, size_t size)
+{
+    uint32_t        n = _mib_cache_get(r);
+
+    if (n > (r->nwords - r->pos) / size) {
+        r->error = 1;
+        return 0;
+    }
+    return n;
+}
+
+static const char *
+_mib_cache_get_string(struct mib_cache_reader *r)
+{
+    uint32_t        off = _mib_cache_get(r);
+
+    if (off == 0)
+        return NULL;
+    if (off > r->strings_len) {
+        r->error = 1;
+        return NULL;
+    }
+    return r->strings + off - 1;
+}
+
+static char *
+_mib_cache_get_strdup(struct mib_cache_reader *r)
+{
+    const char     *s = _mib_cache_get_string(r);
+    char           *copy;
+
+    if (s == NULL)
+        return NULL;
+    copy = strdup(s);
+    if (copy == NULL)
+        r->error = 1;
+    return copy;
+}
+
+static struct enum_list *
+_mib_cache_get_enums(struct mib_cache_reader *r)
+{
+    struct enum_list *head = NULL, **ep = &head;
+    uint32_t        n = _mib_cache_get_count(r, 2);
+
+    for (; n > 0 && !r->error; n--, ep = &(*ep)->next) {
+        *ep = calloc(1, sizeof(**ep));
+        if (*ep == NULL) {
+            r->error = 1;
+            break;
+        }
+        (*ep)->value = _mib_cache_get(r);
+        (*ep)->label = _mib_cache_get_strdup(r);
+    }
+    return head;
+}
+
+static struct range_list *
+_mib_cache_get_ranges(struct mib_cache_reader *r)
+{
+    struct range_list *head = NULL, **rp = &head;
+    uint32_t        n = _mib_cache_get_count(r, 2);
+
+    for (; n > 0 && !r->error; n--, rp = &(*rp)->next) {
+        *rp = calloc(1, sizeof(**rp));
+        if (*rp == NULL) {
+            r->error = 1;
+            break;
+        }
+        (*rp)->low = _mib_cache_get(r);
+        (*rp)->high = _mib_cache_get(r);
+    }
+    return head;
+}
+
+/*
+ * Checks that none of the files and directories the image was built from
+ * has changed.
+ */
+static int
+_mib_cache_check_deps(struct mib_cache_reader *r)
+{
+    struct stat     st;
+    const char     *path;
+    uint64_t        mtime, size;
+    uint32_t        n, exists;
+
+    for (n = _mib_cache_get_count(r, 2); n > 0 && !r->error; n--) {
+        exists = _mib_cache_get(r);
+        path = _mib_cache_get_string(r);
+        if (path == NULL)
+            return -1;
+        if (!exists) {
+            if (stat(path, &st) == 0) {
+                DEBUGMSGTL(("parse-mibs:cache", "%s is new\n", path));
+                return -1;
+            }
+            continue;
+        }
+        mtime = _mib_cache_get(r);
+        mtime |= (uint64_t) _mib_cache_get(r) << 32;
+        size = _mib_cache_get(r);
+        size |= (uint64_t) _mib_cache_get(r) << 32;
+        if (r->error)
+            return -1;
+        if (stat(path, &st) < 0 || (uint64_t) st.st_mtime != mtime ||
+            (uint64_t) st.st_size != size) {
+            DEBUGMSGTL(("parse-mibs:cache", "%s has changed\n", path));
+            return -1;
+        }
+    }
+    return r->error ? -1 : 0;
+}
+
+/*
+ * Frees a list of peers read from an image, with their children.
+ */
+static void
+_mib_cache_free_tree(struct tree *tp)
+{
+    struct tree    *next;
+
+    for (; tp; tp = next) {
+        next = tp->next_peer;
+        _mib_cache_free_tree(tp->child_list);
+        free_partial_tree(tp, FALSE);
+        if (tp->module_list != &tp->modid)
+            free(tp->module_list);
+        free(tp);
+    }
+}
+
+static struct tree *
+_mib_cache_get_tree(struct mib_cache_reader *r, struct tree *parent,
+                    struct tree **nodes, uint32_t nnodes, uint32_t *idx,
+                    int depth)
+{
+    struct tree    *tp, **cp;
+    struct index_list **ip;
+    struct varbind_list **vp;
+    uint32_t        n, i;
+
+    if (*idx >= nnodes || depth > MAX_OID_LEN) {
+        r->error = 1;
+        return NULL;
+    }
+    tp = calloc(1, sizeof(*tp));
+    if (tp == NULL) {
+        r->error = 1;
+        return NULL;
+    }
+    nodes[(*idx)++] = tp;
+    tp->parent = parent;
+    tp->module_list = &tp->modid;
+
+    tp->label = _mib_cache_get_strdup(r);
+    if (tp->label == NULL)
+        r->error = 1;
+    tp->subid = _mib_cache_get(r);
+    tp->modid = _mib_cache_get(r);
+    tp->number_modules = _mib_cache_get(r);
+    n = _mib_cache_get_count(r, 1);
+    if (n > 0) {
+        if (n != (uint32_t) tp->number_modules ||
+            (tp->module_list = malloc(n * sizeof(int))) == NULL) {
+            tp->module_list = &tp->modid;
+            r->error = 1;
+            return tp;
+        }
+        for (i = 0; i < n; i++)
+            tp->module_list[i] = _mib_cache_get(r);
+    }
+    tp->tc_index = _mib_cache_get(r);
+    if (tp->tc_index < -1 || tp->tc_index >= (int) r->ntc)
+        r->error = 1;
+    tp->type = _mib_cache_get(r);
+    tp->access = _mib_cache_get(r);
+    tp->status = _mib_cache_get(r);
+    tp->enums = _mib_cache_get_enums(r);
+    tp->ranges = _mib_cache_get_ranges(r);
+    n = _mib_cache_get_count(r, 2);
+    for (ip = &tp->indexes; n > 0 && !r->error; n--, ip = &(*ip)->next) {
+        *ip = calloc(1, sizeof(**ip));
+        if (*ip == NULL) {
+            r->error = 1;
+            break;
+        }
+        (*ip)->ilabel = _mib_cache_get_strdup(r);
+        (*ip)->isimplied = _mib_cache_get(r);
+    }
+    tp->augments = _mib_cache_get_strdup(r);
+    n = _mib_cache_get_count(r, 1);
+    for (vp = &tp->varbinds; n > 0 && !r->error; n--, vp = &(*vp)->next) {
+        *vp = calloc(1, sizeof(**vp));
+        if (*vp == NULL) {
+            r->error = 1;
+            break;
+        }
+        (*vp)->vblabel = _mib_cache_get_strdup(r);
+    }
+    tp->hint = _mib_cache_get_strdup(r);
+    tp->units = _mib_cache_get_strdup(r);
+    tp->description = _mib_cache_get_strdup(r);
+    tp->reference = _mib_cache_get_strdup(r);
+    tp->defaultValue = _mib_cache_get_strdup(r);
+    set_function(tp);           /* from mib.c */
+
+    n = _mib_cache_get_count(r, 20);
+    for (cp = &tp->child_list; n > 0 && !r->error; n--) {
+        *cp = _mib_cache_get_tree(r, tp, nodes, nnodes, idx, depth + 1);
+        if (*cp == NULL)
+            break;
+        cp = &(*cp)->next_peer;
+    }
+    return tp;
+}
+
+static void
+_mib_cache_free_modules(struct module *mp)
+{
+    struct module  *next;
+    int             i;
+
+    for (; mp; mp = next) {
+        next = mp->next;
+        if (mp->imports && mp->imports != root_imports) {
+            for (i = 0; i < mp->no_imports; i++)
+                free(mp->imports[i].label);
+            free(mp->imports);
+        }
+        free(mp->name);
+        free(mp->file);
+        free(mp);
+    }
+}
+
+/*
+ * netsnmp_read_mib_cache(): loads the MIB modules and tree from an image
+ * written by netsnmp_write_mib_cache(), if it was built with the same @key
+ * and the MIB files it was built from have not changed since.  Must be
+ * called before any MIB directory is added or any module is read.
+ *
+ * Returns 0 if the image was loaded, or -1 if the MIBs should be read as
+ * usual.
+ */
+int
+netsnmp_read_mib_cache(const char *filename, const char *key)
+{
+    struct mib_cache_reader r;
+    struct mib_cache_header hdr;
+    struct module_import imports[NUMBER_OF_ROOT_NODES];
+    struct module  *modules = NULL, **mpp = &modules, *mp;
+    struct tc      *tcs = NULL;
+    struct tree    *roots = NULL, **tpp = &roots, *tp, *next;
+    struct tree    *hashed = NULL;
+    struct tree   **nodes = NULL;
+    struct stat     st;
+    const char     *cp;
+    char           *image = NULL;
+    size_t          size = 0;
+    uint32_t        n, i, j, nnodes = 0, idx = 0, ntc = 0, tcsize = 0;
+    uint32_t        nhashed = 0, hsize;
+    int             fd, maxmod, mapped = 0, rc = -1;
+
+    if (module_head != NULL || tree_head == NULL)
+        return -1;
+    for (tp = tree_head; tp; tp = tp->next_peer)
+        if (tp->child_list)
+            return -1;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        DEBUGMSGTL(("parse-mibs:cache", "cannot open %s\n", filename));
+        return -1;
+    }
+    if (fstat(fd, &st) < 0 || st.st_size < (off_t) sizeof(hdr) ||
+        (uint64_t) st.st_size > 0xffffffffUL) {
+        close(fd);
+        return -1;
+    }
+    size = st.st_size;
+#ifdef MIB_CACHE_MMAP
+    image = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (image == MAP_FAILED)
+        image = NULL;
+    else
+        mapped = 1;
+#endif
+    if (image == NULL) {
+        image = malloc(size);
+        if (image == NULL || read(fd, image, size) != (ssize_t) size) {
+            free(image);
+            close(fd);
+            return -1;
+        }
+    }
+    close(fd);
+
+    memset(imports, 0, sizeof(imports));
+    memcpy(&hdr, image, sizeof(hdr));
+    if (hdr.magic != MIB_CACHE_MAGIC || hdr.version != MIB_CACHE_VERSION ||
+        hdr.byte_order != MIB_CACHE_BYTE_ORDER ||
+        hdr.strings_len == 0 || hdr.strings_len % sizeof(uint32_t) ||
+        hdr.strings_len > size - sizeof(hdr) ||
+        (size - sizeof(hdr) - hdr.strings_len) !=
+        (size_t) hdr.words_len * sizeof(uint32_t) ||
+        image[sizeof(hdr) + hdr.strings_len - 1] != '\0') {
+        snmp_log(LOG_WARNING, "%s is not a usable MIB cache\n", filename);
+        goto out;
+    }
+    memset(&r, 0, sizeof(r));
+    r.strings = image + sizeof(hdr);
+    r.strings_len = hdr.strings_len;
+    r.words = (const uint32_t *) (r.strings + hdr.strings_len);
+    r.nwords = hdr.words_len;
+
+    cp = _mib_cache_get_string(&r);
+    if (cp == NULL || strcmp(cp, key ? key : "") != 0) {
+        DEBUGMSGTL(("parse-mibs:cache",
+                    "%s was built with other MIB settings\n", filename));
+        goto out;
+    }
+    if (_mib_cache_check_deps(&r) < 0)
+        goto out;
+
+    for (i = 0; i < NUMBER_OF_ROOT_NODES; i++) {
+        imports[i].label = _mib_cache_get_strdup(&r);
+        imports[i].modid = _mib_cache_get(&r);
+    }
+
+    maxmod = _mib_cache_get(&r);
+    for (n = _mib_cache_get_count(&r, 4); n > 0 && !r.error; n--) {
+        mp = calloc(1, sizeof(*mp));
+        if (mp == NULL) {
+            r.error = 1;
+            break;
+        }
+        *mpp = mp;
+        mpp = &mp->next;
+        mp->name = _mib_cache_get_strdup(&r);
+        mp->file = _mib_cache_get_strdup(&r);
+        mp->modid = _mib_cache_get(&r);
+        mp->no_imports = _mib_cache_get(&r);
+        if (mp->name == NULL || mp->file == NULL)
+            r.error = 1;
+        if (r.error || mp->no_imports <= 0)
+            continue;
+        if (_mib_cache_get(&r)) {
+            if (mp->no_imports != NUMBER_OF_ROOT_NODES)
+                r.error = 1;
+            mp->imports = root_imports;
+            continue;
+        }
+        j = mp->no_imports;
+        mp->no_imports = 0;
+        if (j > (r.nwords - r.pos) / 2 ||
+            (mp->imports = calloc(j, sizeof(*mp->imports))) == NULL) {
+            r.error = 1;
+            break;
+        }
+        mp->no_imports = j;
+        for (i = 0; i < j; i++) {
+            mp->imports[i].label = _mib_cache_get_strdup(&r);
+            mp->imports[i].modid = _mib_cache_get(&r);
+        }
+    }
+
+    ntc = _mib_cache_get_count(&r, 7);
+    tcsize = (ntc / TC_INCR + 1) * TC_INCR;
+    tcs = calloc(tcsize, sizeof(*tcs));
+    if (tcs == NULL)
+        r.error = 1;
+    for (i = 0; i < ntc && !r.error; i++) {
+        tcs[i].type = _mib_cache_get(&r);
+        tcs[i].modid = _mib_cache_get(&r);
+        tcs[i].descriptor = _mib_cache_get_strdup(&r);
+        tcs[i].hint = _mib_cache_get_strdup(&r);
+        tcs[i].description = _mib_cache_get_strdup(&r);
+        tcs[i].enums = _mib_cache_get_enums(&r);
+        tcs[i].ranges = _mib_cache_get_ranges(&r);
+        if (tcs[i].type != 0 && tcs[i].descriptor == NULL)
+            r.error = 1;
+    }
+    r.ntc = ntc;
+
+    nnodes = _mib_cache_get_count(&r, 20);
+    nodes = calloc(nnodes ? nnodes : 1, sizeof(*nodes));
+    if (nodes == NULL)
+        r.error = 1;
+    for (n = _mib_cache_get_count(&r, 20); n > 0 && !r.error; n--) {
+        *tpp = _mib_cache_get_tree(&r, NULL, nodes, nnodes, &idx, 0);
+        if (*tpp == NULL)
+            break;
+        tpp = &(*tpp)->next_peer;
+    }
+    if (idx != nnodes || roots == NULL)
+        r.error = 1;
+
+    /*
+     * Collect the hashed nodes in reverse, to be pushed onto their chains
+     * below in their original order.
+     */
+    for (n = r.error ? 0 : _mib_cache_get_count(&r, 1); n > 0; n--) {
+        j = _mib_cache_get(&r);
+        /* each node is hashed at most once */
+        if (r.error || j >= nnodes || nodes[j] == NULL) {
+            r.error = 1;
+            break;
+        }
+        nodes[j]->next = hashed;
+        hashed = nodes[j];
+        nodes[j] = NULL;
+        nhashed++;
+    }
+
+    if (r.error || r.pos != r.nwords) {
+        snmp_log(LOG_WARNING, "Ignoring corrupt MIB cache %s\n", filename);
+        goto out;
+    }
+
+    /*
+     * Replace the roots set up by netsnmp_init_mib_internals().
+     */
+    for (tp = tree_head; tp; tp = next) {
+        next = tp->next_peer;
+        free_tree(tp);
+    }
+    for (i = 0; i < NUMBER_OF_ROOT_NODES; i++) {
+        SNMP_FREE(root_imports[i].label);
+        root_imports[i] = imports[i];
+        imports[i].label = NULL;
+    }
+    free(tclist);
+    tclist = tcs;
+    tc_alloc = tcsize;
+    tcs = NULL;
+    module_head = modules;
+    modules = NULL;
+    max_module = maxmod;
+    reset_hash_tables();
+    for (hsize = NHASHSIZE; hsize < nhashed && hsize < 0x40000000U;
+         hsize <<= 1)
+        ;
+    if (hsize > NHASHSIZE)
+        resize_tbuckets(hsize);
+    for (tp = hashed; tp; tp = next) {
+        next = tp->next;
+        link_tbucket(tp);
+    }
+    tree_head = roots;
+    roots = NULL;
+    DEBUGMSGTL(("parse-mibs:cache", "loaded %s: %d modules, %d nodes\n",
+                filename, max_module, (int)nnodes));
+    rc = 0;
+
+  out:
+    _mib_cache_free_tree(roots);
+    _mib_cache_free_modules(modules);
+    if (tcs) {
+        for (i = 0; i < ntc; i++) {
+            free(tcs[i].descriptor);
+            free(tcs[i].hint);
+            free(tcs[i].description);
+            free_enums(&tcs[i].enums);
+            free_ranges(&tcs[i].ranges);
+        }
+        free(tcs);
+    }
+    for (i = 0; i < NUMBER_OF_ROOT_NODES; i++)
+        free(imports[i].label);
+    free(nodes);
+#ifdef MIB_CACHE_MMAP
+    if (mapped)
+        munmap(image, size);
+    else
+#endif
+        free(image);
+    return rc;
+}
+
 #ifdef TEST
 int main(int argc, char *argv[])
 {
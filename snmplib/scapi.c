@@ -84,6 +84,7 @@ netsnmp_feature_child_of(usm_scapi, usm_support);
 #ifdef NETSNMP_USE_OPENSSL
 #include <openssl/hmac.h>
 #include <openssl/evp.h>
+#include <openssl/err.h>
 #include <openssl/rand.h>
 #include <openssl/des.h>
 #ifdef HAVE_AES
@@ -693,6 +694,319 @@ sc_get_openssl_privfn(int priv_type)
 }
 #endif /* openssl */
 
+/*
+ * Key caches
+ *
+ * Setting up a key is a good part of the work of authenticating or
+ * encrypting a small message: HMAC hashes the key XORed with the inner
+ * and outer pads, and the ciphers expand the key into a key schedule.
+ * A key cache keeps that state for one key, so that messages that use the
+ * same key only need to copy or reset it.  A cache remembers the key it
+ * was set up for and is set up again when it is used with another key, so
+ * that changing the key of a user needs no further care.
+ *
+ * A cache is locked from the time it is looked up until the message has
+ * been hashed or crypted with it, since the agent may process messages for
+ * the same user on several threads.
+ */
+#if defined(NETSNMP_USE_OPENSSL) && !defined(NETSNMP_DISABLE_DES)
+#define SC_CACHE_DES
+#endif
+#if defined(NETSNMP_REENTRANT) && defined(HAVE_PTHREAD_H)
+#define SC_CACHE_MUTEX
+#endif
+
+struct netsnmp_sc_key_cache_s {
+    int             type;       /* authentication or privacy type */
+    u_char         *key;
+    u_int           keylen;
+#ifdef NETSNMP_USE_OPENSSL
+    EVP_MD_CTX     *hmac_inner; /* hash state after the key ^ ipad block */
+    EVP_MD_CTX     *hmac_outer; /* hash state after the key ^ opad block */
+    EVP_MD_CTX     *hmac_work;
+    EVP_CIPHER_CTX *cipher_enc;
+    EVP_CIPHER_CTX *cipher_dec;
+#endif
+#ifdef SC_CACHE_MUTEX
+    pthread_mutex_t lock;
+#endif
+};
+
+#ifdef NETSNMP_USE_OPENSSL
+static EVP_MD_CTX *
+_sc_md_ctx_new(void)
+{
+#if defined(HAVE_EVP_MD_CTX_NEW)
+    return EVP_MD_CTX_new();
+#elif defined(HAVE_EVP_MD_CTX_CREATE)
+    return EVP_MD_CTX_create();
+#else
+    EVP_MD_CTX     *cptr = malloc(sizeof(*cptr));
+
+    if (cptr)
+        EVP_MD_CTX_init(cptr);
+    return cptr;
+#endif
+}
+
+static void
+_sc_md_ctx_free(EVP_MD_CTX *cptr)
+{
+    if (!cptr)
+        return;
+#if defined(HAVE_EVP_MD_CTX_FREE)
+    EVP_MD_CTX_free(cptr);
+#elif defined(HAVE_EVP_MD_CTX_DESTROY)
+    EVP_MD_CTX_destroy(cptr);
+#else
+    EVP_MD_CTX_cleanup(cptr);
+    free(cptr);
+#endif
+}
+#endif /* NETSNMP_USE_OPENSSL */
+
+static void
+_sc_key_cache_clear(netsnmp_sc_key_cache *kc)
+{
+    if (kc->key) {
+        SNMP_ZERO(kc->key, kc->keylen);
+        SNMP_FREE(kc->key);
+    }
+    kc->keylen = 0;
+#ifdef NETSNMP_USE_OPENSSL
+    _sc_md_ctx_free(kc->hmac_inner);
+    _sc_md_ctx_free(kc->hmac_outer);
+    _sc_md_ctx_free(kc->hmac_work);
+    kc->hmac_inner = kc->hmac_outer = kc->hmac_work = NULL;
+    if (kc->cipher_enc)
+        EVP_CIPHER_CTX_free(kc->cipher_enc);
+    if (kc->cipher_dec)
+        EVP_CIPHER_CTX_free(kc->cipher_dec);
+    kc->cipher_enc = kc->cipher_dec = NULL;
+#endif
+}
+
+/*
+ * sc_key_cache_free(): frees the key cache *cache, if any, and sets
+ * *cache to NULL.
+ */
+void
+sc_key_cache_free(netsnmp_sc_key_cache **cache)
+{
+    if (!cache || !*cache)
+        return;
+    _sc_key_cache_clear(*cache);
+#ifdef SC_CACHE_MUTEX
+    pthread_mutex_destroy(&(*cache)->lock);
+#endif
+    SNMP_FREE(*cache);
+}
+
+#ifdef NETSNMP_USE_OPENSSL
+static void
+_sc_key_cache_lock(netsnmp_sc_key_cache *kc)
+{
+#ifdef SC_CACHE_MUTEX
+    pthread_mutex_lock(&kc->lock);
+#else
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_KEYCACHE);
+#endif
+}
+
+static void
+_sc_key_cache_unlock(netsnmp_sc_key_cache *kc)
+{
+#ifdef SC_CACHE_MUTEX
+    pthread_mutex_unlock(&kc->lock);
+#else
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_KEYCACHE);
+#endif
+}
+
+
+/*
+ * Returns the cache in *cache, allocating it if needed, locked and set up
+ * for the given type and key.  *fresh is set if it was not and the caller
+ * has to set up its state.  Returns NULL, unlocked, if out of memory.
+ */
+static netsnmp_sc_key_cache *
+_sc_key_cache_get(netsnmp_sc_key_cache **cache, int type,
+                  const u_char *key, u_int keylen, int *fresh)
+{
+    netsnmp_sc_key_cache *kc;
+
+    *fresh = 0;
+    snmp_res_lock(MT_LIBRARY_ID, MT_LIB_KEYCACHE);
+    kc = *cache;
+    if (!kc && (kc = calloc(1, sizeof(*kc))) != NULL) {
+#ifdef SC_CACHE_MUTEX
+        if (pthread_mutex_init(&kc->lock, NULL) != 0)
+            SNMP_FREE(kc);
+#endif
+        *cache = kc;
+    }
+    snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_KEYCACHE);
+    if (!kc)
+        return NULL;
+
+    _sc_key_cache_lock(kc);
+    if (kc->key && kc->type == type && kc->keylen == keylen &&
+        memcmp(kc->key, key, keylen) == 0)
+        return kc;
+
+    _sc_key_cache_clear(kc);
+    kc->key = netsnmp_memdup(key, keylen);
+    if (!kc->key) {
+        _sc_key_cache_unlock(kc);
+        return NULL;
+    }
+    kc->keylen = keylen;
+    kc->type = type;
+    *fresh = 1;
+    return kc;
+}
+
+/*
+ * Returns a locked key cache with the HMAC pads of key hashed in, or NULL.
+ */
+static netsnmp_sc_key_cache *
+_sc_key_cache_auth(netsnmp_sc_key_cache **cache, int auth_type,
+                   const u_char *key, u_int keylen)
+{
+    netsnmp_sc_key_cache *kc;
+    const EVP_MD   *hashfn;
+    u_char          ipad[128], opad[128], keyhash[EVP_MAX_MD_SIZE];
+    unsigned int    keyhashlen;
+    int             blocksize, fresh, i;
+
+    kc = _sc_key_cache_get(cache, auth_type, key, keylen, &fresh);
+    if (!kc || !fresh)
+        return kc;
+
+    hashfn = sc_get_openssl_hashfn(auth_type);
+    if (!hashfn)
+        goto fail;
+    blocksize = EVP_MD_block_size(hashfn);
+    if (blocksize <= 0 || blocksize > (int) sizeof(ipad))
+        goto fail;
+    if (keylen > (u_int) blocksize) {
+        if (!EVP_Digest(key, keylen, keyhash, &keyhashlen, hashfn, NULL))
+            goto fail;
+        key = keyhash;
+        keylen = keyhashlen;
+    }
+    memset(ipad, 0x36, blocksize);
+    memset(opad, 0x5c, blocksize);
+    for (i = 0; i < (int) keylen; i++) {
+        ipad[i] ^= key[i];
+        opad[i] ^= key[i];
+    }
+
+    kc->hmac_inner = _sc_md_ctx_new();
+    kc->hmac_outer = _sc_md_ctx_new();
+    kc->hmac_work = _sc_md_ctx_new();
+    if (!kc->hmac_inner || !kc->hmac_outer || !kc->hmac_work ||
+        !EVP_DigestInit_ex(kc->hmac_inner, hashfn, NULL) ||
+        !EVP_DigestUpdate(kc->hmac_inner, ipad, blocksize) ||
+        !EVP_DigestInit_ex(kc->hmac_outer, hashfn, NULL) ||
+        !EVP_DigestUpdate(kc->hmac_outer, opad, blocksize))
+        goto fail;
+
+    memset(ipad, 0, sizeof(ipad));
+    memset(opad, 0, sizeof(opad));
+    memset(keyhash, 0, sizeof(keyhash));
+    return kc;
+
+  fail:
+    memset(ipad, 0, sizeof(ipad));
+    memset(opad, 0, sizeof(opad));
+    memset(keyhash, 0, sizeof(keyhash));
+    _sc_key_cache_clear(kc);
+    _sc_key_cache_unlock(kc);
+    return NULL;
+}
+
+/*
+ * HMAC of message with the key of kc.  buf must hold EVP_MAX_MD_SIZE bytes.
+ */
+static int
+_sc_key_cache_hmac(netsnmp_sc_key_cache *kc, const u_char *message,
+                   u_int msglen, u_char *buf, unsigned int *buf_len)
+{
+    if (!EVP_MD_CTX_copy_ex(kc->hmac_work, kc->hmac_inner) ||
+        !EVP_DigestUpdate(kc->hmac_work, message, msglen) ||
+        !EVP_DigestFinal_ex(kc->hmac_work, buf, buf_len) ||
+        !EVP_MD_CTX_copy_ex(kc->hmac_work, kc->hmac_outer) ||
+        !EVP_DigestUpdate(kc->hmac_work, buf, *buf_len) ||
+        !EVP_DigestFinal_ex(kc->hmac_work, buf, buf_len))
+        return SNMPERR_GENERR;
+    return SNMPERR_SUCCESS;
+}
+
+#if defined(HAVE_AES) || defined(SC_CACHE_DES)
+/*
+ * Returns the cipher context of kc for encrypting (enc = 1) or decrypting
+ * (enc = 0), with the key set up, or NULL.
+ */
+static EVP_CIPHER_CTX *
+_sc_key_cache_cipher(netsnmp_sc_key_cache *kc, const EVP_CIPHER *cipher,
+                     int enc)
+{
+    EVP_CIPHER_CTX **ctxp = enc ? &kc->cipher_enc : &kc->cipher_dec;
+
+    if (*ctxp == NULL) {
+        *ctxp = EVP_CIPHER_CTX_new();
+        if (*ctxp == NULL)
+            return NULL;
+        if (EVP_CipherInit_ex(*ctxp, cipher, NULL, kc->key, NULL, enc) != 1) {
+            EVP_CIPHER_CTX_free(*ctxp);
+            *ctxp = NULL;
+            return NULL;
+        }
+        /* DES messages are padded by the caller */
+        EVP_CIPHER_CTX_set_padding(*ctxp, 0);
+    }
+    return *ctxp;
+}
+#endif /* HAVE_AES || SC_CACHE_DES */
+
+/*
+ * Returns a locked key cache for privacy protocol pai with key, or NULL.
+ * For DES the cipher contexts are set up right away; they are left unset
+ * if the crypto library does not offer DES-CBC through EVP (OpenSSL 3
+ * without the legacy provider), and the key schedule is then computed for
+ * each message as without a cache.
+ */
+static netsnmp_sc_key_cache *
+_sc_key_cache_priv(netsnmp_sc_key_cache **cache,
+                   const netsnmp_priv_alg_info *pai,
+                   const u_char *key, u_int keylen)
+{
+    netsnmp_sc_key_cache *kc;
+    int             fresh;
+
+    kc = _sc_key_cache_get(cache, pai->type, key, keylen, &fresh);
+#ifdef SC_CACHE_DES
+    if (kc && fresh &&
+        USM_CREATE_USER_PRIV_DES == (pai->type & USM_PRIV_MASK_ALG) &&
+        keylen >= 8) {
+        ERR_set_mark();
+        if (!_sc_key_cache_cipher(kc, EVP_des_cbc(), 1) ||
+            !_sc_key_cache_cipher(kc, EVP_des_cbc(), 0)) {
+            if (kc->cipher_enc)
+                EVP_CIPHER_CTX_free(kc->cipher_enc);
+            if (kc->cipher_dec)
+                EVP_CIPHER_CTX_free(kc->cipher_dec);
+            kc->cipher_enc = kc->cipher_dec = NULL;
+        }
+        ERR_pop_to_mark();
+    }
+#endif
+    return kc;
+}
+#endif /* NETSNMP_USE_OPENSSL */
+
+
 
 /*******************************************************************-o-******
  * sc_generate_keyed_hash
@@ -726,6 +1040,22 @@ sc_generate_keyed_hash(const oid * authtypeOID, size_t authtypeOIDlen,
                        const u_char * key, u_int keylen,
                        const u_char * message, u_int msglen,
                        u_char * MAC, size_t * maclen)
+{
+    return sc_generate_keyed_hash_cached(NULL, authtypeOID, authtypeOIDlen,
+                                         key, keylen, message, msglen,
+                                         MAC, maclen);
+}
+
+/*
+ * sc_generate_keyed_hash_cached(): like sc_generate_keyed_hash(), but
+ * keeps the hashed key pads in *cache between calls.  cache may be NULL.
+ */
+int
+sc_generate_keyed_hash_cached(netsnmp_sc_key_cache **cache,
+                              const oid * authtypeOID, size_t authtypeOIDlen,
+                              const u_char * key, u_int keylen,
+                              const u_char * message, u_int msglen,
+                              u_char * MAC, size_t * maclen)
 #if  defined(NETSNMP_USE_INTERNAL_MD5) || defined(NETSNMP_USE_OPENSSL) || defined(NETSNMP_USE_PKCS11) || defined(NETSNMP_USE_INTERNAL_CRYPTO)
 {
     int             rval = SNMPERR_SUCCESS, auth_type;
@@ -737,6 +1067,7 @@ sc_generate_keyed_hash(const oid * authtypeOID, size_t authtypeOIDlen,
 #endif
 #ifdef NETSNMP_USE_OPENSSL
     const EVP_MD   *hashfn;
+    netsnmp_sc_key_cache *kc = NULL;
 #elif defined(NETSNMP_USE_PKCS11)
     u_long          ck_type;
 #endif
@@ -781,7 +1112,16 @@ sc_generate_keyed_hash(const oid * authtypeOID, size_t authtypeOIDlen,
         QUITFUN(SNMPERR_GENERR, sc_generate_keyed_hash_quit);
     }
 
-    HMAC(hashfn, key, keylen, message, msglen, buf, &buf_len);
+    if (cache)
+        kc = _sc_key_cache_auth(cache, auth_type, key, keylen);
+    if (kc) {
+        rval = _sc_key_cache_hmac(kc, message, msglen, buf, &buf_len);
+        _sc_key_cache_unlock(kc);
+        if (rval != SNMPERR_SUCCESS) {
+            QUITFUN(SNMPERR_GENERR, sc_generate_keyed_hash_quit);
+        }
+    } else
+        HMAC(hashfn, key, keylen, message, msglen, buf, &buf_len);
     if (buf_len != properlength) {
         QUITFUN(rval, sc_generate_keyed_hash_quit);
     }
@@ -1076,6 +1416,22 @@ sc_check_keyed_hash(const oid * authtypeOID, size_t authtypeOIDlen,
                     const u_char * key, u_int keylen,
                     const u_char * message, u_int msglen,
                     const u_char * MAC, u_int maclen)
+{
+    return sc_check_keyed_hash_cached(NULL, authtypeOID, authtypeOIDlen,
+                                      key, keylen, message, msglen,
+                                      MAC, maclen);
+}
+
+/*
+ * sc_check_keyed_hash_cached(): like sc_check_keyed_hash(), with a key
+ * cache as for sc_generate_keyed_hash_cached().
+ */
+int
+sc_check_keyed_hash_cached(netsnmp_sc_key_cache **cache,
+                           const oid * authtypeOID, size_t authtypeOIDlen,
+                           const u_char * key, u_int keylen,
+                           const u_char * message, u_int msglen,
+                           const u_char * MAC, u_int maclen)
 #if defined(NETSNMP_USE_INTERNAL_MD5) || defined(NETSNMP_USE_OPENSSL) || defined(NETSNMP_USE_PKCS11) || defined(NETSNMP_USE_INTERNAL_CRYPTO)
 {
     int             rval = SNMPERR_SUCCESS, auth_type, auth_size;
@@ -1117,8 +1473,9 @@ sc_check_keyed_hash(const oid * authtypeOID, size_t authtypeOIDlen,
      * the result with the given MAC which may be shorter than
      * the full hash length.
      */
-    rval = sc_generate_keyed_hash(authtypeOID, authtypeOIDlen, key, keylen,
-                                  message, msglen, buf, &buf_len);
+    rval = sc_generate_keyed_hash_cached(cache, authtypeOID, authtypeOIDlen,
+                                         key, keylen, message, msglen,
+                                         buf, &buf_len);
     QUITFUN(rval, sc_check_keyed_hash_quit);
 
     if (maclen > msglen) {
@@ -1170,6 +1527,22 @@ sc_encrypt(const oid * privtype, size_t privtypelen,
            u_char * iv, u_int ivlen,
            const u_char * plaintext, u_int ptlen,
            u_char * ciphertext, size_t * ctlen)
+{
+    return sc_encrypt_cached(NULL, privtype, privtypelen, key, keylen,
+                             iv, ivlen, plaintext, ptlen, ciphertext, ctlen);
+}
+
+/*
+ * sc_encrypt_cached(): like sc_encrypt(), but keeps the key schedule in
+ * *cache between calls.  cache may be NULL.
+ */
+int
+sc_encrypt_cached(netsnmp_sc_key_cache **cache,
+                  const oid * privtype, size_t privtypelen,
+                  u_char * key, u_int keylen,
+                  u_char * iv, u_int ivlen,
+                  const u_char * plaintext, u_int ptlen,
+                  u_char * ciphertext, size_t * ctlen)
 #if defined(NETSNMP_USE_OPENSSL) || defined(NETSNMP_USE_INTERNAL_CRYPTO)
 {
     int             rval = SNMPERR_SUCCESS;
@@ -1186,6 +1559,9 @@ sc_encrypt(const oid * privtype, size_t privtypelen,
 #endif /* OLD_DES */
     DES_cblock       key_struct;
 #endif /* NETSNMP_DISABLE_DES */
+#ifdef NETSNMP_USE_OPENSSL
+    netsnmp_sc_key_cache *kc = NULL;
+#endif
 
     DEBUGTRACE;
 
@@ -1259,6 +1635,10 @@ sc_encrypt(const oid * privtype, size_t privtypelen,
     }
 
     memset(my_iv, 0, sizeof(my_iv));
+#ifdef NETSNMP_USE_OPENSSL
+    if (cache)
+        kc = _sc_key_cache_priv(cache, pai, key, keylen);
+#endif
 
 #ifndef NETSNMP_DISABLE_DES
     if (USM_CREATE_USER_PRIV_DES == (pai->type & USM_PRIV_MASK_ALG)) {
@@ -1281,25 +1661,41 @@ sc_encrypt(const oid * privtype, size_t privtypelen,
             memset(&pad_block[pad_size - pad], pad, pad);   /* filling in padblock */
         }
 
-        memcpy(key_struct, key, sizeof(key_struct));
-        (void) DES_key_sched(&key_struct, key_sch);
-
         memcpy(my_iv, iv, ivlen);
-        /*
-         * encrypt the data 
-         */
-        DES_ncbc_encrypt(plaintext, ciphertext, plast, key_sch,
-                         (DES_cblock *) my_iv, DES_ENCRYPT);
-        if (pad > 0) {
+#ifdef SC_CACHE_DES
+        if (kc && kc->cipher_enc) {
+            int             len;
+
+            if (EVP_EncryptInit_ex(kc->cipher_enc, NULL, NULL, NULL,
+                                   my_iv) != 1 ||
+                EVP_EncryptUpdate(kc->cipher_enc, ciphertext, &len,
+                                  plaintext, plast) != 1 ||
+                (pad > 0 &&
+                 EVP_EncryptUpdate(kc->cipher_enc, ciphertext + plast, &len,
+                                   pad_block, pad_size) != 1)) {
+                DEBUGMSGTL(("scapi:encrypt", "openssl error: des\n"));
+                QUITFUN(SNMPERR_GENERR, sc_encrypt_quit);
+            }
+        } else
+#endif
+        {
+            memcpy(key_struct, key, sizeof(key_struct));
+            (void) DES_key_sched(&key_struct, key_sch);
+
             /*
-             * then encrypt the pad block 
+             * encrypt the data 
              */
-            DES_ncbc_encrypt(pad_block, ciphertext + plast, pad_size,
-                             key_sch, (DES_cblock *) my_iv, DES_ENCRYPT);
-            *ctlen = plast + pad_size;
-        } else {
-            *ctlen = plast;
+            DES_ncbc_encrypt(plaintext, ciphertext, plast, key_sch,
+                             (DES_cblock *) my_iv, DES_ENCRYPT);
+            if (pad > 0) {
+                /*
+                 * then encrypt the pad block 
+                 */
+                DES_ncbc_encrypt(pad_block, ciphertext + plast, pad_size,
+                                 key_sch, (DES_cblock *) my_iv, DES_ENCRYPT);
+            }
         }
+        *ctlen = pad > 0 ? plast + pad_size : plast;
     }
 #endif
 #if defined(NETSNMP_USE_OPENSSL) && defined(HAVE_AES)
@@ -1318,38 +1714,49 @@ sc_encrypt(const oid * privtype, size_t privtypelen,
         /*
          * encrypt the data 
          */
-        ctx = EVP_CIPHER_CTX_new();
+        ctx = kc ? _sc_key_cache_cipher(kc, cipher, 1) : EVP_CIPHER_CTX_new();
         if (!ctx) {
             DEBUGMSGTL(("scapi:encrypt", "openssl error: ctx_new\n"));
             QUITFUN(SNMPERR_GENERR, sc_encrypt_quit);
         }
-        rc = EVP_EncryptInit(ctx, cipher, key, my_iv);
+        if (kc)
+            rc = EVP_EncryptInit_ex(ctx, NULL, NULL, NULL, my_iv);
+        else
+            rc = EVP_EncryptInit(ctx, cipher, key, my_iv);
         if (rc != 1) {
             DEBUGMSGTL(("scapi:encrypt", "openssl error: init\n"));
-            EVP_CIPHER_CTX_free(ctx);
+            if (!kc)
+                EVP_CIPHER_CTX_free(ctx);
             QUITFUN(SNMPERR_GENERR, sc_encrypt_quit);
         }
         rc = EVP_EncryptUpdate(ctx, ciphertext, &len, plaintext, ptlen);
         if (rc != 1) {
             DEBUGMSGTL(("scapi:encrypt", "openssl error: update\n"));
-            EVP_CIPHER_CTX_free(ctx);
+            if (!kc)
+                EVP_CIPHER_CTX_free(ctx);
             QUITFUN(SNMPERR_GENERR, sc_encrypt_quit);
         }
         enclen = len;
-        rc = EVP_EncryptFinal(ctx, ciphertext + len, &len);
+        rc = EVP_EncryptFinal_ex(ctx, ciphertext + len, &len);
         if (rc != 1) {
             DEBUGMSGTL(("scapi:encrypt", "openssl error: final\n"));
-            EVP_CIPHER_CTX_free(ctx);
+            if (!kc)
+                EVP_CIPHER_CTX_free(ctx);
             QUITFUN(SNMPERR_GENERR, sc_encrypt_quit);
         }
         enclen += len;
         ptlen = enclen;
         /* Clean up */
-        EVP_CIPHER_CTX_free(ctx);
+        if (!kc)
+            EVP_CIPHER_CTX_free(ctx);
         *ctlen = ptlen;
     }
 #endif
   sc_encrypt_quit:
+#ifdef NETSNMP_USE_OPENSSL
+    if (kc)
+        _sc_key_cache_unlock(kc);
+#endif
     /*
      * clear memory just in case 
      */
@@ -1455,6 +1862,22 @@ sc_decrypt(const oid * privtype, size_t privtypelen,
            u_char * iv, u_int ivlen,
            u_char * ciphertext, u_int ctlen,
            u_char * plaintext, size_t * ptlen)
+{
+    return sc_decrypt_cached(NULL, privtype, privtypelen, key, keylen,
+                             iv, ivlen, ciphertext, ctlen, plaintext, ptlen);
+}
+
+/*
+ * sc_decrypt_cached(): like sc_decrypt(), with a key cache as for
+ * sc_encrypt_cached().
+ */
+int
+sc_decrypt_cached(netsnmp_sc_key_cache **cache,
+                  const oid * privtype, size_t privtypelen,
+                  u_char * key, u_int keylen,
+                  u_char * iv, u_int ivlen,
+                  u_char * ciphertext, u_int ctlen,
+                  u_char * plaintext, size_t * ptlen)
 #if defined(NETSNMP_USE_OPENSSL) || defined(NETSNMP_USE_INTERNAL_CRYPTO)
 {
 
@@ -1470,6 +1893,9 @@ sc_decrypt(const oid * privtype, size_t privtypelen,
     DES_cblock      key_struct;
 #endif
     netsnmp_priv_alg_info *pai = NULL;
+#ifdef NETSNMP_USE_OPENSSL
+    netsnmp_sc_key_cache *kc = NULL;
+#endif
 
     DEBUGTRACE;
 
@@ -1515,14 +1941,32 @@ sc_decrypt(const oid * privtype, size_t privtypelen,
     }
 
     memset(my_iv, 0, sizeof(my_iv));
+#ifdef NETSNMP_USE_OPENSSL
+    if (cache)
+        kc = _sc_key_cache_priv(cache, pai, key, keylen);
+#endif
 #ifndef NETSNMP_DISABLE_DES
     if (USM_CREATE_USER_PRIV_DES == (pai->type & USM_PRIV_MASK_ALG)) {
-        memcpy(key_struct, key, sizeof(key_struct));
-        (void) DES_key_sched(&key_struct, key_sch);
-
         memcpy(my_iv, iv, ivlen);
-        DES_cbc_encrypt(ciphertext, plaintext, ctlen, key_sch,
-                        (DES_cblock *) my_iv, DES_DECRYPT);
+#ifdef SC_CACHE_DES
+        if (kc && kc->cipher_dec && ctlen % 8 == 0) {
+            int             len;
+
+            if (EVP_DecryptInit_ex(kc->cipher_dec, NULL, NULL, NULL,
+                                   my_iv) != 1 ||
+                EVP_DecryptUpdate(kc->cipher_dec, plaintext, &len,
+                                  ciphertext, ctlen) != 1) {
+                QUITFUN(SNMPERR_GENERR, sc_decrypt_quit);
+            }
+        } else
+#endif
+        {
+            memcpy(key_struct, key, sizeof(key_struct));
+            (void) DES_key_sched(&key_struct, key_sch);
+
+            DES_cbc_encrypt(ciphertext, plaintext, ctlen, key_sch,
+                            (DES_cblock *) my_iv, DES_DECRYPT);
+        }
         *ptlen = ctlen;
     }
 #endif
@@ -1540,27 +1984,34 @@ sc_decrypt(const oid * privtype, size_t privtypelen,
         /*
          * decrypt the data
          */
-        ctx = EVP_CIPHER_CTX_new();
+        ctx = kc ? _sc_key_cache_cipher(kc, cipher, 0) : EVP_CIPHER_CTX_new();
         if (!ctx) {
             QUITFUN(SNMPERR_GENERR, sc_decrypt_quit);
         }
-        rc = EVP_DecryptInit(ctx, cipher, key, my_iv);
+        if (kc)
+            rc = EVP_DecryptInit_ex(ctx, NULL, NULL, NULL, my_iv);
+        else
+            rc = EVP_DecryptInit(ctx, cipher, key, my_iv);
         if (rc != 1) {
-            EVP_CIPHER_CTX_free(ctx);
+            if (!kc)
+                EVP_CIPHER_CTX_free(ctx);
             QUITFUN(SNMPERR_GENERR, sc_decrypt_quit);
         }
         rc = EVP_DecryptUpdate(ctx, plaintext, &len, ciphertext, ctlen);
         if (rc != 1) {
-            EVP_CIPHER_CTX_free(ctx);
+            if (!kc)
+                EVP_CIPHER_CTX_free(ctx);
             QUITFUN(SNMPERR_GENERR, sc_decrypt_quit);
         }
-        rc = EVP_DecryptFinal(ctx, plaintext + len, &len);
+        rc = EVP_DecryptFinal_ex(ctx, plaintext + len, &len);
         if (rc != 1) {
-            EVP_CIPHER_CTX_free(ctx);
+            if (!kc)
+                EVP_CIPHER_CTX_free(ctx);
             QUITFUN(SNMPERR_GENERR, sc_decrypt_quit);
         }
         /* Clean up */
-        EVP_CIPHER_CTX_free(ctx);
+        if (!kc)
+            EVP_CIPHER_CTX_free(ctx);
         *ptlen = ctlen;
     }
 #endif
@@ -1569,6 +2020,10 @@ sc_decrypt(const oid * privtype, size_t privtypelen,
      * exit cond 
      */
   sc_decrypt_quit:
+#ifdef NETSNMP_USE_OPENSSL
+    if (kc)
+        _sc_key_cache_unlock(kc);
+#endif
 #ifndef NETSNMP_DISABLE_DES
 #ifdef OLD_DES
     memset(&key_sch, 0, sizeof(key_sch));
@@ -46,6 +46,7 @@ SOFTWARE.
 #include <net-snmp/net-snmp-features.h>
 
 #include <stdio.h>
+#include <stddef.h>
 #include <ctype.h>
 #if HAVE_STDLIB_H
 #include <stdlib.h>
@@ -124,6 +125,7 @@ SOFTWARE.
 #include <net-snmp/library/container.h>
 #include <net-snmp/library/snmp_secmod.h>
 #include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/event_loop.h>
 #ifdef NETSNMP_SECMOD_USM
 #include <net-snmp/library/snmpusm.h>
 #endif
@@ -193,6 +195,11 @@ static const oid default_enterprise[] = { 1, 3, 6, 1, 4, 1, 3, 1, 1 };
 struct snmp_internal_session {
     netsnmp_request_list *requests;     /* Info about outstanding requests */
     netsnmp_request_list *requestsEnd;  /* ptr to end of list */
+    netsnmp_request_list **req_hash;    /* requests by request/message id */
+    size_t          req_hash_size;      /* number of buckets, a power of 2 */
+    netsnmp_request_list **req_heap;    /* requests by expiry time */
+    size_t          req_heap_size;
+    size_t          req_count;          /* number of outstanding requests */
     int             (*hook_pre) (netsnmp_session *, netsnmp_transport *,
                                  void *, int);
     int             (*hook_parse) (netsnmp_session *, netsnmp_pdu *,
@@ -345,7 +352,6 @@ static int      snmpv3_build(u_char ** pkt, size_t * pkt_len,
                              netsnmp_pdu *pdu);
 static int      snmp_parse_version(u_char *, size_t);
 static int      snmp_resend_request(struct session_list *slp,
-                                    netsnmp_request_list *orp,
                                     netsnmp_request_list *rp,
                                     int incr_retries);
 static void     register_default_handlers(void);
@@ -818,6 +824,8 @@ register_default_handlers(void)
 		      NETSNMP_DS_LIBRARY_ID, NETSNMP_DS_LIB_CLIENTSENDBUF);
     netsnmp_ds_register_config(ASN_INTEGER, "snmp", "clientRecvBuf",
 		      NETSNMP_DS_LIBRARY_ID, NETSNMP_DS_LIB_CLIENTRECVBUF);
+    netsnmp_ds_register_config(ASN_INTEGER, "snmp", "udpIOBatch",
+		      NETSNMP_DS_LIBRARY_ID, NETSNMP_DS_LIB_UDP_IO_BATCH);
     netsnmp_ds_register_config(ASN_INTEGER, "snmp", "sendMessageMaxSize",
                                NETSNMP_DS_LIBRARY_ID,
                                NETSNMP_DS_LIB_MSG_SEND_MAX);
@@ -994,6 +1002,7 @@ void  snmp_session_insert(struct session_list *slp)
     snmp_res_lock(MT_LIBRARY_ID, MT_LIB_SESSION);
     slp->next = Sessions;
     Sessions = slp;
+    netsnmp_event_loop_session_added(slp);
     snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_SESSION);
 }
 
@@ -1964,6 +1973,8 @@ snmp_sess_close(struct session_list *slp)
             free((char *) orp);
         }
 
+        free(isp->req_hash);
+        free(isp->req_heap);
         free((char *) isp);
     }
 
@@ -2022,6 +2033,8 @@ snmp_close(netsnmp_session * session)
                 oslp = slp;
             }
         }
+        if (slp)
+            netsnmp_event_loop_session_removed(slp);
         snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_SESSION);
     }                           /*END MTCRITICAL_RESOURCE */
     if (slp == NULL) {
@@ -2039,6 +2052,7 @@ snmp_close_sessions(void)
     while (Sessions) {
         slp = Sessions;
         Sessions = Sessions->next;
+        netsnmp_event_loop_session_removed(slp);
         snmp_sess_close(slp);
     }
     snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_SESSION);
@@ -4258,6 +4272,8 @@ _snmp_parse(struct session_list *slp,
      * though that is where the need becomes visible)   
      */
     pdu->transid = snmp_get_next_transid();
+    if (session->flags & SNMP_FLAGS_DECODE_IN_PLACE)
+        pdu->flags |= UCD_MSG_FLAG_DECODE_IN_PLACE;
 
     if (session->version != SNMP_DEFAULT_VERSION) {
         pdu->version = session->version;
@@ -4538,6 +4554,93 @@ snmp_parse(struct session_list *slp, netsnmp_session *pss,
     return rc;
 }
 
+/*
+ * Copy of a received packet that the values of varbinds decoded in place
+ * point into.  Every such varbind holds a reference through its data and
+ * dataFreeHook members, which keeps netsnmp_variable_list unchanged.
+ */
+struct netsnmp_rxbuf_s {
+    int             refcount;
+    size_t          len;
+    u_char          data[1];
+};
+
+static void
+_snmp_rxbuf_release(void *data)
+{
+    struct netsnmp_rxbuf_s *rx = (struct netsnmp_rxbuf_s *) data;
+
+    if (--rx->refcount == 0)
+        free(rx);
+}
+
+/*
+ * Make vp->val.string, which points into the packet being parsed, point
+ * into the shared copy of the packet instead.  The copy, which spans from
+ * the first shared value to end, is made when it is first needed.
+ */
+static int
+_snmp_share_value(netsnmp_variable_list *vp, struct netsnmp_rxbuf_s **rxp,
+                  u_char **basep, u_char *end)
+{
+    struct netsnmp_rxbuf_s *rx = *rxp;
+
+    if (rx == NULL) {
+        size_t          len = end - vp->val.string;
+
+        rx = (struct netsnmp_rxbuf_s *)
+            malloc(offsetof(struct netsnmp_rxbuf_s, data) + len);
+        if (rx == NULL) {
+            vp->val.string = NULL;
+            return -1;
+        }
+        rx->refcount = 0;
+        rx->len = len;
+        memcpy(rx->data, vp->val.string, len);
+        *rxp = rx;
+        *basep = vp->val.string;
+    }
+    vp->val.string = rx->data + (vp->val.string - *basep);
+    vp->data = rx;
+    vp->dataFreeHook = _snmp_rxbuf_release;
+    rx->refcount++;
+    return 0;
+}
+
+int
+netsnmp_var_share_rxbuf(netsnmp_variable_list *dst,
+                        const netsnmp_variable_list *src)
+{
+    struct netsnmp_rxbuf_s *rx;
+
+    if (src->dataFreeHook != _snmp_rxbuf_release)
+        return 0;
+    rx = (struct netsnmp_rxbuf_s *) src->data;
+    if (src->val.string < rx->data || src->val.string >= rx->data + rx->len)
+        return 0;
+    dst->val.string = src->val.string;
+    dst->val_len = src->val_len;
+    dst->data = rx;
+    dst->dataFreeHook = _snmp_rxbuf_release;
+    rx->refcount++;
+    return 1;
+}
+
+void
+netsnmp_var_release_rxbuf(netsnmp_variable_list *var)
+{
+    struct netsnmp_rxbuf_s *rx;
+
+    if (var->dataFreeHook != _snmp_rxbuf_release)
+        return;
+    rx = (struct netsnmp_rxbuf_s *) var->data;
+    if (var->val.string >= rx->data && var->val.string < rx->data + rx->len)
+        var->val.string = var->buf;
+    var->data = NULL;
+    var->dataFreeHook = NULL;
+    _snmp_rxbuf_release(rx);
+}
+
 int
 snmp_pdu_parse(netsnmp_pdu *pdu, u_char * data, size_t * length)
 {
@@ -4549,6 +4652,9 @@ snmp_pdu_parse(netsnmp_pdu *pdu, u_char * data, size_t * length)
     netsnmp_variable_list *vp = NULL, *vplast = NULL;
     oid             objid[MAX_OID_LEN];
     u_char         *p;
+    struct netsnmp_rxbuf_s *rx = NULL;
+    u_char         *rx_base = NULL;
+    int             in_place;
 
     /*
      * Get the PDU type 
@@ -4674,6 +4780,17 @@ snmp_pdu_parse(netsnmp_pdu *pdu, u_char * data, size_t * length)
         return -1;
     }
 
+    /*
+     * GET class requests are never decoded in place.  Their values are
+     * ignored, the agent overwrites them with the response values (freeing
+     * the old ones through dataFreeHook, see the MFD get_values code), and
+     * it may hand those requests to worker threads, where the plain
+     * reference counts would race.
+     */
+    in_place = (pdu->flags & UCD_MSG_FLAG_DECODE_IN_PLACE) &&
+        pdu->command != SNMP_MSG_GET && pdu->command != SNMP_MSG_GETNEXT &&
+        pdu->command != SNMP_MSG_GETBULK;
+
     /*
      * get header for variable-bindings sequence 
      */
@@ -4773,6 +4890,14 @@ snmp_pdu_parse(netsnmp_pdu *pdu, u_char * data, size_t * length)
         case ASN_OCTET_STR:
         case ASN_OPAQUE:
         case ASN_NSAP:
+            if (in_place && vp->val_len >= sizeof(vp->buf)) {
+                p = asn_parse_string_ptr(var_val, &len, &vp->type,
+                                         &vp->val.string, &vp->val_len);
+                if (!p || _snmp_share_value(vp, &rx, &rx_base,
+                                            data + *length) < 0)
+                    goto fail;
+                break;
+            }
             if (vp->val_len < sizeof(vp->buf)) {
                 vp->val.string = (u_char *) vp->buf;
             } else {
@@ -4792,6 +4917,11 @@ snmp_pdu_parse(netsnmp_pdu *pdu, u_char * data, size_t * length)
             if (!p)
                 goto fail;
             vp->val_len *= sizeof(oid);
+            if (in_place && vp->val_len <= sizeof(vp->buf)) {
+                memcpy(vp->buf, objid, vp->val_len);
+                vp->val.objid = (oid *) vp->buf;
+                break;
+            }
             vp->val.objid = netsnmp_memdup(objid, vp->val_len);
             if (vp->val.objid == NULL)
                 goto fail;
@@ -5206,6 +5336,193 @@ snmp_send(netsnmp_session * session, netsnmp_pdu *pdu)
     return snmp_async_send(session, pdu, NULL, NULL);
 }
 
+/*
+ * Outstanding requests
+ *
+ * Besides the list in send order, the outstanding requests of a session
+ * are kept in a hash table, so that the request a response belongs to can
+ * be found without walking the list, and in a binary heap ordered by
+ * expiry time, so that finding the requests that timed out does not have
+ * to look at the others.  SNMPv3 requests are hashed by message id and
+ * other requests by request id, which are the ids responses are matched
+ * on.
+ */
+#define REQUEST_HASH_MIN        16
+
+static long
+_request_key(const netsnmp_request_list *rp)
+{
+    return rp->pdu->version == SNMP_VERSION_3 ? rp->message_id :
+        rp->request_id;
+}
+
+static size_t
+_request_bucket(const struct snmp_internal_session *isp, long key)
+{
+    return ((u_long) key * 2654435761UL) & (isp->req_hash_size - 1);
+}
+
+/* Append rp to its hash chain, keeping the chain in send order. */
+static void
+_request_hash(struct snmp_internal_session *isp, netsnmp_request_list *rp)
+{
+    netsnmp_request_list **rpp;
+
+    rpp = &isp->req_hash[_request_bucket(isp, _request_key(rp))];
+    while (*rpp)
+        rpp = &(*rpp)->next_hashed;
+    rp->next_hashed = NULL;
+    *rpp = rp;
+}
+
+static void
+_request_unhash(struct snmp_internal_session *isp, netsnmp_request_list *rp)
+{
+    netsnmp_request_list **rpp;
+
+    rpp = &isp->req_hash[_request_bucket(isp, _request_key(rp))];
+    while (*rpp && *rpp != rp)
+        rpp = &(*rpp)->next_hashed;
+    if (*rpp)
+        *rpp = rp->next_hashed;
+    rp->next_hashed = NULL;
+}
+
+/*
+ * Returns the first request after rp (or the first request if rp is NULL)
+ * that may be the one a response with the given id belongs to.
+ */
+static netsnmp_request_list *
+_request_find(struct snmp_internal_session *isp, long key,
+              netsnmp_request_list *rp)
+{
+    if (!isp->req_hash)
+        return NULL;
+    rp = rp ? rp->next_hashed :
+        isp->req_hash[_request_bucket(isp, key)];
+    while (rp && _request_key(rp) != key)
+        rp = rp->next_hashed;
+    return rp;
+}
+
+static void
+_request_heap_set(struct snmp_internal_session *isp, size_t i,
+                  netsnmp_request_list *rp)
+{
+    isp->req_heap[i] = rp;
+    rp->heap_index = i;
+}
+
+/* Restore the heap order after the expiry time of rp has changed. */
+static void
+_request_heap_fix(struct snmp_internal_session *isp, netsnmp_request_list *rp)
+{
+    size_t          i = rp->heap_index, child;
+
+    while (i > 0 && timercmp(&rp->expireM,
+                             &isp->req_heap[(i - 1) / 2]->expireM, <)) {
+        _request_heap_set(isp, i, isp->req_heap[(i - 1) / 2]);
+        i = (i - 1) / 2;
+    }
+    for (;;) {
+        child = 2 * i + 1;
+        if (child >= isp->req_count)
+            break;
+        if (child + 1 < isp->req_count &&
+            timercmp(&isp->req_heap[child + 1]->expireM,
+                     &isp->req_heap[child]->expireM, <))
+            child++;
+        if (!timercmp(&isp->req_heap[child]->expireM, &rp->expireM, <))
+            break;
+        _request_heap_set(isp, i, isp->req_heap[child]);
+        i = child;
+    }
+    _request_heap_set(isp, i, rp);
+}
+
+/*
+ * Make room for one more request.  Returns 0 on success, -1 if out of
+ * memory.
+ */
+static int
+_request_reserve(struct snmp_internal_session *isp)
+{
+    netsnmp_request_list *rp, **table;
+    size_t          size;
+
+    if (isp->req_count >= isp->req_heap_size) {
+        size = isp->req_heap_size ? 2 * isp->req_heap_size : REQUEST_HASH_MIN;
+        table = (netsnmp_request_list **)
+            realloc(isp->req_heap, size * sizeof(*table));
+        if (!table)
+            return -1;
+        isp->req_heap = table;
+        isp->req_heap_size = size;
+    }
+    if (isp->req_count >= isp->req_hash_size) {
+        size = isp->req_hash_size ? 2 * isp->req_hash_size : REQUEST_HASH_MIN;
+        table = (netsnmp_request_list **) calloc(size, sizeof(*table));
+        if (!table) {
+            /*
+             * Longer chains are slower but still work.
+             */
+            return isp->req_hash ? 0 : -1;
+        }
+        free(isp->req_hash);
+        isp->req_hash = table;
+        isp->req_hash_size = size;
+        for (rp = isp->requests; rp; rp = rp->next_request)
+            _request_hash(isp, rp);
+    }
+    return 0;
+}
+
+/* Add rp to the outstanding requests of session @isp. */
+static int
+add_request(struct snmp_internal_session *isp, netsnmp_request_list *rp)
+{
+    if (_request_reserve(isp) < 0)
+        return -1;
+
+    rp->next_request = NULL;
+    rp->prev_request = isp->requestsEnd;
+    if (isp->requestsEnd)
+        isp->requestsEnd->next_request = rp;
+    else
+        isp->requests = rp;
+    isp->requestsEnd = rp;
+
+    _request_hash(isp, rp);
+    rp->heap_index = isp->req_count++;
+    _request_heap_fix(isp, rp);
+    return 0;
+}
+
+/* Remove request @rp from session @isp. */
+static void
+remove_request(struct snmp_internal_session *isp, netsnmp_request_list *rp)
+{
+    netsnmp_request_list *last;
+
+    if (rp->prev_request)
+        rp->prev_request->next_request = rp->next_request;
+    else
+        isp->requests = rp->next_request;
+    if (rp->next_request)
+        rp->next_request->prev_request = rp->prev_request;
+    else
+        isp->requestsEnd = rp->prev_request;
+
+    _request_unhash(isp, rp);
+    last = isp->req_heap[--isp->req_count];
+    if (last != rp) {
+        last->heap_index = rp->heap_index;
+        isp->req_heap[last->heap_index] = last;
+        _request_heap_fix(isp, last);
+    }
+    snmp_free_pdu(rp->pdu);
+}
+
 int
 snmp_sess_send(struct session_list *slp, netsnmp_pdu *pdu)
 {
@@ -5369,14 +5686,11 @@ _sess_async_send(struct session_list *slp,
          * XX lock should be per session ! 
          */
         snmp_res_lock(MT_LIBRARY_ID, MT_LIB_SESSION);
-        if (isp->requestsEnd) {
-            rp->next_request = isp->requestsEnd->next_request;
-            isp->requestsEnd->next_request = rp;
-            isp->requestsEnd = rp;
-        } else {
-            rp->next_request = isp->requests;
-            isp->requests = rp;
-            isp->requestsEnd = rp;
+        if (add_request(isp, rp) < 0) {
+            snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_SESSION);
+            free(rp);
+            session->s_snmp_errno = SNMPERR_GENERR;
+            return 0;
         }
         snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_SESSION);
     } else {
@@ -5438,6 +5752,7 @@ snmp_free_var_internals(netsnmp_variable_list * var)
     if (!var)
         return;
 
+    netsnmp_var_release_rxbuf(var);
     if (var->name != var->name_loc)
         SNMP_FREE(var->name);
     if (var->val.string != var->buf)
@@ -5643,20 +5958,6 @@ _sess_process_packet_parse_pdu(struct session_list *slp, netsnmp_session * sp,
   return pdu;
 }
 
-/* Remove request @rp from session @isp. @orp is the request before @rp. */
-static void
-remove_request(struct snmp_internal_session *isp,
-               netsnmp_request_list *orp, netsnmp_request_list *rp)
-{
-    if (orp)
-        orp->next_request = rp->next_request;
-    else
-        isp->requests = rp->next_request;
-    if (isp->requestsEnd == rp)
-        isp->requestsEnd = orp;
-    snmp_free_pdu(rp->pdu);
-}
-
 /*
  * This function processes a PDU and calls the relevant callbacks.
  */
@@ -5665,7 +5966,8 @@ _sess_process_packet_handle_pdu(struct session_list *slp, netsnmp_session * sp,
                                 struct snmp_internal_session *isp,
                                 netsnmp_transport *transport, netsnmp_pdu *pdu)
 {
-  netsnmp_request_list *rp, *orp = NULL;
+  netsnmp_request_list *rp;
+  long            key;
   int             handled = 0;
 
   if (pdu->flags & UCD_MSG_FLAG_RESPONSE_PDU) {
@@ -5674,7 +5976,9 @@ _sess_process_packet_handle_pdu(struct session_list *slp, netsnmp_session * sp,
      */
     free_securityStateRef(pdu);
 
-    for (rp = isp->requests; rp; orp = rp, rp = rp->next_request) {
+    key = pdu->version == SNMP_VERSION_3 ? pdu->msgid : pdu->reqid;
+    for (rp = _request_find(isp, key, NULL); rp;
+         rp = _request_find(isp, key, rp)) {
       snmp_callback   callback;
       void           *magic;
 
@@ -5728,7 +6032,7 @@ _sess_process_packet_handle_pdu(struct session_list *slp, netsnmp_session * sp,
 	     * * inifinite resend                      
 	     */
 	    if (rp->retries <= sp->retries) {
-	      snmp_resend_request(slp, orp, rp, TRUE);
+	      snmp_resend_request(slp, rp, TRUE);
 	      break;
 	    } else {
 	      /* We're done with retries, so no longer waiting for a response */
@@ -5789,7 +6093,7 @@ _sess_process_packet_handle_pdu(struct session_list *slp, netsnmp_session * sp,
 	/*
 	 * Successful, so delete request.  
 	 */
-	remove_request(isp, orp, rp);
+	remove_request(isp, rp);
 	free(rp);
 	/*
 	 * There shouldn't be any more requests with the same reqid.  
@@ -6103,20 +6407,35 @@ _sess_read(struct session_list *slp, netsnmp_large_fd_set * fdset)
 
     if (!(transport->flags & NETSNMP_TRANSPORT_FLAG_STREAM)) {
         snmp_rcv_packet rcvp;
-        memset(&rcvp, 0x0, sizeof(rcvp));
 
-        /** read the packet */
-        rc = _sess_read_dgram_packet(slp, fdset, &rcvp);
-        if (-1 == rc) /* protocol error */
-            return -1;
-        else if (-2 == rc) /* no packet to process */
-            return 0;
+        /*
+         * A transport that reads several datagrams per system call keeps
+         * the rest buffered and says so with RECV_PENDING; the socket will
+         * not be reported readable again for them, so drain them all now.
+         */
+        do {
+            memset(&rcvp, 0x0, sizeof(rcvp));
+
+            /** read the packet */
+            rc = _sess_read_dgram_packet(slp, fdset, &rcvp);
+            if (-1 == rc) /* protocol error */
+                break;
+            else if (-2 == rc) { /* no packet to process */
+                rc = 0;
+                continue;
+            }
 
-        rc = _sess_process_packet(slp, sp, isp, transport,
-                                  rcvp.opaque, rcvp.olength,
-                                  rcvp.packet, rcvp.packet_len);
-        SNMP_FREE(rcvp.packet);
-        /** opaque is freed in _sess_process_packet */
+            rc = _sess_process_packet(slp, sp, isp, transport,
+                                      rcvp.opaque, rcvp.olength,
+                                      rcvp.packet, rcvp.packet_len);
+            SNMP_FREE(rcvp.packet);
+            /** opaque is freed in _sess_process_packet */
+        } while ((transport->flags & NETSNMP_TRANSPORT_FLAG_RECV_PENDING) &&
+                 transport->sock >= 0);
+
+        /** send the responses the transport queued up meanwhile */
+        if (transport->f_flush)
+            transport->f_flush(transport);
         return rc;
     }
 
@@ -6479,6 +6798,88 @@ snmp_sess_select_info2(struct session_list *slp, int *numfds, netsnmp_large_fd_s
                                         NETSNMP_SELECT_NOFLAGS);
 }
 
+/*
+ * Fold the expiry times of the outstanding requests of slp into *earliest.
+ * Returns 1 if slp has outstanding requests, 0 otherwise.
+ */
+static int
+_sess_select_earliest(struct session_list *slp, struct timeval *earliest)
+{
+    netsnmp_request_list *rp;
+
+    if (slp->internal == NULL || slp->internal->req_count == 0)
+        return 0;
+
+    rp = slp->internal->req_heap[0];
+    if (!timerisset(earliest)
+        || (timerisset(&rp->expireM)
+            && timercmp(&rp->expireM, earliest, <))) {
+        *earliest = rp->expireM;
+        DEBUGMSG(("verbose:sess_select","(to in %d.%06d sec) ",
+                   (int)earliest->tv_sec, (int)earliest->tv_usec));
+    }
+    return 1;
+}
+
+/*
+ * Turn the earliest request expiry time into the timeout and block values
+ * returned by snmp_sess_select_info2_flags(), taking alarms into account.
+ */
+static void
+_sess_select_timeout(struct timeval *earliest, int requests,
+                     struct timeval *timeout, int *block, int flags)
+{
+    struct timeval  now, alarm_tm;
+    int             next_alarm = 0;
+
+    netsnmp_get_monotonic_clock(&now);
+
+    if (netsnmp_ds_get_boolean(NETSNMP_DS_LIBRARY_ID,
+                               NETSNMP_DS_LIB_ALARM_DONT_USE_SIG) &&
+        !(flags & NETSNMP_SELECT_NOALARMS)) {
+        next_alarm = netsnmp_get_next_alarm_time(&alarm_tm, &now);
+        if (next_alarm)
+            DEBUGMSGT(("sess_select","next alarm at %ld.%06ld sec\n",
+                       (long)alarm_tm.tv_sec, (long)alarm_tm.tv_usec));
+    }
+    if (next_alarm == 0 && requests == 0) {
+        /*
+         * If none are active, skip arithmetic.  
+         */
+        DEBUGMSGT(("sess_select","blocking:no session requests or alarms.\n"));
+        *block = 1; /* can block - timeout value is undefined if no requests */
+        return;
+    }
+
+    if (next_alarm &&
+        (!timerisset(earliest) || timercmp(&alarm_tm, earliest, <)))
+        *earliest = alarm_tm;
+
+    NETSNMP_TIMERSUB(earliest, &now, earliest);
+    if (earliest->tv_sec < 0) {
+        time_t overdue_ms = -(earliest->tv_sec * 1000 +
+                              earliest->tv_usec / 1000);
+        if (overdue_ms >= 10)
+            DEBUGMSGT(("verbose:sess_select","timer overdue by %ld ms\n",
+                       (long) overdue_ms));
+        timerclear(earliest);
+    } else {
+        DEBUGMSGT(("verbose:sess_select","timer due in %d.%06d sec\n",
+                   (int)earliest->tv_sec, (int)earliest->tv_usec));
+    }
+
+    /*
+     * if it was blocking before or our delta time is less, reset timeout 
+     */
+    if ((*block || (timercmp(earliest, timeout, <)))) {
+        DEBUGMSGT(("verbose:sess_select",
+                   "setting timer to %d.%06d sec, clear block (was %d)\n",
+                   (int)earliest->tv_sec, (int)earliest->tv_usec, *block));
+        *timeout = *earliest;
+        *block = 0;
+    }
+}
+
 /**
  * Compute/update the arguments to be passed to select().
  *
@@ -6512,10 +6913,8 @@ snmp_sess_select_info2_flags(struct session_list *sessp, int *numfds,
                              struct timeval *timeout, int *block, int flags)
 {
     struct session_list *slp, *next = NULL;
-    netsnmp_request_list *rp;
-    struct timeval  now, earliest, alarm_tm;
+    struct timeval  earliest;
     int             active = 0, requests = 0;
-    int             next_alarm = 0;
 
     timerclear(&earliest);
 
@@ -6560,21 +6959,7 @@ snmp_sess_select_info2_flags(struct session_list *sessp, int *numfds,
         }
 
         NETSNMP_LARGE_FD_SET(slp->transport->sock, fdset);
-        if (slp->internal != NULL && slp->internal->requests) {
-            /*
-             * Found another session with outstanding requests.  
-             */
-            requests++;
-            for (rp = slp->internal->requests; rp; rp = rp->next_request) {
-                if (!timerisset(&earliest)
-                    || (timerisset(&rp->expireM)
-                        && timercmp(&rp->expireM, &earliest, <))) {
-                    earliest = rp->expireM;
-                    DEBUGMSG(("verbose:sess_select","(to in %d.%06d sec) ",
-                               (int)earliest.tv_sec, (int)earliest.tv_usec));
-                }
-            }
-        }
+        requests += _sess_select_earliest(slp, &earliest);
 
         active++;
         if (sessp) {
@@ -6586,51 +6971,42 @@ snmp_sess_select_info2_flags(struct session_list *sessp, int *numfds,
     }
     DEBUGMSG(("sess_select", "\n"));
 
-    netsnmp_get_monotonic_clock(&now);
+    _sess_select_timeout(&earliest, requests, timeout, block, flags);
+    return active;
+}
 
-    if (netsnmp_ds_get_boolean(NETSNMP_DS_LIBRARY_ID,
-                               NETSNMP_DS_LIB_ALARM_DONT_USE_SIG) &&
-        !(flags & NETSNMP_SELECT_NOALARMS)) {
-        next_alarm = netsnmp_get_next_alarm_time(&alarm_tm, &now);
-        if (next_alarm)
-            DEBUGMSGT(("sess_select","next alarm at %ld.%06ld sec\n",
-                       (long)alarm_tm.tv_sec, (long)alarm_tm.tv_usec));
-    }
-    if (next_alarm == 0 && requests == 0) {
-        /*
-         * If none are active, skip arithmetic.  
-         */
-        DEBUGMSGT(("sess_select","blocking:no session requests or alarms.\n"));
-        *block = 1; /* can block - timeout value is undefined if no requests */
-        return active;
-    }
+/**
+ * Compute only the timeout part of snmp_sess_select_info2_flags(), for
+ * callers that keep track of the session file descriptors by other means
+ * (see event_loop.c).  Sessions are not added to any file descriptor set and
+ * sessions marked for deletion are left alone.
+ *
+ * @return Number of sessions processed by this function.
+ */
+int
+snmp_sess_select_timeout(struct session_list *sessp, struct timeval *timeout,
+                         int *block, int flags)
+{
+    struct session_list *slp;
+    struct timeval  earliest;
+    int             active = 0, requests = 0;
 
-    if (next_alarm &&
-        (!timerisset(&earliest) || timercmp(&alarm_tm, &earliest, <)))
-        earliest = alarm_tm;
+    timerclear(&earliest);
 
-    NETSNMP_TIMERSUB(&earliest, &now, &earliest);
-    if (earliest.tv_sec < 0) {
-        time_t overdue_ms = -(earliest.tv_sec * 1000 + earliest.tv_usec / 1000);
-        if (overdue_ms >= 10)
-            DEBUGMSGT(("verbose:sess_select","timer overdue by %ld ms\n",
-                       (long) overdue_ms));
-        timerclear(&earliest);
-    } else {
-        DEBUGMSGT(("verbose:sess_select","timer due in %d.%06d sec\n",
-                   (int)earliest.tv_sec, (int)earliest.tv_usec));
-    }
+    DEBUGMSGTL(("sess_select", "timeout for %s session%s: ",
+                sessp ? "single" : "all", sessp ? "" : "s"));
 
-    /*
-     * if it was blocking before or our delta time is less, reset timeout 
-     */
-    if ((*block || (timercmp(&earliest, timeout, <)))) {
-        DEBUGMSGT(("verbose:sess_select",
-                   "setting timer to %d.%06d sec, clear block (was %d)\n",
-                   (int)earliest.tv_sec, (int)earliest.tv_usec, *block));
-        *timeout = earliest;
-        *block = 0;
+    for (slp = sessp ? sessp : Sessions; slp; slp = slp->next) {
+        if (slp->transport == NULL)
+            continue;
+        requests += _sess_select_earliest(slp, &earliest);
+        active++;
+        if (sessp)
+            break;
     }
+    DEBUGMSG(("sess_select", "\n"));
+
+    _sess_select_timeout(&earliest, requests, timeout, block, flags);
     return active;
 }
 
@@ -6655,8 +7031,8 @@ snmp_timeout(void)
 }
 
 static int
-snmp_resend_request(struct session_list *slp, netsnmp_request_list *orp,
-                    netsnmp_request_list *rp, int incr_retries)
+snmp_resend_request(struct session_list *slp, netsnmp_request_list *rp,
+                    int incr_retries)
 {
     struct snmp_internal_session *isp;
     netsnmp_session *sp;
@@ -6689,7 +7065,9 @@ snmp_resend_request(struct session_list *slp, netsnmp_request_list *orp,
     /*
      * Always increment msgId for resent messages.  
      */
+    _request_unhash(isp, rp);
     rp->pdu->msgid = rp->message_id = snmp_get_next_msgid();
+    _request_hash(isp, rp);
 
     result = netsnmp_build_packet(isp, sp, rp->pdu, &pktbuf, &pktbuf_len,
                                   &packet, &length);
@@ -6726,7 +7104,7 @@ snmp_resend_request(struct session_list *slp, netsnmp_request_list *orp,
         if (rp->callback) {
             rp->callback(NETSNMP_CALLBACK_OP_SEND_FAILED, sp,
                          rp->pdu->reqid, rp->pdu, rp->cb_data);
-            remove_request(isp, orp, rp);
+            remove_request(isp, rp);
 	}
         return -1;
     } else {
@@ -6737,6 +7115,7 @@ snmp_resend_request(struct session_list *slp, netsnmp_request_list *orp,
         tv.tv_sec += tv.tv_usec / 1000000L;
         tv.tv_usec %= 1000000L;
         rp->expireM = tv;
+        _request_heap_fix(isp, rp);
         if (rp->callback)
             rp->callback(NETSNMP_CALLBACK_OP_RESEND, sp,
                          rp->pdu->reqid, rp->pdu, rp->cb_data);
@@ -6751,7 +7130,7 @@ snmp_sess_timeout(struct session_list *slp)
 {
     netsnmp_session *sp;
     struct snmp_internal_session *isp;
-    netsnmp_request_list *rp, *orp = NULL, *freeme = NULL;
+    netsnmp_request_list *rp;
     struct timeval  now;
     snmp_callback   callback;
     void           *magic;
@@ -6767,61 +7146,189 @@ snmp_sess_timeout(struct session_list *slp)
     netsnmp_get_monotonic_clock(&now);
 
     /*
-     * For each request outstanding, check to see if it has expired.
+     * Handle the outstanding requests that have expired, earliest first.
      */
-    for (rp = isp->requests; rp; rp = rp->next_request) {
-        if (freeme != NULL) {
+    while (isp->req_count > 0 &&
+           timercmp(&isp->req_heap[0]->expireM, &now, <)) {
+        rp = isp->req_heap[0];
+
+        if ((sptr = find_sec_mod(rp->pdu->securityModel)) != NULL &&
+            sptr->pdu_timeout != NULL) {
             /*
-             * frees rp's after the for loop goes on to the next_request 
+             * call security model if it needs to know about this
              */
-            free((char *) freeme);
-            freeme = NULL;
+            (*sptr->pdu_timeout) (rp->pdu);
         }
 
-        if ((timercmp(&rp->expireM, &now, <))) {
-            if ((sptr = find_sec_mod(rp->pdu->securityModel)) != NULL &&
-                sptr->pdu_timeout != NULL) {
-                /*
-                 * call security model if it needs to know about this 
-                 */
-                (*sptr->pdu_timeout) (rp->pdu);
+        /*
+         * this timer has expired
+         */
+        if (rp->retries >= sp->retries) {
+            if (rp->callback) {
+                callback = rp->callback;
+                magic = rp->cb_data;
+            } else {
+                callback = sp->callback;
+                magic = sp->callback_magic;
             }
 
             /*
-             * this timer has expired 
+             * No more chances, delete this entry
              */
-            if (rp->retries >= sp->retries) {
-                if (rp->callback) {
-                    callback = rp->callback;
-                    magic = rp->cb_data;
-                } else {
-                    callback = sp->callback;
-                    magic = sp->callback_magic;
-                }
-
-                /*
-                 * No more chances, delete this entry 
-                 */
-                if (callback) {
-                    callback(NETSNMP_CALLBACK_OP_TIMED_OUT, sp,
-                             rp->pdu->reqid, rp->pdu, magic);
-                }
-                remove_request(isp, orp, rp);
-                freeme = rp;
-                continue;       /* don't update orp below */
-            } else {
-                if (snmp_resend_request(slp, orp, rp, TRUE)) {
-                    break;
-                }
+            if (callback) {
+                callback(NETSNMP_CALLBACK_OP_TIMED_OUT, sp,
+                         rp->pdu->reqid, rp->pdu, magic);
+            }
+            remove_request(isp, rp);
+            free(rp);
+        } else {
+            if (snmp_resend_request(slp, rp, TRUE)) {
+                break;
             }
+            /*
+             * If the request could not be resent (without that being
+             * reported as an error) it is still due; try again on the
+             * next timeout.
+             */
+            if (timercmp(&rp->expireM, &now, <))
+                break;
         }
-        orp = rp;
     }
+}
+
+/*
+ * OID comparison
+ *
+ * All the comparison functions below first look for the first
+ * sub-identifier at which two OIDs differ.  On x86 with SSE2 that search
+ * compares 16 bytes (32 with AVX2, when the CPU supports it) of both OIDs
+ * at a time; the byte order of the sub-identifiers does not matter since
+ * only equality is tested.  netsnmp_oid_compare_select() switches back to
+ * the plain loop, e.g. for benchmarking.
+ */
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#define NETSNMP_OID_MISMATCH_SSE2 1
+#include <emmintrin.h>
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || __GNUC__ > 4 || \
+     (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define NETSNMP_OID_MISMATCH_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+/*
+ * Returns the index of the first sub-identifier that differs between
+ * name1 and name2, or len if the first len sub-identifiers are equal.
+ */
+static size_t
+_oid_mismatch_scalar(const oid * name1, const oid * name2, size_t len)
+{
+    size_t          i;
+
+    for (i = 0; i < len; i++)
+        if (name1[i] != name2[i])
+            break;
+    return i;
+}
+
+#ifdef NETSNMP_OID_MISMATCH_SSE2
+static size_t
+_oid_mismatch_sse2(const oid * name1, const oid * name2, size_t len)
+{
+    const char     *p1 = (const char *) name1;
+    const char     *p2 = (const char *) name2;
+    size_t          off, bytes = len * sizeof(oid);
+    unsigned int    mask;
+
+    for (off = 0; off + 16 <= bytes; off += 16) {
+        __m128i         a = _mm_loadu_si128((const __m128i *) (p1 + off));
+        __m128i         b = _mm_loadu_si128((const __m128i *) (p2 + off));
+
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) ^ 0xffff;
+        if (mask)
+            return (off + __builtin_ctz(mask)) / sizeof(oid);
+    }
+    off /= sizeof(oid);
+    return off + _oid_mismatch_scalar(name1 + off, name2 + off, len - off);
+}
+#endif
+
+#ifdef NETSNMP_OID_MISMATCH_AVX2
+__attribute__((target("avx2")))
+static size_t
+_oid_mismatch_avx2(const oid * name1, const oid * name2, size_t len)
+{
+    const char     *p1 = (const char *) name1;
+    const char     *p2 = (const char *) name2;
+    size_t          off, bytes = len * sizeof(oid);
+    unsigned int    mask;
+
+    for (off = 0; off + 32 <= bytes; off += 32) {
+        __m256i         a = _mm256_loadu_si256((const __m256i *) (p1 + off));
+        __m256i         b = _mm256_loadu_si256((const __m256i *) (p2 + off));
+
+        mask = ~(unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b));
+        if (mask)
+            return (off + __builtin_ctz(mask)) / sizeof(oid);
+    }
+    /*
+     * Stay in this function for the remainder: calling SSE code with the
+     * upper halves of the AVX registers in use is slow.
+     */
+    if (off + 16 <= bytes) {
+        __m128i         a = _mm_loadu_si128((const __m128i *) (p1 + off));
+        __m128i         b = _mm_loadu_si128((const __m128i *) (p2 + off));
+
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) ^ 0xffff;
+        if (mask)
+            return (off + __builtin_ctz(mask)) / sizeof(oid);
+        off += 16;
+    }
+    for (off /= sizeof(oid); off < len; off++)
+        if (name1[off] != name2[off])
+            break;
+    return off;
+}
+#endif
+
+static size_t   _oid_mismatch_init(const oid *, const oid *, size_t);
+
+static size_t   (*_oid_mismatch) (const oid *, const oid *, size_t) =
+    _oid_mismatch_init;
 
-    if (freeme != NULL) {
-        free((char *) freeme);
-        freeme = NULL;
+/** Selects the way OIDs are compared.
+ *
+ * @param vector 0 to compare one sub-identifier at a time, 1 to use the
+ *               fastest vector instructions the CPU supports.
+ * @return the name of the selected implementation: "scalar", "sse2" or
+ *         "avx2".
+ */
+const char *
+netsnmp_oid_compare_select(int vector)
+{
+    if (vector) {
+#ifdef NETSNMP_OID_MISMATCH_AVX2
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            _oid_mismatch = _oid_mismatch_avx2;
+            return "avx2";
+        }
+#endif
+#ifdef NETSNMP_OID_MISMATCH_SSE2
+        _oid_mismatch = _oid_mismatch_sse2;
+        return "sse2";
+#endif
     }
+    _oid_mismatch = _oid_mismatch_scalar;
+    return "scalar";
+}
+
+static size_t
+_oid_mismatch_init(const oid * name1, const oid * name2, size_t len)
+{
+    netsnmp_oid_compare_select(1);
+    return _oid_mismatch(name1, name2, len);
 }
 
 /*
@@ -6838,10 +7345,7 @@ snmp_oid_ncompare(const oid * in_name1,
                   size_t len1,
                   const oid * in_name2, size_t len2, size_t max_len)
 {
-    register int    len;
-    register const oid *name1 = in_name1;
-    register const oid *name2 = in_name2;
-    size_t          min_len;
+    size_t          min_len, i;
 
     /*
      * len = minimum of len1 and len2 
@@ -6854,24 +7358,19 @@ snmp_oid_ncompare(const oid * in_name1,
     if (min_len > max_len)
         min_len = max_len;
 
-    len = min_len;
-
     /*
      * find first non-matching OID 
      */
-    while (len-- > 0) {
+    i = _oid_mismatch(in_name1, in_name2, min_len);
+    if (i < min_len) {
         /*
          * these must be done in seperate comparisons, since
          * subtracting them and using that result has problems with
          * subids > 2^31. 
          */
-        if (*(name1) != *(name2)) {
-            if (*(name1) < *(name2))
-                return -1;
-            return 1;
-        }
-        name1++;
-        name2++;
+        if (in_name1[i] < in_name2[i])
+            return -1;
+        return 1;
     }
 
     if (min_len != max_len) {
@@ -6898,9 +7397,7 @@ int
 snmp_oid_compare(const oid * in_name1,
                  size_t len1, const oid * in_name2, size_t len2)
 {
-    register int    len;
-    register const oid *name1 = in_name1;
-    register const oid *name2 = in_name2;
+    size_t          len, i;
 
     /*
      * len = minimum of len1 and len2 
@@ -6912,19 +7409,16 @@ snmp_oid_compare(const oid * in_name1,
     /*
      * find first non-matching OID 
      */
-    while (len-- > 0) {
+    i = _oid_mismatch(in_name1, in_name2, len);
+    if (i < len) {
         /*
          * these must be done in seperate comparisons, since
          * subtracting them and using that result has problems with
          * subids > 2^31. 
          */
-        if (*(name1) != *(name2)) {
-            if (*(name1) < *(name2))
-                return -1;
-            return 1;
-        }
-        name1++;
-        name2++;
+        if (in_name1[i] < in_name2[i])
+            return -1;
+        return 1;
     }
     /*
      * both OIDs equal up to length of shorter OID 
@@ -6948,40 +7442,33 @@ netsnmp_oid_compare_ll(const oid * in_name1,
                        size_t len1, const oid * in_name2, size_t len2,
                        size_t *offpt)
 {
-    register int    len;
-    register const oid *name1 = in_name1;
-    register const oid *name2 = in_name2;
-    int initlen;
+    size_t          len, i;
 
     /*
      * len = minimum of len1 and len2 
      */
     if (len1 < len2)
-        initlen = len = len1;
+        len = len1;
     else
-        initlen = len = len2;
+        len = len2;
     /*
-     * find first non-matching OID 
+     * find first non-matching OID; offpt is one past it
      */
-    while (len-- > 0) {
+    i = _oid_mismatch(in_name1, in_name2, len);
+    *offpt = i + 1;
+    if (i < len) {
         /*
          * these must be done in seperate comparisons, since
          * subtracting them and using that result has problems with
          * subids > 2^31. 
          */
-        if (*(name1) != *(name2)) {
-            *offpt = initlen - len;
-            if (*(name1) < *(name2))
-                return -1;
-            return 1;
-        }
-        name1++;
-        name2++;
+        if (in_name1[i] < in_name2[i])
+            return -1;
+        return 1;
     }
     /*
      * both OIDs equal up to length of shorter OID 
      */
-    *offpt = initlen - len;
     if (len1 < len2)
         return -1;
     if (len2 < len1)
@@ -7028,10 +7515,6 @@ int
 netsnmp_oid_equals(const oid * in_name1,
                    size_t len1, const oid * in_name2, size_t len2)
 {
-    register const oid *name1 = in_name1;
-    register const oid *name2 = in_name2;
-    register int    len = len1;
-
     /*
      * len = minimum of len1 and len2 
      */
@@ -7042,20 +7525,13 @@ netsnmp_oid_equals(const oid * in_name1,
      */
     if (len1 == 0)
         return 0;   /* Two null OIDs are (trivially) the same */
-    if (!name1 || !name2)
+    if (!in_name1 || !in_name2)
         return 1;   /* Otherwise something's wrong, so report a non-match */
     /*
      * find first non-matching OID 
      */
-    while (len-- > 0) {
-        /*
-         * these must be done in seperate comparisons, since
-         * subtracting them and using that result has problems with
-         * subids > 2^31. 
-         */
-        if (*(name1++) != *(name2++))
-            return 1;
-    }
+    if (_oid_mismatch(in_name1, in_name2, len1) != len1)
+        return 1;
     return 0;
 }
 
@@ -7094,7 +7570,6 @@ int
 netsnmp_oid_find_prefix(const oid * in_name1, size_t len1,
                         const oid * in_name2, size_t len2)
 {
-    int i;
     size_t min_size;
 
     if (!in_name1 || !in_name2 || !len1 || !len2)
@@ -7103,14 +7578,12 @@ netsnmp_oid_find_prefix(const oid * in_name1, size_t len1,
     if (in_name1[0] != in_name2[0])
         return 0;   /* No match */
     min_size = SNMP_MIN(len1, len2);
-    for(i = 0; i < (int)min_size; i++) {
-        if (in_name1[i] != in_name2[i])
-            return i;    /* '' is the first differing subidentifier
-                            So the common prefix is 0..(i-1), of length i */
-    }
-    return min_size;	/* The shorter OID is a prefix of the longer, and
-                           hence is precisely the common prefix of the two.
-                           Return its length. */
+    /*
+     * Either the index of the first differing subidentifier, which is the
+     * length of the common prefix, or the length of the shorter OID, which
+     * then is precisely the common prefix of the two.
+     */
+    return _oid_mismatch(in_name1, in_name2, min_size);
 }
 
 #ifndef NETSNMP_DISABLE_MIB_LOADING
@@ -7826,8 +8299,18 @@ snmp_sess_transport(struct session_list *slp)
 void
 snmp_sess_transport_set(struct session_list *slp, netsnmp_transport *t)
 {
+    struct session_list *s;
+
     if (slp != NULL) {
+        snmp_res_lock(MT_LIBRARY_ID, MT_LIB_SESSION);
+        for (s = Sessions; s && s != slp; s = s->next)
+            ;
+        if (s)
+            netsnmp_event_loop_session_removed(slp);
         slp->transport = t;
+        if (s)
+            netsnmp_event_loop_session_added(slp);
+        snmp_res_unlock(MT_LIBRARY_ID, MT_LIB_SESSION);
     }
 }
 
@@ -7852,8 +8335,152 @@ snmp_duplicate_objid(const oid * objToCopy, size_t objToCopyLen)
 
 #ifndef NETSNMP_FEATURE_REMOVE_STATISTICS
 /*
- * generic statistics counter functions 
+ * generic statistics counter functions
+ *
+ * In a reentrant build every thread that bumps a counter gets a shard of
+ * its own, so that the counters can be updated without locking and without
+ * threads fighting over the same cache lines.  snmp_get_statistic() adds up
+ * the shards.  The shard of a thread that exits is kept, so that its counts
+ * are not lost, and is handed to the next new thread.
  */
+#if defined(NETSNMP_REENTRANT) && HAVE_PTHREAD_H
+
+#if defined(__ATOMIC_RELAXED)
+#define STAT_LOAD(p)            __atomic_load_n((p), __ATOMIC_RELAXED)
+#define STAT_STORE(p, v)        __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#else
+#define STAT_LOAD(p)            (*(volatile u_int *)(p))
+#define STAT_STORE(p, v)        (*(volatile u_int *)(p) = (v))
+#endif
+
+typedef struct netsnmp_stat_shard_s {
+    u_int           counts[NETSNMP_STAT_MAX_STATS];
+    struct netsnmp_stat_shard_s *next;
+    int             in_use;
+} netsnmp_stat_shard;
+
+static netsnmp_stat_shard stat_shard_main;  /* used when no shard can be had */
+static netsnmp_stat_shard *stat_shards = &stat_shard_main;
+static pthread_mutex_t stat_shards_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t stat_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t stat_key;
+static int      stat_key_ok;
+
+static void
+_stat_shard_release(void *arg)
+{
+    netsnmp_stat_shard *shard = (netsnmp_stat_shard *) arg;
+
+    pthread_mutex_lock(&stat_shards_lock);
+    shard->in_use = 0;
+    pthread_mutex_unlock(&stat_shards_lock);
+}
+
+static void
+_stat_key_create(void)
+{
+    stat_key_ok = (pthread_key_create(&stat_key, _stat_shard_release) == 0);
+}
+
+static netsnmp_stat_shard *
+_stat_shard(void)
+{
+    netsnmp_stat_shard *shard;
+
+    pthread_once(&stat_key_once, _stat_key_create);
+    if (!stat_key_ok)
+        return &stat_shard_main;
+    shard = (netsnmp_stat_shard *) pthread_getspecific(stat_key);
+    if (shard)
+        return shard;
+
+    pthread_mutex_lock(&stat_shards_lock);
+    for (shard = stat_shards; shard; shard = shard->next)
+        if (!shard->in_use && shard != &stat_shard_main)
+            break;
+    if (!shard) {
+        shard = (netsnmp_stat_shard *) calloc(1, sizeof(*shard));
+        if (shard) {
+            shard->next = stat_shards;
+            stat_shards = shard;
+        }
+    }
+    if (shard)
+        shard->in_use = 1;
+    pthread_mutex_unlock(&stat_shards_lock);
+
+    /*
+     * Without a shard of its own the thread shares the main one; the
+     * counts may then be off a little, but nothing worse.
+     */
+    if (!shard)
+        return &stat_shard_main;
+    if (pthread_setspecific(stat_key, shard) != 0) {
+        _stat_shard_release(shard);
+        return &stat_shard_main;
+    }
+    return shard;
+}
+
+/*
+ * In a reentrant build the increment functions return the count of the
+ * calling thread only; snmp_get_statistic() returns the total.
+ */
+u_int
+snmp_increment_statistic_by(int which, int count)
+{
+    netsnmp_stat_shard *shard;
+    u_int           value;
+
+    if (which < 0 || which >= NETSNMP_STAT_MAX_STATS)
+        return 0;
+    shard = _stat_shard();
+    value = STAT_LOAD(&shard->counts[which]) + count;
+    STAT_STORE(&shard->counts[which], value);
+    return value;
+}
+
+u_int
+snmp_increment_statistic(int which)
+{
+    return snmp_increment_statistic_by(which, 1);
+}
+
+u_int
+snmp_get_statistic(int which)
+{
+    netsnmp_stat_shard *shard;
+    u_int           total = 0;
+
+    if (which < 0 || which >= NETSNMP_STAT_MAX_STATS)
+        return 0;
+    /*
+     * Shards are never freed and only ever prepended, so the list can be
+     * walked from a snapshot of its head without holding the lock.
+     */
+    pthread_mutex_lock(&stat_shards_lock);
+    shard = stat_shards;
+    pthread_mutex_unlock(&stat_shards_lock);
+    for (; shard; shard = shard->next)
+        total += STAT_LOAD(&shard->counts[which]);
+    return total;
+}
+
+void
+snmp_init_statistics(void)
+{
+    netsnmp_stat_shard *shard;
+    int             i;
+
+    pthread_mutex_lock(&stat_shards_lock);
+    for (shard = stat_shards; shard; shard = shard->next)
+        for (i = 0; i < NETSNMP_STAT_MAX_STATS; i++)
+            STAT_STORE(&shard->counts[i], 0);
+    pthread_mutex_unlock(&stat_shards_lock);
+}
+
+#else /* NETSNMP_REENTRANT && HAVE_PTHREAD_H */
+
 static u_int    statistics[NETSNMP_STAT_MAX_STATS];
 
 u_int
@@ -7889,5 +8516,6 @@ snmp_init_statistics(void)
 {
     memset(statistics, 0, sizeof(statistics));
 }
+#endif /* NETSNMP_REENTRANT && HAVE_PTHREAD_H */
 #endif /* NETSNMP_FEATURE_REMOVE_STATISTICS */
 /**  @} */
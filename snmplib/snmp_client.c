@@ -272,7 +272,9 @@ snmp_clone_var(netsnmp_variable_list * var, netsnmp_variable_list * newvar)
      * need a pointer to copy a string value. 
      */
     if (var->val.string) {
-        if (var->val.string != &var->buf[0]) {
+        if (netsnmp_var_share_rxbuf(newvar, var)) {
+            /* values decoded in place are shared instead of copied */
+        } else if (var->val.string != &var->buf[0]) {
             if (var->val_len <= sizeof(var->buf))
                 newvar->val.string = newvar->buf;
             else {
@@ -330,6 +332,7 @@ void
 snmp_reset_var_buffers(netsnmp_variable_list * var)
 {
     while (var) {
+        netsnmp_var_release_rxbuf(var);
         if (var->name != var->name_loc) {
             if(NULL != var->name)
                 free(var->name);
@@ -808,6 +811,7 @@ snmp_set_var_value(netsnmp_variable_list * vars,
      * xxx-rks: why the unconditional free? why not use existing
      * memory, if len < vars->val_len ?
      */
+    netsnmp_var_release_rxbuf(vars);
     if (vars->val.string && vars->val.string != vars->buf) {
         free(vars->val.string);
     }
@@ -0,0 +1,638 @@
+/*
+ * snmp_completion.c: send requests on single sessions and collect their
+ * responses through completion handles.
+ */
+/** @defgroup completion Completion queues
+ *  Many requests in flight from one thread, with synchronous-style code.
+ *  @ingroup library
+ *
+ *  netsnmp_completion_submit() sends a request with snmp_sess_async_send()
+ *  and returns a handle that is filled in by the request callback.  The
+ *  waiting functions select() on the sockets of the sessions that have
+ *  requests pending on the queue, then read from them and process their
+ *  timeouts with the single session API, so requests on one session do not
+ *  hold up those on the others.  Finished completions are kept in the order
+ *  they finished until they are waited for, taken from the queue or freed.
+ *
+ *  @{
+ */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-features.h>
+
+#include <errno.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#ifdef HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_SYS_SELECT_H
+#include <sys/select.h>
+#endif
+
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmp_completion.h>
+
+netsnmp_feature_child_of(snmp_completion, libnetsnmp);
+
+#ifndef NETSNMP_FEATURE_REMOVE_SNMP_COMPLETION
+
+/*
+ * A session with requests pending on a queue.
+ */
+typedef struct completion_session_s {
+    struct session_list *slp;
+    int             pending;
+    struct completion_session_s *next;
+} completion_session;
+
+struct netsnmp_completion_s {
+    netsnmp_completion_queue *queue;    /* NULL once the queue is freed */
+    struct session_list *slp;
+    completion_session *cs;             /* while pending */
+    int             status;
+    int             snmp_errno;
+    netsnmp_pdu    *response;
+    void           *user_data;
+    u_char          done;
+    u_char          sending;    /* snmp_sess_async_send() not returned yet */
+    u_char          freed;      /* free as soon as done */
+    u_char          taken;      /* returned by _next() or waited for */
+    /* in the pending, done or taken list of the queue */
+    netsnmp_completion *prev, *next;
+};
+
+struct netsnmp_completion_queue_s {
+    completion_session *sessions;
+    netsnmp_completion *pending_head;
+    netsnmp_completion *done_head, *done_tail;
+    netsnmp_completion *taken_head;
+    int             pending;
+    u_long          finished;   /* requests finished so far */
+    netsnmp_large_fd_set fdset; /* kept between waits */
+};
+
+static void
+_completion_unlink(netsnmp_completion **head, netsnmp_completion **tail,
+                   netsnmp_completion *c)
+{
+    if (c->prev)
+        c->prev->next = c->next;
+    else
+        *head = c->next;
+    if (c->next)
+        c->next->prev = c->prev;
+    else if (tail)
+        *tail = c->prev;
+    c->prev = c->next = NULL;
+}
+
+/*
+ * Moves a finished completion from the done to the taken list.
+ */
+static void
+_completion_take(netsnmp_completion_queue *cq, netsnmp_completion *c)
+{
+    if (c->taken)
+        return;
+    _completion_unlink(&cq->done_head, &cq->done_tail, c);
+    c->taken = 1;
+    c->next = cq->taken_head;
+    if (c->next)
+        c->next->prev = c;
+    cq->taken_head = c;
+}
+
+/*
+ * Moves c from the pending to the done list of its queue, or frees it if
+ * nobody is interested in it any more.
+ */
+static void
+_completion_finish(netsnmp_completion *c, int status, int err)
+{
+    netsnmp_completion_queue *cq = c->queue;
+
+    if (c->done)
+        return;
+    c->done = 1;
+    c->status = status;
+    c->snmp_errno = err;
+    DEBUGMSGTL(("completion", "%p finished: status %d, error %d\n", c,
+                status, err));
+
+    if (c->sending)
+        return;                 /* netsnmp_completion_submit() cleans up */
+
+    if (cq) {
+        _completion_unlink(&cq->pending_head, NULL, c);
+        cq->pending--;
+        cq->finished++;
+        c->cs->pending--;
+    }
+    c->cs = NULL;
+    if (c->freed || !cq) {
+        if (c->response)
+            snmp_free_pdu(c->response);
+        free(c);
+        return;
+    }
+    c->prev = cq->done_tail;
+    if (cq->done_tail)
+        cq->done_tail->next = c;
+    else
+        cq->done_head = c;
+    cq->done_tail = c;
+}
+
+/*
+ * Request callback, following snmp_synch_input() in snmp_client.c.
+ */
+static int
+_completion_input(int op, netsnmp_session *session, int reqid,
+                  netsnmp_pdu *pdu, void *magic)
+{
+    netsnmp_completion *c = (netsnmp_completion *) magic;
+
+    switch (op) {
+    case NETSNMP_CALLBACK_OP_RECEIVED_MESSAGE:
+        if (pdu && pdu->command == SNMP_MSG_REPORT) {
+            /*
+             * The request is either resent, left to time out, or
+             * followed by NETSNMP_CALLBACK_OP_SEC_ERROR.
+             */
+            c->snmp_errno = snmpv3_get_report_type(pdu);
+            return 1;
+        }
+        if (pdu && pdu->command == SNMP_MSG_RESPONSE) {
+            c->response = snmp_clone_pdu(pdu);
+            if (c->response)
+                _completion_finish(c, STAT_SUCCESS, SNMPERR_SUCCESS);
+            else
+                _completion_finish(c, STAT_ERROR, SNMPERR_MALLOC);
+        } else {
+            char            msg_buf[50];
+
+            snprintf(msg_buf, sizeof(msg_buf),
+                     "Expected RESPONSE-PDU but got %s-PDU",
+                     pdu ? snmp_pdu_type(pdu->command) : "no");
+            snmp_set_detail(msg_buf);
+            _completion_finish(c, STAT_ERROR, SNMPERR_PROTOCOL);
+        }
+        break;
+
+    case NETSNMP_CALLBACK_OP_TIMED_OUT:
+        _completion_finish(c, STAT_TIMEOUT, SNMPERR_TIMEOUT);
+        break;
+
+    case NETSNMP_CALLBACK_OP_SEC_ERROR:
+        _completion_finish(c, STAT_ERROR,
+                           c->snmp_errno ? c->snmp_errno : SNMPERR_GENERR);
+        break;
+
+    case NETSNMP_CALLBACK_OP_SEND_FAILED:
+        _completion_finish(c, STAT_ERROR, session->s_snmp_errno ?
+                           session->s_snmp_errno : SNMPERR_BAD_SENDTO);
+        break;
+
+    case NETSNMP_CALLBACK_OP_DISCONNECT:
+        _completion_finish(c, STAT_ERROR, SNMPERR_ABORT);
+        break;
+
+    default:
+        break;
+    }
+    return 1;
+}
+
+/**
+ * Creates an empty completion queue.
+ *
+ * @return The queue, or NULL if out of memory.
+ */
+netsnmp_completion_queue *
+netsnmp_completion_queue_create(void)
+{
+    netsnmp_completion_queue *cq;
+
+    cq = SNMP_MALLOC_TYPEDEF(netsnmp_completion_queue);
+    if (cq == NULL)
+        return NULL;
+    netsnmp_large_fd_set_init(&cq->fdset, FD_SETSIZE);
+    return cq;
+}
+
+/**
+ * Frees a completion queue.  Finished completions that have not been freed
+ * are freed with it.  The requests that are still pending stay with their
+ * sessions, and their completions are freed when they finish.
+ */
+void
+netsnmp_completion_queue_free(netsnmp_completion_queue *cq)
+{
+    netsnmp_completion *c, *next;
+    completion_session *cs, *csnext;
+
+    if (cq == NULL)
+        return;
+
+    for (c = cq->pending_head; c; c = next) {
+        next = c->next;
+        c->queue = NULL;
+        c->cs = NULL;
+        c->prev = c->next = NULL;
+    }
+    for (c = cq->done_head; c; c = next) {
+        next = c->next;
+        if (c->response)
+            snmp_free_pdu(c->response);
+        free(c);
+    }
+    for (c = cq->taken_head; c; c = next) {
+        next = c->next;
+        if (c->response)
+            snmp_free_pdu(c->response);
+        free(c);
+    }
+    for (cs = cq->sessions; cs; cs = csnext) {
+        csnext = cs->next;
+        free(cs);
+    }
+    netsnmp_large_fd_set_cleanup(&cq->fdset);
+    free(cq);
+}
+
+/*
+ * Returns the entry of slp in the session list of cq, adding it if need be.
+ * The entry found is moved to the front, since requests tend to be
+ * submitted on the same session in a row.
+ */
+static completion_session *
+_completion_session(netsnmp_completion_queue *cq, struct session_list *slp)
+{
+    completion_session *cs, *prev = NULL;
+
+    for (cs = cq->sessions; cs; prev = cs, cs = cs->next)
+        if (cs->slp == slp)
+            break;
+    if (cs == NULL) {
+        cs = SNMP_MALLOC_TYPEDEF(completion_session);
+        if (cs == NULL)
+            return NULL;
+        cs->slp = slp;
+    } else if (prev == NULL) {
+        return cs;
+    } else {
+        prev->next = cs->next;
+    }
+    cs->next = cq->sessions;
+    cq->sessions = cs;
+    return cs;
+}
+
+/*
+ * Forgets the sessions that no request is pending on any more.
+ */
+static void
+_completion_sessions_prune(netsnmp_completion_queue *cq)
+{
+    completion_session **csp, *cs;
+
+    for (csp = &cq->sessions; (cs = *csp) != NULL; ) {
+        if (cs->pending > 0) {
+            csp = &cs->next;
+            continue;
+        }
+        *csp = cs->next;
+        free(cs);
+    }
+}
+
+/**
+ * Sends a request on a single session.
+ *
+ * @param cq        The queue to add the request to.
+ * @param sessp     A session opened with snmp_sess_open().
+ * @param pdu       The request; it belongs to the library from now on.
+ * @param user_data Returned by netsnmp_completion_user_data().
+ *
+ * @return A completion, to be freed with netsnmp_completion_free(), or NULL
+ *   if the request could not be sent.  The PDU has been freed in that case,
+ *   and the reason is left in the s_snmp_errno of the session.  For PDUs
+ *   that get no response, such as traps, the completion is returned
+ *   finished with STAT_SUCCESS.
+ */
+netsnmp_completion *
+netsnmp_completion_submit(netsnmp_completion_queue *cq,
+                          struct session_list *sessp, netsnmp_pdu *pdu,
+                          void *user_data)
+{
+    netsnmp_completion *c;
+    netsnmp_session *ss;
+    int             expect_response;
+
+    ss = snmp_sess_session(sessp);
+    if (cq == NULL || ss == NULL || pdu == NULL) {
+        if (pdu)
+            snmp_free_pdu(pdu);
+        return NULL;
+    }
+
+    c = SNMP_MALLOC_TYPEDEF(netsnmp_completion);
+    if (c == NULL || (c->cs = _completion_session(cq, sessp)) == NULL) {
+        ss->s_snmp_errno = SNMPERR_MALLOC;
+        free(c);
+        snmp_free_pdu(pdu);
+        return NULL;
+    }
+    c->queue = cq;
+    c->slp = sessp;
+    c->user_data = user_data;
+
+    switch (pdu->command) {
+    case SNMP_MSG_TRAP:
+    case SNMP_MSG_TRAP2:
+    case SNMP_MSG_RESPONSE:
+    case SNMP_MSG_REPORT:
+        expect_response = 0;
+        break;
+    default:
+        expect_response = 1;
+        break;
+    }
+
+    c->sending = 1;
+    if (snmp_sess_async_send(sessp, pdu, _completion_input, c) == 0) {
+        DEBUGMSGTL(("completion", "send failed: %s\n",
+                    snmp_api_errstring(ss->s_snmp_errno)));
+        snmp_free_pdu(pdu);
+        free(c);
+        return NULL;
+    }
+    c->sending = 0;
+
+    if (!expect_response) {
+        c->cs = NULL;
+        c->done = 1;
+        c->status = STAT_SUCCESS;
+        c->prev = cq->done_tail;
+        if (cq->done_tail)
+            cq->done_tail->next = c;
+        else
+            cq->done_head = c;
+        cq->done_tail = c;
+        cq->finished++;
+        return c;
+    }
+
+    c->next = cq->pending_head;
+    if (c->next)
+        c->next->prev = c;
+    cq->pending_head = c;
+    cq->pending++;
+    c->cs->pending++;
+    return c;
+}
+
+/**
+ * Waits for activity on the sessions with requests pending on the queue,
+ * then reads from them and processes their request timeouts.
+ *
+ * @param cq      The queue.
+ * @param timeout How long to wait at most, or NULL to wait until a response
+ *   arrives or a request times out.
+ *
+ * @return The number of requests that finished, or -1 if select() failed.
+ */
+int
+netsnmp_completion_queue_run(netsnmp_completion_queue *cq,
+                             struct timeval *timeout)
+{
+    completion_session *cs;
+    struct timeval  tv, *tvp;
+    u_long          finished = cq->finished;
+    int             numfds = 0, block = 1, count;
+
+    _completion_sessions_prune(cq);
+    if (cq->sessions == NULL)
+        return 0;
+
+    NETSNMP_LARGE_FD_ZERO(&cq->fdset);
+    timerclear(&tv);
+    for (cs = cq->sessions; cs; cs = cs->next)
+        snmp_sess_select_info2_flags(cs->slp, &numfds, &cq->fdset, &tv,
+                                     &block, NETSNMP_SELECT_NOALARMS);
+    if (timeout && (block || timercmp(timeout, &tv, <))) {
+        tv = *timeout;
+        block = 0;
+    }
+    tvp = block ? NULL : &tv;
+
+    count = netsnmp_large_fd_set_select(numfds, &cq->fdset, NULL, NULL, tvp);
+    if (count < 0) {
+        if (errno == EINTR)
+            return 0;
+        snmp_errno = SNMPERR_GENERR;    /*MTCRITICAL_RESOURCE */
+        snmp_set_detail(strerror(errno));
+        return -1;
+    }
+
+    /*
+     * The callbacks only update the pending counts, sessions are pruned on
+     * the next run, so the list stays intact here.
+     */
+    for (cs = cq->sessions; cs; cs = cs->next) {
+        if (count > 0)
+            snmp_sess_read2(cs->slp, &cq->fdset);
+        if (cs->pending > 0)
+            snmp_sess_timeout(cs->slp);
+    }
+    return (int) (cq->finished - finished);
+}
+
+/*
+ * Turns a relative timeout into a deadline on the monotonic clock.
+ */
+static struct timeval *
+_completion_deadline(struct timeval *timeout, struct timeval *deadline)
+{
+    if (timeout == NULL)
+        return NULL;
+    netsnmp_get_monotonic_clock(deadline);
+    NETSNMP_TIMERADD(deadline, timeout, deadline);
+    return deadline;
+}
+
+/*
+ * Runs the queue once, waiting at most until deadline.  Returns 0 once the
+ * deadline has passed, -1 on error and 1 otherwise.
+ */
+static int
+_completion_run_until(netsnmp_completion_queue *cq, struct timeval *deadline)
+{
+    struct timeval  now, left;
+
+    if (deadline == NULL)
+        return netsnmp_completion_queue_run(cq, NULL) < 0 ? -1 : 1;
+
+    netsnmp_get_monotonic_clock(&now);
+    if (timercmp(&now, deadline, >)) {
+        /* still pick up what has already arrived */
+        timerclear(&left);
+        return netsnmp_completion_queue_run(cq, &left) < 0 ? -1 : 0;
+    }
+    NETSNMP_TIMERSUB(deadline, &now, &left);
+    return netsnmp_completion_queue_run(cq, &left) < 0 ? -1 : 1;
+}
+
+/**
+ * Takes the next finished completion off the queue, waiting for one if
+ * need be.
+ *
+ * @param cq      The queue.
+ * @param timeout How long to wait at most, or NULL to wait as long as
+ *   requests are pending.  A zero timeout only polls.
+ *
+ * @return The completion that finished first among those not yet taken,
+ *   waited for or freed, or NULL.
+ */
+netsnmp_completion *
+netsnmp_completion_queue_next(netsnmp_completion_queue *cq,
+                              struct timeval *timeout)
+{
+    struct timeval  deadline, *dp;
+    netsnmp_completion *c;
+    int             rc = 1;
+
+    dp = _completion_deadline(timeout, &deadline);
+    while (cq->done_head == NULL && cq->pending > 0 && rc > 0)
+        rc = _completion_run_until(cq, dp);
+
+    c = cq->done_head;
+    if (c)
+        _completion_take(cq, c);
+    return c;
+}
+
+/**
+ * Waits for every request pending on the queue to finish.
+ *
+ * @return 1 if no request is pending any more, 0 on timeout or error.
+ */
+int
+netsnmp_completion_queue_wait_all(netsnmp_completion_queue *cq,
+                                  struct timeval *timeout)
+{
+    struct timeval  deadline, *dp;
+    int             rc = 1;
+
+    dp = _completion_deadline(timeout, &deadline);
+    while (cq->pending > 0 && rc > 0)
+        rc = _completion_run_until(cq, dp);
+    return cq->pending == 0;
+}
+
+int
+netsnmp_completion_queue_pending(netsnmp_completion_queue *cq)
+{
+    return cq->pending;
+}
+
+/**
+ * Waits for one request to finish.  Other requests of its queue are
+ * processed meanwhile and remain available through
+ * netsnmp_completion_queue_next().
+ *
+ * @return 1 if the request has finished, 0 on timeout or error.
+ */
+int
+netsnmp_completion_wait(netsnmp_completion *c, struct timeval *timeout)
+{
+    netsnmp_completion_queue *cq = c->queue;
+    struct timeval  deadline, *dp;
+    int             rc = 1;
+
+    if (cq == NULL)
+        return c->done;
+
+    dp = _completion_deadline(timeout, &deadline);
+    while (!c->done && rc > 0)
+        rc = _completion_run_until(cq, dp);
+
+    if (!c->done)
+        return 0;
+    /* it has been seen, netsnmp_completion_queue_next() skips it */
+    _completion_take(cq, c);
+    return 1;
+}
+
+int
+netsnmp_completion_done(netsnmp_completion *c)
+{
+    return c->done;
+}
+
+int
+netsnmp_completion_status(netsnmp_completion *c)
+{
+    return c->done ? c->status : STAT_ERROR;
+}
+
+int
+netsnmp_completion_errno(netsnmp_completion *c)
+{
+    return c->snmp_errno;
+}
+
+netsnmp_pdu *
+netsnmp_completion_response(netsnmp_completion *c)
+{
+    netsnmp_pdu    *response = c->response;
+
+    c->response = NULL;
+    return response;
+}
+
+void *
+netsnmp_completion_user_data(netsnmp_completion *c)
+{
+    return c->user_data;
+}
+
+struct session_list *
+netsnmp_completion_session(netsnmp_completion *c)
+{
+    return c->slp;
+}
+
+/**
+ * Frees a completion and its response.  A completion whose request is
+ * still pending is freed when the request finishes.
+ */
+void
+netsnmp_completion_free(netsnmp_completion *c)
+{
+    netsnmp_completion_queue *cq;
+
+    if (c == NULL)
+        return;
+    if (!c->done) {
+        c->freed = 1;
+        return;
+    }
+    cq = c->queue;
+    if (cq && c->taken)
+        _completion_unlink(&cq->taken_head, NULL, c);
+    else if (cq)
+        _completion_unlink(&cq->done_head, &cq->done_tail, c);
+    if (c->response)
+        snmp_free_pdu(c->response);
+    free(c);
+}
+
+#else  /* !NETSNMP_FEATURE_REMOVE_SNMP_COMPLETION */
+netsnmp_feature_unused(snmp_completion);
+#endif /* !NETSNMP_FEATURE_REMOVE_SNMP_COMPLETION */
+/**  @} */
@@ -0,0 +1,2 @@
+/* This file is automatically generated by configure.  Do not modify by hand. */
+init_usm();
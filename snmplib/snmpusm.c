@@ -468,31 +468,170 @@ emergency_print(u_char * field, u_int length)
 }                               /* end emergency_print() */
 #endif                          /* NETSNMP_ENABLE_TESTING_CODE */
 
+/*
+ * Index of userList.
+ *
+ * userList is kept sorted on the usmUserTable index (engineID length,
+ * engineID, name length, name) so that the table can be walked in order.
+ * The users are also kept in an array in the same order, which is
+ * searched to find where a new user goes, and in a hash table on engineID
+ * and name, which is used to look up the user of an incoming message.
+ */
+#define USM_USER_HASH_MIN       64
+
+static struct usmUser **userHash = NULL;   /* chained through hashNext */
+static size_t   userHashSize = 0;          /* a power of 2 */
+static struct usmUser **userIndex = NULL;  /* sorted like userList */
+static size_t   userIndexLen = 0, userIndexSize = 0;
+
+static size_t
+_usm_user_hash(const u_char *engineID, size_t engineIDLen,
+               const char *name, size_t nameLen)
+{
+    u_int           h = 2166136261U;        /* FNV-1a */
+    size_t          i;
+
+    for (i = 0; engineID && i < engineIDLen; i++)
+        h = (h ^ engineID[i]) * 16777619U;
+    for (i = 0; i < nameLen; i++)
+        h = (h ^ (u_char) name[i]) * 16777619U;
+    return h & (userHashSize - 1);
+}
+
+/*
+ * Compares a user index with that of a user, in the order of userList.
+ */
+static int
+_usm_user_cmp(const u_char *engineID, size_t engineIDLen,
+              const char *name, size_t nameLen, const struct usmUser *user)
+{
+    size_t          userNameLen = user->name ? strlen(user->name) : 0;
+    int             rc;
+
+    if (engineIDLen != user->engineIDLen)
+        return engineIDLen < user->engineIDLen ? -1 : 1;
+    if (engineID == NULL || user->engineID == NULL) {
+        if (engineID != user->engineID)
+            return engineID == NULL ? -1 : 1;
+    } else if ((rc = memcmp(engineID, user->engineID, engineIDLen)) != 0)
+        return rc;
+    if (nameLen != userNameLen)
+        return nameLen < userNameLen ? -1 : 1;
+    return nameLen ? memcmp(name, user->name, nameLen) : 0;
+}
+
+/*
+ * Returns the position of the first user in userIndex that does not sort
+ * before the given index.
+ */
+static size_t
+_usm_user_index_find(const u_char *engineID, size_t engineIDLen,
+                     const char *name, size_t nameLen)
+{
+    size_t          lo = 0, hi = userIndexLen, mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (_usm_user_cmp(engineID, engineIDLen, name, nameLen,
+                          userIndex[mid]) > 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static void
+_usm_user_hash_add(struct usmUser *user)
+{
+    size_t          h;
+
+    h = _usm_user_hash(user->engineID, user->engineIDLen, user->name,
+                       user->name ? strlen(user->name) : 0);
+    user->hashNext = userHash[h];
+    userHash[h] = user;
+}
+
+static void
+_usm_user_hash_remove(struct usmUser *user)
+{
+    struct usmUser **up;
+
+    up = &userHash[_usm_user_hash(user->engineID, user->engineIDLen,
+                                  user->name,
+                                  user->name ? strlen(user->name) : 0)];
+    while (*up && *up != user)
+        up = &(*up)->hashNext;
+    if (*up)
+        *up = user->hashNext;
+    user->hashNext = NULL;
+}
+
+/*
+ * Makes room for one more user in the index.  Returns 0 on success, -1 if
+ * out of memory.
+ */
+static int
+_usm_user_index_reserve(void)
+{
+    struct usmUser **table, *uptr;
+    size_t          size;
+
+    if (userIndexLen >= userIndexSize) {
+        size = userIndexSize ? 2 * userIndexSize : USM_USER_HASH_MIN;
+        table = realloc(userIndex, size * sizeof(*table));
+        if (table == NULL)
+            return -1;
+        userIndex = table;
+        userIndexSize = size;
+    }
+    if (userIndexLen >= userHashSize) {
+        size = userHashSize ? 2 * userHashSize : USM_USER_HASH_MIN;
+        table = calloc(size, sizeof(*table));
+        if (table == NULL)
+            return userHash ? 0 : -1;
+        free(userHash);
+        userHash = table;
+        userHashSize = size;
+        for (uptr = userList; uptr != NULL; uptr = uptr->next)
+            _usm_user_hash_add(uptr);
+    }
+    return 0;
+}
+
+static void
+_usm_user_index_clear(void)
+{
+    SNMP_FREE(userHash);
+    userHashSize = 0;
+    SNMP_FREE(userIndex);
+    userIndexLen = userIndexSize = 0;
+}
+
 static struct usmUser *
 usm_get_user_from_list(const u_char *engineID, size_t engineIDLen,
-                       const char *name, size_t nameLen,
-                       struct usmUser *puserList, int use_default)
+                       const char *name, size_t nameLen, int use_default)
 {
-    struct usmUser *ptr;
-
-    for (ptr = puserList; ptr != NULL; ptr = ptr->next) {
-        if (ptr->name && strlen(ptr->name) == nameLen &&
-            memcmp(ptr->name, name, nameLen) == 0) {
-          DEBUGMSGTL(("usm", "match on user %s\n", ptr->name));
-          if (ptr->engineIDLen == engineIDLen &&
-            ((ptr->engineID == NULL && engineID == NULL) ||
-             (ptr->engineID != NULL && engineID != NULL &&
-              memcmp(ptr->engineID, engineID, engineIDLen) == 0)))
+    struct usmUser *ptr = NULL;
+
+    if (userHash)
+        ptr = userHash[_usm_user_hash(engineID, engineIDLen, name,
+                                      nameLen)];
+    for (; ptr != NULL; ptr = ptr->hashNext) {
+        if (ptr->name && _usm_user_cmp(engineID, engineIDLen, name,
+                                       nameLen, ptr) == 0) {
+            DEBUGMSGTL(("usm", "match on user %s\n", ptr->name));
             return ptr;
-          DEBUGMSGTL(("usm", "no match on engineID ("));
-          if (engineID) {
-              DEBUGMSGHEX(("usm", engineID, engineIDLen));
-          } else {
-              DEBUGMSGTL(("usm", "Empty EngineID"));
-          }
-          DEBUGMSG(("usm", ")\n"));
         }
     }
+    DEBUGMSGTL(("usm", "no match on user %.*s and engineID (",
+                (int)nameLen, name));
+    if (engineID) {
+        DEBUGMSGHEX(("usm", engineID, engineIDLen));
+    } else {
+        DEBUGMSG(("usm", "Empty EngineID"));
+    }
+    DEBUGMSG(("usm", ")\n"));
 
     /*
      * return "" user used to facilitate engineID discovery
@@ -508,8 +647,7 @@ usm_get_user2(const u_char *engineID, size_t engineIDLen, const void *name,
 {
     DEBUGMSGTL(("usm", "getting user %.*s\n", (int)nameLen,
                 (const char *)name));
-    return usm_get_user_from_list(engineID, engineIDLen, name, nameLen,
-                                  userList, 1);
+    return usm_get_user_from_list(engineID, engineIDLen, name, nameLen, 1);
 }
 
 /*
@@ -522,104 +660,37 @@ usm_get_user(const u_char *engineID, size_t engineIDLen, const char *name)
     return usm_get_user2(engineID, engineIDLen, name, strlen(name));
 }
 
-static struct usmUser *
-usm_add_user_to_list(struct usmUser *user, struct usmUser *puserList)
+/*
+ * usm_remove_usmUser(): removes a user from userList.
+ *
+ * returns SNMPERR_SUCCESS or SNMPERR_USM_UNKNOWNSECURITYNAME
+ */
+static int
+usm_remove_usmUser(struct usmUser *user)
 {
-    struct usmUser *nptr, *pptr, *optr;
+    size_t          pos;
 
-    /*
-     * loop through puserList till we find the proper, sorted place to
-     * insert the new user
-     */
-    /* XXX - how to handle a NULL user->name ?? */
-    /* XXX - similarly for a NULL nptr->name ?? */
-    for (nptr = puserList, pptr = NULL; nptr != NULL;
-         pptr = nptr, nptr = nptr->next) {
-        if (nptr->engineIDLen > user->engineIDLen)
-            break;
-
-        if (user->engineID == NULL && nptr->engineID != NULL)
-            break;
-
-        if (nptr->engineIDLen == user->engineIDLen &&
-            (nptr->engineID != NULL && user->engineID != NULL &&
-             memcmp(nptr->engineID, user->engineID,
-                    user->engineIDLen) > 0))
-            break;
-
-        if (!(nptr->engineID == NULL && user->engineID != NULL)) {
-            if (nptr->engineIDLen == user->engineIDLen &&
-                ((nptr->engineID == NULL && user->engineID == NULL) ||
-                 memcmp(nptr->engineID, user->engineID,
-                        user->engineIDLen) == 0)
-                && strlen(nptr->name) > strlen(user->name))
-                break;
-
-            if (nptr->engineIDLen == user->engineIDLen &&
-                ((nptr->engineID == NULL && user->engineID == NULL) ||
-                 memcmp(nptr->engineID, user->engineID,
-                        user->engineIDLen) == 0)
-                && strlen(nptr->name) == strlen(user->name)
-                && strcmp(nptr->name, user->name) > 0)
-                break;
-
-            if (nptr->engineIDLen == user->engineIDLen &&
-                ((nptr->engineID == NULL && user->engineID == NULL) ||
-                 memcmp(nptr->engineID, user->engineID,
-                        user->engineIDLen) == 0)
-                && strlen(nptr->name) == strlen(user->name)
-                && strcmp(nptr->name, user->name) == 0) {
-                /*
-                 * the user is an exact match of a previous entry.
-                 * Credentials may be different, though, so remove
-                 * the old entry (and add the new one)!
-                 */
-                if (pptr) { /* change prev's next pointer */
-                  pptr->next = nptr->next;
-                }
-                if (nptr->next) { /* change next's prev pointer */
-                  nptr->next->prev = pptr;
-                }
-                optr = nptr;
-                nptr = optr->next; /* add new user at this position */
-                /* free the old user */
-                optr->next=NULL;
-                optr->prev=NULL;
-                usm_free_user(optr);
-                break; /* new user will be added below */
-            }
-        }
-    }
-
-    /*
-     * nptr should now point to the user that we need to add ourselves
-     * in front of, and pptr should be our new 'prev'.
-     */
-
-    /*
-     * change our pointers
-     */
-    user->prev = pptr;
-    user->next = nptr;
+    if (user == NULL)
+        return SNMPERR_USM_UNKNOWNSECURITYNAME;
+    pos = _usm_user_index_find(user->engineID, user->engineIDLen,
+                               user->name,
+                               user->name ? strlen(user->name) : 0);
+    if (pos >= userIndexLen || userIndex[pos] != user)
+        return SNMPERR_USM_UNKNOWNSECURITYNAME;
 
-    /*
-     * change the next's prev pointer
-     */
-    if (user->next)
-        user->next->prev = user;
+    memmove(&userIndex[pos], &userIndex[pos + 1],
+            (userIndexLen - pos - 1) * sizeof(*userIndex));
+    userIndexLen--;
+    _usm_user_hash_remove(user);
 
-    /*
-     * change the prev's next pointer
-     */
     if (user->prev)
-        user->prev->next = user;
-
-    /*
-     * rewind to the head of the list and return it (since the new head
-     * could be us, we need to notify the above routine who the head now is.
-     */
-    for (pptr = user; pptr->prev != NULL; pptr = pptr->prev);
-    return pptr;
+        user->prev->next = user->next;
+    else
+        userList = user->next;
+    if (user->next)
+        user->next->prev = user->prev;
+    user->next = user->prev = NULL;
+    return SNMPERR_SUCCESS;
 }
 
 /*
@@ -628,75 +699,61 @@ usm_add_user_to_list(struct usmUser *user, struct usmUser *puserList)
  * to facilitate getNext calls on a usmUser table which is indexed by
  * these values.
  *
- * returns the head of the list (which could change due to this add).
+ * returns the head of the list (which could change due to this add), or
+ * NULL if out of memory.
  */
 
 struct usmUser *
 usm_add_user(struct usmUser *user)
-{
-    struct usmUser *uptr;
-    uptr = usm_add_user_to_list(user, userList);
-    if (uptr != NULL)
-        userList = uptr;
-    return uptr;
-}
-
-/*
- * usm_remove_usmUser_from_list remove user from (optional) list
- *
- * if list is not specified, defaults to global userList.
- *
- * returns SNMPERR_SUCCESS or SNMPERR_USM_UNKNOWNSECURITYNAME
- */
-static int
-usm_remove_usmUser_from_list(struct usmUser *user, struct usmUser **ppuserList)
 {
     struct usmUser *nptr, *pptr;
+    size_t          nameLen = user->name ? strlen(user->name) : 0;
+    size_t          pos;
 
-    /*
-     * NULL pointers aren't allowed
-     */
-    if (ppuserList == NULL)
-        ppuserList = &userList;
+    if (_usm_user_index_reserve() < 0)
+        return NULL;
 
-    if (*ppuserList == NULL)
-        return SNMPERR_USM_UNKNOWNSECURITYNAME;
+    pos = _usm_user_index_find(user->engineID, user->engineIDLen,
+                               user->name, nameLen);
+    if (pos < userIndexLen &&
+        _usm_user_cmp(user->engineID, user->engineIDLen, user->name,
+                      nameLen, userIndex[pos]) == 0) {
+        /*
+         * the user is an exact match of a previous entry.
+         * Credentials may be different, though, so remove
+         * the old entry (and add the new one)!
+         */
+        nptr = userIndex[pos];
+        usm_remove_usmUser(nptr);
+        usm_free_user(nptr);
+    }
 
     /*
-     * find the user in the list
+     * insert the new user in front of the user now at its position
      */
-    for (nptr = *ppuserList, pptr = NULL; nptr != NULL;
-         pptr = nptr, nptr = nptr->next) {
-        if (nptr == user)
-            break;
-    }
+    nptr = pos < userIndexLen ? userIndex[pos] : NULL;
+    pptr = nptr ? nptr->prev :
+        (userIndexLen ? userIndex[userIndexLen - 1] : NULL);
+    user->prev = pptr;
+    user->next = nptr;
+    if (nptr)
+        nptr->prev = user;
+    if (pptr)
+        pptr->next = user;
+    else
+        userList = user;
 
-    if (nptr) {
-        /*
-         * remove the user from the linked list
-         */
-        if (pptr) {
-            pptr->next = nptr->next;
-        }
-        if (nptr->next) {
-            nptr->next->prev = pptr;
-        }
-    } else {
-        /*
-         * user didn't exist
-         */
-        return SNMPERR_USM_UNKNOWNSECURITYNAME;
-    }
-    if (nptr == *ppuserList)    /* we're the head of the list, need to change
-                                 * * the head to the next user */
-        *ppuserList = nptr->next;
-    return SNMPERR_SUCCESS;
-}                               /* end usm_remove_usmUser_from_list() */
+    memmove(&userIndex[pos + 1], &userIndex[pos],
+            (userIndexLen - pos) * sizeof(*userIndex));
+    userIndex[pos] = user;
+    userIndexLen++;
+    _usm_user_hash_add(user);
+
+    return userList;
+}
 
 /*
- * usm_remove_user_from_list
- *
- * removes user from list.
+ * usm_remove_user(): finds and removes a user from userList.
  *
  * returns new list head on success, or NULL on error.
  *
@@ -705,24 +762,12 @@ usm_remove_usmUser_from_list(struct usmUser *user, struct usmUser **ppuserList)
  *       more specific return codes. This function is kept for backwards
  *       compatability with this ambiguous behaviour.
  */
-static struct usmUser *
-usm_remove_user_from_list(struct usmUser *user,
-                          struct usmUser **ppuserList)
-{
-    int rc = usm_remove_usmUser_from_list(user, ppuserList);
-    if (rc != SNMPERR_SUCCESS || NULL == ppuserList)
-        return NULL;
-
-    return *ppuserList;
-}                               /* end usm_remove_user_from_list() */
-
-/*
- * usm_remove_user(): finds and removes a user from a list
- */
 struct usmUser *
 usm_remove_user(struct usmUser *user)
 {
-    return usm_remove_user_from_list(user, &userList);
+    if (usm_remove_usmUser(user) != SNMPERR_SUCCESS)
+        return NULL;
+    return userList;
 }
 
 /*
@@ -769,6 +814,8 @@ usm_free_user(struct usmUser *user)
         SNMP_FREE(user->privKeyKu);
     }
 
+    sc_key_cache_free(&user->authKeyCache);
+    sc_key_cache_free(&user->privKeyCache);
 
     /*
      * FIX  Why not put this check *first?*
@@ -1473,6 +1520,8 @@ usm_generate_out_msg(int msgProcModel,  /* (UNUSED) */
     u_int           thePrivKeyLength = 0;
     const oid      *thePrivProtocol = NULL;
     u_int           thePrivProtocolLength = 0;
+    netsnmp_sc_key_cache **theAuthKeyCache = NULL;
+    netsnmp_sc_key_cache **thePrivKeyCache = NULL;
     int             theSecLevel = 0;    /* No defined const for bad
                                          * value (other then err).
                                          */
@@ -1484,6 +1533,7 @@ usm_generate_out_msg(int msgProcModel,  /* (UNUSED) */
          * To hush the compiler for now.  XXX 
          */
         const struct usmStateReference *ref = secStateRef;
+        struct usmUser *user;
 
         theName = ref->usr_name;
         theNameLength = ref->usr_name_length;
@@ -1504,6 +1554,17 @@ usm_generate_out_msg(int msgProcModel,  /* (UNUSED) */
         thePrivKey = ref->usr_priv_key;
         thePrivKeyLength = ref->usr_priv_key_length;
         theSecLevel = ref->usr_sec_level;
+
+        /*
+         * The keys are copies of those of the user; use its key caches
+         * if it is still there.
+         */
+        user = usm_get_user_from_list(theEngineID, theEngineIDLength,
+                                      theName, theNameLength, 0);
+        if (user) {
+            theAuthKeyCache = &user->authKeyCache;
+            thePrivKeyCache = &user->privKeyCache;
+        }
     }
 
     /*
@@ -1528,6 +1589,8 @@ usm_generate_out_msg(int msgProcModel,  /* (UNUSED) */
         theSecLevel = secLevel;
         theEngineIDLength = secEngineIDLen;
         if (user) {
+            theAuthKeyCache = &user->authKeyCache;
+            thePrivKeyCache = &user->privKeyCache;
             theAuthProtocol = user->authProtocol;
             theAuthProtocolLength = user->authProtocolLen;
             theAuthKey = user->authKey;
@@ -1665,11 +1728,12 @@ usm_generate_out_msg(int msgProcModel,  /* (UNUSED) */
         }
 #endif
 
-        if (sc_encrypt(thePrivProtocol, thePrivProtocolLength,
-                       thePrivKey, thePrivKeyLength,
-                       salt, salt_length,
-                       scopedPdu, scopedPduLen,
-                       &ptr[dataOffset], &encrypted_length)
+        if (sc_encrypt_cached(thePrivKeyCache,
+                              thePrivProtocol, thePrivProtocolLength,
+                              thePrivKey, thePrivKeyLength,
+                              salt, salt_length,
+                              scopedPdu, scopedPduLen,
+                              &ptr[dataOffset], &encrypted_length)
             != SNMP_ERR_NOERROR) {
             DEBUGMSGTL(("usm", "encryption error.\n"));
             return SNMPERR_USM_ENCRYPTIONERROR;
@@ -1837,9 +1901,12 @@ usm_generate_out_msg(int msgProcModel,  /* (UNUSED) */
             return SNMPERR_USM_GENERICERROR;
         }
 
-        if (sc_generate_keyed_hash(theAuthProtocol, theAuthProtocolLength,
-                                   theAuthKey, theAuthKeyLength,
-                                   ptr, ptr_len, temp_sig, &temp_sig_len)
+        if (sc_generate_keyed_hash_cached(theAuthKeyCache,
+                                          theAuthProtocol,
+                                          theAuthProtocolLength,
+                                          theAuthKey, theAuthKeyLength,
+                                          ptr, ptr_len,
+                                          temp_sig, &temp_sig_len)
             != SNMP_ERR_NOERROR) {
             /*
              * FIX temp_sig_len defined?!
@@ -1964,6 +2031,8 @@ usm_rgenerate_out_msg(int msgProcModel, /* (UNUSED) */
     u_int           thePrivKeyLength = 0;
     const oid      *thePrivProtocol = NULL;
     u_int           thePrivProtocolLength = 0;
+    netsnmp_sc_key_cache **theAuthKeyCache = NULL;
+    netsnmp_sc_key_cache **thePrivKeyCache = NULL;
     int             theSecLevel = 0;    /* No defined const for bad
                                          * value (other then err). */
     size_t          salt_length = 0, save_salt_length = 0;
@@ -1980,6 +2049,7 @@ usm_rgenerate_out_msg(int msgProcModel, /* (UNUSED) */
          * To hush the compiler for now.  XXX 
          */
         const struct usmStateReference *ref = secStateRef;
+        struct usmUser *user;
 
         theName = ref->usr_name;
         theNameLength = ref->usr_name_length;
@@ -2000,6 +2070,17 @@ usm_rgenerate_out_msg(int msgProcModel, /* (UNUSED) */
         thePrivKey = ref->usr_priv_key;
         thePrivKeyLength = ref->usr_priv_key_length;
         theSecLevel = ref->usr_sec_level;
+
+        /*
+         * The keys are copies of those of the user; use its key caches
+         * if it is still there.
+         */
+        user = usm_get_user_from_list(theEngineID, theEngineIDLength,
+                                      theName, theNameLength, 0);
+        if (user) {
+            theAuthKeyCache = &user->authKeyCache;
+            thePrivKeyCache = &user->privKeyCache;
+        }
     }
 
     /*
@@ -2024,6 +2105,8 @@ usm_rgenerate_out_msg(int msgProcModel, /* (UNUSED) */
         theSecLevel = secLevel;
         theEngineIDLength = secEngineIDLen;
         if (user) {
+            theAuthKeyCache = &user->authKeyCache;
+            thePrivKeyCache = &user->privKeyCache;
             theAuthProtocol = user->authProtocol;
             theAuthProtocolLength = user->authProtocolLen;
             theAuthKey = user->authKey;
@@ -2142,11 +2225,13 @@ usm_rgenerate_out_msg(int msgProcModel, /* (UNUSED) */
         }
 #endif
 
-        if (sc_encrypt(thePrivProtocol, thePrivProtocolLength,
-                       thePrivKey, thePrivKeyLength,
-                       salt, salt_length,
-                       scopedPdu, scopedPduLen,
-                       ciphertext, &ciphertextlen) != SNMP_ERR_NOERROR) {
+        if (sc_encrypt_cached(thePrivKeyCache,
+                              thePrivProtocol, thePrivProtocolLength,
+                              thePrivKey, thePrivKeyLength,
+                              salt, salt_length,
+                              scopedPdu, scopedPduLen,
+                              ciphertext, &ciphertextlen)
+            != SNMP_ERR_NOERROR) {
             DEBUGMSGTL(("usm", "encryption error.\n"));
             SNMP_FREE(ciphertext);
             return SNMPERR_USM_ENCRYPTIONERROR;
@@ -2357,10 +2442,12 @@ usm_rgenerate_out_msg(int msgProcModel, /* (UNUSED) */
             return SNMPERR_USM_GENERICERROR;
         }
 
-        if (sc_generate_keyed_hash(theAuthProtocol, theAuthProtocolLength,
-                                   theAuthKey, theAuthKeyLength,
-                                   proto_msg, proto_msg_len,
-                                   temp_sig, &temp_sig_len)
+        if (sc_generate_keyed_hash_cached(theAuthKeyCache,
+                                          theAuthProtocol,
+                                          theAuthProtocolLength,
+                                          theAuthKey, theAuthKeyLength,
+                                          proto_msg, proto_msg_len,
+                                          temp_sig, &temp_sig_len)
             != SNMP_ERR_NOERROR) {
             SNMP_FREE(temp_sig);
             DEBUGMSGTL(("usm", "Signing failed.\n"));
@@ -3052,7 +3139,7 @@ usm_process_in_msg(int msgProcModel,    /* (UNUSED) */
      * If the user/engine ID is unknown, report this as an error.
      */
     if ((user = usm_get_user_from_list(secEngineID, *secEngineIDLen,
-                                       secName, *secNameLen, userList,
+                                       secName, *secNameLen,
                                        (((sess && sess->isAuthoritative ==
                                           SNMP_SESS_AUTHORITATIVE) ||
                                          (!sess)) ? 0 : 1)))
@@ -3092,10 +3179,12 @@ usm_process_in_msg(int msgProcModel,    /* (UNUSED) */
      */
     if (secLevel == SNMP_SEC_LEVEL_AUTHNOPRIV
         || secLevel == SNMP_SEC_LEVEL_AUTHPRIV) {
-        if (sc_check_keyed_hash(user->authProtocol, user->authProtocolLen,
-                                user->authKey, user->authKeyLen,
-                                wholeMsg, wholeMsgLen,
-                                signature, signature_length)
+        if (sc_check_keyed_hash_cached(&user->authKeyCache,
+                                       user->authProtocol,
+                                       user->authProtocolLen,
+                                       user->authKey, user->authKeyLen,
+                                       wholeMsg, wholeMsgLen,
+                                       signature, signature_length)
             != SNMP_ERR_NOERROR) {
             DEBUGMSGTL(("usm", "Verification failed.\n"));
             snmp_increment_statistic(STAT_USMSTATSWRONGDIGESTS);
@@ -3260,10 +3349,11 @@ usm_process_in_msg(int msgProcModel,    /* (UNUSED) */
             dump_chunk("usm/dump", "IV + Encrypted form:", iv, iv_length);
         }
 #endif
-        if (sc_decrypt(user->privProtocol, user->privProtocolLen,
-                       user->privKey, user->privKeyLen,
-                       iv, iv_length,
-                       value_ptr, remaining, *scopedPdu, scopedPduLen)
+        if (sc_decrypt_cached(&user->privKeyCache,
+                              user->privProtocol, user->privProtocolLen,
+                              user->privKey, user->privKeyLen,
+                              iv, iv_length,
+                              value_ptr, remaining, *scopedPdu, scopedPduLen)
             != SNMP_ERR_NOERROR) {
             DEBUGMSGTL(("usm", "%s\n", "Failed decryption."));
             snmp_increment_statistic(STAT_USMSTATSDECRYPTIONERRORS);
@@ -3587,8 +3677,7 @@ usm_create_user_from_session(netsnmp_session * session)
     user = usm_get_user_from_list(session->securityEngineID,
                                   session->securityEngineIDLen,
                                   session->securityName,
-                                  session->securityNameLen,
-                                  usm_get_userList(), 0);
+                                  session->securityNameLen, 0);
     if (NULL != user) {
         DEBUGMSGTL(("usm", "user exists x=%p\n", user));
     } else {
@@ -3919,6 +4008,7 @@ clear_user_list(void)
 	tmp = next;
     }
     userList = NULL;
+    _usm_user_index_clear();
 
 }
 
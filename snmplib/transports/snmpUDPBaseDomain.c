@@ -27,6 +27,9 @@
 #else
 #include <strings.h>
 #endif
+#if HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
 #if HAVE_NETINET_IN_H
 #include <netinet/in.h>
 #endif
@@ -60,6 +63,15 @@
 #define MSG_DONTWAIT 0
 #endif
 
+/*
+ * Batched datagram I/O with recvmmsg() and sendmmsg(), enabled with the
+ * udpIOBatch snmp.conf directive.
+ */
+#if defined(linux) && defined(HAVE_IP_PKTINFO) && defined(MSG_WAITFORONE)
+#define NETSNMP_UDPBASE_BATCH 1
+#define UDPBASE_BATCH_MAX     64
+#endif
+
 void
 _netsnmp_udp_sockopt_set(int fd, int local)
 {
@@ -418,6 +430,305 @@ int netsnmp_udpbase_sendto(int fd, const struct in_addr *srcip, int if_index,
 }
 #endif /* HAVE_IP_PKTINFO || HAVE_IP_RECVDSTADDR */
 
+#ifdef NETSNMP_UDPBASE_BATCH
+/*
+ * Per transport state for batched I/O.  Received datagrams are kept in
+ * rbuf until f_recv has handed all of them up.  While they are processed
+ * the transport is "corked": replies are queued instead of sent, and
+ * netsnmp_udpbase_flush() sends them with as few sendmmsg() calls as
+ * possible once the whole batch has been processed.
+ */
+typedef struct udpbase_batch_s {
+    int             size;               /* datagrams per system call */
+    size_t          bufsize;            /* bytes per received datagram */
+
+    int             rcount, rnext;      /* received, handed up */
+    struct sockaddr_in local;           /* local address of the socket */
+    struct mmsghdr *rmsg;
+    struct iovec   *riov;
+    netsnmp_sockaddr_storage *rfrom;
+    char           *rcmsg;
+    u_char         *rbuf;
+
+    int             corked;
+    int             scount;             /* queued for sending */
+    struct mmsghdr *smsg;
+    struct iovec   *siov;
+    netsnmp_indexed_addr_pair *sto;
+    char           *scmsg;
+} udpbase_batch;
+
+#define UDPBASE_CMSG_SPACE CMSG_SPACE(sizeof(struct in_pktinfo))
+
+static void
+_udpbase_batch_free(udpbase_batch *b)
+{
+    int             i;
+
+    if (b == NULL)
+        return;
+    if (b->siov)
+        for (i = 0; i < b->scount; i++)
+            free(b->siov[i].iov_base);
+    free(b->rmsg);
+    free(b->riov);
+    free(b->rfrom);
+    free(b->rcmsg);
+    free(b->rbuf);
+    free(b->smsg);
+    free(b->siov);
+    free(b->sto);
+    free(b->scmsg);
+    free(b);
+}
+
+/*
+ * Returns the batch state of t, allocating it on first use, or NULL if
+ * batching is not enabled for t.
+ */
+static udpbase_batch *
+_udpbase_batch_get(netsnmp_transport *t)
+{
+    udpbase_batch  *b;
+    int             size, i;
+
+    if (t->io_batch)
+        return (udpbase_batch *) t->io_batch;
+
+    /*
+     * Only transports whose reads go through _sess_read(), which knows
+     * about RECV_PENDING and calls f_flush, can batch: not those wrapped
+     * by other transports (UDPshared, DTLS).
+     */
+    if (t->f_recv != netsnmp_udpbase_recv ||
+        t->f_flush != netsnmp_udpbase_flush)
+        return NULL;
+
+    size = netsnmp_ds_get_int(NETSNMP_DS_LIBRARY_ID,
+                              NETSNMP_DS_LIB_UDP_IO_BATCH);
+    if (size <= 1)
+        return NULL;
+    if (size > UDPBASE_BATCH_MAX)
+        size = UDPBASE_BATCH_MAX;
+
+    b = SNMP_MALLOC_TYPEDEF(udpbase_batch);
+    if (b == NULL)
+        return NULL;
+    b->size = size;
+    b->bufsize = t->msgMaxSize;
+    b->rmsg = calloc(size, sizeof(*b->rmsg));
+    b->riov = calloc(size, sizeof(*b->riov));
+    b->rfrom = calloc(size, sizeof(*b->rfrom));
+    b->rcmsg = calloc(size, UDPBASE_CMSG_SPACE);
+    b->rbuf = malloc(size * b->bufsize);
+    b->smsg = calloc(size, sizeof(*b->smsg));
+    b->siov = calloc(size, sizeof(*b->siov));
+    b->sto = calloc(size, sizeof(*b->sto));
+    b->scmsg = calloc(size, UDPBASE_CMSG_SPACE);
+    if (!b->rmsg || !b->riov || !b->rfrom || !b->rcmsg || !b->rbuf ||
+        !b->smsg || !b->siov || !b->sto || !b->scmsg) {
+        snmp_log(LOG_ERR, "udpbase: no memory for %d datagram batch\n", size);
+        _udpbase_batch_free(b);
+        return NULL;
+    }
+
+    for (i = 0; i < size; i++) {
+        b->riov[i].iov_base = b->rbuf + i * b->bufsize;
+        b->riov[i].iov_len = b->bufsize;
+        b->rmsg[i].msg_hdr.msg_name = &b->rfrom[i];
+        b->rmsg[i].msg_hdr.msg_iov = &b->riov[i];
+        b->rmsg[i].msg_hdr.msg_iovlen = 1;
+        b->rmsg[i].msg_hdr.msg_control = b->rcmsg + i * UDPBASE_CMSG_SPACE;
+    }
+
+    DEBUGMSGTL(("udpbase:batch", "fd %d: batches of %d datagrams\n",
+                t->sock, size));
+    t->io_batch = b;
+    return b;
+}
+
+/*
+ * Send everything queued by _udpbase_batch_queue().
+ */
+static void
+_udpbase_batch_send(netsnmp_transport *t, udpbase_batch *b)
+{
+    struct msghdr  *m;
+    struct cmsghdr *cm;
+    struct in_pktinfo ipi;
+    int             i, rc, sent = 0, use_sendmmsg = 1;
+#ifdef HAVE_SO_BINDTODEVICE
+    char            iface[IFNAMSIZ];
+    socklen_t       ifacelen = IFNAMSIZ;
+#endif
+
+    if (b->scount == 0)
+        return;
+
+    for (i = 0; i < b->scount; i++) {
+        m = &b->smsg[i].msg_hdr;
+        memset(m, 0, sizeof(*m));
+        m->msg_name = &b->sto[i].remote_addr;
+        m->msg_namelen = sizeof(struct sockaddr_in);
+        m->msg_iov = &b->siov[i];
+        m->msg_iovlen = 1;
+        if (b->sto[i].local_addr.sin.sin_addr.s_addr != INADDR_ANY) {
+            /* reply from the address the request was sent to */
+            m->msg_control = b->scmsg + i * UDPBASE_CMSG_SPACE;
+            m->msg_controllen = UDPBASE_CMSG_SPACE;
+            memset(m->msg_control, 0, UDPBASE_CMSG_SPACE);
+            cm = CMSG_FIRSTHDR(m);
+            cm->cmsg_len = CMSG_LEN(sizeof(struct in_pktinfo));
+            cm->cmsg_level = SOL_IP;
+            cm->cmsg_type = IP_PKTINFO;
+            memset(&ipi, 0, sizeof(ipi));
+#ifdef HAVE_STRUCT_IN_PKTINFO_IPI_SPEC_DST
+            ipi.ipi_spec_dst = b->sto[i].local_addr.sin.sin_addr;
+#endif
+            memcpy(CMSG_DATA(cm), &ipi, sizeof(ipi));
+        }
+    }
+
+#ifdef HAVE_SO_BINDTODEVICE
+    /* no IP_PKTINFO on sockets bound to a device (VRF), see sendto_unix */
+    if (getsockopt(t->sock, SOL_SOCKET, SO_BINDTODEVICE, iface,
+                   &ifacelen) == 0 && ifacelen != 0)
+        use_sendmmsg = 0;
+#endif
+    while (use_sendmmsg && sent < b->scount) {
+        rc = sendmmsg(t->sock, &b->smsg[sent], b->scount - sent,
+                      MSG_DONTWAIT);
+        if (rc < 0 && errno == EINTR)
+            continue;
+        if (rc <= 0) {
+            DEBUGMSGTL(("udpbase:batch", "sendmmsg fd %d: %s\n", t->sock,
+                        rc < 0 ? strerror(errno) : "nothing sent"));
+            break;
+        }
+        sent += rc;
+    }
+    DEBUGMSGTL(("udpbase:batch", "fd %d: sent %d of %d queued datagrams\n",
+                t->sock, sent, b->scount));
+
+    /*
+     * Whatever sendmmsg() did not take goes out one at a time, with the
+     * source address fallbacks of netsnmp_udpbase_sendto().
+     */
+    for (i = 0; i < b->scount; i++) {
+        if (i >= sent) {
+            do {
+                rc = netsnmp_udpbase_sendto(t->sock,
+                                            &b->sto[i].local_addr.sin.sin_addr,
+                                            b->sto[i].if_index,
+                                            &b->sto[i].remote_addr.sa,
+                                            b->siov[i].iov_base,
+                                            b->siov[i].iov_len);
+            } while (rc < 0 && errno == EINTR);
+            if (rc < 0)
+                DEBUGMSGTL(("udpbase:batch", "sendto error, rc %d (errno %d)\n",
+                            rc, errno));
+        }
+        free(b->siov[i].iov_base);
+        b->siov[i].iov_base = NULL;
+    }
+    b->scount = 0;
+}
+
+/*
+ * Queue a reply while the transport is corked.  Returns size, or -1 if the
+ * caller should send it right away.
+ */
+static int
+_udpbase_batch_queue(netsnmp_transport *t, udpbase_batch *b,
+                     const netsnmp_indexed_addr_pair *addr_pair,
+                     int addr_len, const void *buf, int size)
+{
+    int             i;
+
+    if (b->scount >= b->size)
+        _udpbase_batch_send(t, b);
+
+    i = b->scount;
+    b->siov[i].iov_base = netsnmp_memdup(buf, size);
+    if (b->siov[i].iov_base == NULL)
+        return -1;
+    b->siov[i].iov_len = size;
+    memset(&b->sto[i], 0, sizeof(b->sto[i]));
+    memcpy(&b->sto[i], addr_pair, addr_len);
+    b->scount++;
+    return size;
+}
+
+/*
+ * Hand up the next datagram of the current batch, reading a new batch with
+ * recvmmsg() if the current one has been used up.
+ */
+static int
+_udpbase_batch_recv(netsnmp_transport *t, udpbase_batch *b, void *buf,
+                    int size, netsnmp_indexed_addr_pair *addr_pair)
+{
+    struct msghdr  *m;
+    struct cmsghdr *cm;
+    socklen_t       locallen;
+    int             i, rc, len;
+
+    if (b->rnext >= b->rcount) {
+        /* replies to the last batch must not wait for this one */
+        _udpbase_batch_send(t, b);
+        b->corked = 0;
+
+        for (i = 0; i < b->size; i++) {
+            b->rmsg[i].msg_hdr.msg_namelen = sizeof(b->rfrom[i]);
+            b->rmsg[i].msg_hdr.msg_controllen = UDPBASE_CMSG_SPACE;
+            b->rmsg[i].msg_hdr.msg_flags = 0;
+        }
+        do {
+            rc = recvmmsg(t->sock, b->rmsg, b->size, MSG_DONTWAIT, NULL);
+        } while (rc < 0 && errno == EINTR);
+        b->rcount = b->rnext = 0;
+        if (rc <= 0) {
+            t->flags &= ~NETSNMP_TRANSPORT_FLAG_RECV_PENDING;
+            return -1;
+        }
+        b->rcount = rc;
+        b->corked = rc > 1;
+
+        /* Get the local port number for use in diagnostic messages */
+        locallen = sizeof(b->local);
+        memset(&b->local, 0, sizeof(b->local));
+        if (getsockname(t->sock, (struct sockaddr *) &b->local,
+                        &locallen) != 0)
+            b->local.sin_family = AF_INET;
+        DEBUGMSGTL(("udpbase:batch", "fd %d: received %d datagrams\n",
+                    t->sock, rc));
+    }
+
+    m = &b->rmsg[b->rnext].msg_hdr;
+    len = b->rmsg[b->rnext].msg_len;
+    b->rnext++;
+    if (len > size)
+        len = size;
+    memcpy(buf, m->msg_iov->iov_base, len);
+
+    memcpy(&addr_pair->remote_addr, m->msg_name,
+           SNMP_MIN(m->msg_namelen, sizeof(addr_pair->remote_addr)));
+    addr_pair->local_addr.sin = b->local;
+    for (cm = CMSG_FIRSTHDR(m); cm != NULL; cm = CMSG_NXTHDR(m, cm)) {
+        if (cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_PKTINFO) {
+            struct in_pktinfo *src = (struct in_pktinfo *) CMSG_DATA(cm);
+            addr_pair->local_addr.sin.sin_addr = src->ipi_addr;
+            addr_pair->if_index = src->ipi_ifindex;
+        }
+    }
+
+    if (b->rnext < b->rcount)
+        t->flags |= NETSNMP_TRANSPORT_FLAG_RECV_PENDING;
+    else
+        t->flags &= ~NETSNMP_TRANSPORT_FLAG_RECV_PENDING;
+    return len;
+}
+#endif                          /* NETSNMP_UDPBASE_BATCH */
+
 /*
  * You can write something into opaque that will subsequently get passed back 
  * to your send function if you like.  For instance, you might want to
@@ -432,6 +743,9 @@ netsnmp_udpbase_recv(netsnmp_transport *t, void *buf, int size,
     socklen_t       fromlen = sizeof(netsnmp_sockaddr_storage);
     netsnmp_indexed_addr_pair *addr_pair = NULL;
     struct sockaddr *from;
+#ifdef NETSNMP_UDPBASE_BATCH
+    udpbase_batch  *batch;
+#endif
 
     if (t != NULL && t->sock >= 0) {
         addr_pair = SNMP_MALLOC_TYPEDEF(netsnmp_indexed_addr_pair);
@@ -442,6 +756,11 @@ netsnmp_udpbase_recv(netsnmp_transport *t, void *buf, int size,
         } else
             from = &addr_pair->remote_addr.sa;
 
+#ifdef NETSNMP_UDPBASE_BATCH
+        if ((batch = _udpbase_batch_get(t)) != NULL)
+            rc = _udpbase_batch_recv(t, batch, buf, size, addr_pair);
+        else
+#endif
 	while (rc < 0) {
 #ifdef netsnmp_udpbase_recvfrom_sendto_defined
             socklen_t local_addr_len = sizeof(addr_pair->local_addr);
@@ -504,6 +823,19 @@ netsnmp_udpbase_send(netsnmp_transport *t, const void *buf, int size,
 
     to = &addr_pair->remote_addr.sa;
 
+#ifdef NETSNMP_UDPBASE_BATCH
+    if (t != NULL && t->sock >= 0 && t->io_batch &&
+        ((udpbase_batch *) t->io_batch)->corked) {
+        rc = _udpbase_batch_queue(t, (udpbase_batch *) t->io_batch,
+                                  addr_pair,
+                                  (opaque && *opaque && olength) ?
+                                  *olength : t->data_length,
+                                  buf, size);
+        if (rc >= 0)
+            return rc;
+    }
+#endif
+
     if (to != NULL && t != NULL && t->sock >= 0) {
         DEBUGIF("netsnmp_udp") {
             char *str = netsnmp_udp_fmtaddr(NULL, addr_pair,
@@ -530,6 +862,38 @@ netsnmp_udpbase_send(netsnmp_transport *t, const void *buf, int size,
     return rc;
 }
 
+/*
+ * Send the replies queued while a batch of requests was processed.
+ */
+int
+netsnmp_udpbase_flush(netsnmp_transport *t)
+{
+#ifdef NETSNMP_UDPBASE_BATCH
+    udpbase_batch  *b;
+
+    if (t == NULL || (b = (udpbase_batch *) t->io_batch) == NULL)
+        return 0;
+    if (t->sock >= 0)
+        _udpbase_batch_send(t, b);
+    b->corked = 0;
+#endif
+    return 0;
+}
+
+int
+netsnmp_udpbase_close(netsnmp_transport *t)
+{
+#ifdef NETSNMP_UDPBASE_BATCH
+    if (t != NULL && t->io_batch != NULL) {
+        netsnmp_udpbase_flush(t);
+        _udpbase_batch_free((udpbase_batch *) t->io_batch);
+        t->io_batch = NULL;
+        t->flags &= ~NETSNMP_TRANSPORT_FLAG_RECV_PENDING;
+    }
+#endif
+    return netsnmp_socketbase_close(t);
+}
+
 void
 netsnmp_udp_base_ctor(void)
 {
@@ -0,0 +1,60 @@
+/* HEADER Testing the event loop with a UDP session */
+
+#include <net-snmp/library/event_loop.h>
+
+netsnmp_event_loop *loop;
+netsnmp_transport *t;
+netsnmp_session sess, *ss;
+struct sockaddr_in sin;
+socklen_t sinlen = sizeof(sin);
+struct timeval tv;
+int s, n, rc;
+
+init_snmp("snmp");
+
+loop = netsnmp_event_loop_create(NETSNMP_SELECT_NOALARMS);
+OK(loop != NULL, "event loop creation");
+#ifdef HAVE_SYS_EPOLL_H
+OKF(strcmp(netsnmp_event_loop_backend(loop), "epoll") == 0,
+    ("backend %s", netsnmp_event_loop_backend(loop)));
+#endif
+
+t = netsnmp_transport_open_server("snmp", "udp:127.0.0.1:0");
+OK(t != NULL, "opening a UDP server transport");
+snmp_sess_init(&sess);
+ss = snmp_add(&sess, t, NULL, NULL);
+OK(ss != NULL, "adding a session for it");
+OK(getsockname(t->sock, (struct sockaddr *)&sin, &sinlen) == 0,
+   "looking up its port");
+
+timerclear(&tv);
+OK(netsnmp_event_loop_run_once(loop, &tv) == 0, "nothing to read yet");
+
+s = socket(AF_INET, SOCK_DGRAM, 0);
+OK(s >= 0, "client socket");
+OK(sendto(s, "x", 1, 0, (struct sockaddr *)&sin, sinlen) == 1,
+   "sending a datagram to the session");
+
+/* The datagram is not a valid SNMP message; it is read and dropped. */
+tv.tv_sec = 5;
+tv.tv_usec = 0;
+rc = netsnmp_event_loop_run_once(loop, &tv);
+OKF(rc == 1, ("run_once reported %d ready descriptors", rc));
+
+timerclear(&tv);
+rc = netsnmp_event_loop_run_once(loop, &tv);
+OKF(rc == 0, ("datagram was consumed (%d)", rc));
+
+/* After the session is gone, traffic to its old port goes unnoticed. */
+snmp_close(ss);
+for (n = 0; n < 3; n++) {
+    timerclear(&tv);
+    rc = netsnmp_event_loop_run_once(loop, &tv);
+    if (rc != 0)
+        break;
+}
+OKF(rc == 0, ("closed session not watched (%d)", rc));
+
+close(s);
+netsnmp_event_loop_free(loop);
+snmp_shutdown("snmp");
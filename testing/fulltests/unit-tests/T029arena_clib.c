@@ -0,0 +1,58 @@
+/* HEADER Arena allocator */
+
+netsnmp_arena *arena, *other;
+netsnmp_data_list *head = NULL, *node;
+char *p, *q, *big, *s;
+size_t allocs, chunks, before;
+int i, zeroed;
+
+arena = netsnmp_arena_create(256);
+OK(arena != NULL, "arena creation");
+
+p = netsnmp_arena_alloc(arena, 3);
+q = netsnmp_arena_alloc(arena, 8);
+OK(p && q && q >= p + 3, "consecutive allocations do not overlap");
+OKF(((size_t) q % sizeof(void *)) == 0, ("allocation %p is aligned", q));
+
+big = netsnmp_arena_alloc(arena, 4096);
+for (i = 0, zeroed = 1; big && i < 4096; i++)
+    if (big[i])
+        zeroed = 0;
+OK(big && zeroed, "allocations larger than a chunk are zeroed");
+memset(big, 'x', 4096);
+
+for (i = 0; i < 100; i++)
+    if (netsnmp_arena_alloc(arena, 40) == NULL)
+        break;
+OKF(i == 100, ("%d allocations spanning several chunks", i));
+
+s = netsnmp_arena_strdup(arena, "table");
+OK(s && strcmp(s, "table") == 0, "strdup");
+
+netsnmp_arena_reset(arena);
+p = netsnmp_arena_alloc(arena, 16);
+OK(p != NULL && p[0] == 0, "allocation after a reset");
+netsnmp_arena_stats(arena, &allocs, &chunks);
+OKF(allocs == 1 && chunks == 0,
+    ("%d allocations and %d new chunks counted after a reset",
+     (int) allocs, (int) chunks));
+
+other = netsnmp_arena_create(0);
+s = netsnmp_arena_strdup(other, "adopted");
+netsnmp_arena_adopt(arena, other);
+OK(strcmp(s, "adopted") == 0, "adopted memory stays valid");
+
+netsnmp_arena_stats(arena, &before, NULL);
+node = netsnmp_create_data_list_arena(arena, "arena", strdup("data"), free);
+netsnmp_arena_stats(arena, &allocs, NULL);
+OK(node && allocs == before + 2, "data list node and name from an arena");
+netsnmp_data_list_add_node(&head, node);
+netsnmp_data_list_add_node(&head,
+                           netsnmp_create_data_list("heap", strdup("x"),
+                                                    free));
+OK(strcmp(netsnmp_get_list_data(head, "arena"), "data") == 0,
+   "lookup of the arena node");
+OK(netsnmp_remove_list_node(&head, "arena") == 0, "removing the arena node");
+netsnmp_free_all_list_data(head);
+
+netsnmp_arena_free(arena);
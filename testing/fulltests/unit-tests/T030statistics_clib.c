@@ -0,0 +1,24 @@
+/* HEADER Statistics counters */
+
+u_int v;
+
+snmp_init_statistics();
+OK(snmp_get_statistic(STAT_SNMPINPKTS) == 0, "counters start at zero");
+
+snmp_increment_statistic(STAT_SNMPINPKTS);
+v = snmp_increment_statistic(STAT_SNMPINPKTS);
+OKF(v == 2, ("increment returned %u", v));
+v = snmp_increment_statistic_by(STAT_SNMPINPKTS, 40);
+OKF(v == 42, ("increment by 40 returned %u", v));
+v = snmp_get_statistic(STAT_SNMPINPKTS);
+OKF(v == 42, ("total is %u", v));
+OK(snmp_get_statistic(STAT_SNMPOUTPKTS) == 0,
+   "other counters are left alone");
+
+OK(snmp_increment_statistic(-1) == 0 &&
+   snmp_increment_statistic(NETSNMP_STAT_MAX_STATS) == 0 &&
+   snmp_get_statistic(NETSNMP_STAT_MAX_STATS) == 0,
+   "out of range counters are rejected");
+
+snmp_init_statistics();
+OK(snmp_get_statistic(STAT_SNMPINPKTS) == 0, "counters can be reset");
@@ -0,0 +1,166 @@
+/* HEADER Matching responses with many requests in flight */
+
+/*
+ * Sends GET requests to a plain UDP socket that stores them, then turns
+ * them into responses and sends them back in random order, reading them
+ * with the event loop and running the request timeouts as a client would
+ * between reads.
+ */
+#include <net-snmp/library/event_loop.h>
+
+static const int inflight[] = { 1000, 10000, 100000 };
+static oid sysUpTime[] = { 1, 3, 6, 1, 2, 1, 1, 3, 0 };
+netsnmp_event_loop *loop;
+netsnmp_session sess, *ss;
+netsnmp_large_fd_set fdset;
+netsnmp_pdu *pdu;
+struct sockaddr_in sin, from;
+socklen_t sinlen = sizeof(sin), fromlen;
+struct timeval tv, start, end;
+u_char (*pkts)[64];
+int *lens, *order;
+char peer[64];
+unsigned int seed = 1;
+int s, i, j, k, n, t, ok, sent, stored, numfds, block, tmp;
+long usecs;
+
+init_snmp("snmp");
+loop = netsnmp_event_loop_create(NETSNMP_SELECT_NOALARMS);
+netsnmp_large_fd_set_init(&fdset, FD_SETSIZE);
+
+s = socket(AF_INET, SOCK_DGRAM, 0);
+memset(&sin, 0, sizeof(sin));
+sin.sin_family = AF_INET;
+sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+/* Do not wait forever for requests that got lost. */
+tv.tv_sec = 5;
+tv.tv_usec = 0;
+setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+OK(s >= 0 && bind(s, (struct sockaddr *)&sin, sizeof(sin)) == 0 &&
+   getsockname(s, (struct sockaddr *)&sin, &sinlen) == 0,
+   "agent socket");
+
+snmp_sess_init(&sess);
+snprintf(peer, sizeof(peer), "udp:127.0.0.1:%d", ntohs(sin.sin_port));
+sess.peername = peer;
+sess.version = SNMP_VERSION_2c;
+sess.community = (u_char *) "public";
+sess.community_len = 6;
+sess.retries = 0;
+sess.timeout = 600 * 1000000L;
+ss = snmp_open(&sess);
+OK(ss != NULL, "client session");
+
+n = inflight[sizeof(inflight) / sizeof(inflight[0]) - 1];
+pkts = malloc(n * sizeof(*pkts));
+lens = malloc(n * sizeof(*lens));
+order = malloc(n * sizeof(*order));
+
+for (t = 0; ss && t < (int)(sizeof(inflight) / sizeof(inflight[0])); t++) {
+    n = inflight[t];
+
+    /* Send the requests, storing them as they arrive. */
+    for (sent = stored = 0; sent < n; ) {
+        pdu = snmp_pdu_create(SNMP_MSG_GET);
+        snmp_add_null_var(pdu, sysUpTime, OID_LENGTH(sysUpTime));
+        if (!snmp_async_send(ss, pdu, NULL, NULL)) {
+            snmp_free_pdu(pdu);
+            break;
+        }
+        if (++sent % 64 && sent < n)
+            continue;
+        while (stored < sent) {
+            fromlen = sizeof(from);
+            k = recvfrom(s, pkts[stored], sizeof(pkts[stored]),
+                         sent < n ? MSG_DONTWAIT : 0,
+                         (struct sockaddr *)&from, &fromlen);
+            if (k <= 0)
+                break;
+            lens[stored++] = k;
+        }
+    }
+    ok = (sent == n && stored == n);
+    OKF(ok, ("%d requests sent, %d received", sent, stored));
+    if (!ok)
+        break;
+
+    /* GetRequest-PDU to Response-PDU, right after the community. */
+    for (i = 0; i < n; i++) {
+        for (j = 0; j + 6 < lens[i]; j++)
+            if (memcmp(pkts[i] + j, "public", 6) == 0)
+                break;
+        pkts[i][j + 6] = SNMP_MSG_RESPONSE;
+        order[i] = i;
+    }
+    for (i = n - 1; i > 0; i--) {
+        seed = seed * 1103515245 + 12345;
+        j = (seed >> 8) % (i + 1);
+        tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+
+    netsnmp_get_monotonic_clock(&start);
+    for (i = 0; i < n; i++) {
+        sendto(s, pkts[order[i]], lens[order[i]], 0,
+               (struct sockaddr *)&from, fromlen);
+        if ((i + 1) % 64 && i + 1 < n)
+            continue;
+        do {
+            timerclear(&tv);
+        } while (netsnmp_event_loop_run_once(loop, &tv) > 0);
+        snmp_timeout();
+    }
+    netsnmp_get_monotonic_clock(&end);
+    usecs = (end.tv_sec - start.tv_sec) * 1000000L +
+        (end.tv_usec - start.tv_usec);
+    printf("# %d in flight: %.0f responses/s\n", n,
+           usecs > 0 ? n * 1e6 / usecs : 0.0);
+
+    numfds = 0;
+    block = 0;
+    tv.tv_sec = 1000;
+    tv.tv_usec = 0;
+    snmp_sess_select_info2_flags(snmp_sess_pointer(ss), &numfds, &fdset,
+                                 &tv, &block, NETSNMP_SELECT_NOALARMS);
+    OKF(block == 1, ("all %d responses matched", n));
+}
+
+if (ss)
+    snmp_close(ss);
+
+/* Unanswered requests are resent once, then time out. */
+sess.retries = 1;
+sess.timeout = 50000;
+ss = snmp_open(&sess);
+for (i = 0; ss && i < 3; i++) {
+    pdu = snmp_pdu_create(SNMP_MSG_GET);
+    snmp_add_null_var(pdu, sysUpTime, OID_LENGTH(sysUpTime));
+    if (!snmp_async_send(ss, pdu, NULL, NULL))
+        snmp_free_pdu(pdu);
+}
+for (i = stored = 0; ss && i < 40; i++) {
+    usleep(10000);
+    snmp_timeout();
+    while (recv(s, pkts[0], sizeof(pkts[0]), MSG_DONTWAIT) > 0)
+        stored++;
+}
+OKF(stored == 6, ("%d requests sent including resends", stored));
+numfds = 0;
+block = 0;
+tv.tv_sec = 1000;
+tv.tv_usec = 0;
+if (ss)
+    snmp_sess_select_info2_flags(snmp_sess_pointer(ss), &numfds, &fdset,
+                                 &tv, &block, NETSNMP_SELECT_NOALARMS);
+OK(block == 1, "timed out requests are gone");
+
+free(order);
+free(lens);
+free(pkts);
+if (ss)
+    snmp_close(ss);
+close(s);
+netsnmp_large_fd_set_cleanup(&fdset);
+netsnmp_event_loop_free(loop);
+snmp_shutdown("snmp");
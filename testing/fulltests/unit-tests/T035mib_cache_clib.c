@@ -0,0 +1,109 @@
+/* HEADER Loading MIBs from a MIB cache */
+
+/*
+ * Loads all MIBs, saves them to a MIB cache, then compares the time it
+ * takes to load them from the MIB files and from the cache, and checks
+ * that both give the same tree.
+ */
+#define NLOADS 20
+static const char *names[] = {
+    "SNMPv2-MIB::sysDescr.0", "IF-MIB::ifHCInOctets.7",
+    "IP-MIB::ipAddressPrefixOrigin.1.ipv4.\"127.0.0.0\".8",
+    "SNMP-VIEW-BASED-ACM-MIB::vacmAccessContextMatch",
+};
+char file[64], buf[1024];
+oid name[MAX_OID_LEN];
+size_t name_len;
+struct tree *tp;
+struct timeval start, end;
+unsigned int sum, sums[2];
+int i, k, n, nodes[2], ok;
+long usecs[2];
+FILE *fp;
+
+snprintf(file, sizeof(file), "/tmp/T035mib_cache.%d", (int) getpid());
+setenv("MIBS", "ALL", 1);
+unsetenv("MIBCACHE");
+init_snmp("snmp");
+OK(netsnmp_save_mib_cache(file) == 0, "MIB cache saved");
+
+for (k = 0; k < 2; k++) {
+    if (k)
+        setenv("MIBCACHE", file, 1);
+    netsnmp_get_monotonic_clock(&start);
+    for (i = 0; i < NLOADS; i++) {
+        shutdown_mib();
+        netsnmp_init_mib();
+    }
+    netsnmp_get_monotonic_clock(&end);
+    usecs[k] = (end.tv_sec - start.tv_sec) * 1000000L +
+        (end.tv_usec - start.tv_usec);
+
+    /* Walk the tree in preorder, summing what identifies each node. */
+    for (sum = 0, n = 0, tp = get_tree_head(); tp; n++) {
+        for (i = 0; tp->label[i]; i++)
+            sum = sum * 31 + (u_char) tp->label[i];
+        sum = sum * 31 + tp->subid;
+        sum = sum * 31 + tp->type * 7 + tp->access * 3 + tp->status;
+        sum = sum * 31 + (tp->hint ? tp->hint[0] : 0) + tp->tc_index;
+        if (tp->child_list)
+            tp = tp->child_list;
+        else {
+            while (tp && !tp->next_peer)
+                tp = tp->parent;
+            if (tp)
+                tp = tp->next_peer;
+        }
+    }
+    sums[k] = sum;
+    nodes[k] = n;
+
+    for (i = ok = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++) {
+        name_len = MAX_OID_LEN;
+        if (read_objid(names[i], name, &name_len) &&
+            snprint_objid(buf, sizeof(buf), name, name_len) > 0 &&
+            strcmp(buf, names[i]) == 0)
+            ok++;
+    }
+    OKF(ok == (int)(sizeof(names) / sizeof(names[0])),
+        ("%s: %d of %d names translated", k ? "cache" : "MIB files", ok,
+         (int)(sizeof(names) / sizeof(names[0]))));
+}
+OKF(nodes[0] > 1000 && nodes[0] == nodes[1] && sums[0] == sums[1],
+    ("same tree of %d nodes loaded from the cache", nodes[1]));
+printf("# MIB loads/s: %.0f from MIB files, %.0f from the cache\n",
+       usecs[0] > 0 ? NLOADS * 1e6 / usecs[0] : 0.0,
+       usecs[1] > 0 ? NLOADS * 1e6 / usecs[1] : 0.0);
+
+/* The cache is not used with other MIB settings ... */
+setenv("MIBS", "SNMPv2-MIB", 1);
+shutdown_mib();
+netsnmp_init_mib();
+for (n = 0, tp = get_tree_head(); tp; n++) {
+    if (tp->child_list)
+        tp = tp->child_list;
+    else {
+        while (tp && !tp->next_peer)
+            tp = tp->parent;
+        if (tp)
+            tp = tp->next_peer;
+    }
+}
+OKF(n < nodes[0], ("cache not used for other MIBs (%d nodes)", n));
+
+/* ... nor when it is damaged. */
+setenv("MIBS", "ALL", 1);
+fp = fopen(file, "r+");
+if (fp) {
+    fputs("junk", fp);
+    fclose(fp);
+}
+shutdown_mib();
+netsnmp_init_mib();
+name_len = MAX_OID_LEN;
+OK(read_objid("IF-MIB::ifHCInOctets.7", name, &name_len),
+   "MIB files read when the cache is damaged");
+
+unlink(file);
+unsetenv("MIBCACHE");
+snmp_shutdown("snmp");
@@ -0,0 +1,108 @@
+/* HEADER MIB name lookup in a large MIB */
+
+/*
+ * Parses a generated MIB with many objects, then translates each of them
+ * by name and checks the result, and measures how long parsing, exact
+ * and fuzzy name lookups take.
+ */
+#define NLGROUPS  100
+#define NLOBJECTS 1000
+#define NFUZZY   20
+char file[64], name_buf[64], buf[256], expected[256];
+oid name[MAX_OID_LEN];
+size_t name_len;
+struct tree *tp;
+struct timeval start, end;
+int i, j, ok, fuzzy_ok;
+long usecs[3];
+FILE *fp;
+
+snprintf(file, sizeof(file), "/tmp/T036mib_name_lookup.%d", (int) getpid());
+fp = fopen(file, "w");
+OK(fp != NULL, "MIB file created");
+if (fp == NULL)
+    return 1;
+fprintf(fp, "T036-LARGE-MIB DEFINITIONS ::= BEGIN\n"
+        "IMPORTS enterprises FROM SNMPv2-SMI;\n"
+        "largeMib OBJECT IDENTIFIER ::= { enterprises 8072 9999 }\n");
+for (i = 0; i < NLGROUPS; i++) {
+    fprintf(fp, "largeGroup%d OBJECT IDENTIFIER ::= { largeMib %d }\n",
+            i, i + 1);
+    for (j = 0; j < NLOBJECTS; j++)
+        fprintf(fp, "largeObject%dx%d OBJECT IDENTIFIER ::= "
+                "{ largeGroup%d %d }\n", i, j, i, j + 1);
+}
+fprintf(fp, "END\n");
+fclose(fp);
+
+init_snmp("snmp");
+netsnmp_get_monotonic_clock(&start);
+tp = read_mib(file);
+netsnmp_get_monotonic_clock(&end);
+usecs[0] = (end.tv_sec - start.tv_sec) * 1000000L +
+    (end.tv_usec - start.tv_usec);
+OK(tp != NULL, "generated MIB parsed");
+
+netsnmp_get_monotonic_clock(&start);
+for (i = ok = 0; i < NLGROUPS; i++) {
+    for (j = 0; j < NLOBJECTS; j++) {
+        snprintf(name_buf, sizeof(name_buf),
+                 "T036-LARGE-MIB::largeObject%dx%d", i, j);
+        snprintf(expected, sizeof(expected),
+                 ".1.3.6.1.4.1.8072.9999.%d.%d", i + 1, j + 1);
+        name_len = MAX_OID_LEN;
+        if (read_objid(name_buf, name, &name_len) &&
+            snprint_objid(buf, sizeof(buf), name, name_len) > 0 &&
+            strcmp(buf, name_buf) == 0 &&
+            (tp = find_tree_node(name_buf + 16, -1)) != NULL &&
+            tp->subid == (u_long) j + 1) {
+            netsnmp_ds_set_int(NETSNMP_DS_LIBRARY_ID,
+                               NETSNMP_DS_LIB_OID_OUTPUT_FORMAT,
+                               NETSNMP_OID_OUTPUT_NUMERIC);
+            snprint_objid(buf, sizeof(buf), name, name_len);
+            netsnmp_ds_set_int(NETSNMP_DS_LIBRARY_ID,
+                               NETSNMP_DS_LIB_OID_OUTPUT_FORMAT,
+                               NETSNMP_OID_OUTPUT_MODULE);
+            if (strcmp(buf, expected) == 0)
+                ok++;
+        }
+    }
+}
+netsnmp_get_monotonic_clock(&end);
+usecs[1] = (end.tv_sec - start.tv_sec) * 1000000L +
+    (end.tv_usec - start.tv_usec);
+OKF(ok == NLGROUPS * NLOBJECTS, ("%d of %d names translated", ok,
+                                 NLGROUPS * NLOBJECTS));
+
+netsnmp_get_monotonic_clock(&start);
+for (i = fuzzy_ok = 0; i < NFUZZY; i++) {
+    snprintf(name_buf, sizeof(name_buf), "objECT%dx%d$", i * 3,
+             NLOBJECTS - 1 - i);
+    clear_tree_flags(get_tree_head());
+    tp = find_best_tree_node(name_buf, NULL, NULL);
+    snprintf(buf, sizeof(buf), "largeObject%dx%d", i * 3,
+             NLOBJECTS - 1 - i);
+    if (tp && strcmp(tp->label, buf) == 0)
+        fuzzy_ok++;
+}
+netsnmp_get_monotonic_clock(&end);
+usecs[2] = (end.tv_sec - start.tv_sec) * 1000000L +
+    (end.tv_usec - start.tv_usec);
+OKF(fuzzy_ok == NFUZZY, ("%d of %d fuzzy lookups found their node",
+                         fuzzy_ok, NFUZZY));
+
+/* The best match is the one that matches earliest in the label. */
+clear_tree_flags(get_tree_head());
+tp = find_best_tree_node("sysDescr", NULL, NULL);
+OK(tp && strcmp(tp->label, "sysDescr") == 0, "fuzzy lookup of sysDescr");
+clear_tree_flags(get_tree_head());
+tp = find_best_tree_node("no-such-label", NULL, NULL);
+OK(tp == NULL, "fuzzy lookup of an unknown label");
+
+printf("# %d objects: parsed in %ld ms, %.0f names/s translated, "
+       "%.0f fuzzy lookups/s\n", NLGROUPS * NLOBJECTS, usecs[0] / 1000,
+       usecs[1] > 0 ? ok * 1e6 / usecs[1] : 0.0,
+       usecs[2] > 0 ? NFUZZY * 1e6 / usecs[2] : 0.0);
+
+unlink(file);
+snmp_shutdown("snmp");
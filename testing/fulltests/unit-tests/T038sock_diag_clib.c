@@ -0,0 +1,183 @@
+/* HEADER Loading TCP connections and UDP endpoints through sock_diag */
+
+/*
+ * Opens a synthetic socket set - a listener with NPAIRS connections to it
+ * and as many UDP sockets - then loads the tcpConn and udp_endpoint
+ * containers with sock_diag and from /proc, checks that both see the same
+ * sockets and reports how fast each is.  Set SOCK_DIAG_PAIRS in the
+ * environment (and raise ulimit -n) to benchmark a larger set.
+ */
+#ifdef linux
+#include <net-snmp/data_access/tcpConn.h>
+#include <net-snmp/data_access/udp_endpoint.h>
+#define NLOADS 5
+/* tcpConnectionState values */
+#define LISTEN      2
+#define ESTABLISHED 5
+struct sockaddr_in sin;
+socklen_t sinlen;
+long max_fds;
+struct timeval start, end;
+netsnmp_container *c;
+netsnmp_iterator *it;
+netsnmp_tcpconn_entry *te;
+netsnmp_udp_endpoint_entry *ue;
+int *fds, *udp, nfds = 0, npairs = 256, lfd, i, mode, load;
+unsigned char *udp_ports;
+unsigned int lport;
+int estab[2], listen_count[2], others[2], mine[2], endpoints[2];
+unsigned long long tcp_sum[2], udp_sum[2];
+double rate[2][2];
+const char *env;
+
+init_snmp("snmp");
+
+if ((env = getenv("SOCK_DIAG_PAIRS")) != NULL && atoi(env) > 0)
+    npairs = atoi(env);
+max_fds = sysconf(_SC_OPEN_MAX);
+if (max_fds > 0 && max_fds < 3L * npairs + 64)
+    npairs = (max_fds - 64) / 3;
+fds = malloc(2 * npairs * sizeof(int));
+udp = malloc(npairs * sizeof(int));
+udp_ports = calloc(65536, 1);
+
+/* the synthetic socket set */
+memset(&sin, 0, sizeof(sin));
+sin.sin_family = AF_INET;
+sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+sinlen = sizeof(sin);
+lfd = socket(AF_INET, SOCK_STREAM, 0);
+OK(lfd >= 0 && bind(lfd, (struct sockaddr *)&sin, sizeof(sin)) == 0 &&
+   listen(lfd, npairs) == 0 &&
+   getsockname(lfd, (struct sockaddr *)&sin, &sinlen) == 0, "listener");
+lport = ntohs(sin.sin_port);
+for (i = 0; i < npairs; i++) {
+    fds[nfds] = socket(AF_INET, SOCK_STREAM, 0);
+    if (fds[nfds] < 0 ||
+        connect(fds[nfds], (struct sockaddr *)&sin, sizeof(sin)) != 0)
+        break;
+    nfds++;
+    if ((fds[nfds] = accept(lfd, NULL, NULL)) < 0)
+        break;
+    nfds++;
+}
+OKF(nfds == 2 * npairs, ("%d connected TCP sockets", nfds));
+for (i = 0; i < npairs; i++) {
+    struct sockaddr_in usin = sin;
+
+    usin.sin_port = 0;
+    sinlen = sizeof(usin);
+    udp[i] = socket(AF_INET, SOCK_DGRAM, 0);
+    if (udp[i] < 0 || bind(udp[i], (struct sockaddr *)&usin, sizeof(usin)) ||
+        getsockname(udp[i], (struct sockaddr *)&usin, &sinlen))
+        break;
+    udp_ports[ntohs(usin.sin_port)] = 1;
+}
+OKF(i == npairs, ("%d UDP sockets", i));
+
+/* mode 0 prefers sock_diag, mode 1 reads /proc */
+for (mode = 0; mode < 2; mode++) {
+    u_int tflags = mode ? NETSNMP_ACCESS_TCPCONN_LOAD_NO_SOCK_DIAG : 0;
+    u_int uflags = mode ? NETSNMP_ACCESS_UDP_ENDPOINT_LOAD_NO_SOCK_DIAG : 0;
+
+    estab[mode] = listen_count[mode] = others[mode] = mine[mode] = 0;
+    endpoints[mode] = 0;
+    tcp_sum[mode] = udp_sum[mode] = 0;
+
+    c = netsnmp_access_tcpconn_container_load(NULL, tflags |
+                                NETSNMP_ACCESS_TCPCONN_LOAD_NOLISTEN);
+    it = c ? CONTAINER_ITERATOR(c) : NULL;
+    for (te = it ? ITERATOR_FIRST(it) : NULL; te; te = ITERATOR_NEXT(it)) {
+        if (te->loc_port != lport && te->rmt_port != lport)
+            continue;
+        if (te->tcpConnState == ESTABLISHED)
+            estab[mode]++;
+        else
+            others[mode]++;
+        if (te->pid == (u_int) getpid())
+            mine[mode]++;
+        tcp_sum[mode] += te->loc_port * 65537ULL + te->rmt_port +
+            te->loc_addr_len + te->rmt_addr_len;
+    }
+    if (it)
+        ITERATOR_RELEASE(it);
+    if (c)
+        netsnmp_access_tcpconn_container_free(c, 0);
+
+    c = netsnmp_access_tcpconn_container_load(NULL, tflags |
+                                NETSNMP_ACCESS_TCPCONN_LOAD_ONLYLISTEN);
+    it = c ? CONTAINER_ITERATOR(c) : NULL;
+    for (te = it ? ITERATOR_FIRST(it) : NULL; te; te = ITERATOR_NEXT(it)) {
+        if (te->tcpConnState != LISTEN)
+            others[mode]++;
+        else if (te->loc_port == lport)
+            listen_count[mode]++;
+    }
+    if (it)
+        ITERATOR_RELEASE(it);
+    if (c)
+        netsnmp_access_tcpconn_container_free(c, 0);
+
+    c = netsnmp_access_udp_endpoint_container_load(NULL, uflags);
+    it = c ? CONTAINER_ITERATOR(c) : NULL;
+    for (ue = it ? ITERATOR_FIRST(it) : NULL; ue; ue = ITERATOR_NEXT(it)) {
+        if (ue->loc_addr_len != 4 || !udp_ports[ue->loc_port])
+            continue;
+        endpoints[mode]++;
+        if (ue->pid == (u_int) getpid())
+            mine[mode]++;
+        udp_sum[mode] += ue->instance + ue->loc_port + ue->rmt_port;
+    }
+    if (it)
+        ITERATOR_RELEASE(it);
+    if (c)
+        netsnmp_access_udp_endpoint_container_free(c, 0);
+
+    OKF(estab[mode] == nfds && listen_count[mode] == 1 && others[mode] == 0,
+        ("%s: %d established, %d listening, %d unexpected",
+         mode ? "/proc" : "sock_diag", estab[mode], listen_count[mode],
+         others[mode]));
+    OKF(endpoints[mode] == npairs && mine[mode] == nfds + npairs,
+        ("%s: %d UDP endpoints, %d sockets of this process",
+         mode ? "/proc" : "sock_diag", endpoints[mode], mine[mode]));
+
+    /* how fast */
+    for (i = 0; i < 2; i++) {
+        netsnmp_get_monotonic_clock(&start);
+        for (load = 0; load < NLOADS; load++) {
+            if (i == 0) {
+                c = netsnmp_access_tcpconn_container_load(NULL, tflags |
+                                NETSNMP_ACCESS_TCPCONN_LOAD_NOLISTEN);
+                if (c)
+                    netsnmp_access_tcpconn_container_free(c, 0);
+            } else {
+                c = netsnmp_access_udp_endpoint_container_load(NULL, uflags);
+                if (c)
+                    netsnmp_access_udp_endpoint_container_free(c, 0);
+            }
+        }
+        netsnmp_get_monotonic_clock(&end);
+        rate[mode][i] = NLOADS / ((end.tv_sec - start.tv_sec) +
+                                  (end.tv_usec - start.tv_usec) / 1e6 + 1e-9);
+    }
+}
+OK(tcp_sum[0] == tcp_sum[1] && udp_sum[0] == udp_sum[1],
+   "sock_diag and /proc load the same sockets");
+printf("# %d TCP connections: %.1f loads/s with sock_diag, %.1f from /proc\n",
+       nfds, rate[0][0], rate[1][0]);
+printf("# %d UDP endpoints: %.1f loads/s with sock_diag, %.1f from /proc\n",
+       npairs, rate[0][1], rate[1][1]);
+
+for (i = 0; i < nfds; i++)
+    close(fds[i]);
+for (i = 0; i < npairs; i++)
+    if (udp[i] >= 0)
+        close(udp[i]);
+close(lfd);
+free(udp_ports);
+free(udp);
+free(fds);
+snmp_shutdown("snmp");
+#else
+OK(1, "sock_diag is linux only");
+#endif
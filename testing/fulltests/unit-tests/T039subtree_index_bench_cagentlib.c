@@ -0,0 +1,91 @@
+/* HEADER Registering and looking up 100k subtrees */
+
+/*
+ * Registers many instances, measures how long the registrations and
+ * GET and GETNEXT style lookups take, then unregisters them again.
+ */
+#define NREG 100000
+
+static oid base[] = { 1, 3, 6, 1, 3, 328, 0, 0 };
+netsnmp_handler_registration **reg;
+netsnmp_subtree *s;
+oid name[OID_LENGTH(base) + 1];
+struct timeval start, end;
+int i, found, next_ok;
+long usecs[4];
+
+#define ELAPSED(n) (usecs[n] = (end.tv_sec - start.tv_sec) * 1000000L + \
+                    (end.tv_usec - start.tv_usec))
+
+init_snmp("snmp");
+
+reg = calloc(NREG, sizeof(*reg));
+OK(reg != NULL, "registration array allocated");
+if (reg == NULL)
+    return 1;
+
+netsnmp_get_monotonic_clock(&start);
+for (i = 0; i < NREG; i++) {
+    base[OID_LENGTH(base) - 2] = i / 1000;
+    base[OID_LENGTH(base) - 1] = 2 * (i % 1000) + 1;
+    reg[i] = netsnmp_create_handler_registration("subtree-bench", NULL, base,
+                                                 OID_LENGTH(base),
+                                                 HANDLER_CAN_RONLY);
+    if (!reg[i] || netsnmp_register_instance(reg[i]) != MIB_REGISTERED_OK)
+        break;
+}
+netsnmp_get_monotonic_clock(&end);
+ELAPSED(0);
+OKF(i == NREG, ("registered %d of %d instances", i, NREG));
+
+memcpy(name, base, sizeof(base));
+name[OID_LENGTH(base)] = 0;
+
+/* GET: each instance must be found at its own OID. */
+netsnmp_get_monotonic_clock(&start);
+for (i = 0, found = 0; i < NREG; i++) {
+    name[OID_LENGTH(base) - 2] = i / 1000;
+    name[OID_LENGTH(base) - 1] = 2 * (i % 1000) + 1;
+    s = netsnmp_subtree_find(name, OID_LENGTH(name), NULL, "");
+    if (s && s->reginfo && s->reginfo->handler == reg[i]->handler)
+        found++;
+}
+netsnmp_get_monotonic_clock(&end);
+ELAPSED(1);
+OKF(found == NREG, ("found %d of %d registrations", found, NREG));
+
+/* GETNEXT: the subtree after the gap before each instance must be it. */
+netsnmp_get_monotonic_clock(&start);
+for (i = 0, next_ok = 0; i < NREG; i++) {
+    name[OID_LENGTH(base) - 2] = i / 1000;
+    name[OID_LENGTH(base) - 1] = 2 * (i % 1000);
+    s = netsnmp_subtree_find_prev(name, OID_LENGTH(name), NULL, "");
+    if (s)
+        s = s->next;
+    if (s && s->reginfo && s->reginfo->handler == reg[i]->handler)
+        next_ok++;
+}
+netsnmp_get_monotonic_clock(&end);
+ELAPSED(2);
+OKF(next_ok == NREG, ("%d of %d next lookups found the next registration",
+                      next_ok, NREG));
+
+netsnmp_get_monotonic_clock(&start);
+for (i = 0; i < NREG; i++)
+    netsnmp_unregister_handler(reg[i]);
+netsnmp_get_monotonic_clock(&end);
+ELAPSED(3);
+
+name[OID_LENGTH(base) - 2] = 0;
+name[OID_LENGTH(base) - 1] = 1;
+s = netsnmp_subtree_find(name, OID_LENGTH(name), NULL, "");
+OK(!s || !s->reginfo || strcmp(s->reginfo->handlerName, "subtree-bench") != 0,
+   "registrations gone");
+
+printf("# %d subtrees: registered in %ld ms, %.0f gets/s, %.0f getnexts/s, "
+       "unregistered in %ld ms\n", NREG, usecs[0] / 1000,
+       usecs[1] > 0 ? found * 1e6 / usecs[1] : 0.0,
+       usecs[2] > 0 ? next_ok * 1e6 / usecs[2] : 0.0, usecs[3] / 1000);
+
+free(reg);
+snmp_shutdown("snmp");
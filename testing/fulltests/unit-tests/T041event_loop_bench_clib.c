@@ -0,0 +1,122 @@
+/* HEADER Event loop cost with many idle sessions */
+
+/*
+ * Sends datagrams to one UDP session, first on its own and then with
+ * NIDLE idle UDP sessions open, and measures how long the event loop and
+ * the select() based compatibility path (snmp_select_info2(), select(),
+ * snmp_read2()) take to pick up each datagram.  The event loop exists
+ * before the sessions are opened, so it only learns about them as they
+ * are added.  Set EVENT_LOOP_SESSIONS in the environment (and raise
+ * ulimit -n) to benchmark more idle sessions.
+ */
+#include <net-snmp/library/event_loop.h>
+
+#define NITER 2000
+netsnmp_event_loop *loop;
+netsnmp_transport *t;
+netsnmp_session sess, **idle, *active;
+netsnmp_large_fd_set fdset;
+struct sockaddr_in sin;
+socklen_t sinlen = sizeof(sin);
+struct timeval tv, start, end;
+long max_fds;
+int nidle = 1000, opened = 0, phase, i, s, rc, numfds, block;
+int got[2][2];
+double usecs[2][2];
+const char *env;
+
+init_snmp("snmp");
+
+if ((env = getenv("EVENT_LOOP_SESSIONS")) != NULL && atoi(env) > 0)
+    nidle = atoi(env);
+max_fds = sysconf(_SC_OPEN_MAX);
+if (max_fds > 0 && max_fds < nidle + 64L)
+    nidle = max_fds - 64;
+idle = calloc(nidle, sizeof(*idle));
+netsnmp_large_fd_set_init(&fdset, FD_SETSIZE);
+
+loop = netsnmp_event_loop_create(NETSNMP_SELECT_NOALARMS);
+OK(loop != NULL, "event loop creation");
+if (loop == NULL)
+    return 1;
+
+t = netsnmp_transport_open_server("snmp", "udp:127.0.0.1:0");
+snmp_sess_init(&sess);
+active = t ? snmp_add(&sess, t, NULL, NULL) : NULL;
+OK(active != NULL &&
+   getsockname(t->sock, (struct sockaddr *)&sin, &sinlen) == 0,
+   "active session");
+s = socket(AF_INET, SOCK_DGRAM, 0);
+OK(s >= 0, "client socket");
+
+for (phase = 0; phase < 2; phase++) {
+    if (phase == 1) {
+        for (i = 0; i < nidle; i++) {
+            t = netsnmp_transport_open_server("snmp", "udp:127.0.0.1:0");
+            if (t == NULL)
+                break;
+            snmp_sess_init(&sess);
+            if ((idle[i] = snmp_add(&sess, t, NULL, NULL)) == NULL)
+                break;
+            opened++;
+        }
+        OKF(opened == nidle, ("%d idle sessions", opened));
+    }
+
+    /* the datagrams are not valid SNMP messages; they are read and dropped */
+    got[phase][0] = 0;
+    netsnmp_get_monotonic_clock(&start);
+    for (i = 0; i < NITER; i++) {
+        sendto(s, "x", 1, 0, (struct sockaddr *)&sin, sinlen);
+        tv.tv_sec = 1;
+        tv.tv_usec = 0;
+        if (netsnmp_event_loop_run_once(loop, &tv) == 1)
+            got[phase][0]++;
+    }
+    netsnmp_get_monotonic_clock(&end);
+    usecs[phase][0] = ((end.tv_sec - start.tv_sec) * 1e6 +
+                       (end.tv_usec - start.tv_usec)) / NITER;
+    OKF(got[phase][0] == NITER, ("event loop read %d of %d datagrams",
+                                 got[phase][0], NITER));
+
+    got[phase][1] = 0;
+    netsnmp_get_monotonic_clock(&start);
+    for (i = 0; i < NITER; i++) {
+        sendto(s, "x", 1, 0, (struct sockaddr *)&sin, sinlen);
+        NETSNMP_LARGE_FD_ZERO(&fdset);
+        numfds = 0;
+        block = 0;
+        tv.tv_sec = 1;
+        tv.tv_usec = 0;
+        snmp_select_info2(&numfds, &fdset, &tv, &block);
+        rc = netsnmp_large_fd_set_select(numfds, &fdset, NULL, NULL, &tv);
+        if (rc == 1) {
+            snmp_read2(&fdset);
+            got[phase][1]++;
+        }
+    }
+    netsnmp_get_monotonic_clock(&end);
+    usecs[phase][1] = ((end.tv_sec - start.tv_sec) * 1e6 +
+                       (end.tv_usec - start.tv_usec)) / NITER;
+    OKF(got[phase][1] == NITER, ("select() path read %d of %d datagrams",
+                                 got[phase][1], NITER));
+
+    timerclear(&tv);
+    rc = netsnmp_event_loop_run_once(loop, &tv);
+    OKF(rc == 0, ("nothing left to read (%d)", rc));
+}
+
+printf("# %s backend, 1 active session: %.2f us per datagram, "
+       "select(): %.2f us\n", netsnmp_event_loop_backend(loop),
+       usecs[0][0], usecs[0][1]);
+printf("# with %d idle sessions: %.2f us per datagram, select(): %.2f us\n",
+       opened, usecs[1][0], usecs[1][1]);
+
+for (i = 0; i < opened; i++)
+    snmp_close(idle[i]);
+close(s);
+snmp_close(active);
+free(idle);
+netsnmp_large_fd_set_cleanup(&fdset);
+netsnmp_event_loop_free(loop);
+snmp_shutdown("snmp");
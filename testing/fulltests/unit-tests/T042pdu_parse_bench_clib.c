@@ -0,0 +1,92 @@
+/* HEADER Allocations and time per varbind when parsing PDUs */
+
+/*
+ * Parses a GETNEXT request and a response carrying ifDescr-like string
+ * values, NVARS varbinds each, with and without
+ * UCD_MSG_FLAG_DECODE_IN_PLACE.  The allocations snmp_pdu_parse() makes
+ * are counted from the parsed varbinds: one per varbind, one per name or
+ * value not stored in the varbind itself, and one for a shared copy of
+ * the packet.
+ */
+#define NVARS 50
+#define NITER 4000
+static const char *kinds[] = { "GETNEXT request", "response" };
+oid name[] = { 1, 3, 6, 1, 2, 1, 2, 2, 1, 2, 0 };
+char value[65];
+netsnmp_pdu *pdu, *parsed;
+netsnmp_variable_list *vp;
+u_char packets[2][8192], *end;
+size_t packet_len[2], len;
+struct timeval start, stop;
+int kind, in_place, i, rc, allocs[2][2], shared;
+double nsecs[2][2];
+
+init_snmp("snmp");
+memset(value, 'x', sizeof(value) - 1);
+
+for (kind = 0; kind < 2; kind++) {
+    pdu = snmp_pdu_create(kind ? SNMP_MSG_RESPONSE : SNMP_MSG_GETNEXT);
+    for (i = 0; i < NVARS; i++) {
+        name[OID_LENGTH(name) - 1] = i + 1;
+        if (kind)
+            snmp_pdu_add_variable(pdu, name, OID_LENGTH(name), ASN_OCTET_STR,
+                                  value, strlen(value));
+        else
+            snmp_add_null_var(pdu, name, OID_LENGTH(name));
+    }
+    len = sizeof(packets[kind]);
+    end = snmp_pdu_build(pdu, packets[kind], &len);
+    OKF(end != NULL, ("building the %s", kinds[kind]));
+    packet_len[kind] = end ? end - packets[kind] : 0;
+    snmp_free_pdu(pdu);
+
+    for (in_place = 0; in_place < 2; in_place++) {
+        parsed = SNMP_MALLOC_TYPEDEF(netsnmp_pdu);
+        parsed->flags = in_place ? UCD_MSG_FLAG_DECODE_IN_PLACE : 0;
+        len = packet_len[kind];
+        rc = snmp_pdu_parse(parsed, packets[kind], &len);
+        OKF(rc == 0, ("parsing the %s%s", kinds[kind],
+                      in_place ? " in place" : ""));
+        allocs[kind][in_place] = shared = 0;
+        for (vp = parsed->variables; vp; vp = vp->next_variable) {
+            allocs[kind][in_place]++;
+            if (vp->name != vp->name_loc)
+                allocs[kind][in_place]++;
+            if (vp->data)
+                shared = 1;
+            else if (vp->val.string && vp->val.string != vp->buf)
+                allocs[kind][in_place]++;
+        }
+        allocs[kind][in_place] += shared;
+        snmp_free_pdu(parsed);
+
+        netsnmp_get_monotonic_clock(&start);
+        for (i = 0; i < NITER; i++) {
+            parsed = SNMP_MALLOC_TYPEDEF(netsnmp_pdu);
+            parsed->flags = in_place ? UCD_MSG_FLAG_DECODE_IN_PLACE : 0;
+            len = packet_len[kind];
+            snmp_pdu_parse(parsed, packets[kind], &len);
+            snmp_free_pdu(parsed);
+        }
+        netsnmp_get_monotonic_clock(&stop);
+        nsecs[kind][in_place] = ((stop.tv_sec - start.tv_sec) * 1e9 +
+                                 (stop.tv_usec - start.tv_usec) * 1e3) /
+            ((double) NITER * NVARS);
+    }
+    printf("# %s, %d varbinds: %d allocations, %.0f ns per varbind copied; "
+           "%d allocations, %.0f ns per varbind in place\n", kinds[kind],
+           NVARS, allocs[kind][0], nsecs[kind][0], allocs[kind][1],
+           nsecs[kind][1]);
+}
+
+OKF(allocs[1][1] == NVARS + 1,
+    ("response values share one copy of the packet (%d allocations)",
+     allocs[1][1]));
+OKF(allocs[1][0] == 2 * NVARS,
+    ("copied response values are allocated one by one (%d allocations)",
+     allocs[1][0]));
+OKF(allocs[0][0] == NVARS && allocs[0][1] == NVARS,
+    ("request varbinds only allocate the varbind itself (%d, %d)",
+     allocs[0][0], allocs[0][1]));
+
+snmp_shutdown("snmp");
@@ -0,0 +1,112 @@
+/* HEADER Allocations on the agent request path */
+
+/*
+ * Runs a GETNEXT for every column of a small table through handle_pdu()
+ * in this process, first with the arena the agent gives every request and
+ * then with that arena taken away, so that the same allocations go to
+ * malloc().  The arena counts the allocations it serves and the chunks it
+ * has to take from malloc() for them.
+ */
+#define NROWS 10
+#define NCOLS 8
+#define NITER 5000
+
+extern int      handle_pdu(netsnmp_agent_session *asp);
+static oid table_oid[] = { 1, 3, 6, 1, 3, 341, 1 };
+netsnmp_table_data_set *tds;
+netsnmp_handler_registration *reg;
+netsnmp_table_row *row;
+netsnmp_pdu *request;
+netsnmp_agent_session *asp;
+netsnmp_arena *arena;
+netsnmp_variable_list *vb;
+oid name[MAX_OID_LEN];
+struct timeval start, end;
+size_t allocs, chunks, total_allocs, total_chunks;
+double usecs[2];
+int i, j, heap, ok[2], ival;
+
+netsnmp_ds_set_boolean(NETSNMP_DS_LIBRARY_ID,
+                       NETSNMP_DS_LIB_DONT_READ_CONFIGS, 1);
+netsnmp_ds_set_boolean(NETSNMP_DS_APPLICATION_ID, NETSNMP_DS_AGENT_ROLE, 0);
+init_agent("snmpd");
+
+tds = netsnmp_create_table_data_set("arena-bench");
+netsnmp_table_dataset_add_index(tds, ASN_INTEGER);
+for (j = 1; j <= NCOLS; j++)
+    netsnmp_table_set_add_default_row(tds, j, ASN_INTEGER, FALSE, NULL, 0);
+reg = netsnmp_create_handler_registration("arena-bench", NULL, table_oid,
+                                          OID_LENGTH(table_oid),
+                                          HANDLER_CAN_RONLY);
+netsnmp_register_table_data_set(reg, tds, NULL);
+for (i = 1; i <= NROWS; i++) {
+    row = netsnmp_create_table_data_row();
+    netsnmp_table_row_add_index(row, ASN_INTEGER, &i, sizeof(i));
+    netsnmp_table_dataset_add_row(tds, row);
+    for (j = 1; j <= NCOLS; j++) {
+        ival = 100 * i + j;
+        netsnmp_set_row_column(row, j, ASN_INTEGER, &ival, sizeof(ival));
+    }
+}
+init_snmp("snmpd");
+
+/* GETNEXT of every column, answered from the first row */
+request = snmp_pdu_create(SNMP_MSG_GETNEXT);
+request->version = SNMP_VERSION_2c;
+request->flags |= UCD_MSG_FLAG_ALWAYS_IN_VIEW;
+memcpy(name, table_oid, sizeof(table_oid));
+name[OID_LENGTH(table_oid)] = 1;
+for (j = 1; j <= NCOLS; j++) {
+    name[OID_LENGTH(table_oid) + 1] = j;
+    snmp_add_null_var(request, name, OID_LENGTH(table_oid) + 2);
+}
+
+total_allocs = total_chunks = 0;
+for (heap = 0; heap < 2; heap++) {
+    usecs[heap] = 0;
+    ok[heap] = 0;
+    for (i = 0; i < NITER; i++) {
+        asp = init_agent_snmp_session(NULL, request);
+        if (asp == NULL)
+            break;
+        arena = asp->arena;
+        if (heap)
+            asp->arena = NULL;
+        netsnmp_get_monotonic_clock(&start);
+        if (handle_pdu(asp) == SNMP_ERR_NOERROR) {
+            for (vb = asp->pdu->variables, j = 1; vb;
+                 vb = vb->next_variable, j++)
+                if (vb->type != ASN_INTEGER || *vb->val.integer != 100 + j)
+                    break;
+            if (vb == NULL && j == NCOLS + 1)
+                ok[heap]++;
+        }
+        if (!heap) {
+            netsnmp_arena_stats(arena, &allocs, &chunks);
+            total_allocs += allocs;
+            total_chunks += chunks;
+        }
+        free_agent_snmp_session(asp);
+        netsnmp_get_monotonic_clock(&end);
+        usecs[heap] += (end.tv_sec - start.tv_sec) * 1e6 +
+            (end.tv_usec - start.tv_usec);
+        if (heap)
+            netsnmp_arena_free(arena);
+    }
+    OKF(ok[heap] == NITER, ("%d of %d requests answered %s", ok[heap], NITER,
+                            heap ? "from the heap" : "from the arena"));
+}
+
+OKF(total_allocs >= (size_t) NITER * NCOLS,
+    ("%.1f allocations per request served by the arena",
+     (double) total_allocs / NITER));
+/* only the first request finds no arena to reuse */
+OKF(total_chunks <= 1, ("%d arena chunks taken from malloc() in %d requests",
+                        (int) total_chunks, NITER));
+printf("# GETNEXT of %d columns: %.1f allocations per request from the "
+       "arena; %.1f us per request with the arena, %.1f us with malloc()\n",
+       NCOLS, (double) total_allocs / NITER, usecs[0] / NITER,
+       usecs[1] / NITER);
+
+snmp_free_pdu(request);
+snmp_shutdown("snmpd");
@@ -0,0 +1,97 @@
+/* HEADER Statistics counters updated from several threads */
+
+/*
+ * NTHREADS threads bump the same two counters NINC times each while this
+ * thread keeps adding them up.  Each thread must see its own increments
+ * one after the other, the totals may only grow while the threads run,
+ * and nothing may be lost once they are joined.  A second round of
+ * threads takes over the shards the first round left behind, and must
+ * add to their counts rather than start over.
+ *
+ * The threads need a function of their own, which cannot be defined in
+ * main(): main() hands over to run_threads() below, and the end of the
+ * test program closes that function instead.
+ */
+#if defined(NETSNMP_REENTRANT) && defined(HAVE_PTHREAD_H)
+#define NTHREADS 8
+#define NINC     200000
+
+int             run_threads(void);
+
+return run_threads();
+}
+
+static void    *
+stat_thread(void *arg)
+{
+    u_int           first, v = 0;
+    int             i;
+
+    first = snmp_increment_statistic(STAT_SNMPINPKTS);
+    for (i = 1; i < NINC; i++) {
+        v = snmp_increment_statistic(STAT_SNMPINPKTS);
+        if (v != first + i)
+            break;
+        snmp_increment_statistic_by(STAT_SNMPOUTPKTS, 2);
+    }
+    snmp_increment_statistic_by(STAT_SNMPOUTPKTS, 2);
+    return (void *) (intptr_t) (i == NINC);
+}
+
+int
+run_threads(void)
+{
+    pthread_t       threads[NTHREADS];
+    void           *ret;
+    u_int           total, last, expected;
+    int             round, i, started, in_order, reads, shrunk;
+
+    init_snmp("snmp");
+    snmp_init_statistics();
+
+    for (round = 1; round <= 2; round++) {
+        expected = round * NTHREADS * NINC;
+        for (started = 0; started < NTHREADS; started++)
+            if (pthread_create(&threads[started], NULL, stat_thread,
+                               NULL) != 0)
+                break;
+        OKF(started == NTHREADS, ("round %d: started %d threads", round,
+                                  started));
+
+        /* read the totals for as long as the threads are counting */
+        last = snmp_get_statistic(STAT_SNMPINPKTS);
+        for (reads = shrunk = 0; last < expected && reads < 10000000;
+             reads++) {
+            total = snmp_get_statistic(STAT_SNMPINPKTS);
+            if (total < last)
+                shrunk++;
+            last = total;
+        }
+        OKF(shrunk == 0, ("round %d: the total went down %d times in %d "
+                          "reads", round, shrunk, reads));
+
+        for (i = in_order = 0; i < started; i++)
+            if (pthread_join(threads[i], &ret) == 0 && ret)
+                in_order++;
+        OKF(in_order == started, ("round %d: %d of %d threads saw their "
+                                  "own increments in order", round,
+                                  in_order, started));
+
+        total = snmp_get_statistic(STAT_SNMPINPKTS);
+        OKF(total == expected, ("round %d: %u packets counted, expected %u",
+                                round, total, expected));
+        total = snmp_get_statistic(STAT_SNMPOUTPKTS);
+        OKF(total == 2 * expected, ("round %d: %u counted by 2, expected %u",
+                                    round, total, 2 * expected));
+    }
+
+    snmp_init_statistics();
+    OK(snmp_get_statistic(STAT_SNMPINPKTS) == 0 &&
+       snmp_get_statistic(STAT_SNMPOUTPKTS) == 0,
+       "every thread's counts are reset");
+
+    snmp_shutdown("snmp");
+#else
+printf("1..0 # SKIP per-thread statistics need --enable-reentrant\n");
+__did_plan = 1;
+#endif
@@ -0,0 +1,109 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T010netsnmp_string_time_to_secs_clib.c"
+/* HEADER Testing the netsnmp_string_time_to_secs API */
+
+#ifndef NETSNMP_FEATURE_REMOVE_STRING_TIME_TO_SECS
+
+int secs;
+
+#define TESTIT(x,y) \
+    OKF(y == (secs = netsnmp_string_time_to_secs(x)), \
+        ("netsnmp_string_time_to_secs of %s returned %d, not 5", x, secs))
+
+TESTIT("5", 5);
+TESTIT("5", 5);
+
+TESTIT("5s", 5);
+TESTIT("5S", 5);
+
+TESTIT("5m", 5 * 60);
+TESTIT("5M", 5 * 60);
+
+TESTIT("5h", 5 * 60 * 60);
+TESTIT("5H", 5 * 60 * 60);
+
+TESTIT("5d", 5 * 60 * 60 * 24);
+TESTIT("5D", 5 * 60 * 60 * 24);
+
+TESTIT("5w", 5 * 60 * 60 * 24 * 7);
+TESTIT("5W", 5 * 60 * 60 * 24 * 7);
+
+/* now with longer times */
+TESTIT("1234", 1234);
+TESTIT("1234", 1234);
+
+TESTIT("1234s", 1234);
+TESTIT("1234S", 1234);
+
+TESTIT("1234m", 1234 * 60);
+TESTIT("1234M", 1234 * 60);
+
+TESTIT("1234h", 1234 * 60 * 60);
+TESTIT("1234H", 1234 * 60 * 60);
+
+TESTIT("1234d", 1234 * 60 * 60 * 24);
+TESTIT("1234D", 1234 * 60 * 60 * 24);
+
+TESTIT("1234w", 1234 * 60 * 60 * 24 * 7);
+TESTIT("1234W", 1234 * 60 * 60 * 24 * 7);
+
+#endif
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
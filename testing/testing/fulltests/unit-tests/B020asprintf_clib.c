@@ -0,0 +1,74 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T020asprintf_clib.c"
+/* HEADER Testing asprintf() */
+
+char *strp;
+
+OK(asprintf(&strp, "%s", "") == 0, "asprintf() (1) failed");
+OKF(strp && strcmp(strp, "") == 0, ("%s <> \"\"", strp));
+free(strp);
+OK(asprintf(&strp, "%s", "abc") == 3, "asprintf() (1) failed");
+OKF(strp && strcmp(strp, "abc") == 0, ("%s <> \"abc\"", strp));
+free(strp);
+OK(asprintf(&strp, "%s %s", "abc", "def") == 7, "asprintf() (2) failed");
+OKF(strp && strcmp(strp, "abc def") == 0, ("%s <> \"abc def\"", strp));
+free(strp);
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
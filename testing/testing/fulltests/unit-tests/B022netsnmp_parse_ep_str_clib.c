@@ -0,0 +1,120 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T022netsnmp_parse_ep_str_clib.c"
+/*
+ * HEADER Testing netsnmp_parse_ep_str()
+ */
+
+struct one_test_data {
+    const char *in;
+    int res;
+    struct netsnmp_ep_str expected;
+};
+
+static struct one_test_data test_data[] = {
+    { "9999",              1, { "",         "",   "9999" } },
+    { ":777",              1, { "",         "",   "777"  } },
+    { "hostname:777",      1, { "hostname", "",   "777"  } },
+    { "hostname",          1, { "hostname", "",   ""     } },
+    { "1.2.3.4",           1, { "1.2.3.4",  "",   ""     } },
+    { "hostname@if",       1, { "hostname", "if", ""     } },
+    { "hostname@if:833",   1, { "hostname", "if", "833"  } },
+    { "[hostname]@if:833", 1, { "hostname", "if", "833"  } },
+    { "[hostname]?",       0, {                          } },
+    { "[hostname",         0, {                          } },
+    { "@if:844",           1, { "",         "if", "844"  } },
+    { "::1",               1, { "::1",      "",   ""     } },
+    { "::1@if",            1, { "::1",      "if", ""     } },
+    { "1::2",              1, { "1::2",     "",   ""     } },
+    { "[::1]",             1, { "::1",      "",   ""     } },
+    { "[::1]:0",           1, { "::1",      "",   "0"    } },
+    { "[::1]:2",           1, { "::1",      "",   "2"    } },
+    { "[::1]@if:2",        1, { "::1",      "if", "2"    } },
+    { "[::1]:2@if",        0, {                          } },
+};
+
+SOCK_STARTUP;
+
+{
+    int i;
+
+    for (i = 0; i < sizeof(test_data) / sizeof(test_data[0]); i++) {
+        const struct one_test_data *p = &test_data[i];
+        struct netsnmp_ep_str ep_str;
+        int res;
+
+        memset(&ep_str, 0, sizeof(ep_str));
+        res = netsnmp_parse_ep_str(&ep_str, p->in);
+        OKF(res == p->res, ("%s: return value %d <> %d", p->in, res, p->res));
+        if (res && p->res) {
+            OKF(strcmp(ep_str.addr,  p->expected.addr)  == 0,
+                ("%s: network address %s <> %s", p->in, ep_str.addr,
+                 p->expected.addr));
+            OKF(strcmp(ep_str.iface, p->expected.iface) == 0,
+                ("%s: network interface %s <> %s", p->in, ep_str.iface,
+                 p->expected.iface));
+            OKF(strcmp(ep_str.port, p->expected.port) == 0,
+                ("%s: port %s <> %s", p->in, ep_str.port, p->expected.port));
+        }
+    }
+}
+
+SOCK_CLEANUP;
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
@@ -0,0 +1,85 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T023varbind_set_var_value_int8_clib.c"
+/* HEADER Testing snmp_set_var_value() */
+
+{
+    static const signed char values[] = { -128, -23, -1, 1, 42, 127, 0 };
+    int i;
+
+    for (i = 0; values[i]; i++) {
+        netsnmp_variable_list variable;
+        int ec;
+
+        memset(&variable, 0, sizeof(variable));
+        variable.next_variable = NULL;
+        variable.type = ASN_INTEGER;
+        variable.val.string = NULL;
+        variable.val.integer = NULL;
+        variable.val_len = 0;
+
+        ec = snmp_set_var_value( &variable, &values[i], 1);
+
+        OK(ec == 0, "snmp_set_var_value() should succeed");
+        OKF(*variable.val.integer == values[i],
+            ("%ld =?= %d", *variable.val.integer, values[i]));
+    }
+}
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
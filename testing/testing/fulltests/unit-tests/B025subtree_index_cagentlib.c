@@ -0,0 +1,151 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/agent/net-snmp-agent-includes.h>
+#include <agentx/protocol.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <stdio.h>
+#include <sys/types.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T025subtree_index_cagentlib.c"
+/* HEADER Testing subtree lookups with many registrations */
+
+#define NREG 2000
+
+/*
+ * Compares the indexed lookup of every OID around the registrations with
+ * a walk of the subtree list.
+ */
+#define CHECK_INDEX(what)                                                 \
+    for (i = 0, mismatch = 0; i <= 2 * NREG + 2; i++) {                   \
+        name[OID_LENGTH(base) - 1] = i;                                   \
+        for (j = 0; j < 2; j++) {                                         \
+            if (netsnmp_subtree_find_prev(name, OID_LENGTH(base) + j,     \
+                                          NULL, "") !=                    \
+                netsnmp_subtree_find_prev(name, OID_LENGTH(base) + j,     \
+                                          netsnmp_subtree_find_first(""), \
+                                          ""))                            \
+                mismatch++;                                               \
+        }                                                                 \
+    }                                                                     \
+    OKF(mismatch == 0, ("%s: %d index lookups differ from the list",      \
+                        what, mismatch))
+
+static oid base[] = { 1, 3, 6, 1, 3, 327, 0 };
+netsnmp_handler_registration *reg[NREG], *wide, *high;
+netsnmp_subtree *s;
+oid name[OID_LENGTH(base) + 1];
+int i, j, found, missing, mismatch;
+
+init_snmp("snmp");
+
+for (i = 0; i < NREG; i++) {
+    base[OID_LENGTH(base) - 1] = 2 * i + 1;
+    reg[i] = netsnmp_create_handler_registration("subtree-index", NULL, base,
+                                                 OID_LENGTH(base),
+                                                 HANDLER_CAN_RONLY);
+    if (!reg[i] || netsnmp_register_instance(reg[i]) != MIB_REGISTERED_OK)
+        break;
+}
+OKF(i == NREG, ("registered %d of %d instances", i, NREG));
+
+memcpy(name, base, sizeof(base));
+name[OID_LENGTH(base)] = 0;
+
+/* Every registered instance must be found ... */
+for (i = 0, found = 0, missing = 0; i < NREG; i++) {
+    name[OID_LENGTH(base) - 1] = 2 * i + 1;
+    s = netsnmp_subtree_find(name, OID_LENGTH(name), NULL, "");
+    if (s && s->reginfo && s->reginfo->handler == reg[i]->handler)
+        found++;
+    /* ... and the gaps between them must not be. */
+    name[OID_LENGTH(base) - 1] = 2 * i + 2;
+    s = netsnmp_subtree_find(name, OID_LENGTH(name), NULL, "");
+    if (!s || !s->reginfo ||
+        strcmp(s->reginfo->handlerName, "subtree-index") != 0)
+        missing++;
+}
+OKF(found == NREG, ("found %d of %d registrations", found, NREG));
+OKF(missing == NREG, ("%d of %d gaps unregistered", missing, NREG));
+CHECK_INDEX("registered");
+
+/*
+ * A low priority registration covering all of them gets split around
+ * every instance, and a high priority one takes over an instance.
+ */
+wide = netsnmp_create_handler_registration("subtree-wide", NULL, base,
+                                           OID_LENGTH(base) - 1,
+                                           HANDLER_CAN_RONLY);
+wide->priority = 200;
+OK(netsnmp_register_handler(wide) == MIB_REGISTERED_OK,
+   "wide registration");
+base[OID_LENGTH(base) - 1] = 11;
+high = netsnmp_create_handler_registration("subtree-high", NULL, base,
+                                           OID_LENGTH(base),
+                                           HANDLER_CAN_RONLY);
+high->priority = 50;
+OK(netsnmp_register_instance(high) == MIB_REGISTERED_OK,
+   "high priority registration");
+CHECK_INDEX("overlapping");
+
+name[OID_LENGTH(base) - 1] = 11;
+s = netsnmp_subtree_find(name, OID_LENGTH(name), NULL, "");
+OK(s && s->reginfo && s->reginfo->handler == high->handler,
+   "high priority registration found");
+name[OID_LENGTH(base) - 1] = 12;
+s = netsnmp_subtree_find(name, OID_LENGTH(name), NULL, "");
+OK(s && s->reginfo && strcmp(s->reginfo->handlerName, "subtree-wide") == 0,
+   "wide registration found between instances");
+
+netsnmp_unregister_handler(high);
+netsnmp_unregister_handler(wide);
+CHECK_INDEX("overlapping unregistered");
+
+/* Unregister every other instance and look again. */
+for (i = 0; i < NREG; i += 2)
+    netsnmp_unregister_handler(reg[i]);
+
+for (i = 0, found = 0, missing = 0; i < NREG; i++) {
+    name[OID_LENGTH(base) - 1] = 2 * i + 1;
+    s = netsnmp_subtree_find(name, OID_LENGTH(name), NULL, "");
+    if (i % 2 == 0) {
+        if (!s || !s->reginfo ||
+            strcmp(s->reginfo->handlerName, "subtree-index") != 0)
+            missing++;
+    } else if (s && s->reginfo && s->reginfo->handler == reg[i]->handler) {
+        found++;
+    }
+}
+OKF(found == NREG / 2, ("found %d of %d remaining registrations", found,
+                        NREG / 2));
+OKF(missing == NREG / 2, ("%d of %d unregistered instances gone", missing,
+                          NREG / 2));
+CHECK_INDEX("half unregistered");
+
+for (i = 1; i < NREG; i += 2)
+    netsnmp_unregister_handler(reg[i]);
+
+snmp_shutdown("snmp");
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
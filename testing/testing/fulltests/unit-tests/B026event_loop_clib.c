@@ -0,0 +1,121 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T026event_loop_clib.c"
+/* HEADER Testing the event loop with a UDP session */
+
+#include <net-snmp/library/event_loop.h>
+
+netsnmp_event_loop *loop;
+netsnmp_transport *t;
+netsnmp_session sess, *ss;
+struct sockaddr_in sin;
+socklen_t sinlen = sizeof(sin);
+struct timeval tv;
+int s, n, rc;
+
+init_snmp("snmp");
+
+loop = netsnmp_event_loop_create(NETSNMP_SELECT_NOALARMS);
+OK(loop != NULL, "event loop creation");
+#ifdef HAVE_SYS_EPOLL_H
+OKF(strcmp(netsnmp_event_loop_backend(loop), "epoll") == 0,
+    ("backend %s", netsnmp_event_loop_backend(loop)));
+#endif
+
+t = netsnmp_transport_open_server("snmp", "udp:127.0.0.1:0");
+OK(t != NULL, "opening a UDP server transport");
+snmp_sess_init(&sess);
+ss = snmp_add(&sess, t, NULL, NULL);
+OK(ss != NULL, "adding a session for it");
+OK(getsockname(t->sock, (struct sockaddr *)&sin, &sinlen) == 0,
+   "looking up its port");
+
+timerclear(&tv);
+OK(netsnmp_event_loop_run_once(loop, &tv) == 0, "nothing to read yet");
+
+s = socket(AF_INET, SOCK_DGRAM, 0);
+OK(s >= 0, "client socket");
+OK(sendto(s, "x", 1, 0, (struct sockaddr *)&sin, sinlen) == 1,
+   "sending a datagram to the session");
+
+/* The datagram is not a valid SNMP message; it is read and dropped. */
+tv.tv_sec = 5;
+tv.tv_usec = 0;
+rc = netsnmp_event_loop_run_once(loop, &tv);
+OKF(rc == 1, ("run_once reported %d ready descriptors", rc));
+
+timerclear(&tv);
+rc = netsnmp_event_loop_run_once(loop, &tv);
+OKF(rc == 0, ("datagram was consumed (%d)", rc));
+
+/* After the session is gone, traffic to its old port goes unnoticed. */
+snmp_close(ss);
+for (n = 0; n < 3; n++) {
+    timerclear(&tv);
+    rc = netsnmp_event_loop_run_once(loop, &tv);
+    if (rc != 0)
+        break;
+}
+OKF(rc == 0, ("closed session not watched (%d)", rc));
+
+close(s);
+netsnmp_event_loop_free(loop);
+snmp_shutdown("snmp");
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
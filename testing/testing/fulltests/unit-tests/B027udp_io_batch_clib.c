@@ -0,0 +1,118 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T027udp_io_batch_clib.c"
+/* HEADER Reading a batch of UDP datagrams at once */
+
+#include <net-snmp/library/event_loop.h>
+
+netsnmp_event_loop *loop;
+netsnmp_transport *t;
+netsnmp_session sess, *ss;
+struct sockaddr_in sin;
+socklen_t sinlen = sizeof(sin);
+struct timeval tv;
+int s, n, rc;
+
+init_snmp("snmp");
+netsnmp_ds_set_int(NETSNMP_DS_LIBRARY_ID, NETSNMP_DS_LIB_UDP_IO_BATCH, 8);
+
+loop = netsnmp_event_loop_create(NETSNMP_SELECT_NOALARMS);
+t = netsnmp_transport_open_server("snmp", "udp:127.0.0.1:0");
+OK(t != NULL, "opening a UDP server transport");
+snmp_sess_init(&sess);
+ss = snmp_add(&sess, t, NULL, NULL);
+OK(ss != NULL, "adding a session for it");
+OK(getsockname(t->sock, (struct sockaddr *)&sin, &sinlen) == 0,
+   "looking up its port");
+
+s = socket(AF_INET, SOCK_DGRAM, 0);
+OK(s >= 0, "client socket");
+for (n = 0; n < 5; n++)
+    if (sendto(s, "x", 1, 0, (struct sockaddr *)&sin, sinlen) != 1)
+        break;
+OKF(n == 5, ("sent %d datagrams", n));
+
+tv.tv_sec = 5;
+tv.tv_usec = 0;
+rc = netsnmp_event_loop_run_once(loop, &tv);
+OKF(rc == 1, ("run_once reported %d ready descriptors", rc));
+
+/*
+ * Linux delivers all five datagrams to the first recvmmsg() call, so a
+ * single wakeup drains the socket.  Elsewhere they are read one by one.
+ */
+for (n = 1; n < 5; n++) {
+    timerclear(&tv);
+    if (netsnmp_event_loop_run_once(loop, &tv) == 0)
+        break;
+}
+#ifdef linux
+OKF(n == 1, ("datagrams consumed in %d wakeups", n));
+#else
+OKF(n == 5, ("datagrams consumed in %d wakeups", n));
+#endif
+timerclear(&tv);
+OK(netsnmp_event_loop_run_once(loop, &tv) == 0, "socket drained");
+
+snmp_close(ss);
+close(s);
+netsnmp_event_loop_free(loop);
+snmp_shutdown("snmp");
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
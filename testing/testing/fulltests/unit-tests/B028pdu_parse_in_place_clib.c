@@ -0,0 +1,138 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T028pdu_parse_in_place_clib.c"
+/* HEADER Decoding PDU values in place */
+
+static const oid name[] = { 1, 3, 6, 1, 2, 1, 1, 1, 0 };
+static const oid objid[] = { 1, 3, 6, 1, 4, 1, 8072, 3, 2, 10 };
+static const char longstr[] =
+    "a string value that does not fit into the varbind buffer";
+netsnmp_pdu *pdu, *parsed, *clone;
+netsnmp_variable_list *vp;
+u_char packet[1024], *end;
+size_t len, packet_len;
+int rc;
+
+init_snmp("snmp");
+
+pdu = snmp_pdu_create(SNMP_MSG_RESPONSE);
+snmp_pdu_add_variable(pdu, name, OID_LENGTH(name), ASN_OCTET_STR,
+                      longstr, strlen(longstr));
+snmp_pdu_add_variable(pdu, name, OID_LENGTH(name), ASN_OCTET_STR,
+                      "short", 5);
+snmp_pdu_add_variable(pdu, name, OID_LENGTH(name), ASN_OBJECT_ID,
+                      objid, sizeof(objid));
+len = sizeof(packet);
+end = snmp_pdu_build(pdu, packet, &len);
+OK(end != NULL, "building a response PDU");
+packet_len = end - packet;
+
+parsed = SNMP_MALLOC_TYPEDEF(netsnmp_pdu);
+parsed->flags = UCD_MSG_FLAG_DECODE_IN_PLACE;
+len = packet_len;
+rc = snmp_pdu_parse(parsed, packet, &len);
+OKF(rc == 0, ("parsing the response in place (%d)", rc));
+/* scribble over the packet, the values must not depend on it */
+memset(packet, 0, sizeof(packet));
+
+vp = parsed->variables;
+OK(vp->data != NULL && vp->val.string != vp->buf,
+   "long string value shares the received packet");
+OK(vp->val_len == strlen(longstr) &&
+   memcmp(vp->val.string, longstr, vp->val_len) == 0,
+   "long string value is intact");
+vp = vp->next_variable;
+OK(vp->data == NULL && vp->val.string == vp->buf &&
+   memcmp(vp->val.string, "short", 5) == 0,
+   "short string value is stored in the varbind");
+vp = vp->next_variable;
+OK(vp->val_len == sizeof(objid) &&
+   memcmp(vp->val.objid, objid, sizeof(objid)) == 0,
+   "object identifier value is intact");
+
+clone = snmp_clone_pdu(parsed);
+OK(clone && clone->variables->data == parsed->variables->data &&
+   clone->variables->val.string == parsed->variables->val.string,
+   "clones share values decoded in place");
+snmp_free_pdu(parsed);
+OK(memcmp(clone->variables->val.string, longstr, strlen(longstr)) == 0,
+   "shared value outlives the PDU it was decoded with");
+
+snmp_set_var_typed_value(clone->variables, ASN_OCTET_STR, "new", 3);
+OK(clone->variables->data == NULL &&
+   clone->variables->val.string == clone->variables->buf,
+   "replacing a shared value drops the packet");
+snmp_free_pdu(clone);
+
+/* values of GET requests are never decoded in place */
+pdu->command = SNMP_MSG_GET;
+len = sizeof(packet);
+end = snmp_pdu_build(pdu, packet, &len);
+parsed = SNMP_MALLOC_TYPEDEF(netsnmp_pdu);
+parsed->flags = UCD_MSG_FLAG_DECODE_IN_PLACE;
+len = end - packet;
+rc = snmp_pdu_parse(parsed, packet, &len);
+OK(rc == 0 && parsed->variables->data == NULL,
+   "GET request values are copied");
+snmp_free_pdu(parsed);
+
+snmp_free_pdu(pdu);
+snmp_shutdown("snmp");
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
@@ -0,0 +1,85 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T030statistics_clib.c"
+/* HEADER Statistics counters */
+
+u_int v;
+
+snmp_init_statistics();
+OK(snmp_get_statistic(STAT_SNMPINPKTS) == 0, "counters start at zero");
+
+snmp_increment_statistic(STAT_SNMPINPKTS);
+v = snmp_increment_statistic(STAT_SNMPINPKTS);
+OKF(v == 2, ("increment returned %u", v));
+v = snmp_increment_statistic_by(STAT_SNMPINPKTS, 40);
+OKF(v == 42, ("increment by 40 returned %u", v));
+v = snmp_get_statistic(STAT_SNMPINPKTS);
+OKF(v == 42, ("total is %u", v));
+OK(snmp_get_statistic(STAT_SNMPOUTPKTS) == 0,
+   "other counters are left alone");
+
+OK(snmp_increment_statistic(-1) == 0 &&
+   snmp_increment_statistic(NETSNMP_STAT_MAX_STATS) == 0 &&
+   snmp_get_statistic(NETSNMP_STAT_MAX_STATS) == 0,
+   "out of range counters are rejected");
+
+snmp_init_statistics();
+OK(snmp_get_statistic(STAT_SNMPINPKTS) == 0, "counters can be reset");
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
@@ -0,0 +1,152 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T031oid_compare_clib.c"
+/* HEADER OID comparison: vector versus scalar */
+
+/*
+ * Table row OIDs as the agent sees them: ifTable rows, and
+ * ipAddressTable rows indexed by an IPv6 address, whose instances differ
+ * late in the OID.
+ */
+#define NOIDS 512
+static const oid if_prefix[] = { 1, 3, 6, 1, 2, 1, 2, 2, 1, 10 };
+static const oid ip_prefix[] = { 1, 3, 6, 1, 2, 1, 4, 34, 1, 3, 2, 16,
+                                 0xfe, 0x80, 0, 0, 0, 0, 0, 0 };
+oid oids[NOIDS][MAX_OID_LEN];
+size_t lens[NOIDS];
+const char *impl[2];
+long elapsed[2];
+int results[2][3], mismatches = 0, prefix_ok = 1, ll_ok = 1;
+unsigned int seed = 1;
+struct timeval start, end;
+size_t off1, off2;
+int i, j, k, n, pass;
+
+for (i = 0; i < NOIDS; i++) {
+    const oid *prefix = (i & 1) ? ip_prefix : if_prefix;
+    size_t plen = (i & 1) ? OID_LENGTH(ip_prefix) : OID_LENGTH(if_prefix);
+
+    memcpy(oids[i], prefix, plen * sizeof(oid));
+    n = (i & 1) ? 8 : 1 + (i & 2) / 2;
+    for (k = 0; k < n; k++) {
+        seed = seed * 1103515245 + 12345;
+        oids[i][plen + k] = (i % 7 == 0) ? 0xfffffff0UL + (seed >> 28) :
+                                           (seed >> 16) % 4;
+    }
+    lens[i] = plen + n;
+}
+
+for (pass = 0; pass < 2; pass++) {
+    impl[pass] = netsnmp_oid_compare_select(pass);
+    netsnmp_get_monotonic_clock(&start);
+    for (n = 0; n < 20; n++)
+        for (i = 0; i < NOIDS; i++)
+            for (j = 0; j < NOIDS; j++)
+                results[pass][0] += snmp_oid_compare(oids[i], lens[i],
+                                                     oids[j], lens[j]);
+    netsnmp_get_monotonic_clock(&end);
+    elapsed[pass] = (end.tv_sec - start.tv_sec) * 1000000L +
+        (end.tv_usec - start.tv_usec);
+}
+printf("# %d compares: %s %ld us, %s %ld us\n", 20 * NOIDS * NOIDS,
+       impl[0], elapsed[0], impl[1], elapsed[1]);
+OKF(strcmp(impl[0], "scalar") == 0, ("scalar implementation %s", impl[0]));
+#if defined(__SSE2__) && defined(__GNUC__)
+OKF(strcmp(impl[1], "scalar") != 0, ("vector implementation %s", impl[1]));
+#endif
+
+for (i = 0; i < NOIDS; i++) {
+    for (j = 0; j < NOIDS; j++) {
+        for (pass = 0; pass < 2; pass++) {
+            netsnmp_oid_compare_select(pass);
+            results[pass][0] = snmp_oid_compare(oids[i], lens[i],
+                                                oids[j], lens[j]);
+            results[pass][1] = snmp_oid_ncompare(oids[i], lens[i],
+                                                 oids[j], lens[j], 15);
+            results[pass][2] = netsnmp_oid_equals(oids[i], lens[i],
+                                                  oids[j], lens[j]);
+        }
+        if (memcmp(results[0], results[1], sizeof(results[0])))
+            mismatches++;
+        netsnmp_oid_compare_select(0);
+        k = netsnmp_oid_find_prefix(oids[i], lens[i], oids[j], lens[j]);
+        netsnmp_oid_compare_ll(oids[i], lens[i], oids[j], lens[j], &off1);
+        netsnmp_oid_compare_select(1);
+        if (netsnmp_oid_find_prefix(oids[i], lens[i], oids[j], lens[j]) != k)
+            prefix_ok = 0;
+        netsnmp_oid_compare_ll(oids[i], lens[i], oids[j], lens[j], &off2);
+        if (off1 != off2)
+            ll_ok = 0;
+    }
+}
+OKF(mismatches == 0, ("%d compare results differ", mismatches));
+OK(prefix_ok, "common prefixes agree");
+OK(ll_ok, "netsnmp_oid_compare_ll() offsets agree");
+
+OK(snmp_oid_compare(if_prefix, 3, ip_prefix, 3) == 0 &&
+   snmp_oid_compare(if_prefix, 6, ip_prefix, 7) == -1 &&
+   snmp_oid_compare(if_prefix, 7, ip_prefix, 7) == -1 &&
+   snmp_oid_compare(ip_prefix, 7, if_prefix, 7) == 1,
+   "ordering of known OIDs");
+netsnmp_oid_compare_ll(if_prefix, 7, ip_prefix, 7, &off1);
+OKF(off1 == 7, ("offset of first difference %" NETSNMP_PRIz "u", off1));
+netsnmp_oid_compare_ll(if_prefix, 6, ip_prefix, 6, &off1);
+OKF(off1 == 7, ("offset past equal OIDs %" NETSNMP_PRIz "u", off1));
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
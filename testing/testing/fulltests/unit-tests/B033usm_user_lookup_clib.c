@@ -0,0 +1,172 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T033usm_user_lookup_clib.c"
+/* HEADER USM user store with 10k users */
+
+#define NUSERS 10000
+#define NENGINES 100
+u_char engines[NENGINES][12];
+char name[32];
+struct usmUser *user, *prev, *found;
+struct timeval start, end;
+unsigned int seed = 1;
+int i, j, n, ok, sorted, hits;
+long usecs;
+
+init_snmp("snmp");
+
+for (i = 0; i < NENGINES; i++) {
+    memset(engines[i], 0x80, sizeof(engines[i]));
+    engines[i][10] = i / 256;
+    engines[i][11] = i % 256;
+}
+
+/* Add the users in a pseudo-random order. */
+for (n = ok = 0; n < NUSERS; n++) {
+    seed = seed * 1103515245 + 12345;
+    i = (seed >> 8) % NUSERS;
+    user = usm_create_user();
+    user->engineIDLen = sizeof(engines[0]);
+    user->engineID = netsnmp_memdup(engines[i % NENGINES],
+                                    user->engineIDLen);
+    snprintf(name, sizeof(name), "user%d", i / NENGINES * 7919 % NUSERS);
+    user->name = strdup(name);
+    user->secName = strdup(name);
+    if (usm_add_user(user) != NULL)
+        ok++;
+}
+OKF(ok == NUSERS, ("%d users added", ok));
+
+for (n = 0, sorted = 1, prev = NULL, user = usm_get_userList(); user;
+     prev = user, user = user->next, n++) {
+    if (user->prev != prev)
+        sorted = 0;
+    if (prev && (memcmp(prev->engineID, user->engineID,
+                        user->engineIDLen) > 0 ||
+                 (memcmp(prev->engineID, user->engineID,
+                         user->engineIDLen) == 0 &&
+                  (strlen(prev->name) > strlen(user->name) ||
+                   (strlen(prev->name) == strlen(user->name) &&
+                    strcmp(prev->name, user->name) >= 0)))))
+        sorted = 0;
+}
+OK(sorted, "user list is in usmUserTable order");
+OKF(n <= NUSERS, ("%d distinct users in the list", n));
+
+/* Look every user up, then compare with walking the list. */
+netsnmp_get_monotonic_clock(&start);
+for (hits = 0, user = usm_get_userList(); user; user = user->next)
+    if (usm_get_user(user->engineID, user->engineIDLen, user->name) == user)
+        hits++;
+netsnmp_get_monotonic_clock(&end);
+usecs = (end.tv_sec - start.tv_sec) * 1000000L +
+    (end.tv_usec - start.tv_usec);
+OKF(hits == n, ("%d of %d users found", hits, n));
+printf("# %d lookups: %ld us\n", n, usecs);
+
+netsnmp_get_monotonic_clock(&start);
+for (hits = 0, user = usm_get_userList(); user; user = user->next) {
+    for (found = usm_get_userList(); found; found = found->next)
+        if (found->engineIDLen == user->engineIDLen &&
+            memcmp(found->engineID, user->engineID, user->engineIDLen) == 0 &&
+            strcmp(found->name, user->name) == 0)
+            break;
+    if (found == user)
+        hits++;
+}
+netsnmp_get_monotonic_clock(&end);
+usecs = (end.tv_sec - start.tv_sec) * 1000000L +
+    (end.tv_usec - start.tv_usec);
+printf("# %d list scans: %ld us\n", n, usecs);
+
+OK(usm_get_user(engines[0], sizeof(engines[0]), "nobody") == NULL,
+   "unknown user not found");
+OK(usm_get_user(engines[0], 4, "user0") == NULL,
+   "user not found under a different engineID");
+
+/* Adding a user again replaces it. */
+found = usm_get_userList()->next;
+user = usm_create_user();
+user->engineIDLen = found->engineIDLen;
+user->engineID = netsnmp_memdup(found->engineID, found->engineIDLen);
+user->name = strdup(found->name);
+user->secName = strdup(found->name);
+usm_add_user(user);
+OK(usm_get_user(user->engineID, user->engineIDLen, user->name) == user &&
+   usm_get_userList()->next == user, "duplicate user replaced");
+
+/* Removing users. */
+for (i = j = 0, user = usm_get_userList(); user; i++) {
+    found = user->next;
+    if (i % 2) {
+        usm_remove_user(user);
+        usm_free_user(user);
+        j++;
+    }
+    user = found;
+}
+for (i = 0, hits = 0, user = usm_get_userList(); user; user = user->next, i++)
+    if (usm_get_user(user->engineID, user->engineIDLen, user->name) == user)
+        hits++;
+OKF(i == n - j && hits == i, ("%d of %d remaining users found", hits, i));
+OK(usm_remove_user(NULL) == NULL, "removing no user");
+
+snmp_shutdown("snmp");
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
@@ -0,0 +1,192 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T034usm_key_cache_clib.c"
+/* HEADER Cached USM key setup */
+
+/*
+ * Checks that the cached variants of the keyed hash and cipher functions
+ * give the same results as the plain ones, also after the key changes,
+ * then compares the time it takes to protect and check authPriv messages
+ * with and without caches.
+ */
+#define NMSGS 20000
+netsnmp_auth_alg_info *ai;
+netsnmp_priv_alg_info *pi;
+netsnmp_sc_key_cache *authCache = NULL, *privCache = NULL;
+u_char key[64], iv[16], msg[200], mac1[64], mac2[64];
+u_char ct1[256], ct2[256], pt[256];
+size_t maclen1, maclen2, ctlen1, ctlen2, ptlen;
+struct timeval start, end;
+int i, j, k, ok, rc;
+long usecs[2];
+
+init_snmp("snmp");
+
+for (i = 0; i < (int) sizeof(key); i++)
+    key[i] = i * 7 + 1;
+for (i = 0; i < (int) sizeof(msg); i++)
+    msg[i] = i;
+memset(iv, 0x5a, sizeof(iv));
+
+for (i = 0; (ai = sc_get_auth_alg_byindex(i)) != NULL; i++) {
+    if (ai->type == NETSNMP_USMAUTH_NOAUTH)
+        continue;
+    for (j = ok = 0; j < 2; j++) {
+        key[0] = j;
+        maclen1 = maclen2 = ai->mac_length;
+        if (sc_generate_keyed_hash(ai->alg_oid, ai->oid_len, key,
+                                   ai->proper_length, msg, sizeof(msg),
+                                   mac1, &maclen1) == SNMPERR_SUCCESS &&
+            sc_generate_keyed_hash_cached(&authCache, ai->alg_oid,
+                                          ai->oid_len, key, ai->proper_length,
+                                          msg, sizeof(msg), mac2,
+                                          &maclen2) == SNMPERR_SUCCESS &&
+            maclen1 == maclen2 && memcmp(mac1, mac2, maclen1) == 0 &&
+            sc_check_keyed_hash_cached(&authCache, ai->alg_oid, ai->oid_len,
+                                       key, ai->proper_length, msg,
+                                       sizeof(msg), mac2,
+                                       maclen2) == SNMPERR_SUCCESS)
+            ok++;
+        mac2[0] ^= 1;
+        if (sc_check_keyed_hash_cached(&authCache, ai->alg_oid, ai->oid_len,
+                                       key, ai->proper_length, msg,
+                                       sizeof(msg), mac2,
+                                       maclen2) == SNMPERR_SUCCESS)
+            ok = 0;
+    }
+    OKF(ok == 2, ("%s: cached MACs match", ai->name));
+}
+sc_key_cache_free(&authCache);
+OK(authCache == NULL, "auth key cache freed");
+
+for (i = 0; (pi = sc_get_priv_alg_byindex(i)) != NULL; i++) {
+    if (pi->type == USM_CREATE_USER_PRIV_NONE)
+        continue;
+    for (j = ok = 0; j < 3; j++) {
+        key[0] = j / 2;
+        iv[0] = j;
+        ctlen1 = ctlen2 = sizeof(ct1);
+        ptlen = sizeof(pt);
+        if (sc_encrypt(pi->alg_oid, pi->oid_len, key, pi->proper_length,
+                       iv, pi->iv_length, msg, sizeof(msg),
+                       ct1, &ctlen1) == SNMPERR_SUCCESS &&
+            sc_encrypt_cached(&privCache, pi->alg_oid, pi->oid_len, key,
+                              pi->proper_length, iv, pi->iv_length,
+                              msg, sizeof(msg),
+                              ct2, &ctlen2) == SNMPERR_SUCCESS &&
+            ctlen1 == ctlen2 && memcmp(ct1, ct2, ctlen1) == 0 &&
+            sc_decrypt_cached(&privCache, pi->alg_oid, pi->oid_len, key,
+                              pi->proper_length, iv, pi->iv_length,
+                              ct2, ctlen2, pt, &ptlen) == SNMPERR_SUCCESS &&
+            memcmp(pt, msg, sizeof(msg)) == 0)
+            ok++;
+    }
+    OKF(ok == 3, ("%s: cached encryption matches", pi->name));
+}
+sc_key_cache_free(&privCache);
+
+/*
+ * An authPriv message: encrypt and sign, then check and decrypt.
+ */
+key[0] = 0;
+for (k = 0; k < 2; k++) {
+    netsnmp_sc_key_cache **ac = k ? &authCache : NULL;
+    netsnmp_sc_key_cache **pc = k ? &privCache : NULL;
+
+    netsnmp_get_monotonic_clock(&start);
+    for (j = ok = 0; j < NMSGS; j++) {
+        iv[0] = j;
+        ctlen1 = sizeof(ct1);
+        ptlen = sizeof(pt);
+        maclen1 = 12;
+        rc = sc_encrypt_cached(pc, usmAESPrivProtocol,
+                               OID_LENGTH(usmAESPrivProtocol), key, 16,
+                               iv, 16, msg, sizeof(msg), ct1, &ctlen1);
+        if (rc == SNMPERR_SUCCESS)
+            rc = sc_generate_keyed_hash_cached(ac, usmHMACSHA1AuthProtocol,
+                                               OID_LENGTH(usmHMACSHA1AuthProtocol),
+                                               key, 20, ct1, ctlen1,
+                                               mac1, &maclen1);
+        if (rc == SNMPERR_SUCCESS)
+            rc = sc_check_keyed_hash_cached(ac, usmHMACSHA1AuthProtocol,
+                                            OID_LENGTH(usmHMACSHA1AuthProtocol),
+                                            key, 20, ct1, ctlen1,
+                                            mac1, maclen1);
+        if (rc == SNMPERR_SUCCESS)
+            rc = sc_decrypt_cached(pc, usmAESPrivProtocol,
+                                   OID_LENGTH(usmAESPrivProtocol), key, 16,
+                                   iv, 16, ct1, ctlen1, pt, &ptlen);
+        if (rc == SNMPERR_SUCCESS)
+            ok++;
+    }
+    netsnmp_get_monotonic_clock(&end);
+    usecs[k] = (end.tv_sec - start.tv_sec) * 1000000L +
+        (end.tv_usec - start.tv_usec);
+    OKF(ok == NMSGS, ("%d of %d messages processed %s", ok, NMSGS,
+                      k ? "with key caches" : "without key caches"));
+}
+printf("# authPriv (HMAC-SHA1, AES-128) messages/s: %.0f uncached, "
+       "%.0f cached\n", usecs[0] > 0 ? NMSGS * 1e6 / usecs[0] : 0.0,
+       usecs[1] > 0 ? NMSGS * 1e6 / usecs[1] : 0.0);
+sc_key_cache_free(&authCache);
+sc_key_cache_free(&privCache);
+
+snmp_shutdown("snmp");
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
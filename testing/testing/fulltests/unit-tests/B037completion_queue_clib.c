@@ -0,0 +1,278 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/library/large_fd_set.h>
+#include <net-snmp/library/snmpIPBaseDomain.h>
+#include <utilities/execute.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <errno.h>
+#ifdef HAVE_INTTYPES_H
+#include <inttypes.h>
+#endif
+#include <stdio.h>
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <sys/types.h>
+#ifdef HAVE_LIMITS_H
+#include <limits.h>
+#endif
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+#ifdef HAVE_ARPA_INET_H
+#include <arpa/inet.h>
+#endif
+#ifdef HAVE_NETINET_IP6_H
+#include <netinet/ip6.h>
+#endif
+#ifndef HAVE_INET_PTON
+#include "snmplib/inet_pton.h"
+#endif
+#ifndef HAVE_INET_NTOP
+#include "snmplib/inet_ntop.h"
+#endif
+
+#define ABS_SRCDIR "/root/repo"
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T037completion_queue_clib.c"
+/* HEADER Completion queues with many requests in flight */
+
+/*
+ * Sends GET requests on several single sessions to a plain UDP socket that
+ * stores them, then turns them into responses and sends them back in
+ * random order while taking the completions off the queue.
+ */
+#include <net-snmp/library/snmp_completion.h>
+
+#define NSESS 4
+#define NREQ  4000
+static oid sysUpTime[] = { 1, 3, 6, 1, 2, 1, 1, 3, 0 };
+netsnmp_completion_queue *cq;
+netsnmp_completion **comps, *c;
+netsnmp_session sess;
+struct session_list *slp[NSESS], *slow;
+netsnmp_pdu *pdu, *response;
+struct sockaddr_in sin, *from;
+socklen_t sinlen = sizeof(sin), fromlen;
+struct timeval tv, start, end;
+u_char (*pkts)[64];
+int *lens, *order, *seen;
+char peer[64];
+unsigned int seed = 1;
+int s, i, j, k, ok, sent, stored, tmp, got, dup, bad;
+long usecs;
+
+init_snmp("snmp");
+
+s = socket(AF_INET, SOCK_DGRAM, 0);
+memset(&sin, 0, sizeof(sin));
+sin.sin_family = AF_INET;
+sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+/* Do not wait forever for requests that got lost. */
+tv.tv_sec = 5;
+tv.tv_usec = 0;
+setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+OK(s >= 0 && bind(s, (struct sockaddr *)&sin, sizeof(sin)) == 0 &&
+   getsockname(s, (struct sockaddr *)&sin, &sinlen) == 0,
+   "agent socket");
+
+snmp_sess_init(&sess);
+snprintf(peer, sizeof(peer), "udp:127.0.0.1:%d", ntohs(sin.sin_port));
+sess.peername = peer;
+sess.version = SNMP_VERSION_2c;
+sess.community = (u_char *) "public";
+sess.community_len = 6;
+sess.retries = 0;
+sess.timeout = 600 * 1000000L;
+for (i = ok = 0; i < NSESS; i++)
+    if ((slp[i] = snmp_sess_open(&sess)) != NULL)
+        ok++;
+OKF(ok == NSESS, ("%d client sessions", ok));
+
+cq = netsnmp_completion_queue_create();
+OK(cq != NULL, "completion queue");
+timerclear(&tv);
+OK(netsnmp_completion_queue_next(cq, &tv) == NULL,
+   "nothing to take from an empty queue");
+
+comps = calloc(NREQ, sizeof(*comps));
+pkts = malloc(NREQ * sizeof(*pkts));
+lens = malloc(NREQ * sizeof(*lens));
+order = malloc(NREQ * sizeof(*order));
+seen = calloc(NREQ, sizeof(*seen));
+from = malloc(NREQ * sizeof(*from));
+
+/* Submit the requests round robin, storing them as they arrive. */
+for (sent = stored = 0; ok == NSESS && sent < NREQ; ) {
+    pdu = snmp_pdu_create(SNMP_MSG_GET);
+    snmp_add_null_var(pdu, sysUpTime, OID_LENGTH(sysUpTime));
+    comps[sent] = netsnmp_completion_submit(cq, slp[sent % NSESS], pdu,
+                                            &seen[sent]);
+    if (comps[sent] == NULL)
+        break;
+    if (++sent % 64 && sent < NREQ)
+        continue;
+    while (stored < sent) {
+        fromlen = sizeof(from[stored]);
+        k = recvfrom(s, pkts[stored], sizeof(pkts[stored]),
+                     sent < NREQ ? MSG_DONTWAIT : 0,
+                     (struct sockaddr *)&from[stored], &fromlen);
+        if (k <= 0)
+            break;
+        lens[stored++] = k;
+    }
+}
+OKF(sent == NREQ && stored == NREQ,
+    ("%d requests submitted, %d received", sent, stored));
+OKF(netsnmp_completion_queue_pending(cq) == sent,
+    ("%d requests pending", netsnmp_completion_queue_pending(cq)));
+
+/* GetRequest-PDU to Response-PDU, right after the community. */
+for (i = 0; i < stored; i++) {
+    for (j = 0; j + 6 < lens[i]; j++)
+        if (memcmp(pkts[i] + j, "public", 6) == 0)
+            break;
+    pkts[i][j + 6] = SNMP_MSG_RESPONSE;
+    order[i] = i;
+}
+for (i = stored - 1; i > 0; i--) {
+    seed = seed * 1103515245 + 12345;
+    j = (seed >> 8) % (i + 1);
+    tmp = order[i];
+    order[i] = order[j];
+    order[j] = tmp;
+}
+
+got = dup = bad = 0;
+netsnmp_get_monotonic_clock(&start);
+for (i = 0; i <= stored; i++) {
+    if (i < stored) {
+        sendto(s, pkts[order[i]], lens[order[i]], 0,
+               (struct sockaddr *)&from[order[i]], sizeof(from[order[i]]));
+        if ((i + 1) % 64)
+            continue;
+        timerclear(&tv);
+    } else {
+        tv.tv_sec = 5;
+        tv.tv_usec = 0;
+    }
+    while ((c = netsnmp_completion_queue_next(cq, &tv)) != NULL) {
+        int *flag = (int *) netsnmp_completion_user_data(c);
+
+        response = netsnmp_completion_response(c);
+        if (netsnmp_completion_status(c) != STAT_SUCCESS || !response ||
+            !netsnmp_completion_done(c) ||
+            netsnmp_completion_session(c) != slp[(flag - seen) % NSESS])
+            bad++;
+        if ((*flag)++)
+            dup++;
+        got++;
+        if (response)
+            snmp_free_pdu(response);
+        comps[flag - seen] = NULL;
+        netsnmp_completion_free(c);
+    }
+}
+netsnmp_get_monotonic_clock(&end);
+usecs = (end.tv_sec - start.tv_sec) * 1000000L +
+    (end.tv_usec - start.tv_usec);
+OKF(got == stored && dup == 0 && bad == 0,
+    ("%d completions taken, %d twice, %d bad", got, dup, bad));
+OK(netsnmp_completion_queue_pending(cq) == 0, "nothing pending any more");
+printf("# %d in flight on %d sessions: %.0f responses/s\n", stored, NSESS,
+       usecs > 0 ? stored * 1e6 / usecs : 0.0);
+
+/* Waiting for one request takes it off the queue. */
+pdu = snmp_pdu_create(SNMP_MSG_GET);
+snmp_add_null_var(pdu, sysUpTime, OID_LENGTH(sysUpTime));
+c = ok == NSESS ? netsnmp_completion_submit(cq, slp[0], pdu, NULL) : NULL;
+fromlen = sizeof(from[0]);
+k = recvfrom(s, pkts[0], sizeof(pkts[0]), 0, (struct sockaddr *)&from[0],
+             &fromlen);
+for (j = 0; j + 6 < k; j++)
+    if (memcmp(pkts[0] + j, "public", 6) == 0)
+        break;
+if (k > 0) {
+    pkts[0][j + 6] = SNMP_MSG_RESPONSE;
+    sendto(s, pkts[0], k, 0, (struct sockaddr *)&from[0], fromlen);
+}
+tv.tv_sec = 5;
+tv.tv_usec = 0;
+OK(c && netsnmp_completion_wait(c, &tv) == 1 &&
+   netsnmp_completion_status(c) == STAT_SUCCESS,
+   "waiting for a single request");
+timerclear(&tv);
+OK(netsnmp_completion_queue_next(cq, &tv) == NULL,
+   "a completion waited for is not taken again");
+netsnmp_completion_free(c);
+
+/* Unanswered requests time out; abandoned ones are freed. */
+sess.timeout = 50000;
+slow = snmp_sess_open(&sess);
+for (i = 0; slow && i < 3; i++) {
+    pdu = snmp_pdu_create(SNMP_MSG_GET);
+    snmp_add_null_var(pdu, sysUpTime, OID_LENGTH(sysUpTime));
+    comps[i] = netsnmp_completion_submit(cq, slow, pdu, NULL);
+}
+netsnmp_completion_free(comps[2]);
+tv.tv_sec = 5;
+tv.tv_usec = 0;
+OK(slow && netsnmp_completion_queue_wait_all(cq, &tv) == 1,
+   "waiting for all requests");
+OK(comps[0] && netsnmp_completion_status(comps[0]) == STAT_TIMEOUT &&
+   netsnmp_completion_errno(comps[0]) == SNMPERR_TIMEOUT &&
+   netsnmp_completion_response(comps[0]) == NULL,
+   "request timed out");
+for (i = got = 0; i < 3; i++) {
+    timerclear(&tv);
+    if ((c = netsnmp_completion_queue_next(cq, &tv)) != NULL)
+        got++;
+}
+OKF(got == 2, ("%d timed out requests taken", got));
+netsnmp_completion_free(comps[0]);
+netsnmp_completion_free(comps[1]);
+
+/* Requests outlive the queue, and closing the session finishes them. */
+pdu = snmp_pdu_create(SNMP_MSG_GET);
+snmp_add_null_var(pdu, sysUpTime, OID_LENGTH(sysUpTime));
+c = slow ? netsnmp_completion_submit(cq, slow, pdu, NULL) : NULL;
+OK(c != NULL, "request pending while the queue is freed");
+netsnmp_completion_queue_free(cq);
+if (slow)
+    snmp_sess_close(slow);
+
+free(from);
+free(seen);
+free(order);
+free(lens);
+free(pkts);
+free(comps);
+for (i = 0; i < NSESS; i++)
+    if (slp[i])
+        snmp_sess_close(slp[i]);
+close(s);
+snmp_shutdown("snmp");
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
@@ -0,0 +1,114 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/agent/net-snmp-agent-includes.h>
+#include <agentx/protocol.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <stdio.h>
+#include <sys/types.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T039table_cursor_cagentlib.c"
+/* HEADER Testing table_cursor pages */
+
+/*
+ * The rows 0 .. NROWS - 1 are fetched in scrambled order; the pages must
+ * put them back in index order and never hold more than they may.
+ */
+#define NROWS 5000
+typedef struct { netsnmp_index idx; oid o; } row_t;
+static int live, added;
+static int fetch(netsnmp_table_cursor *cursor, netsnmp_table_cursor_page *page)
+{
+    int i;
+    for (i = 0; i < NROWS; i++) {
+        row_t *r = malloc(sizeof(*r));
+        r->o = (i * 7919) % NROWS;
+        r->idx.oids = &r->o;
+        r->idx.len = 1;
+        live++;
+        added++;
+        netsnmp_table_cursor_page_add(page, r);
+    }
+    return 0;
+}
+static void free_row(void *row, void *magic) { live--; free(row); }
+netsnmp_table_cursor *cursor;
+row_t *r;
+netsnmp_index key;
+oid o;
+int n, in_order, max_live;
+size_t bound;
+
+init_snmp("snmp");
+
+cursor = netsnmp_table_cursor_create(fetch, free_row, NULL);
+OK(cursor != NULL, "cursor created");
+cursor->page_rows = 16;
+cursor->max_page_rows = 256;
+cursor->max_pages = 2;
+bound = cursor->max_pages * cursor->max_page_rows;
+
+/* walk */
+key.oids = &o;
+key.len = 1;
+n = in_order = max_live = 0;
+for (r = netsnmp_table_cursor_find(cursor, NULL, 1); r;
+     r = netsnmp_table_cursor_find(cursor, &key, 1)) {
+    if (r->o == (oid) n)
+        in_order++;
+    n++;
+    o = r->o;
+    if (live > max_live)
+        max_live = live;
+}
+OKF(n == NROWS && in_order == NROWS, ("walked %d rows, %d in order", n,
+                                      in_order));
+OKF(cursor->fetches < 30, ("%lu fetches for the walk", cursor->fetches));
+OKF(max_live <= (int) bound, ("at most %d rows held", max_live));
+OKF(cursor->size == NROWS, ("table size %d", (int) cursor->size));
+
+/* a short walk from the start again only costs the first page */
+cursor->fetches = 0;
+added = 0;
+for (n = 0, r = netsnmp_table_cursor_find(cursor, NULL, 1); r && n < 16; n++) {
+    o = r->o;
+    r = netsnmp_table_cursor_find(cursor, &key, 1);
+}
+OKF(cursor->fetches == 1, ("%lu fetch for the first 16 rows",
+                           cursor->fetches));
+
+/* exact lookups */
+o = 1234;
+r = netsnmp_table_cursor_find(cursor, &key, 0);
+OK(r && r->o == 1234, "row 1234 found");
+o = NROWS + 5;
+OK(netsnmp_table_cursor_find(cursor, &key, 0) == NULL, "missing row not found");
+OK(netsnmp_table_cursor_find(cursor, &key, 1) == NULL, "nothing after the last row");
+
+netsnmp_table_cursor_free(cursor);
+OKF(live == 0, ("%d rows left after free", live));
+
+snmp_shutdown("snmp");
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
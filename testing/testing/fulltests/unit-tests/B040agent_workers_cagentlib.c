@@ -0,0 +1,223 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/agent/net-snmp-agent-includes.h>
+#include <agentx/protocol.h>
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <stdio.h>
+#include <sys/types.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T040agent_workers_cagentlib.c"
+/* HEADER Walking tables served from agent worker threads */
+
+/*
+ * Runs an agent in a child process with a sparse table and a scalar
+ * registered as thread-safe, and walks them with GETNEXT and GETBULK.
+ * The handlers run on worker threads, which are only compiled in with
+ * --enable-reentrant, and the table and instance helpers must still
+ * step over the empty column and the end of the table.
+ */
+#if defined(NETSNMP_REENTRANT) && defined(HAVE_PTHREAD_H)
+enum { COL2 = 2, COL3 = 3, COL4 = 4, NROWS = 4, NVB = 2 * NROWS + 1,
+       NBULK = 20 };
+
+static oid root[] = { 1, 3, 6, 1, 3, 340 };
+static oid table_oid[] = { 1, 3, 6, 1, 3, 340, 1 };
+static oid scalar_oid[] = { 1, 3, 6, 1, 3, 340, 2, 0 };
+netsnmp_table_data_set *tds;
+netsnmp_handler_registration *reg;
+netsnmp_table_row *row;
+netsnmp_session session, *ss;
+netsnmp_pdu *pdu, *response;
+netsnmp_variable_list *vb;
+oid name[MAX_OID_LEN], expected[NVB][MAX_OID_LEN];
+size_t name_len, expected_len[NVB];
+char port[64];
+static u_char community[] = "public";
+int32_t ival, scalar = 42;
+int i, j, k, n, ok, bulk_ok, status;
+pid_t pid;
+
+snprintf(port, sizeof(port), "udp:127.0.0.1:%d",
+         20000 + (int) (getpid() % 20000));
+
+/* The walk is expected to return the two filled columns, then the scalar. */
+for (i = 0, n = 0; i < 2; i++) {
+    for (j = 1; j <= NROWS; j++, n++) {
+        memcpy(expected[n], table_oid, sizeof(table_oid));
+        expected[n][OID_LENGTH(table_oid)] = 1;
+        expected[n][OID_LENGTH(table_oid) + 1] = i ? COL4 : COL2;
+        expected[n][OID_LENGTH(table_oid) + 2] = j;
+        expected_len[n] = OID_LENGTH(table_oid) + 3;
+    }
+}
+memcpy(expected[n], scalar_oid, sizeof(scalar_oid));
+expected_len[n] = OID_LENGTH(scalar_oid);
+
+fflush(stdout);
+pid = fork();
+if (pid == 0) {
+    netsnmp_ds_set_boolean(NETSNMP_DS_LIBRARY_ID,
+                           NETSNMP_DS_LIB_DONT_READ_CONFIGS, 1);
+    netsnmp_ds_set_string(NETSNMP_DS_APPLICATION_ID, NETSNMP_DS_AGENT_PORTS,
+                          port);
+    netsnmp_ds_set_int(NETSNMP_DS_APPLICATION_ID,
+                       NETSNMP_DS_AGENT_WORKER_THREADS, 2);
+    init_agent("snmpd");
+
+    tds = netsnmp_create_table_data_set("workers");
+    netsnmp_table_dataset_add_index(tds, ASN_INTEGER);
+    netsnmp_table_set_add_default_row(tds, COL2, ASN_INTEGER, FALSE, NULL, 0);
+    netsnmp_table_set_add_default_row(tds, COL3, ASN_INTEGER, FALSE, NULL, 0);
+    netsnmp_table_set_add_default_row(tds, COL4, ASN_OCTET_STR, FALSE,
+                                      NULL, 0);
+    reg = netsnmp_create_handler_registration("workers", NULL, table_oid,
+                                              OID_LENGTH(table_oid),
+                                              HANDLER_CAN_RONLY |
+                                              HANDLER_CAN_THREADSAFE);
+    netsnmp_register_table_data_set(reg, tds, NULL);
+    for (i = 1; i <= NROWS; i++) {
+        row = netsnmp_create_table_data_row();
+        netsnmp_table_row_add_index(row, ASN_INTEGER, &i, sizeof(i));
+        netsnmp_table_dataset_add_row(tds, row);
+        ival = 10 + i;
+        /* column 3 is left empty */
+        netsnmp_set_row_column(row, COL2, ASN_INTEGER, &ival, sizeof(ival));
+        netsnmp_set_row_column(row, COL4, ASN_OCTET_STR, "test", 4);
+    }
+
+    reg = netsnmp_create_handler_registration("workers-scalar", NULL,
+                                              scalar_oid,
+                                              OID_LENGTH(scalar_oid),
+                                              HANDLER_CAN_RONLY |
+                                              HANDLER_CAN_THREADSAFE);
+    netsnmp_register_watched_instance(reg,
+        netsnmp_create_watcher_info(&scalar, sizeof(scalar), ASN_INTEGER,
+                                    WATCHER_FIXED_SIZE));
+
+    netsnmp_config_remember(strdup("rocommunity public 127.0.0.1"));
+    init_snmp("snmpd");
+    if (init_master_agent() != 0)
+        _exit(1);
+    for (;;)
+        agent_check_and_process(1);
+}
+OK(pid > 0, "agent started");
+if (pid < 0)
+    return 1;
+
+netsnmp_ds_set_boolean(NETSNMP_DS_LIBRARY_ID,
+                       NETSNMP_DS_LIB_DONT_READ_CONFIGS, 1);
+init_snmp("snmpapp");
+snmp_sess_init(&session);
+session.peername = port;
+session.version = SNMP_VERSION_2c;
+session.community = community;
+session.community_len = strlen((char *) community);
+session.timeout = 200000;
+session.retries = 25;
+ss = snmp_open(&session);
+OK(ss != NULL, "session opened");
+
+/* GETNEXT walk */
+memcpy(name, root, sizeof(root));
+name_len = OID_LENGTH(root);
+for (n = 0, ok = 0; n <= NVB; n++) {
+    pdu = snmp_pdu_create(SNMP_MSG_GETNEXT);
+    snmp_add_null_var(pdu, name, name_len);
+    response = NULL;
+    status = snmp_synch_response(ss, pdu, &response);
+    if (status != STAT_SUCCESS || !response ||
+        response->errstat != SNMP_ERR_NOERROR) {
+        if (response)
+            snmp_free_pdu(response);
+        break;
+    }
+    vb = response->variables;
+    if (vb->type == SNMP_ENDOFMIBVIEW ||
+        snmp_oidtree_compare(root, OID_LENGTH(root), vb->name,
+                             vb->name_length) != 0) {
+        snmp_free_pdu(response);
+        break;
+    }
+    if (n < NVB && snmp_oid_compare(vb->name, vb->name_length, expected[n],
+                                    expected_len[n]) == 0)
+        ok++;
+    memcpy(name, vb->name, vb->name_length * sizeof(oid));
+    name_len = vb->name_length;
+    snmp_free_pdu(response);
+}
+OKF(n == NVB && ok == NVB, ("getnext walk returned %d of %d objects, "
+                            "%d as expected", n, NVB, ok));
+
+/* GETBULK, repeated since workers may finish in any order */
+for (k = 0, bulk_ok = 0; k < NBULK; k++) {
+    pdu = snmp_pdu_create(SNMP_MSG_GETBULK);
+    pdu->non_repeaters = 0;
+    pdu->max_repetitions = NVB + 1;
+    snmp_add_null_var(pdu, root, OID_LENGTH(root));
+    response = NULL;
+    status = snmp_synch_response(ss, pdu, &response);
+    n = ok = 0;
+    if (status == STAT_SUCCESS && response &&
+        response->errstat == SNMP_ERR_NOERROR) {
+        for (vb = response->variables; vb && n < NVB;
+             vb = vb->next_variable, n++) {
+            if (snmp_oid_compare(vb->name, vb->name_length, expected[n],
+                                 expected_len[n]) == 0)
+                ok++;
+        }
+        if (vb && vb->type != SNMP_ENDOFMIBVIEW &&
+            snmp_oidtree_compare(root, OID_LENGTH(root), vb->name,
+                                 vb->name_length) == 0)
+            n++;
+    }
+    if (response)
+        snmp_free_pdu(response);
+    if (n == NVB && ok == NVB)
+        bulk_ok++;
+}
+OKF(bulk_ok == NBULK, ("%d of %d getbulk requests returned the expected "
+                       "objects", bulk_ok, NBULK));
+
+/* GET of the scalar */
+pdu = snmp_pdu_create(SNMP_MSG_GET);
+snmp_add_null_var(pdu, scalar_oid, OID_LENGTH(scalar_oid));
+response = NULL;
+status = snmp_synch_response(ss, pdu, &response);
+OK(status == STAT_SUCCESS && response && response->variables &&
+   response->variables->type == ASN_INTEGER &&
+   *response->variables->val.integer == 42, "get of the scalar");
+if (response)
+    snmp_free_pdu(response);
+
+snmp_close(ss);
+kill(pid, SIGTERM);
+snmp_shutdown("snmpapp");
+#else
+printf("1..0 # SKIP agent worker threads need --enable-reentrant\n");
+__did_plan = 1;
+#endif
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+
@@ -0,0 +1,157 @@
+/* net-snmp standard headers */
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+#include <net-snmp/agent/net-snmp-agent-includes.h>
+
+/* snmptrapd headers */
+#include "snmptrapd_handlers.h"
+#include "snmptrapd_auth.h"
+
+/* testing specific header */
+#include <net-snmp/library/testing.h>
+
+/* standard headers */
+#include <stdio.h>
+#include <sys/types.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#if HAVE_STRING_H
+#include <string.h>
+#else
+#include <strings.h>
+#endif
+
+int
+main(int argc, char *argv[]) {
+
+#line 1 "/root/repo/testing/fulltests/unit-tests/T045traphandle_lookup_ctrapdlib.c"
+/* HEADER snmptrapd handler lookup with many traphandle rules */
+
+/*
+ * Registers NRULES trap-specific handlers at random OIDs below a few
+ * enterprises, as exact, subtree and strict subtree rules, then replays a
+ * stream of NTRAPS random trap OIDs below the same enterprises through
+ * netsnmp_get_traphandler().  Each trap must find the handler the
+ * descending walk of netsnmp_specific_traphandlers that it replaced
+ * finds, and both are timed.  The flags are set after registering, as
+ * parse_traphandle() does.
+ */
+#define NENTERPRISES 50
+#define NSUBIDS      8
+#define NTRAPS       20000
+static const int nrules[] = { 1000, 5000 };
+extern netsnmp_trapd_handler *netsnmp_default_traphandlers;
+extern netsnmp_trapd_handler *netsnmp_specific_traphandlers;
+void snmptrapd_free_traphandle(void);
+oid rule[MAX_OID_LEN], (*traps)[MAX_OID_LEN];
+int *traps_len;
+netsnmp_trapd_handler *traph, **found;
+struct timeval start, end;
+unsigned int seed = 1;
+int round, rules, i, j, len, same, matched;
+double usecs[2];
+
+init_snmp("snmptrapd");
+netsnmp_add_default_traphandler(print_handler);
+
+traps = malloc(NTRAPS * sizeof(*traps));
+traps_len = malloc(NTRAPS * sizeof(*traps_len));
+found = malloc(NTRAPS * sizeof(*found));
+for (i = 0; i < NTRAPS; i++) {
+    /* enterprises.<enterprise> and one to four more sub-identifiers */
+    seed = seed * 1103515245 + 12345;
+    len = 8 + (seed >> 8) % 4;
+    traps[i][0] = 1; traps[i][1] = 3; traps[i][2] = 6;
+    traps[i][3] = 1; traps[i][4] = 4; traps[i][5] = 1;
+    traps[i][6] = (seed >> 16) % NENTERPRISES;
+    for (j = 7; j < len; j++) {
+        seed = seed * 1103515245 + 12345;
+        traps[i][j] = (seed >> 8) % NSUBIDS;
+    }
+    traps_len[i] = len;
+}
+
+rule[0] = 1; rule[1] = 3; rule[2] = 6; rule[3] = 1; rule[4] = 4; rule[5] = 1;
+for (round = 0, rules = 0; round < (int)(sizeof(nrules) / sizeof(nrules[0]));
+     round++) {
+    for (; rules < nrules[round]; rules++) {
+        seed = seed * 1103515245 + 12345;
+        len = 7 + (seed >> 8) % 3;
+        rule[6] = (seed >> 16) % NENTERPRISES;
+        for (j = 7; j < len; j++) {
+            seed = seed * 1103515245 + 12345;
+            rule[j] = (seed >> 8) % NSUBIDS;
+        }
+        traph = netsnmp_add_traphandler(print_handler, rule, len);
+        if (traph == NULL)
+            break;
+        seed = seed * 1103515245 + 12345;
+        switch ((seed >> 8) % 3) {
+        case 1:
+            traph->flags = NETSNMP_TRAPHANDLER_FLAG_MATCH_TREE;
+            break;
+        case 2:
+            traph->flags = NETSNMP_TRAPHANDLER_FLAG_MATCH_TREE |
+                NETSNMP_TRAPHANDLER_FLAG_STRICT_SUBTREE;
+            break;
+        }
+    }
+    OKF(rules == nrules[round], ("%d traphandle rules registered", rules));
+
+    netsnmp_get_monotonic_clock(&start);
+    for (i = 0; i < NTRAPS; i++)
+        found[i] = netsnmp_get_traphandler(traps[i], traps_len[i]);
+    netsnmp_get_monotonic_clock(&end);
+    usecs[0] = (end.tv_sec - start.tv_sec) * 1e6 +
+        (end.tv_usec - start.tv_usec);
+
+    /* the list is sorted in descending order, so the longest match wins */
+    netsnmp_get_monotonic_clock(&start);
+    for (i = same = matched = 0; i < NTRAPS; i++) {
+        for (traph = netsnmp_specific_traphandlers; traph;
+             traph = traph->nextt) {
+            if (!(traph->flags & NETSNMP_TRAPHANDLER_FLAG_MATCH_TREE)) {
+                if (snmp_oid_compare(traph->trapoid, traph->trapoid_len,
+                                     traps[i], traps_len[i]) == 0)
+                    break;
+            } else if (snmp_oidsubtree_compare(traph->trapoid,
+                                               traph->trapoid_len,
+                                               traps[i],
+                                               traps_len[i]) == 0) {
+                if (!(traph->flags & NETSNMP_TRAPHANDLER_FLAG_STRICT_SUBTREE)
+                    || snmp_oid_compare(traph->trapoid, traph->trapoid_len,
+                                        traps[i], traps_len[i]) != 0)
+                    break;
+            }
+        }
+        if (found[i] == (traph ? traph : netsnmp_default_traphandlers))
+            same++;
+        if (traph)
+            matched++;
+    }
+    netsnmp_get_monotonic_clock(&end);
+    usecs[1] = (end.tv_sec - start.tv_sec) * 1e6 +
+        (end.tv_usec - start.tv_usec);
+
+    OKF(same == NTRAPS, ("%d rules: %d of %d traps found the handler the "
+                         "list walk finds", rules, same, NTRAPS));
+    printf("# %d rules, %d traps matched one: %.0f lookups/s, %.0f with "
+           "the list walk\n", rules, matched,
+           usecs[0] > 0 ? NTRAPS * 1e6 / usecs[0] : 0.0,
+           usecs[1] > 0 ? NTRAPS * 1e6 / usecs[1] : 0.0);
+}
+
+snmptrapd_free_traphandle();
+free(found);
+free(traps_len);
+free(traps);
+snmp_shutdown("snmptrapd");
+
+   if (__did_plan == 0) {
+       PLAN(__test_counter);
+   }
+
+   return(0);
+}
+